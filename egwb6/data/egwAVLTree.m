@@ -26,15 +26,33 @@
 
 #import <string.h>
 #import "egwAVLTree.h"
+#import "egwNodePool.h"
 #import "../data/egwCyclicArray.h"
 #import "../math/egwMath.h"
 
-static void egwAVLTreeCopyRecurse(egwAVLTree* tree_inout, EGWmallocfp mallocFunc, EGWelementfp addFunc, egwAVLTreeNode* nodeSrc_inout, egwAVLTreeNode* nodeDst_inout) {
+static egwAVLTreeNode* egwAVLTreeAllocNode(egwAVLTree* tree_inout) {
+    if(tree_inout->nPool.nSize)
+        return (egwAVLTreeNode*)egwNodePoolAlloc(&tree_inout->nPool);
+    else if(tree_inout->dFuncs && tree_inout->dFuncs->fpMalloc)
+        return (egwAVLTreeNode*)tree_inout->dFuncs->fpMalloc(((size_t)tree_inout->eSize + sizeof(egwAVLTreeNode)));
+    return (egwAVLTreeNode*)malloc(((size_t)tree_inout->eSize + sizeof(egwAVLTreeNode)));
+}
+
+static void egwAVLTreeFreeNode(egwAVLTree* tree_inout, egwAVLTreeNode* node_inout) {
+    if(tree_inout->nPool.nSize)
+        egwNodePoolDealloc(&tree_inout->nPool, (EGWbyte*)node_inout);
+    else if(tree_inout->dFuncs && tree_inout->dFuncs->fpFree)
+        tree_inout->dFuncs->fpFree((void*)node_inout);
+    else
+        free((void*)node_inout);
+}
+
+static void egwAVLTreeCopyRecurse(egwAVLTree* tree_inout, EGWelementfp addFunc, egwAVLTreeNode* nodeSrc_inout, egwAVLTreeNode* nodeDst_inout) {
     if(tree_inout->tRoot && nodeSrc_inout->left) {
         egwAVLTreeNode* newNode = NULL;
         EGWuintptr data = 0;
         
-        if(!(newNode = (egwAVLTreeNode*)mallocFunc(((size_t)tree_inout->eSize + (size_t)sizeof(egwAVLTreeNode))))) { egwAVLTreeFree(tree_inout); return; }
+        if(!(newNode = egwAVLTreeAllocNode(tree_inout))) { egwAVLTreeFree(tree_inout); return; }
         memset((void*)newNode, 0, ((size_t)tree_inout->eSize + (size_t)sizeof(egwAVLTreeNode)));
         
         ++tree_inout->eCount;
@@ -52,14 +70,14 @@ static void egwAVLTreeCopyRecurse(egwAVLTree* tree_inout, EGWmallocfp mallocFunc
         if(addFunc)
             addFunc((EGWbyte*)data);
         
-        egwAVLTreeCopyRecurse(tree_inout, mallocFunc, addFunc, nodeSrc_inout->left, nodeDst_inout->left);
+        egwAVLTreeCopyRecurse(tree_inout, addFunc, nodeSrc_inout->left, nodeDst_inout->left);
     }
     
     if(tree_inout->tRoot && nodeSrc_inout->right) {
         egwAVLTreeNode* newNode = NULL;
         EGWuintptr data = 0;
         
-        if(!(newNode = (egwAVLTreeNode*)mallocFunc(((size_t)tree_inout->eSize + (size_t)sizeof(egwAVLTreeNode))))) { egwAVLTreeFree(tree_inout); return; }
+        if(!(newNode = egwAVLTreeAllocNode(tree_inout))) { egwAVLTreeFree(tree_inout); return; }
         memset((void*)newNode, 0, ((size_t)tree_inout->eSize + (size_t)sizeof(egwAVLTreeNode)));
         
         ++tree_inout->eCount;
@@ -77,14 +95,14 @@ static void egwAVLTreeCopyRecurse(egwAVLTree* tree_inout, EGWmallocfp mallocFunc
         if(addFunc)
             addFunc((EGWbyte*)data);
         
-        egwAVLTreeCopyRecurse(tree_inout, mallocFunc, addFunc, nodeSrc_inout->right, nodeDst_inout->right);
+        egwAVLTreeCopyRecurse(tree_inout, addFunc, nodeSrc_inout->right, nodeDst_inout->right);
     }
 }
 
-static void egwAVLTreeFreeRecurse(egwAVLTree* tree_inout, EGWfreefp freeFunc, egwAVLTreeNode* node_inout) {
+static void egwAVLTreeFreeRecurse(egwAVLTree* tree_inout, egwAVLTreeNode* node_inout) {
     if(node_inout) {
-        egwAVLTreeFreeRecurse(tree_inout, freeFunc, node_inout->left);
-        egwAVLTreeFreeRecurse(tree_inout, freeFunc, node_inout->right);
+        egwAVLTreeFreeRecurse(tree_inout, node_inout->left);
+        egwAVLTreeFreeRecurse(tree_inout, node_inout->right);
         
         if(tree_inout->dFuncs && tree_inout->dFuncs->fpRemove)
             tree_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)node_inout + (EGWuintptr)sizeof(egwAVLTreeNode)));
@@ -93,7 +111,7 @@ static void egwAVLTreeFreeRecurse(egwAVLTree* tree_inout, EGWfreefp freeFunc, eg
         if(tree_inout->tFlags & EGW_TREE_FLG_FREE)
             free((void*)*(void**)((EGWuintptr)node_inout + (EGWuintptr)sizeof(egwAVLTreeNode)));
         
-        freeFunc(node_inout);
+        egwAVLTreeFreeNode(tree_inout, node_inout);
     }
 }
 
@@ -248,7 +266,7 @@ static void egwAVLTreeRotateLeft(egwAVLTree* tree_inout, egwAVLTreeNode* node_in
     
     if(rightNode) {
         {   register egwAVLTreeNode* parentNode = node_inout->parent;
-            
+        
             if(parentNode) {
                 if(node_inout == parentNode->left)
                     parentNode->left = rightNode;
@@ -272,7 +290,7 @@ static void egwAVLTreeRotateRight(egwAVLTree* tree_inout, egwAVLTreeNode* node_i
     
     if(leftNode) {
         {   register egwAVLTreeNode* parentNode = node_inout->parent;
-            
+        
             if(parentNode) {
                 if(node_inout == parentNode->left)
                     parentNode->left = leftNode;
@@ -360,6 +378,10 @@ egwAVLTree* egwAVLTreeInit(egwAVLTree* tree_out, egwDataFuncs* funcs_in, EGWuint
         memcpy((void*)tree_out->dFuncs, (const void*)funcs_in, sizeof(egwDataFuncs));
     }
     
+    if(!(tree_out->tFlags & EGW_TREE_FLG_NOPOOL) && !(tree_out->dFuncs && (tree_out->dFuncs->fpMalloc || tree_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&tree_out->nPool, (EGWuint)tree_out->eSize + (EGWuint)sizeof(egwAVLTreeNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwAVLTreeFree(tree_out); return NULL; }
+    }
+    
     return tree_out;
 }
 
@@ -374,14 +396,17 @@ egwAVLTree* egwAVLTreeCopy(const egwAVLTree* tree_in, egwAVLTree* tree_out) {
         memcpy((void*)tree_out->dFuncs, (const void*)tree_in->dFuncs, sizeof(egwDataFuncs));
     }
     
+    if(!(tree_out->tFlags & EGW_TREE_FLG_NOPOOL) && !(tree_out->dFuncs && (tree_out->dFuncs->fpMalloc || tree_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&tree_out->nPool, (EGWuint)tree_out->eSize + (EGWuint)sizeof(egwAVLTreeNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwAVLTreeFree(tree_out); return NULL; }
+    }
+    
     if(tree_in->eCount) {
         // Have to create the root node first before the recursive call to copy
-        EGWmallocfp mallocFunc = (tree_out->dFuncs && tree_out->dFuncs->fpMalloc ? (EGWmallocfp)tree_out->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
         EGWelementfp addFunc = (tree_out->dFuncs && tree_out->dFuncs->fpAdd ? (EGWelementfp)tree_out->dFuncs->fpAdd : (EGWelementfp)NULL);
         egwAVLTreeNode* newNode = NULL;
         EGWuintptr data = 0;
         
-        if(!(newNode = (egwAVLTreeNode*)mallocFunc(((size_t)tree_out->eSize + (size_t)sizeof(egwAVLTreeNode))))) { egwAVLTreeFree(tree_out); return NULL; }
+        if(!(newNode = egwAVLTreeAllocNode(tree_out))) { egwAVLTreeFree(tree_out); return NULL; }
         memset((void*)newNode, 0, ((size_t)tree_out->eSize + (size_t)sizeof(egwAVLTreeNode)));
         
         ++tree_out->eCount;
@@ -398,7 +423,7 @@ egwAVLTree* egwAVLTreeCopy(const egwAVLTree* tree_in, egwAVLTree* tree_out) {
         if(addFunc)
             addFunc((EGWbyte*)data);
         
-        egwAVLTreeCopyRecurse(tree_out, mallocFunc, addFunc, tree_in->tRoot, tree_out->tRoot);
+        egwAVLTreeCopyRecurse(tree_out, addFunc, tree_in->tRoot, tree_out->tRoot);
         
         if(!tree_out->tRoot)
             return NULL;
@@ -408,9 +433,9 @@ egwAVLTree* egwAVLTreeCopy(const egwAVLTree* tree_in, egwAVLTree* tree_out) {
 }
 
 egwAVLTree* egwAVLTreeFree(egwAVLTree* tree_inout) {
-    EGWfreefp freeFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpFree ? (EGWfreefp)tree_inout->dFuncs->fpFree : (EGWfreefp)&free);
+    egwAVLTreeFreeRecurse(tree_inout, tree_inout->tRoot);
     
-    egwAVLTreeFreeRecurse(tree_inout, freeFunc, tree_inout->tRoot);
+    egwNodePoolFree(&tree_inout->nPool);
     
     if(tree_inout->dFuncs)
         free((void*)(tree_inout->dFuncs));
@@ -424,10 +449,8 @@ EGWint egwAVLTreeAdd(egwAVLTree* tree_inout, const EGWbyte* data_in) {
     egwAVLTreeNode* newNode = NULL;
     EGWcomparefp compareFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpCompare ? (EGWcomparefp)tree_inout->dFuncs->fpCompare : (EGWcomparefp)&memcmp);
     
-    {   EGWmallocfp mallocFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpMalloc ? (EGWmallocfp)tree_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-        if(!(newNode = (egwAVLTreeNode*)mallocFunc(((size_t)tree_inout->eSize + (size_t)sizeof(egwAVLTreeNode))))) { return 0; }
-        memset((void*)newNode, 0, ((size_t)tree_inout->eSize + (size_t)sizeof(egwAVLTreeNode)));
-    }
+    if(!(newNode = egwAVLTreeAllocNode(tree_inout))) { return 0; }
+    memset((void*)newNode, 0, ((size_t)tree_inout->eSize + (size_t)sizeof(egwAVLTreeNode)));
     
     ++tree_inout->eCount;
     
@@ -505,9 +528,7 @@ EGWint egwAVLTreeRemove(egwAVLTree* tree_inout, egwAVLTreeNode* node_inout) {
         egwAVLTreeFixUp(tree_inout, parentNode);
     }
     
-    {   EGWfreefp freeFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpFree ? (EGWfreefp)(tree_inout->dFuncs->fpFree) : (EGWfreefp)&free);
-        freeFunc((void*)node_inout);
-    }
+    egwAVLTreeFreeNode(tree_inout, node_inout);
     
     --tree_inout->eCount;
     
@@ -527,9 +548,7 @@ EGWuint egwAVLTreeRemoveAny(egwAVLTree* tree_inout, const EGWbyte* data_in) {
 }
 
 EGWint egwAVLTreeRemoveAll(egwAVLTree* tree_inout) {
-    EGWfreefp freeFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpFree ? (EGWfreefp)(tree_inout->dFuncs->fpFree) : (EGWfreefp)&free);
-    
-    egwAVLTreeFreeRecurse(tree_inout, freeFunc, tree_inout->tRoot);
+    egwAVLTreeFreeRecurse(tree_inout, tree_inout->tRoot);
     
     tree_inout->eCount = 0;
     tree_inout->tRoot = NULL;
@@ -612,7 +631,7 @@ EGWint egwAVLTreeEnumerateStart(const egwAVLTree* tree_in, EGWuint iterMode_in,
                 while(iter_out->nPos->left)
                     iter_out->nPos = iter_out->nPos->left;
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTLRS: {
                 while(iter_out->nPos->left != iter_out->nPos->right) {
                     while(iter_out->nPos->left)
@@ -622,7 +641,7 @@ EGWint egwAVLTreeEnumerateStart(const egwAVLTree* tree_in, EGWuint iterMode_in,
                         iter_out->nPos = iter_out->nPos->right;
                 }
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTRLS: {
                 while(iter_out->nPos->right != iter_out->nPos->left) {
                     while(iter_out->nPos->right)
@@ -632,7 +651,7 @@ EGWint egwAVLTreeEnumerateStart(const egwAVLTree* tree_in, EGWuint iterMode_in,
                         iter_out->nPos = iter_out->nPos->left;
                 }
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTRSL: {
                 while(iter_out->nPos->right)
                     iter_out->nPos = iter_out->nPos->right;
@@ -695,7 +714,7 @@ EGWbyte* egwAVLTreeEnumerateNextPtr(egwAVLTreeIter* iter_inout) {
                 
                 ++iter_inout->eIndex;
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTLRS: {
                 node = iter_inout->nPos;
                 iter_inout->nPos = iter_inout->nPos->parent;
@@ -710,7 +729,7 @@ EGWbyte* egwAVLTreeEnumerateNextPtr(egwAVLTreeIter* iter_inout) {
                 
                 ++iter_inout->eIndex;
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTSLR: {
                 if(iter_inout->nPos->left)
                     iter_inout->nPos = iter_inout->nPos->left;
@@ -730,7 +749,7 @@ EGWbyte* egwAVLTreeEnumerateNextPtr(egwAVLTreeIter* iter_inout) {
                 
                 ++iter_inout->eIndex;
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTSRL: {
                 if(iter_inout->nPos->right)
                     iter_inout->nPos = iter_inout->nPos->right;
@@ -750,7 +769,7 @@ EGWbyte* egwAVLTreeEnumerateNextPtr(egwAVLTreeIter* iter_inout) {
                 
                 ++iter_inout->eIndex;
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTRLS: {
                 node = iter_inout->nPos;
                 iter_inout->nPos = iter_inout->nPos->parent;
@@ -765,7 +784,7 @@ EGWbyte* egwAVLTreeEnumerateNextPtr(egwAVLTreeIter* iter_inout) {
                 
                 ++iter_inout->eIndex;
             } break;
-                
+            
             case EGW_ITERATE_MODE_BSTRSL: {
                 if(iter_inout->nPos->left) {
                     iter_inout->nPos = iter_inout->nPos->left;
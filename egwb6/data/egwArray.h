@@ -244,7 +244,8 @@ EGWint egwArrayShrink(egwArray* array_inout);
 // !!!: ***** Sorting *****
 
 /// Array Sort Routine.
-/// Sorts the contents of the array using the quick sort algorithm at O(n log n) time cost.
+/// Sorts the contents of the array using the intro sort algorithm (median-of-three quick sort, falling back to heap sort upon excessive depth, with insertion sort on small ranges) at O(n log n) worst case time cost.
+/// @note Sort is not stable. Element sizes of 4, 8, and 16 bytes take specialized swap paths, and when no compare function is set, 4 and 8 byte elements are compared word-wise in memcmp() order.
 /// @param [in,out] array_inout Array input/output structure.
 /// @return 1 if sorting successful, otherwise 0 (if temporary storage did not allocate).
 EGWint egwArraySort(egwArray* array_inout);
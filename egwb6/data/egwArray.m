@@ -28,48 +28,189 @@
 #import "../math/egwMath.h"
 
 
-static void egwArraySortRecurse(egwArray* array_inout, EGWbyte* temp, EGWint low, EGWint high) {
-    if(high > low) {
-        EGWcomparefp compareFunc = (array_inout->dFuncs && array_inout->dFuncs->fpCompare ? (EGWcomparefp)(array_inout->dFuncs->fpCompare) : (EGWcomparefp)&memcmp);
-        EGWint pivot = (low + high) >> 1;
-        EGWint left = low;
-        EGWint right = high;
-        
-        while (left <= pivot && right >= pivot) {
-            while(left <= pivot && compareFunc((EGWbyte*)((EGWuintptr)array_inout->rData + ((EGWuintptr)left * (EGWuintptr)array_inout->eSize)),
-                                               (EGWbyte*)((EGWuintptr)array_inout->rData + ((EGWuintptr)pivot * (EGWuintptr)array_inout->eSize)), array_inout->eSize) < 0)
-                ++left;
-            
-            while(right >= pivot && compareFunc((EGWbyte*)((EGWuintptr)array_inout->rData + ((EGWuintptr)pivot * (EGWuintptr)array_inout->eSize)),
-                                                (EGWbyte*)((EGWuintptr)array_inout->rData + ((EGWuintptr)right * (EGWuintptr)array_inout->eSize)), array_inout->eSize) < 0)
-                --right;
+#define EGW_ARRAY_SORTCUTOFF    16  // Sub-range size at or below which insertion sort is used.
+
+// Sort context, resolves element size and comparator once per sort.
+typedef struct {
+    EGWbyte* data;
+    EGWuintptr eSize;
+    EGWcomparefp compare;                   // NULL for default byte-wise (memcmp) ordering.
+    EGWbyte* temp;
+} egwArraySortCtx;
+
+#define egwArraySortElm(ctx,i)  ((EGWbyte*)((EGWuintptr)((ctx)->data) + ((EGWuintptr)(i) * (ctx)->eSize)))
+
+static inline EGWuint32 egwArraySortLoadBE32(const EGWbyte* elm_in) {
+    return ((EGWuint32)elm_in[0] << 24) | ((EGWuint32)elm_in[1] << 16) | ((EGWuint32)elm_in[2] << 8) | (EGWuint32)elm_in[3];
+}
+
+static inline EGWint egwArraySortCompare(const egwArraySortCtx* ctx_in, const EGWbyte* elm1_in, const EGWbyte* elm2_in) {
+    if(ctx_in->compare)
+        return ctx_in->compare(elm1_in, elm2_in, (size_t)ctx_in->eSize);
+    
+    // NOTE: Byte-wise ordering is the same as unsigned big endian ordering, so small elements are compared by word rather than calling out to memcmp. -jw
+    switch(ctx_in->eSize) {
+        case 4: {
+            EGWuint32 val1 = egwArraySortLoadBE32(elm1_in), val2 = egwArraySortLoadBE32(elm2_in);
+            return (val1 < val2 ? -1 : (val1 > val2 ? 1 : 0));
+        } break;
+        
+        case 8: {
+            EGWuint64 val1 = ((EGWuint64)egwArraySortLoadBE32(elm1_in) << 32) | (EGWuint64)egwArraySortLoadBE32(elm1_in + 4);
+            EGWuint64 val2 = ((EGWuint64)egwArraySortLoadBE32(elm2_in) << 32) | (EGWuint64)egwArraySortLoadBE32(elm2_in + 4);
+            return (val1 < val2 ? -1 : (val1 > val2 ? 1 : 0));
+        } break;
+    }
+    
+    return (EGWint)memcmp((const void*)elm1_in, (const void*)elm2_in, (size_t)ctx_in->eSize);
+}
+
+static inline void egwArraySortCopy(const egwArraySortCtx* ctx_in, EGWbyte* dst_out, const EGWbyte* src_in) {
+    // NOTE: Fixed size copies are inlined into plain loads/stores by the compiler. -jw
+    switch(ctx_in->eSize) {
+        case 4: memcpy((void*)dst_out, (const void*)src_in, 4); break;
+        case 8: memcpy((void*)dst_out, (const void*)src_in, 8); break;
+        case 16: memcpy((void*)dst_out, (const void*)src_in, 16); break;
+        default: memcpy((void*)dst_out, (const void*)src_in, (size_t)ctx_in->eSize); break;
+    }
+}
+
+static inline void egwArraySortSwap(const egwArraySortCtx* ctx_in, EGWbyte* elm1_inout, EGWbyte* elm2_inout) {
+    switch(ctx_in->eSize) {
+        case 4: {
+            EGWuint32 temp; memcpy((void*)&temp, (const void*)elm1_inout, 4);
+            memcpy((void*)elm1_inout, (const void*)elm2_inout, 4); memcpy((void*)elm2_inout, (const void*)&temp, 4);
+        } break;
+        
+        case 8: {
+            EGWuint64 temp; memcpy((void*)&temp, (const void*)elm1_inout, 8);
+            memcpy((void*)elm1_inout, (const void*)elm2_inout, 8); memcpy((void*)elm2_inout, (const void*)&temp, 8);
+        } break;
+        
+        case 16: {
+            EGWuint64 temp[2]; memcpy((void*)temp, (const void*)elm1_inout, 16);
+            memcpy((void*)elm1_inout, (const void*)elm2_inout, 16); memcpy((void*)elm2_inout, (const void*)temp, 16);
+        } break;
+        
+        default: {
+            memcpy((void*)ctx_in->temp, (const void*)elm1_inout, (size_t)ctx_in->eSize);
+            memcpy((void*)elm1_inout, (const void*)elm2_inout, (size_t)ctx_in->eSize);
+            memcpy((void*)elm2_inout, (const void*)ctx_in->temp, (size_t)ctx_in->eSize);
+        } break;
+    }
+}
+
+static void egwArraySortInsertion(const egwArraySortCtx* ctx_in, EGWint low, EGWint high) {
+    EGWint index, slide;
+    
+    for(index = low + 1; index <= high; ++index) {
+        if(egwArraySortCompare(ctx_in, egwArraySortElm(ctx_in, index), egwArraySortElm(ctx_in, index - 1)) < 0) {
+            egwArraySortCopy(ctx_in, ctx_in->temp, egwArraySortElm(ctx_in, index));
+            slide = index;
             
-            memcpy((void*)temp, (void*)((EGWuintptr)array_inout->rData + ((EGWuintptr)left * (EGWuintptr)array_inout->eSize)), (size_t)array_inout->eSize);
-            memcpy((void*)((EGWuintptr)array_inout->rData + ((EGWuintptr)left * (EGWuintptr)array_inout->eSize)),
-                   (void*)((EGWuintptr)array_inout->rData + ((EGWuintptr)right * (EGWuintptr)array_inout->eSize)), (size_t)array_inout->eSize);
-            memcpy((void*)((EGWuintptr)array_inout->rData + ((EGWuintptr)right * (EGWuintptr)array_inout->eSize)), (void*)temp, (size_t)array_inout->eSize);
+            do {
+                egwArraySortCopy(ctx_in, egwArraySortElm(ctx_in, slide), egwArraySortElm(ctx_in, slide - 1));
+                --slide;
+            } while(slide > low && egwArraySortCompare(ctx_in, ctx_in->temp, egwArraySortElm(ctx_in, slide - 1)) < 0);
             
-            ++left; --right;
-            if(left - 1 == pivot)
-                pivot = ++right;
-            else if(right + 1 == pivot)
-                pivot = --left;
+            egwArraySortCopy(ctx_in, egwArraySortElm(ctx_in, slide), ctx_in->temp);
+        }
+    }
+}
+
+static void egwArraySortHeapSift(const egwArraySortCtx* ctx_in, EGWint low, EGWint root, EGWint count) {
+    EGWint child;
+    
+    while((child = (root << 1) + 1) < count) {
+        if(child + 1 < count && egwArraySortCompare(ctx_in, egwArraySortElm(ctx_in, low + child), egwArraySortElm(ctx_in, low + child + 1)) < 0)
+            ++child;
+        
+        if(egwArraySortCompare(ctx_in, egwArraySortElm(ctx_in, low + root), egwArraySortElm(ctx_in, low + child)) >= 0)
+            break;
+        
+        egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, low + root), egwArraySortElm(ctx_in, low + child));
+        root = child;
+    }
+}
+
+static void egwArraySortHeap(const egwArraySortCtx* ctx_in, EGWint low, EGWint high) {
+    EGWint count = high - low + 1;
+    EGWint index;
+    
+    for(index = (count >> 1) - 1; index >= 0; --index)
+        egwArraySortHeapSift(ctx_in, low, index, count);
+    
+    for(index = count - 1; index > 0; --index) {
+        egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, low), egwArraySortElm(ctx_in, low + index));
+        egwArraySortHeapSift(ctx_in, low, 0, index);
+    }
+}
+
+static EGWint egwArraySortPartition(const egwArraySortCtx* ctx_in, EGWint low, EGWint high) {
+    EGWint mid = low + ((high - low) >> 1);
+    EGWint left = low, right = high - 1;
+    EGWbyte* pivot;
+    
+    // Median of three, leaves low <= mid <= high which act as sentinels for the scans below
+    if(egwArraySortCompare(ctx_in, egwArraySortElm(ctx_in, mid), egwArraySortElm(ctx_in, low)) < 0)
+        egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, mid), egwArraySortElm(ctx_in, low));
+    if(egwArraySortCompare(ctx_in, egwArraySortElm(ctx_in, high), egwArraySortElm(ctx_in, low)) < 0)
+        egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, high), egwArraySortElm(ctx_in, low));
+    if(egwArraySortCompare(ctx_in, egwArraySortElm(ctx_in, high), egwArraySortElm(ctx_in, mid)) < 0)
+        egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, high), egwArraySortElm(ctx_in, mid));
+    
+    pivot = egwArraySortElm(ctx_in, high - 1);
+    egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, mid), pivot);
+    
+    // NOTE: Both scans stop on elements equal to the pivot, which keeps partitions balanced on inputs with many duplicates. -jw
+    while(1) {
+        while(egwArraySortCompare(ctx_in, egwArraySortElm(ctx_in, ++left), pivot) < 0);
+        while(egwArraySortCompare(ctx_in, pivot, egwArraySortElm(ctx_in, --right)) < 0);
+        
+        if(left >= right)
+            break;
+        
+        egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, left), egwArraySortElm(ctx_in, right));
+    }
+    
+    egwArraySortSwap(ctx_in, egwArraySortElm(ctx_in, left), pivot);
+    
+    return left;
+}
+
+static void egwArraySortIntro(const egwArraySortCtx* ctx_in, EGWint low, EGWint high, EGWuint depth) {
+    EGWint pivot;
+    
+    while(high - low + 1 > EGW_ARRAY_SORTCUTOFF) {
+        if(depth-- == 0) { // Partitioning is degrading, fall back to guaranteed O(n log n)
+            egwArraySortHeap(ctx_in, low, high);
+            return;
         }
         
-        egwArraySortRecurse(array_inout, temp, low, pivot-1);
-        egwArraySortRecurse(array_inout, temp, pivot+1, high);
+        pivot = egwArraySortPartition(ctx_in, low, high);
+        
+        // Recurse on smaller side and loop on larger, bounds stack depth to O(log n)
+        if(pivot - low < high - pivot) {
+            egwArraySortIntro(ctx_in, low, pivot - 1, depth);
+            low = pivot + 1;
+        } else {
+            egwArraySortIntro(ctx_in, pivot + 1, high, depth);
+            high = pivot - 1;
+        }
     }
+    
+    egwArraySortInsertion(ctx_in, low, high);
 }
 
 egwArray* egwArrayInit(egwArray* array_out, egwDataFuncs* funcs_in, EGWuint elmSize_in, EGWuint intCap_in, EGWuint flags_in) {
     memset((void*)array_out, 0, sizeof(egwArray));
     
-    intCap_in = (EGWuint)egwMax2i(1, (EGWint)(EGWuint16)intCap_in);
-    elmSize_in = (EGWuint)egwMax2i(1, (EGWint)(EGWuint16)elmSize_in);
+    intCap_in = egwMax2ui(1, intCap_in);
+    elmSize_in = egwMax2ui(1, elmSize_in);
     
     array_out->aFlags = (EGWuint32)flags_in;
-    array_out->eSize = (EGWuint16)elmSize_in;
-    array_out->eMinCount = array_out->eMaxCount = (EGWuint16)intCap_in;
+    array_out->eSize = (EGWuint32)elmSize_in;
+    array_out->eMinCount = array_out->eMaxCount = (EGWuint32)intCap_in;
     
     if(funcs_in) {
         if(!(array_out->dFuncs = (egwDataFuncs*)malloc(sizeof(egwDataFuncs)))) { egwArrayFree(array_out); return NULL; }
@@ -93,7 +234,7 @@ egwArray* egwArrayCopy(const egwArray* array_in, egwArray* array_out) {
     array_out->eSize = array_in->eSize;
     array_out->eCount = array_in->eCount;
     array_out->eMinCount = array_in->eMinCount;
-    array_out->eMaxCount = (EGWuint16)egwMax2i(egwMax2i(1, (EGWint)array_in->eMaxCount), (EGWint)array_in->eCount);
+    array_out->eMaxCount = (EGWuint32)egwMax2ui(egwMax2ui(1, (EGWuint)array_in->eMaxCount), (EGWuint)array_in->eCount);
     
     if(array_in->dFuncs) {
         if(!(array_out->dFuncs = (egwDataFuncs*)malloc(sizeof(egwDataFuncs)))) { egwArrayFree(array_out); return NULL; }
@@ -109,11 +250,11 @@ egwArray* egwArrayCopy(const egwArray* array_in, egwArray* array_out) {
            (size_t)(array_in->eSize) * (size_t)(array_in->eCount));
     
     if(array_out->aFlags & EGW_ARRAY_FLG_RETAIN) {
-        EGWuint16 index = array_out->eCount; while(index--)
+        EGWuint32 index = array_out->eCount; while(index--)
             [(id<NSObject>)*(void**)((EGWuintptr)(array_out->rData) + ((EGWuintptr)index * (EGWuintptr)(array_out->eSize))) retain];
     }
     if(array_out->dFuncs && array_out->dFuncs->fpAdd) {
-        EGWuint16 index = array_out->eCount; while(index--)
+        EGWuint32 index = array_out->eCount; while(index--)
             array_out->dFuncs->fpAdd((EGWbyte*)((EGWuintptr)(array_out->rData) + ((EGWuintptr)index * (EGWuintptr)(array_out->eSize))));
     }
     
@@ -123,15 +264,15 @@ egwArray* egwArrayCopy(const egwArray* array_in, egwArray* array_out) {
 egwArray* egwArrayFree(egwArray* array_inout) {
     if(array_inout->rData) {
         if(array_inout->dFuncs && array_inout->dFuncs->fpRemove) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 array_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))));
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_RETAIN) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 [(id<NSObject>)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))) release];
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_FREE) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 free((void*)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))));
         }
         
@@ -224,25 +365,25 @@ EGWint egwArrayRemoveTail(egwArray* array_inout) {
 EGWint egwArrayRemoveAll(egwArray* array_inout) {
     if(array_inout->eCount) {
         if(array_inout->dFuncs && array_inout->dFuncs->fpRemove) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 array_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))));
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_RETAIN) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 [(id<NSObject>)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))) release];
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_FREE) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 free((void*)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))));
         }
         
         if((array_inout->aFlags & EGW_ARRAY_FLG_EXSHRNKCND) && (array_inout->aFlags & EGW_ARRAY_FLG_EXSHRNKBY)) {
             while((array_inout->eCount)--)
                 if(egwArrayShrinkChk(array_inout)) {
-                    EGWuint16 count = array_inout->eCount;
+                    EGWuint32 count = array_inout->eCount;
                     array_inout->eCount = 0;
                     egwArrayShrink(array_inout);
-                    array_inout->eCount = (EGWuint16)egwMin2i((EGWint)count, (EGWint)(array_inout->eMaxCount));
+                    array_inout->eCount = (EGWuint32)egwMin2ui((EGWuint)count, (EGWuint)(array_inout->eMaxCount));
                 }
         }
         
@@ -333,7 +474,7 @@ EGWint egwArrayFind(const egwArray* array_in, const EGWbyte* data_in, EGWuint fi
                 }
             }
         } break;
-            
+        
         case EGW_FIND_MODE_LINTTH: {
             register EGWbyte* node = (EGWbyte*)((EGWuintptr)array_in->rData + ((EGWuintptr)(array_in->eCount - 1) * (EGWuintptr)array_in->eSize));
             
@@ -457,7 +598,7 @@ EGWuint egwArrayOccurances(const egwArray* array_in, const EGWbyte* data_in, EGW
 }
 
 EGWint egwArrayResize(egwArray* array_inout, EGWuint newCap_in) {
-    newCap_in = egwMax2ui(1, egwMin2ui(newCap_in, EGW_UINT16_MAX));
+    newCap_in = egwMax2ui(1, egwMin2ui(newCap_in, EGW_UINT32_MAX));
     if(array_inout->aFlags & EGW_ARRAY_FLG_USEMIN)
         newCap_in = egwMax2ui(array_inout->eMinCount, newCap_in);
     
@@ -471,15 +612,15 @@ EGWint egwArrayResize(egwArray* array_inout, EGWuint newCap_in) {
             
             if(array_inout->eCount > newCap_in) {
                 if(array_inout->dFuncs && array_inout->dFuncs->fpRemove) {
-                    EGWuint16 index = array_inout->eCount; while(index-- > (EGWuint16)newCap_in)
+                    EGWuint32 index = array_inout->eCount; while(index-- > (EGWuint32)newCap_in)
                         array_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))));
                 }
                 if(array_inout->aFlags & EGW_ARRAY_FLG_RETAIN) {
-                    EGWuint16 index = array_inout->eCount; while(index-- > (EGWuint16)newCap_in)
+                    EGWuint32 index = array_inout->eCount; while(index-- > (EGWuint32)newCap_in)
                         [(id<NSObject>)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))) release];
                 }
                 if(array_inout->aFlags & EGW_ARRAY_FLG_FREE) {
-                    EGWuint16 index = array_inout->eCount; while(index-- > (EGWuint16)newCap_in)
+                    EGWuint32 index = array_inout->eCount; while(index-- > (EGWuint32)newCap_in)
                         free((void*)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)index * (EGWuintptr)(array_inout->eSize))));
                 }
                 
@@ -508,7 +649,7 @@ EGWint egwArrayResize(egwArray* array_inout, EGWuint newCap_in) {
             }
         }
         
-        array_inout->eMaxCount = (EGWuint16)newCap_in;
+        array_inout->eMaxCount = (EGWuint32)newCap_in;
     }
     
     return 1;
@@ -520,22 +661,22 @@ EGWint egwArrayGrowChk(const egwArray* array_in) {
             if(array_in->eCount >= array_in->eMaxCount)
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_GRWCND90: {
-            if(array_in->eCount >= ((array_in->eMaxCount * 9) / 10))
+            if(array_in->eCount >= (EGWuint32)(((EGWuint64)array_in->eMaxCount * 9) / 10))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_GRWCND75: {
-            if(array_in->eCount >= ((array_in->eMaxCount * 3) >> 2))
+            if(array_in->eCount >= (EGWuint32)(((EGWuint64)array_in->eMaxCount * 3) >> 2))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_GRWCND66: {
-            if(array_in->eCount >= ((array_in->eMaxCount << 1) / 3))
+            if(array_in->eCount >= (EGWuint32)(((EGWuint64)array_in->eMaxCount << 1) / 3))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_GRWCND50: {
             if(array_in->eCount >= (array_in->eMaxCount >> 1))
                 return 1;
@@ -551,22 +692,22 @@ EGWint egwArrayShrinkChk(const egwArray* array_in) {
             if(array_in->eCount <= 0)
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND10: {
             if(array_in->eCount <= (array_in->eMaxCount / 10))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND25: {
             if(array_in->eCount <= (array_in->eMaxCount >> 2))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND33: {
             if(array_in->eCount <= (array_in->eMaxCount / 3))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND50: {
             if(array_in->eCount <= (array_in->eMaxCount >> 1))
                 return 1;
@@ -579,23 +720,23 @@ EGWint egwArrayShrinkChk(const egwArray* array_in) {
 EGWint egwArrayGrow(egwArray* array_inout) {
     switch(array_inout->aFlags & EGW_ARRAY_FLG_EXGROWBY) {
         case EGW_ARRAY_FLG_GROWBY2X: {
-            return egwArrayResize(array_inout, array_inout->eMaxCount * 2);
+            return egwArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount * 2, (EGWuint64)EGW_UINT32_MAX));
         } break;
         
         case EGW_ARRAY_FLG_GROWBY3X: {
-            return egwArrayResize(array_inout, array_inout->eMaxCount * 3);
+            return egwArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount * 3, (EGWuint64)EGW_UINT32_MAX));
         } break;
         
         case EGW_ARRAY_FLG_GROWBY10: {
-            return egwArrayResize(array_inout, array_inout->eMaxCount + 10);
+            return egwArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount + 10, (EGWuint64)EGW_UINT32_MAX));
         } break;
         
         case EGW_ARRAY_FLG_GROWBY25: {
-            return egwArrayResize(array_inout, array_inout->eMaxCount + 25);
+            return egwArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount + 25, (EGWuint64)EGW_UINT32_MAX));
         } break;
         
         case EGW_ARRAY_FLG_GROWBYSQRD: {
-            return egwArrayResize(array_inout, array_inout->eMaxCount * array_inout->eMaxCount);
+            return egwArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount * (EGWuint64)array_inout->eMaxCount, (EGWuint64)EGW_UINT32_MAX));
         } break;
     }
     
@@ -629,17 +770,31 @@ EGWint egwArrayShrink(egwArray* array_inout) {
 }
 
 EGWint egwArraySort(egwArray* array_inout) {
-    EGWbyte* temp = malloc((size_t)array_inout->eSize);
+    egwArraySortCtx ctx;
+    EGWuint64 hold[2]; // Small elements are held on the stack
+    EGWuint depth = 0;
+    EGWuint count;
     
-    if(temp) {
-        if(array_inout->eCount > 1)
-            egwArraySortRecurse(array_inout, temp, 0, array_inout->eCount - 1);
-        
-        free((void*)temp);
+    if(array_inout->eCount <= 1)
         return 1;
-    }
     
-    return 0;
+    ctx.data = array_inout->rData;
+    ctx.eSize = (EGWuintptr)array_inout->eSize;
+    ctx.compare = (array_inout->dFuncs && array_inout->dFuncs->fpCompare ? (EGWcomparefp)(array_inout->dFuncs->fpCompare) : (EGWcomparefp)NULL);
+    ctx.temp = (ctx.eSize <= (EGWuintptr)sizeof(hold) ? (EGWbyte*)hold : (EGWbyte*)malloc((size_t)ctx.eSize));
+    
+    if(!ctx.temp)
+        return 0;
+    
+    for(count = array_inout->eCount; count > 1; count >>= 1)
+        depth += 2;
+    
+    egwArraySortIntro(&ctx, 0, (EGWint)array_inout->eCount - 1, depth);
+    
+    if(ctx.temp != (EGWbyte*)hold)
+        free((void*)ctx.temp);
+    
+    return 1;
 }
 
 EGWint egwArrayEnumerateStart(const egwArray* array_in, EGWuint iterMode_in, egwArrayIter* iter_out) {
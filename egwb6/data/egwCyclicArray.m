@@ -64,12 +64,12 @@ static void egwCycArraySortRecurse(egwCyclicArray* array_inout, EGWbyte* temp_in
 egwCyclicArray* egwCycArrayInit(egwCyclicArray* array_out, egwDataFuncs* funcs_in, EGWuint elmSize_in, EGWuint intCap_in, EGWuint flags_in) {
     memset((void*)array_out, 0, sizeof(egwCyclicArray));
     
-    intCap_in = (EGWuint)egwMax2i(1, (EGWint)(EGWuint16)intCap_in);
-    elmSize_in = (EGWuint)egwMax2i(1, (EGWint)(EGWuint16)elmSize_in);
+    intCap_in = egwMax2ui(1, intCap_in);
+    elmSize_in = egwMax2ui(1, elmSize_in);
     
     array_out->aFlags = (EGWuint32)flags_in;
-    array_out->eSize = (EGWuint16)elmSize_in;
-    array_out->eMinCount = array_out->eMaxCount = (EGWuint16)intCap_in;
+    array_out->eSize = (EGWuint32)elmSize_in;
+    array_out->eMinCount = array_out->eMaxCount = (EGWuint32)intCap_in;
     
     if(funcs_in) {
         if(!(array_out->dFuncs = (egwDataFuncs*)malloc(sizeof(egwDataFuncs)))) { egwCycArrayFree(array_out); return NULL; }
@@ -93,7 +93,7 @@ egwCyclicArray* egwCycArrayCopy(const egwCyclicArray* array_in, egwCyclicArray*
     array_out->eSize = array_in->eSize;
     array_out->eCount = array_in->eCount;
     array_out->eMinCount = array_in->eMinCount;
-    array_out->eMaxCount = (EGWuint16)egwMax2i(egwMax2i(1, (EGWint)array_in->eMaxCount), (EGWint)array_in->eCount);
+    array_out->eMaxCount = (EGWuint32)egwMax2ui(egwMax2ui(1, (EGWuint)array_in->eMaxCount), (EGWuint)array_in->eCount);
     
     if(array_in->dFuncs) {
         if(!(array_out->dFuncs = (egwDataFuncs*)malloc(sizeof(egwDataFuncs)))) { egwCycArrayFree(array_out); return NULL; }
@@ -118,11 +118,11 @@ egwCyclicArray* egwCycArrayCopy(const egwCyclicArray* array_in, egwCyclicArray*
     }
     
     if(array_out->aFlags & EGW_ARRAY_FLG_RETAIN) {
-        EGWuint16 index = array_out->eCount; while(index--)
+        EGWuint32 index = array_out->eCount; while(index--)
             [(id<NSObject>)*(void**)((EGWuintptr)(array_out->rData) + ((EGWuintptr)((array_out->pOffset + index) % array_out->eMaxCount) * (EGWuintptr)(array_out->eSize))) retain];
     }
     if(array_out->dFuncs && array_out->dFuncs->fpAdd) {
-        EGWuint16 index = array_out->eCount; while(index--)
+        EGWuint32 index = array_out->eCount; while(index--)
             array_out->dFuncs->fpAdd((EGWbyte*)((EGWuintptr)(array_out->rData) + ((EGWuintptr)((array_out->pOffset + index) % array_out->eMaxCount) * (EGWuintptr)(array_out->eSize))));
     }
     
@@ -132,15 +132,15 @@ egwCyclicArray* egwCycArrayCopy(const egwCyclicArray* array_in, egwCyclicArray*
 egwCyclicArray* egwCycArrayFree(egwCyclicArray* array_inout) {
     if(array_inout->rData) {
         if(array_inout->dFuncs && array_inout->dFuncs->fpRemove) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 array_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))));
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_RETAIN) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 [(id<NSObject>)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))) release];
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_FREE) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 free((void*)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))));
         }
         
@@ -345,25 +345,25 @@ EGWint egwCycArrayRemoveTail(egwCyclicArray* array_inout) {
 EGWint egwCycArrayRemoveAll(egwCyclicArray* array_inout) {
     if(array_inout->eCount) {
         if(array_inout->dFuncs && array_inout->dFuncs->fpRemove) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 array_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))));
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_RETAIN) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 [(id<NSObject>)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))) release];
         }
         if(array_inout->aFlags & EGW_ARRAY_FLG_FREE) {
-            EGWuint16 index = array_inout->eCount; while(index--)
+            EGWuint32 index = array_inout->eCount; while(index--)
                 free((void*)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))));
         }
         
         if((array_inout->aFlags & EGW_ARRAY_FLG_EXSHRNKCND) && (array_inout->aFlags & EGW_ARRAY_FLG_EXSHRNKBY)) {
             while((array_inout->eCount)--)
                 if(egwCycArrayShrinkChk(array_inout)) {
-                    EGWuint16 count = array_inout->eCount;
+                    EGWuint32 count = array_inout->eCount;
                     array_inout->eCount = 0;
                     egwCycArrayShrink(array_inout);
-                    array_inout->eCount = (EGWuint16)egwMin2i((EGWint)count, (EGWint)(array_inout->eMaxCount));
+                    array_inout->eCount = (EGWuint32)egwMin2ui((EGWuint)count, (EGWuint)(array_inout->eMaxCount));
                 }
         }
         
@@ -601,7 +601,7 @@ EGWuint egwCycArrayOccurances(const egwCyclicArray* array_in, const EGWbyte* dat
 }
 
 EGWint egwCycArrayResize(egwCyclicArray* array_inout, EGWuint newCap_in) {
-    newCap_in = egwMax2ui(1, egwMin2ui(newCap_in, EGW_UINT16_MAX));
+    newCap_in = egwMax2ui(1, egwMin2ui(newCap_in, EGW_UINT32_MAX));
     if(array_inout->aFlags & EGW_ARRAY_FLG_USEMIN)
         newCap_in = egwMax2ui(array_inout->eMinCount, newCap_in);
     
@@ -615,15 +615,15 @@ EGWint egwCycArrayResize(egwCyclicArray* array_inout, EGWuint newCap_in) {
             
             if(array_inout->eCount > newCap_in) {
                 if(array_inout->dFuncs && array_inout->dFuncs->fpRemove) {
-                    EGWuint16 index = array_inout->eCount; while(index-- > (EGWuint16)newCap_in)
+                    EGWuint32 index = array_inout->eCount; while(index-- > (EGWuint32)newCap_in)
                         array_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))));
                 }
                 if(array_inout->aFlags & EGW_ARRAY_FLG_RETAIN) {
-                    EGWuint16 index = array_inout->eCount; while(index-- > (EGWuint16)newCap_in)
+                    EGWuint32 index = array_inout->eCount; while(index-- > (EGWuint32)newCap_in)
                         [(id<NSObject>)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))) release];
                 }
                 if(array_inout->aFlags & EGW_ARRAY_FLG_FREE) {
-                    EGWuint16 index = array_inout->eCount; while(index-- > (EGWuint16)newCap_in)
+                    EGWuint32 index = array_inout->eCount; while(index-- > (EGWuint32)newCap_in)
                         free((void*)*(void**)((EGWuintptr)(array_inout->rData) + ((EGWuintptr)((array_inout->pOffset + index) % array_inout->eMaxCount) * (EGWuintptr)(array_inout->eSize))));
                 }
                 
@@ -663,7 +663,7 @@ EGWint egwCycArrayResize(egwCyclicArray* array_inout, EGWuint newCap_in) {
             }
         }
         
-        array_inout->eMaxCount = (EGWuint16)newCap_in;
+        array_inout->eMaxCount = (EGWuint32)newCap_in;
     }
     
     return 1;
@@ -677,17 +677,17 @@ EGWint egwCycArrayGrowChk(const egwCyclicArray* array_in) {
         } break;
         
         case EGW_ARRAY_FLG_GRWCND90: {
-            if(array_in->eCount >= ((array_in->eMaxCount * 9) / 10))
+            if(array_in->eCount >= (EGWuint32)(((EGWuint64)array_in->eMaxCount * 9) / 10))
                 return 1;
         } break;
         
         case EGW_ARRAY_FLG_GRWCND75: {
-            if(array_in->eCount >= ((array_in->eMaxCount * 3) >> 2))
+            if(array_in->eCount >= (EGWuint32)(((EGWuint64)array_in->eMaxCount * 3) >> 2))
                 return 1;
         } break;
         
         case EGW_ARRAY_FLG_GRWCND66: {
-            if(array_in->eCount >= ((array_in->eMaxCount << 1) / 3))
+            if(array_in->eCount >= (EGWuint32)(((EGWuint64)array_in->eMaxCount << 1) / 3))
                 return 1;
         } break;
         
@@ -706,22 +706,22 @@ EGWint egwCycArrayShrinkChk(const egwCyclicArray* array_in) {
             if(array_in->eCount <= 0)
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND10: {
             if(array_in->eCount <= (array_in->eMaxCount / 10))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND25: {
             if(array_in->eCount <= (array_in->eMaxCount >> 2))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND33: {
             if(array_in->eCount <= (array_in->eMaxCount / 3))
                 return 1;
         } break;
-            
+        
         case EGW_ARRAY_FLG_SHRKCND50: {
             if(array_in->eCount <= (array_in->eMaxCount >> 1))
                 return 1;
@@ -734,23 +734,23 @@ EGWint egwCycArrayShrinkChk(const egwCyclicArray* array_in) {
 EGWint egwCycArrayGrow(egwCyclicArray* array_inout) {
     switch(array_inout->aFlags & EGW_ARRAY_FLG_EXGROWBY) {
         case EGW_ARRAY_FLG_GROWBY2X: {
-            return egwCycArrayResize(array_inout, array_inout->eMaxCount * 2);
+            return egwCycArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount * 2, (EGWuint64)EGW_UINT32_MAX));
         } break;
-            
+        
         case EGW_ARRAY_FLG_GROWBY3X: {
-            return egwCycArrayResize(array_inout, array_inout->eMaxCount * 3);
+            return egwCycArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount * 3, (EGWuint64)EGW_UINT32_MAX));
         } break;
-            
+        
         case EGW_ARRAY_FLG_GROWBY10: {
-            return egwCycArrayResize(array_inout, array_inout->eMaxCount + 10);
+            return egwCycArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount + 10, (EGWuint64)EGW_UINT32_MAX));
         } break;
-            
+        
         case EGW_ARRAY_FLG_GROWBY25: {
-            return egwCycArrayResize(array_inout, array_inout->eMaxCount + 25);
+            return egwCycArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount + 25, (EGWuint64)EGW_UINT32_MAX));
         } break;
         
         case EGW_ARRAY_FLG_GROWBYSQRD: {
-            return egwCycArrayResize(array_inout, array_inout->eMaxCount * array_inout->eMaxCount);
+            return egwCycArrayResize(array_inout, (EGWuint)egwMin2((EGWuint64)array_inout->eMaxCount * (EGWuint64)array_inout->eMaxCount, (EGWuint64)EGW_UINT32_MAX));
         } break;
     }
     
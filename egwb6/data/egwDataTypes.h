@@ -28,6 +28,7 @@
 /// @file egwDataTypes.h
 /// Data Types.
 
+#import <pthread.h>
 #import "../inf/egwTypes.h"
 
 
@@ -66,13 +67,27 @@
 #define EGW_LIST_FLG_NONE           0x0000  ///< No list flags.
 #define EGW_LIST_FLG_DFLT           0x0000  ///< Default list flags.
 #define EGW_LIST_FLG_RETAIN         0x4000  ///< Treat data element as pointer and auto-retain/auto-release on add/remove, via [ptr retain/release]. Note this only affects the first sizeof(void*) bytes.
+#define EGW_LIST_FLG_NOPOOL         0x1000  ///< Allocate nodes individually instead of from the list's node pool (implied when dFuncs->fpMalloc or dFuncs->fpFree is set).
 #define EGW_LIST_FLG_FREE           0x8000  ///< Treat data element as pointer and auto-free on remove, via free(ptr) (not dFuncs->fpFree). Note this only affects the first sizeof(void*) bytes.
 
 #define EGW_TREE_FLG_NONE           0x0000  ///< No tree flags.
 #define EGW_TREE_FLG_DFLT           0x0000  ///< Default tree flags.
 #define EGW_TREE_FLG_RETAIN         0x4000  ///< Treat data element as pointer and auto-retain/auto-release on add/remove, via [ptr retain/release]. Note this only affects the first sizeof(void*) bytes.
+#define EGW_TREE_FLG_NOPOOL         0x1000  ///< Allocate nodes individually instead of from the tree's node pool (implied when dFuncs->fpMalloc or dFuncs->fpFree is set).
 #define EGW_TREE_FLG_FREE           0x8000  ///< Treat data element as pointer and auto-free on remove, via free(ptr) (not dFuncs->fpFree). Note this only affects the first sizeof(void*) bytes.
 
+#define EGW_HASH_FLG_NONE           0x0000  ///< No hash table flags.
+#define EGW_HASH_FLG_DFLT           0x0000  ///< Default hash table flags.
+#define EGW_HASH_FLG_RETAIN         0x4000  ///< Treat data element as pointer and auto-retain/auto-release on add/remove, via [ptr retain/release]. Note this only affects the first sizeof(void*) bytes.
+#define EGW_HASH_FLG_FREE           0x8000  ///< Treat data element as pointer and auto-free on remove, via free(ptr) (not dFuncs->fpFree). Note this only affects the first sizeof(void*) bytes.
+#define EGW_HASH_FLG_NOSHRINK       0x0001  ///< Do not allow hash table to shrink after removals. Note that a hash table never shrinks below its initial slot capacity.
+
+#define EGW_HASH_DFLTCAPACITY       16      ///< Default hash table slot capacity.
+#define EGW_HASH_MAXLOADNUM         7       ///< Maximum hash table load factor numerator (over 8ths), grows before exceeding.
+
+#define EGW_NODEPOOL_DFLTSLABNODES  16      ///< Default node count of the first node pool slab (doubles per slab).
+#define EGW_NODEPOOL_MAXSLABNODES   1024    ///< Maximum node count of a node pool slab.
+
 #define EGW_FIND_MODE_DFLT          0x0001  ///< Default find mode flags.
 #define EGW_FIND_MODE_LINHTT        0x0001  ///< Head-to-tail (i.e. left-to-right) linear search (arrays, lists only).
 #define EGW_FIND_MODE_LINTTH        0x0002  ///< Tail-to-head (i.e. right-to-left) linear search (arrays, lists only).
@@ -103,6 +118,10 @@ typedef EGWint (*EGWcomparefp)(const EGWbyte*,  const EGWbyte*, size_t size);
 /// Element operator function pointer typedef.
 typedef void (*EGWelementfp)(EGWbyte*);
 
+/// Hash function pointer typedef.
+/// @note Should return equal hashes for elements that compare as equal, i.e. only hash what the comparator compares.
+typedef EGWuint32 (*EGWhashfp)(const EGWbyte*, size_t size);
+
 /// Memory allocation function pointer typedef.
 typedef void* (*EGWmallocfp)(size_t);
 
@@ -117,6 +136,7 @@ typedef struct {
     EGWcomparefp fpCompare;                 ///< Compare element function. If NULL defaults to memcmp().
     EGWelementfp fpAdd;                     ///< Post-add element function. Default is NULL.
     EGWelementfp fpRemove;                  ///< Pre-remove element function. Default is NULL.
+    EGWhashfp    fpHash;                    ///< Hash element function (hash tables only). If NULL defaults to FNV-1a over all element bytes.
 } egwDataFuncs;
 
 /// 1-D Array.
@@ -125,10 +145,10 @@ typedef struct {
     EGWbyte* rData;                         ///< Raw array data (owned).
     egwDataFuncs* dFuncs;                   ///< Data functions (owned).
     EGWuint32 aFlags;                       ///< Array flags.
-    EGWuint16 eSize;                        ///< Element size (bytes).
-    EGWuint16 eCount;                       ///< Current element count.
-    EGWuint16 eMinCount;                    ///< Minimum element count.
-    EGWuint16 eMaxCount;                    ///< Maximum element count.
+    EGWuint32 eSize;                        ///< Element size (bytes).
+    EGWuint32 eCount;                       ///< Current element count.
+    EGWuint32 eMinCount;                    ///< Minimum element count.
+    EGWuint32 eMaxCount;                    ///< Maximum element count.
 } egwArray;
 
 /// 1-D Array Iterator.
@@ -137,7 +157,7 @@ typedef struct {
     const egwArray* pArray;                 ///< Parent array (weak).
     EGWbyte* nPos;                          ///< Next position pointer.
     EGWuint16 iMode;                        ///< Iterator mode.
-    EGWuint16 eIndex;                       ///< Current element index. Note that this represents the index based upon the iteration mode, not of the underlying structure.
+    EGWuint32 eIndex;                       ///< Current element index. Note that this represents the index based upon the iteration mode, not of the underlying structure.
 } egwArrayIter;
 
 /// 1-D Cyclic Array.
@@ -146,11 +166,11 @@ typedef struct {
     EGWbyte* rData;                         ///< Raw array data (owned).
     egwDataFuncs* dFuncs;                   ///< Data functions (owned).
     EGWuint32 aFlags;                       ///< Array flags.
-    EGWuint16 eSize;                        ///< Element size (bytes).
-    EGWuint16 eCount;                       ///< Current element count.
-    EGWuint16 eMinCount;                    ///< Minimum element count.
-    EGWuint16 eMaxCount;                    ///< Maximum element count.
-    EGWuint16 pOffset;                      ///< Head offset position.
+    EGWuint32 eSize;                        ///< Element size (bytes).
+    EGWuint32 eCount;                       ///< Current element count.
+    EGWuint32 eMinCount;                    ///< Minimum element count.
+    EGWuint32 eMaxCount;                    ///< Maximum element count.
+    EGWuint32 pOffset;                      ///< Head offset position.
 } egwCyclicArray;
 
 /// 1-D Cyclic Array Iterator.
@@ -159,9 +179,61 @@ typedef struct {
     const egwCyclicArray* pArray;           ///< Parent array (weak).
     EGWbyte* nPos;                          ///< Next position pointer.
     EGWuint16 iMode;                        ///< Iterator mode.
-    EGWuint16 eIndex;                       ///< Current element index. Note that this represents the index based upon the iteration mode, not of the underlying structure.
+    EGWuint32 eIndex;                       ///< Current element index. Note that this represents the index based upon the iteration mode, not of the underlying structure.
 } egwCyclicArrayIter;
 
+/// Request Ring.
+/// Multiple-producer single-consumer lock-free request ring structure, with a locked overflow spill list.
+typedef struct {
+    EGWbyte* rData;                         ///< Raw ring slot data (owned).
+    egwCyclicArray oList;                   ///< Overflow spill list (owned, locked).
+    pthread_mutex_t oLock;                  ///< Overflow spill list mutex lock.
+    EGWuint32 aFlags;                       ///< Ring flags (only EGW_ARRAY_FLG_RETAIN applies).
+    EGWuint32 eSize;                        ///< Element size (bytes).
+    EGWuint32 sSize;                        ///< Slot size (bytes), sequence stamp plus padded element.
+    EGWuint32 sMask;                        ///< Slot index mask (slot count - 1).
+    volatile EGWuint32 pHead;               ///< Producer claim position.
+    EGWuint32 cTail;                        ///< Consumer position (consumer owned).
+    volatile EGWuint32 oSpill;              ///< Overflow spilling status (overflow list non-empty).
+    volatile EGWint32 oCount;               ///< Overflowed request count.
+    EGWuint32 pCount;                       ///< Peak ring occupancy count (as seen by consumer).
+} egwRequestRing;
+
+/// Node Pool.
+/// Fixed-size node slab allocator structure.
+/// @note Released nodes are kept on a free chain for reuse, slabs are only released by trimming or when the pool is free'd.
+typedef struct {
+    EGWbyte* sHead;                         ///< Slab chain head (owned), each slab leads with a link to the next slab and its node count.
+    EGWbyte* fHead;                         ///< Free node chain head (weak), each free node leads with a link to the next free node.
+    EGWuint32 nSize;                        ///< Node stride (bytes), 0 if pool is unused.
+    EGWuint32 sNodes;                       ///< Node count of the next slab.
+} egwNodePool;
+
+/// Hash Table.
+/// Open-addressing (Robin Hood probing) hash table structure.
+/// @note Elements are stored in place in slots, thus element pointers are invalidated by any addition or removal.
+typedef struct {
+    EGWbyte* rData;                         ///< Raw slot element data (owned).
+    EGWuint32* sHashes;                     ///< Slot element hashes (owned), 0 for empty slot.
+    EGWbyte* sTemp;                         ///< Element swap scratch space (owned), two elements wide.
+    egwDataFuncs* dFuncs;                   ///< Data functions (owned).
+    EGWuint32 hFlags;                       ///< Hash table flags.
+    EGWuint32 eSize;                        ///< Element size (bytes).
+    EGWuint32 eCount;                       ///< Current element count.
+    EGWuint32 sMinCount;                    ///< Minimum slot count.
+    EGWuint32 sCount;                       ///< Current slot count (power of 2).
+    EGWuint32 sShift;                       ///< Slot index shift (32 - log2(sCount)).
+} egwHashTable;
+
+/// Hash Table Iterator.
+/// Iterator container structure.
+typedef struct {
+    const egwHashTable* pTable;             ///< Parent hash table (weak).
+    EGWint32 sIndex;                        ///< Next slot index (-1 if at end).
+    EGWuint16 iMode;                        ///< Iterator mode.
+    EGWuint32 eIndex;                       ///< Current element index. Note that this represents the index based upon the iteration mode, not of the underlying structure.
+} egwHashTableIter;
+
 /// Singly-Linked List Node.
 /// Singly-linked list node header structure.
 /// @note This header is included automatically when allocating nodes (sizeof() is explicitly appended by eSize), and is what is pointed to by node linkage, deallocations, etc..
@@ -178,6 +250,7 @@ typedef struct {
     EGWuint32 lFlags;                       ///< List flags.
     EGWuint16 eSize;                        ///< Element size (bytes).
     EGWuint16 eCount;                       ///< Current element count.
+    egwNodePool nPool;                      ///< Node pool (owned).
 } egwSinglyLinkedList;
 
 /// Singly-Linked List Iterator.
@@ -206,6 +279,7 @@ typedef struct {
     EGWuint32 lFlags;                       ///< List flags.
     EGWuint16 eSize;                        ///< Element size (bytes).
     EGWuint16 eCount;                       ///< Current element count.
+    egwNodePool nPool;                      ///< Node pool (owned).
 } egwDoublyLinkedList;
 
 /// Doubly-Linked List Iterator.
@@ -236,6 +310,7 @@ typedef struct {
     EGWuint32 tFlags;                       ///< Tree flags.
     EGWuint16 eSize;                        ///< Element size (bytes).
     EGWuint16 eCount;                       ///< Current element count.
+    egwNodePool nPool;                      ///< Node pool (owned).
 } egwAVLTree;
 
 /// AVL Tree Iterator.
@@ -266,6 +341,7 @@ typedef struct {
     EGWuint32 tFlags;                       ///< Tree flags.
     EGWuint16 eSize;                        ///< Element size (bytes).
     EGWuint16 eCount;                       ///< Current element count.
+    egwNodePool nPool;                      ///< Node pool (owned).
 } egwRedBlackTree;
 
 /// Red-Black Tree Iterator.
@@ -25,8 +25,26 @@
 /// Doubly-Linked List Implementation.
 
 #import "egwDoublyLinkedList.h"
+#import "egwNodePool.h"
 
 
+static egwDoublyLinkedListNode* egwDLListAllocNode(egwDoublyLinkedList* list_inout) {
+    if(list_inout->nPool.nSize)
+        return (egwDoublyLinkedListNode*)egwNodePoolAlloc(&list_inout->nPool);
+    else if(list_inout->dFuncs && list_inout->dFuncs->fpMalloc)
+        return (egwDoublyLinkedListNode*)list_inout->dFuncs->fpMalloc(((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
+    return (egwDoublyLinkedListNode*)malloc(((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
+}
+
+static void egwDLListFreeNode(egwDoublyLinkedList* list_inout, egwDoublyLinkedListNode* node_inout) {
+    if(list_inout->nPool.nSize)
+        egwNodePoolDealloc(&list_inout->nPool, (EGWbyte*)node_inout);
+    else if(list_inout->dFuncs && list_inout->dFuncs->fpFree)
+        list_inout->dFuncs->fpFree((void*)node_inout);
+    else
+        free((void*)node_inout);
+}
+
 static egwDoublyLinkedListNode* egwDLListSortMerge(egwDoublyLinkedList* list_inout, egwDoublyLinkedListNode* nodeL_in, egwDoublyLinkedListNode* nodeR_in) {
     if(!nodeL_in)
         return nodeR_in;
@@ -79,6 +97,10 @@ egwDoublyLinkedList* egwDLListInit(egwDoublyLinkedList* list_out, egwDataFuncs*
         memcpy((void*)list_out->dFuncs, (const void*)funcs_in, sizeof(egwDataFuncs));
     }
     
+    if(!(list_out->lFlags & EGW_LIST_FLG_NOPOOL) && !(list_out->dFuncs && (list_out->dFuncs->fpMalloc || list_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&list_out->nPool, (EGWuint)list_out->eSize + (EGWuint)sizeof(egwDoublyLinkedListNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwDLListFree(list_out); return NULL; }
+    }
+    
     return list_out;
 }
 
@@ -97,15 +119,18 @@ egwDoublyLinkedList* egwDLListCopy(const egwDoublyLinkedList* list_in, egwDoubly
         memcpy((void*)list_out->dFuncs, (const void*)list_in->dFuncs, sizeof(egwDataFuncs));
     }
     
+    if(!(list_out->lFlags & EGW_LIST_FLG_NOPOOL) && !(list_out->dFuncs && (list_out->dFuncs->fpMalloc || list_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&list_out->nPool, (EGWuint)list_out->eSize + (EGWuint)sizeof(egwDoublyLinkedListNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwDLListFree(list_out); return NULL; }
+    }
+    
     if(list_in->eCount) {
-        EGWmallocfp mallocFunc = (list_out->dFuncs && list_out->dFuncs->fpMalloc ? (EGWmallocfp)list_out->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
         EGWelementfp addFunc = (list_out->dFuncs && list_out->dFuncs->fpAdd ? (EGWelementfp)list_out->dFuncs->fpAdd : (EGWelementfp)NULL);
         egwDoublyLinkedListNode* node = list_in->lHead;
         egwDoublyLinkedListNode* newNode = NULL;
         EGWuintptr data = 0;
         
         while(node) {
-            if(!(newNode = (egwDoublyLinkedListNode*)mallocFunc(((size_t)list_out->eSize + sizeof(egwDoublyLinkedListNode))))) { egwDLListFree(list_out); return NULL; }
+            if(!(newNode = egwDLListAllocNode(list_out))) { egwDLListFree(list_out); return NULL; }
             memset((void*)newNode, 0, ((size_t)list_out->eSize + sizeof(egwDoublyLinkedListNode)));
             
             if(list_out->lTail) {
@@ -131,8 +156,6 @@ egwDoublyLinkedList* egwDLListCopy(const egwDoublyLinkedList* list_in, egwDoubly
 }
 
 egwDoublyLinkedList* egwDLListFree(egwDoublyLinkedList* list_inout) {
-    EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-    
     while(list_inout->lHead) {
         egwDoublyLinkedListNode* node = list_inout->lHead;
         
@@ -144,9 +167,11 @@ egwDoublyLinkedList* egwDLListFree(egwDoublyLinkedList* list_inout) {
             free((void*)*(void**)((EGWuintptr)node + (EGWuintptr)sizeof(egwDoublyLinkedListNode)));
         
         list_inout->lHead = list_inout->lHead->next;
-        freeFunc(node);
+        egwDLListFreeNode(list_inout, node);
     }
     
+    egwNodePoolFree(&list_inout->nPool);
+    
     if(list_inout->dFuncs)
         free((void*)(list_inout->dFuncs));
     
@@ -160,10 +185,8 @@ EGWint egwDLListAddAt(egwDoublyLinkedList* list_inout, EGWuint index_in, const E
         if(index_in < list_inout->eCount - 1) {
             egwDoublyLinkedListNode* newNode = NULL;
             
-            {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-                if(!(newNode = (egwDoublyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode))))) { return 0; }
-                memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
-            }
+            if(!(newNode = egwDLListAllocNode(list_inout))) { return 0; }
+            memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
             
             ++list_inout->eCount;
             
@@ -198,10 +221,8 @@ EGWint egwDLListAddAt(egwDoublyLinkedList* list_inout, EGWuint index_in, const E
 EGWint egwDLListAddHead(egwDoublyLinkedList* list_inout, const EGWbyte* data_in) {
     egwDoublyLinkedListNode* newNode = NULL;
     
-    {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-        if(!(newNode = (egwDoublyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode))))) { return 0; }
-        memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
-    }
+    if(!(newNode = egwDLListAllocNode(list_inout))) { return 0; }
+    memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
     
     ++list_inout->eCount;
     
@@ -225,10 +246,8 @@ EGWint egwDLListAddHead(egwDoublyLinkedList* list_inout, const EGWbyte* data_in)
 EGWint egwDLListAddTail(egwDoublyLinkedList* list_inout, const EGWbyte* data_in) {
     egwDoublyLinkedListNode* newNode = NULL;
     
-    {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-        if(!(newNode = (egwDoublyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode))))) { return 0; }
-        memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
-    }
+    if(!(newNode = egwDLListAllocNode(list_inout))) { return 0; }
+    memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
     
     ++list_inout->eCount;
     
@@ -254,10 +273,8 @@ EGWint egwDLListAddAfter(egwDoublyLinkedList* list_inout, egwDoublyLinkedListNod
         if(list_inout->lTail != node_inout) {
             egwDoublyLinkedListNode* newNode = NULL;
             
-            {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-                if(!(newNode = (egwDoublyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode))))) { return 0; }
-                memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
-            }
+            if(!(newNode = egwDLListAllocNode(list_inout))) { return 0; }
+            memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
             
             ++list_inout->eCount;
             
@@ -285,10 +302,8 @@ EGWint egwDLListAddBefore(egwDoublyLinkedList* list_inout, egwDoublyLinkedListNo
         if(list_inout->lHead != node_inout) {
             egwDoublyLinkedListNode* newNode = NULL;
             
-            {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-                if(!(newNode = (egwDoublyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode))))) { return 0; }
-                memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
-            }
+            if(!(newNode = egwDLListAllocNode(list_inout))) { return 0; }
+            memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwDoublyLinkedListNode)));
             
             ++list_inout->eCount;
             
@@ -339,9 +354,7 @@ EGWint egwDLListRemove(egwDoublyLinkedList* list_inout, egwDoublyLinkedListNode*
                 list_inout->lTail = NULL;
         }
         
-        {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-            freeFunc((void*)node_inout);
-        }
+        egwDLListFreeNode(list_inout, node_inout);
         
         --list_inout->eCount;
         
@@ -356,7 +369,7 @@ EGWint egwDLListRemoveAt(egwDoublyLinkedList* list_inout, EGWuint index_in) {
             egwDoublyLinkedListNode* node = list_inout->lHead->next;
             
             {   register EGWuint index = 1;
-                
+            
                 while(index != index_in) {
                     node = node->next;
                     ++index;
@@ -373,9 +386,7 @@ EGWint egwDLListRemoveAt(egwDoublyLinkedList* list_inout, EGWuint index_in) {
             node->prev->next = node->next;
             node->next->prev = node->prev;
             
-            {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-                freeFunc((void*)node);
-            }
+            egwDLListFreeNode(list_inout, node);
             
             --list_inout->eCount;
             
@@ -403,9 +414,7 @@ EGWint egwDLListRemoveHead(egwDoublyLinkedList* list_inout) {
         else
             list_inout->lTail = NULL;
         
-        {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-            freeFunc((void*)node);
-        }
+        egwDLListFreeNode(list_inout, node);
         
         --list_inout->eCount;
         
@@ -431,9 +440,7 @@ EGWint egwDLListRemoveTail(egwDoublyLinkedList* list_inout) {
         else
             list_inout->lHead = NULL;
         
-        {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-            freeFunc((void*)node);
-        }
+        egwDLListFreeNode(list_inout, node);
         
         --list_inout->eCount;
         
@@ -461,9 +468,7 @@ EGWint egwDLListRemoveAfter(egwDoublyLinkedList* list_inout, egwDoublyLinkedList
             
             node_inout->next = node->next;
             
-            {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-                freeFunc((void*)node);
-            }
+            egwDLListFreeNode(list_inout, node);
             
             --list_inout->eCount;
             
@@ -493,9 +498,7 @@ EGWint egwDLListRemoveBefore(egwDoublyLinkedList* list_inout, egwDoublyLinkedLis
             
             node_inout->prev = node->prev;
             
-            {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-                freeFunc((void*)node);
-            }
+            egwDLListFreeNode(list_inout, node);
             
             --list_inout->eCount;
             
@@ -603,8 +606,6 @@ EGWuint egwDLListRemoveAny(egwDoublyLinkedList* list_inout, const EGWbyte* data_
 }
 
 EGWint egwDLListRemoveAll(egwDoublyLinkedList* list_inout) {
-    EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-    
     while(list_inout->lHead) {
         egwDoublyLinkedListNode* node = list_inout->lHead;
         
@@ -617,7 +618,7 @@ EGWint egwDLListRemoveAll(egwDoublyLinkedList* list_inout) {
         
         list_inout->lHead = list_inout->lHead->next;
         list_inout->lHead->prev = NULL;
-        freeFunc(node);
+        egwDLListFreeNode(list_inout, node);
     }
     
     list_inout->eCount = 0;
@@ -825,7 +826,7 @@ EGWuint egwDLListOccurances(const egwDoublyLinkedList* list_in, const EGWbyte* d
                 }
             }
         } break;
-            
+        
         case EGW_FIND_MODE_LINTTH: {
             register egwDoublyLinkedListNode* node = list_in->lTail;
             
@@ -880,7 +881,7 @@ EGWint egwDLListEnumerateStart(const egwDoublyLinkedList* list_in, EGWuint iterM
             case EGW_ITERATE_MODE_LINHTT: {
                 iter_out->nPos = list_in->lHead;
             } break;
-                
+            
             case EGW_ITERATE_MODE_LINTTH: {
                 iter_out->nPos = list_in->lTail;
             } break;
@@ -0,0 +1,164 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/// @defgroup geWizES_data_hashtable egwHashTable
+/// @ingroup geWizES_data
+/// Open-Addressing Hash Table.
+/// @{
+
+/// @file egwHashTable.h
+/// Open-Addressing Hash Table Interface.
+
+#import "egwDataTypes.h"
+
+
+// !!!: ***** Initialization *****
+
+/// Hash Table Initialization Routine.
+/// Initializes hash table with provided parameters.
+/// @note Elements are keyed by dFuncs->fpHash and dFuncs->fpCompare, which may hash/compare only a leading key section of the element (e.g. for key/value pair elements).
+/// @param [out] table_out Hash table output of initialization.
+/// @param [in] funcs_in Data routine functions (contents copy-over, may be NULL for default routines).
+/// @param [in] elmSize_in Element size (bytes).
+/// @param [in] intCap_in Initial element capacity (rounded up to power of 2 slot count, also taken as minimum slot count).
+/// @param [in] flags_in Hash table attribute flags (EGW_HASH_FLG_*).
+/// @return @a table_out (for nesting), otherwise NULL if failure initializing.
+egwHashTable* egwHashTableInit(egwHashTable* table_out, egwDataFuncs* funcs_in, EGWuint elmSize_in, EGWuint intCap_in, EGWuint flags_in);
+
+/// Hash Table Copy Routine.
+/// Initializes hash table from deep copy of another.
+/// @param [in] table_in Hash table input structure.
+/// @param [out] table_out Hash table output of copy.
+/// @return @a table_out (for nesting), otherwise NULL if failure copying.
+egwHashTable* egwHashTableCopy(const egwHashTable* table_in, egwHashTable* table_out);
+
+/// Hash Table Free Routine.
+/// Frees the contents of the hash table.
+/// @param [in,out] table_inout Hash table input/output structure.
+/// @return @a table_inout (for nesting), otherwise NULL if failure free'ing.
+egwHashTable* egwHashTableFree(egwHashTable* table_inout);
+
+
+// !!!: ***** Hashing *****
+
+/// Hash Bytes Routine.
+/// Hashes the provided data buffer using the FNV-1a algorithm, as used by default for elements.
+/// @note Provided for use by custom dFuncs->fpHash routines that hash only a key section of the element.
+/// @param [in] data_in Data input buffer.
+/// @param [in] size_in Data size (bytes).
+/// @return Hash value.
+EGWuint32 egwHashTableHashBytes(const EGWbyte* data_in, size_t size_in);
+
+
+// !!!: ***** Addition *****
+
+/// Hash Table Add Routine.
+/// Adds an element into the hash table at O(1) average insertion cost, growing the table if need be.
+/// @note Keys are unique - an element matching an already contained element is not added.
+/// @param [in,out] table_inout Hash table input/output structure.
+/// @param [in] data_in Element data input buffer (contents copy-over).
+/// @return 1 if element was successfully added, otherwise 0 (if already contained or failure growing).
+EGWint egwHashTableAdd(egwHashTable* table_inout, const EGWbyte* data_in);
+
+
+// !!!: ***** Removal *****
+
+/// Hash Table Remove Routine.
+/// Removes the element matching the provided element from the hash table at O(1) average deletion cost.
+/// @param [in,out] table_inout Hash table input/output structure.
+/// @param [in] data_in Element data input buffer to match against.
+/// @return 1 if element was successfully removed, otherwise 0 (if not contained).
+EGWint egwHashTableRemove(egwHashTable* table_inout, const EGWbyte* data_in);
+
+/// Hash Table Remove All Routine.
+/// Removes all elements from the hash table at O(n) transversal cost, shrinking to the minimum slot count (unless EGW_HASH_FLG_NOSHRINK).
+/// @param [in,out] table_inout Hash table input/output structure.
+/// @return 1 if all elements were successfully removed, otherwise 0.
+EGWint egwHashTableRemoveAll(egwHashTable* table_inout);
+
+
+// !!!: ***** Fetching *****
+
+/// Hash Table Get Element Routine.
+/// Copies the contained element contents matching the provided element into the output buffer at O(1) average search cost and O(1) copy cost.
+/// @note This routine does a simple memory copy-over - ownership issues fall to the responsibility of the code using this routine.
+/// @param [in] table_in Hash table input structure.
+/// @param [in] data_in Element data input buffer to match against.
+/// @param [out] data_out Element data output buffer (contents copy-over).
+/// @return 1 if element was found and copied, otherwise 0.
+EGWint egwHashTableGetElement(const egwHashTable* table_in, const EGWbyte* data_in, EGWbyte* data_out);
+
+
+// !!!: ***** Searching *****
+
+/// Hash Table Find Routine.
+/// Attempts to find the contained element matching the provided element at O(1) average search cost.
+/// @note Returned pointer is only valid until the next addition or removal. Modifying the hashed/compared section of the element in place is not permitted.
+/// @param [in] table_in Hash table input structure.
+/// @param [in] data_in Element data input buffer to match against.
+/// @return Element data buffer pointer if search successful, otherwise NULL.
+EGWbyte* egwHashTableFind(const egwHashTable* table_in, const EGWbyte* data_in);
+
+/// Hash Table Contains Routine.
+/// Attempts to find the existence of an element in the hash table given the provided parameters at O(1) average search cost.
+/// @param [in] table_in Hash table input structure.
+/// @param [in] data_in Element data input buffer to match against.
+/// @return 1 if search successful, otherwise 0.
+EGWint egwHashTableContains(const egwHashTable* table_in, const EGWbyte* data_in);
+
+
+// !!!: ***** Resizing *****
+
+/// Hash Table Resize Routine.
+/// Resizes the hash table's slot storage to the provided slot count at O(n) rehash cost (stored hashes are reused, dFuncs->fpHash is not invoked).
+/// @param [in,out] table_inout Hash table input/output structure.
+/// @param [in] newCap_in New slot count (rounded up to power of 2, and up to keep within maximum load).
+/// @return 1 if resize successful, otherwise 0.
+EGWint egwHashTableResize(egwHashTable* table_inout, EGWuint newCap_in);
+
+
+// !!!: ***** Enumerating *****
+
+/// Hash Table Enumerate Start Routine.
+/// Attempts to start an enumeration of the hash table given the provided iteration mode.
+/// @note Elements are enumerated in slot order, which bears no relation to element order or order of addition.
+/// @note No mechanism is provided to ensure the data contents are not modified while being enumerated - it is left up to the user to determine what effects should result, if any. Additions and removals invalidate the enumeration.
+/// @param [in] table_in Hash table input structure.
+/// @param [in] iterMode_in Iteration mode (EGW_ITERATE_MODE_LINHTT or EGW_ITERATE_MODE_LINTTH).
+/// @param [out] iter_out Iterator output structure.
+/// @return 1 if enumeration start successful, otherwise 0 if empty or invalid iteration mode.
+EGWint egwHashTableEnumerateStart(const egwHashTable* table_in, EGWuint iterMode_in, egwHashTableIter* iter_out);
+
+/// Hash Table Enumeration Get Next Routine.
+/// Copies the next enumerated element's contents from the hash table into the output buffer at O(1) amortized transversal cost and O(1) copy cost.
+/// @note This routine does a simple memory copy-over - ownership issues fall to the responsibility of the code using this routine.
+/// @param [in,out] iter_inout Iterator input/output structure.
+/// @param [out] data_out Element data output buffer (contents copy-over).
+/// @return 1 if enumeration of next element successful, otherwise 0 if at end of enumeration.
+EGWint egwHashTableEnumerateGetNext(egwHashTableIter* iter_inout, EGWbyte* data_out);
+
+/// Hash Table Enumeration Next Pointer Routine.
+/// Returns the next enumerated element's data buffer pointer from the hash table at O(1) amortized transversal cost.
+/// @param [in,out] iter_inout Iterator input/output structure.
+/// @return Element data buffer pointer to the next enumerated element, otherwise NULL if at end of enumeration.
+EGWbyte* egwHashTableEnumerateNextPtr(egwHashTableIter* iter_inout);
+
+/// @}
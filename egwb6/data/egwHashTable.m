@@ -0,0 +1,419 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/// @file egwHashTable.m
+/// @ingroup geWizES_data_hashtable
+/// Open-Addressing Hash Table Implementation.
+
+#import <string.h>
+#import "egwHashTable.h"
+#import "../math/egwMath.h"
+
+
+#define EGW_HASH_MINSLOTS   8   // Minimum slot count.
+
+#define egwHashTableElm(table,slot) ((EGWbyte*)((EGWuintptr)((table)->rData) + ((EGWuintptr)(slot) * (EGWuintptr)((table)->eSize))))
+
+// NOTE: Slot homes are taken from the top bits of a Fibonacci multiply of the stored hash, which keeps weak user hashes (e.g. raw pointer values) from clustering. -jw
+static inline EGWuint32 egwHashTableHome(const egwHashTable* table_in, EGWuint32 hash_in) {
+    return (EGWuint32)((hash_in * 2654435769u) >> table_in->sShift);
+}
+
+static inline EGWuint32 egwHashTableHashOf(const egwHashTable* table_in, const EGWbyte* data_in) {
+    EGWuint32 hash = (table_in->dFuncs && table_in->dFuncs->fpHash ? table_in->dFuncs->fpHash(data_in, (size_t)table_in->eSize) : egwHashTableHashBytes(data_in, (size_t)table_in->eSize));
+    return (hash ? hash : 1); // 0 is reserved for empty slots
+}
+
+static EGWint egwHashTableFindSlot(const egwHashTable* table_in, EGWuint32 hash_in, const EGWbyte* data_in) {
+    EGWcomparefp compareFunc = (table_in->dFuncs && table_in->dFuncs->fpCompare ? (EGWcomparefp)(table_in->dFuncs->fpCompare) : (EGWcomparefp)&memcmp);
+    EGWuint32 mask = table_in->sCount - 1;
+    EGWuint32 slot = egwHashTableHome(table_in, hash_in);
+    EGWuint32 dist = 0;
+    EGWuint32 sHash;
+    
+    // Robin Hood invariant lets the probe stop as soon as it passes a slot richer than the probe would be
+    while((sHash = table_in->sHashes[slot]) && ((slot - egwHashTableHome(table_in, sHash)) & mask) >= dist) {
+        if(sHash == hash_in && compareFunc(egwHashTableElm(table_in, slot), data_in, (size_t)table_in->eSize) == 0)
+            return (EGWint)slot;
+        
+        slot = (slot + 1) & mask;
+        ++dist;
+    }
+    
+    return -1;
+}
+
+// Places element into table without invoking any element hooks, returns slot element landed at.
+static EGWuint32 egwHashTableInsertSlot(egwHashTable* table_inout, EGWuint32 hash_in, const EGWbyte* data_in) {
+    EGWuint32 mask = table_inout->sCount - 1;
+    EGWuint32 slot = egwHashTableHome(table_inout, hash_in);
+    EGWuint32 dist = 0, sDist;
+    EGWuint32 landed = (EGWuint32)-1;
+    EGWbyte* carry = table_inout->sTemp;
+    EGWbyte* swap = (EGWbyte*)((EGWuintptr)(table_inout->sTemp) + (EGWuintptr)(table_inout->eSize));
+    
+    memcpy((void*)carry, (const void*)data_in, (size_t)(table_inout->eSize));
+    
+    while(table_inout->sHashes[slot]) {
+        sDist = (slot - egwHashTableHome(table_inout, table_inout->sHashes[slot])) & mask;
+        
+        if(sDist < dist) { // Take from the rich, carry on with the displaced element
+            EGWbyte* temp;
+            EGWuint32 sHash = table_inout->sHashes[slot];
+            
+            memcpy((void*)swap, (const void*)egwHashTableElm(table_inout, slot), (size_t)(table_inout->eSize));
+            memcpy((void*)egwHashTableElm(table_inout, slot), (const void*)carry, (size_t)(table_inout->eSize));
+            table_inout->sHashes[slot] = hash_in;
+            
+            if(landed == (EGWuint32)-1) landed = slot;
+            temp = carry; carry = swap; swap = temp;
+            hash_in = sHash;
+            dist = sDist;
+        }
+        
+        slot = (slot + 1) & mask;
+        ++dist;
+    }
+    
+    memcpy((void*)egwHashTableElm(table_inout, slot), (const void*)carry, (size_t)(table_inout->eSize));
+    table_inout->sHashes[slot] = hash_in;
+    
+    return (landed == (EGWuint32)-1 ? slot : landed);
+}
+
+static void egwHashTableRemoveHooks(egwHashTable* table_inout, EGWbyte* elm_inout) {
+    if(table_inout->dFuncs && table_inout->dFuncs->fpRemove)
+        table_inout->dFuncs->fpRemove(elm_inout);
+    if(table_inout->hFlags & EGW_HASH_FLG_RETAIN)
+        [(id<NSObject>)*(void**)elm_inout release];
+    if(table_inout->hFlags & EGW_HASH_FLG_FREE)
+        free((void*)*(void**)elm_inout);
+}
+
+// Returns slot count needed to hold count elements within maximum load, at least minCount.
+static EGWuint32 egwHashTableSlotsFor(EGWuint count_in, EGWuint minCount_in) {
+    EGWuint64 slots = EGW_HASH_MINSLOTS;
+    
+    while(slots < (EGWuint64)minCount_in || (EGWuint64)count_in * 8 > slots * EGW_HASH_MAXLOADNUM)
+        slots <<= 1;
+    
+    return (EGWuint32)slots;
+}
+
+static EGWuint32 egwHashTableShiftFor(EGWuint32 slots_in) {
+    EGWuint32 shift = 32;
+    
+    while(slots_in > 1) { slots_in >>= 1; --shift; }
+    
+    return shift;
+}
+
+EGWuint32 egwHashTableHashBytes(const EGWbyte* data_in, size_t size_in) {
+    EGWuint32 hash = 2166136261u; // FNV-1a
+    
+    while(size_in--) {
+        hash ^= (EGWuint32)*data_in++;
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
+
+egwHashTable* egwHashTableInit(egwHashTable* table_out, egwDataFuncs* funcs_in, EGWuint elmSize_in, EGWuint intCap_in, EGWuint flags_in) {
+    memset((void*)table_out, 0, sizeof(egwHashTable));
+    
+    elmSize_in = egwMax2ui(1, elmSize_in);
+    
+    table_out->hFlags = (EGWuint32)flags_in;
+    table_out->eSize = (EGWuint32)elmSize_in;
+    table_out->sMinCount = table_out->sCount = egwHashTableSlotsFor(intCap_in, 0);
+    table_out->sShift = egwHashTableShiftFor(table_out->sCount);
+    
+    if(funcs_in) {
+        if(!(table_out->dFuncs = (egwDataFuncs*)malloc(sizeof(egwDataFuncs)))) { egwHashTableFree(table_out); return NULL; }
+        memcpy((void*)table_out->dFuncs, (const void*)funcs_in, sizeof(egwDataFuncs));
+    }
+    
+    if(!(table_out->sTemp = (EGWbyte*)malloc((size_t)table_out->eSize * 2))) { egwHashTableFree(table_out); return NULL; }
+    
+    {   EGWmallocfp mallocFunc = (table_out->dFuncs && table_out->dFuncs->fpMalloc ? (EGWmallocfp)table_out->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
+        if(!(table_out->rData = (EGWbyte*)mallocFunc((size_t)table_out->eSize * (size_t)table_out->sCount))) { egwHashTableFree(table_out); return NULL; }
+        if(!(table_out->sHashes = (EGWuint32*)mallocFunc(sizeof(EGWuint32) * (size_t)table_out->sCount))) { egwHashTableFree(table_out); return NULL; }
+        memset((void*)table_out->sHashes, 0, sizeof(EGWuint32) * (size_t)table_out->sCount);
+    }
+    
+    return table_out;
+}
+
+egwHashTable* egwHashTableCopy(const egwHashTable* table_in, egwHashTable* table_out) {
+    memset((void*)table_out, 0, sizeof(egwHashTable));
+    
+    if(table_in->hFlags & EGW_HASH_FLG_FREE) // Ownership sharing not permitted
+        return NULL;
+    
+    table_out->hFlags = table_in->hFlags;
+    table_out->eSize = table_in->eSize;
+    table_out->eCount = table_in->eCount;
+    table_out->sMinCount = table_in->sMinCount;
+    table_out->sCount = table_in->sCount;
+    table_out->sShift = table_in->sShift;
+    
+    if(table_in->dFuncs) {
+        if(!(table_out->dFuncs = (egwDataFuncs*)malloc(sizeof(egwDataFuncs)))) { egwHashTableFree(table_out); return NULL; }
+        memcpy((void*)(table_out->dFuncs), (const void*)(table_in->dFuncs), sizeof(egwDataFuncs));
+    }
+    
+    if(!(table_out->sTemp = (EGWbyte*)malloc((size_t)table_out->eSize * 2))) { egwHashTableFree(table_out); return NULL; }
+    
+    {   EGWmallocfp mallocFunc = (table_out->dFuncs && table_out->dFuncs->fpMalloc ? (EGWmallocfp)(table_out->dFuncs->fpMalloc) : (EGWmallocfp)&malloc);
+        if(!(table_out->rData = (EGWbyte*)mallocFunc((size_t)table_out->eSize * (size_t)table_out->sCount))) { egwHashTableFree(table_out); return NULL; }
+        if(!(table_out->sHashes = (EGWuint32*)mallocFunc(sizeof(EGWuint32) * (size_t)table_out->sCount))) { egwHashTableFree(table_out); return NULL; }
+    }
+    
+    memcpy((void*)(table_out->rData), (const void*)(table_in->rData), (size_t)table_out->eSize * (size_t)table_out->sCount);
+    memcpy((void*)(table_out->sHashes), (const void*)(table_in->sHashes), sizeof(EGWuint32) * (size_t)table_out->sCount);
+    
+    if(table_out->hFlags & EGW_HASH_FLG_RETAIN) {
+        EGWuint32 slot = table_out->sCount; while(slot--)
+            if(table_out->sHashes[slot])
+                [(id<NSObject>)*(void**)egwHashTableElm(table_out, slot) retain];
+    }
+    if(table_out->dFuncs && table_out->dFuncs->fpAdd) {
+        EGWuint32 slot = table_out->sCount; while(slot--)
+            if(table_out->sHashes[slot])
+                table_out->dFuncs->fpAdd(egwHashTableElm(table_out, slot));
+    }
+    
+    return table_out;
+}
+
+egwHashTable* egwHashTableFree(egwHashTable* table_inout) {
+    if(table_inout->rData && table_inout->sHashes) {
+        EGWuint32 slot = table_inout->sCount; while(slot--)
+            if(table_inout->sHashes[slot])
+                egwHashTableRemoveHooks(table_inout, egwHashTableElm(table_inout, slot));
+    }
+    
+    {   EGWfreefp freeFunc = (table_inout->dFuncs && table_inout->dFuncs->fpFree ? (EGWfreefp)(table_inout->dFuncs->fpFree) : (EGWfreefp)&free);
+        if(table_inout->rData) freeFunc((void*)(table_inout->rData));
+        if(table_inout->sHashes) freeFunc((void*)(table_inout->sHashes));
+    }
+    
+    if(table_inout->sTemp)
+        free((void*)(table_inout->sTemp));
+    
+    if(table_inout->dFuncs)
+        free((void*)(table_inout->dFuncs));
+    
+    memset((void*)table_inout, 0, sizeof(egwHashTable));
+    
+    return table_inout;
+}
+
+EGWint egwHashTableAdd(egwHashTable* table_inout, const EGWbyte* data_in) {
+    EGWuint32 hash = egwHashTableHashOf(table_inout, data_in);
+    EGWbyte* elm;
+    
+    if(egwHashTableFindSlot(table_inout, hash, data_in) != -1)
+        return 0;
+    
+    if((EGWuint64)(table_inout->eCount + 1) * 8 > (EGWuint64)table_inout->sCount * EGW_HASH_MAXLOADNUM &&
+       !egwHashTableResize(table_inout, (EGWuint)table_inout->sCount << 1))
+        return 0;
+    
+    elm = egwHashTableElm(table_inout, egwHashTableInsertSlot(table_inout, hash, data_in));
+    ++(table_inout->eCount);
+    
+    if(table_inout->hFlags & EGW_HASH_FLG_RETAIN)
+        [(id<NSObject>)*(void**)elm retain];
+    if(table_inout->dFuncs && table_inout->dFuncs->fpAdd)
+        table_inout->dFuncs->fpAdd(elm);
+    
+    return 1;
+}
+
+EGWint egwHashTableRemove(egwHashTable* table_inout, const EGWbyte* data_in) {
+    EGWint found = egwHashTableFindSlot(table_inout, egwHashTableHashOf(table_inout, data_in), data_in);
+    
+    if(found != -1) {
+        EGWuint32 mask = table_inout->sCount - 1;
+        EGWuint32 slot = (EGWuint32)found, next = (slot + 1) & mask;
+        EGWuint32 sHash;
+        
+        egwHashTableRemoveHooks(table_inout, egwHashTableElm(table_inout, slot));
+        
+        // Backward shift deletion, no tombstones are ever left behind
+        while((sHash = table_inout->sHashes[next]) && egwHashTableHome(table_inout, sHash) != next) {
+            memcpy((void*)egwHashTableElm(table_inout, slot), (const void*)egwHashTableElm(table_inout, next), (size_t)(table_inout->eSize));
+            table_inout->sHashes[slot] = sHash;
+            slot = next;
+            next = (next + 1) & mask;
+        }
+        
+        table_inout->sHashes[slot] = 0;
+        --(table_inout->eCount);
+        
+        if(!(table_inout->hFlags & EGW_HASH_FLG_NOSHRINK) && table_inout->sCount > table_inout->sMinCount &&
+           (EGWuint64)table_inout->eCount * 8 < (EGWuint64)table_inout->sCount)
+            egwHashTableResize(table_inout, (EGWuint)table_inout->sCount >> 1); // failure to shrink is benign
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+EGWint egwHashTableRemoveAll(egwHashTable* table_inout) {
+    EGWuint32 slot = table_inout->sCount; while(slot--)
+        if(table_inout->sHashes[slot]) {
+            egwHashTableRemoveHooks(table_inout, egwHashTableElm(table_inout, slot));
+            table_inout->sHashes[slot] = 0;
+        }
+    
+    table_inout->eCount = 0;
+    
+    if(!(table_inout->hFlags & EGW_HASH_FLG_NOSHRINK) && table_inout->sCount > table_inout->sMinCount)
+        return egwHashTableResize(table_inout, (EGWuint)table_inout->sMinCount);
+    
+    return 1;
+}
+
+EGWint egwHashTableGetElement(const egwHashTable* table_in, const EGWbyte* data_in, EGWbyte* data_out) {
+    EGWbyte* elm = egwHashTableFind(table_in, data_in);
+    
+    if(elm) {
+        memcpy((void*)data_out, (const void*)elm, (size_t)(table_in->eSize));
+        return 1;
+    }
+    
+    return 0;
+}
+
+EGWbyte* egwHashTableFind(const egwHashTable* table_in, const EGWbyte* data_in) {
+    EGWint slot = egwHashTableFindSlot(table_in, egwHashTableHashOf(table_in, data_in), data_in);
+    
+    return (slot != -1 ? egwHashTableElm(table_in, slot) : NULL);
+}
+
+EGWint egwHashTableContains(const egwHashTable* table_in, const EGWbyte* data_in) {
+    return (egwHashTableFindSlot(table_in, egwHashTableHashOf(table_in, data_in), data_in) != -1 ? 1 : 0);
+}
+
+EGWint egwHashTableResize(egwHashTable* table_inout, EGWuint newCap_in) {
+    EGWmallocfp mallocFunc = (table_inout->dFuncs && table_inout->dFuncs->fpMalloc ? (EGWmallocfp)(table_inout->dFuncs->fpMalloc) : (EGWmallocfp)&malloc);
+    EGWfreefp freeFunc = (table_inout->dFuncs && table_inout->dFuncs->fpFree ? (EGWfreefp)(table_inout->dFuncs->fpFree) : (EGWfreefp)&free);
+    egwHashTable resized;
+    EGWuint32 slot;
+    
+    memcpy((void*)&resized, (const void*)table_inout, sizeof(egwHashTable));
+    resized.sCount = egwHashTableSlotsFor(table_inout->eCount, egwMax2ui(newCap_in, table_inout->sMinCount));
+    resized.sShift = egwHashTableShiftFor(resized.sCount);
+    
+    if(resized.sCount == table_inout->sCount)
+        return 1;
+    
+    if(!(resized.rData = (EGWbyte*)mallocFunc((size_t)resized.eSize * (size_t)resized.sCount)))
+        return 0;
+    if(!(resized.sHashes = (EGWuint32*)mallocFunc(sizeof(EGWuint32) * (size_t)resized.sCount))) {
+        freeFunc((void*)(resized.rData));
+        return 0;
+    }
+    memset((void*)resized.sHashes, 0, sizeof(EGWuint32) * (size_t)resized.sCount);
+    
+    for(slot = 0; slot < table_inout->sCount; ++slot)
+        if(table_inout->sHashes[slot])
+            egwHashTableInsertSlot(&resized, table_inout->sHashes[slot], egwHashTableElm(table_inout, slot));
+    
+    freeFunc((void*)(table_inout->rData));
+    freeFunc((void*)(table_inout->sHashes));
+    
+    table_inout->rData = resized.rData;
+    table_inout->sHashes = resized.sHashes;
+    table_inout->sCount = resized.sCount;
+    table_inout->sShift = resized.sShift;
+    
+    return 1;
+}
+
+EGWint egwHashTableEnumerateStart(const egwHashTable* table_in, EGWuint iterMode_in, egwHashTableIter* iter_out) {
+    if(table_in->eCount) {
+        iter_out->pTable = table_in;
+        iter_out->iMode = iterMode_in & EGW_ITERATE_MODE_EXLIN;
+        iter_out->eIndex = -1;
+        
+        switch(iter_out->iMode) {
+            case EGW_ITERATE_MODE_LINHTT: {
+                iter_out->sIndex = 0;
+                while(!table_in->sHashes[iter_out->sIndex])
+                    ++(iter_out->sIndex);
+            } break;
+            
+            case EGW_ITERATE_MODE_LINTTH: {
+                iter_out->sIndex = (EGWint32)table_in->sCount - 1;
+                while(!table_in->sHashes[iter_out->sIndex])
+                    --(iter_out->sIndex);
+            } break;
+            
+            default: {
+                iter_out->sIndex = -1;
+                return 0;
+            } break;
+        }
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+EGWint egwHashTableEnumerateGetNext(egwHashTableIter* iter_inout, EGWbyte* data_out) {
+    EGWbyte* data = egwHashTableEnumerateNextPtr(iter_inout);
+    
+    if(data) {
+        memcpy((void*)data_out, (const void*)data, (size_t)(iter_inout->pTable->eSize));
+        return 1;
+    } else
+        return 0;
+}
+
+EGWbyte* egwHashTableEnumerateNextPtr(egwHashTableIter* iter_inout) {
+    if(iter_inout->sIndex != -1) {
+        const egwHashTable* table = iter_inout->pTable;
+        EGWbyte* retVal = egwHashTableElm(table, iter_inout->sIndex);
+        
+        if(++(iter_inout->eIndex) < table->eCount - 1) {
+            switch(iter_inout->iMode) {
+                case EGW_ITERATE_MODE_LINHTT: {
+                    do { ++(iter_inout->sIndex); } while(!table->sHashes[iter_inout->sIndex]);
+                } break;
+                
+                case EGW_ITERATE_MODE_LINTTH: {
+                    do { --(iter_inout->sIndex); } while(!table->sHashes[iter_inout->sIndex]);
+                } break;
+            }
+        } else
+            iter_inout->sIndex = -1;
+        
+        return retVal;
+    }
+    
+    return NULL;
+}
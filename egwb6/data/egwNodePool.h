@@ -0,0 +1,74 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @defgroup geWizES_data_nodepool egwNodePool
+/// @ingroup geWizES_data
+/// Node Pool.
+/// @{
+
+/// @file egwNodePool.h
+/// Node Pool Interface.
+
+#import "egwDataTypes.h"
+
+
+// !!!: ***** Initialization *****
+
+/// Node Pool Initialization Routine.
+/// Initializes node pool with provided parameters.
+/// @note No slab is allocated until the first node is.
+/// @note Slabs are kept when their nodes are deallocated, memory is only returned to the system by egwNodePoolTrim() or egwNodePoolFree().
+/// @param [out] pool_out Node pool output of initialization.
+/// @param [in] nodeSize_in Node size (bytes), rounded up to keep nodes 16 byte aligned.
+/// @param [in] slabNodes_in Node count of the first slab (>0, doubles per slab up to EGW_NODEPOOL_MAXSLABNODES).
+/// @return @a pool_out (for nesting), otherwise NULL if failure initializing.
+egwNodePool* egwNodePoolInit(egwNodePool* pool_out, EGWuint nodeSize_in, EGWuint slabNodes_in);
+
+/// Node Pool Free Routine.
+/// Frees the contents of the node pool, invalidating all nodes allocated from it.
+/// @param [in,out] pool_inout Node pool input/output structure.
+/// @return @a pool_inout (for nesting), otherwise NULL if failure free'ing.
+egwNodePool* egwNodePoolFree(egwNodePool* pool_inout);
+
+
+// !!!: ***** Allocation *****
+
+/// Node Pool Allocation Routine.
+/// Allocates a node from the node pool at O(1) cost, allocating a new slab if the free chain is empty.
+/// @param [in,out] pool_inout Node pool input/output structure.
+/// @return Node pointer (contents undefined), otherwise NULL if failure allocating.
+EGWbyte* egwNodePoolAlloc(egwNodePool* pool_inout);
+
+/// Node Pool Deallocation Routine.
+/// Releases a node back onto the node pool's free chain at O(1) cost.
+/// @param [in,out] pool_inout Node pool input/output structure.
+/// @param [in] node_in Node pointer (previously allocated from @a pool_inout).
+void egwNodePoolDealloc(egwNodePool* pool_inout, EGWbyte* node_in);
+
+/// Node Pool Trim Routine.
+/// Releases every slab that has no allocated nodes back to the system.
+/// @note Costs O(free nodes * slabs), intended for after bulk removals rather than per deallocation.
+/// @param [in,out] pool_inout Node pool input/output structure.
+/// @return Number of slabs released.
+EGWuint egwNodePoolTrim(egwNodePool* pool_inout);
+
+/// @}
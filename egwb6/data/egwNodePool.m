@@ -0,0 +1,142 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file egwNodePool.m
+/// @ingroup geWizES_data_nodepool
+/// Node Pool Implementation.
+
+#import <stdlib.h>
+#import <string.h>
+#import "egwNodePool.h"
+
+
+// NOTE: Slabs lead with a 16 byte header holding the next slab link so that nodes keep the same alignment malloc() would have given them. -jw
+#define EGW_NODEPOOL_SLABHDRSIZE    16
+#define EGW_NODEPOOL_SLABNEXT(slab) (*(EGWbyte**)(slab))
+#define EGW_NODEPOOL_SLABNODES(slab) (((EGWuint32*)((EGWuintptr)(slab) + (EGWuintptr)sizeof(EGWbyte*)))[0])
+#define EGW_NODEPOOL_SLABFREES(slab) (((EGWuint32*)((EGWuintptr)(slab) + (EGWuintptr)sizeof(EGWbyte*)))[1])
+
+
+static EGWbyte* egwNodePoolSlabOf(egwNodePool* pool_in, EGWbyte* node_in) {
+    EGWbyte* slab = pool_in->sHead;
+    
+    while(slab && !((EGWuintptr)node_in > (EGWuintptr)slab &&
+                    (EGWuintptr)node_in < (EGWuintptr)slab + (EGWuintptr)EGW_NODEPOOL_SLABHDRSIZE + ((EGWuintptr)EGW_NODEPOOL_SLABNODES(slab) * (EGWuintptr)pool_in->nSize)))
+        slab = EGW_NODEPOOL_SLABNEXT(slab);
+    
+    return slab;
+}
+
+
+egwNodePool* egwNodePoolInit(egwNodePool* pool_out, EGWuint nodeSize_in, EGWuint slabNodes_in) {
+    memset((void*)pool_out, 0, sizeof(egwNodePool));
+    
+    if(!nodeSize_in || !slabNodes_in) return NULL;
+    
+    pool_out->nSize = (EGWuint32)((nodeSize_in + 15) & ~15);
+    pool_out->sNodes = (EGWuint32)(slabNodes_in <= EGW_NODEPOOL_MAXSLABNODES ? slabNodes_in : EGW_NODEPOOL_MAXSLABNODES);
+    
+    return pool_out;
+}
+
+egwNodePool* egwNodePoolFree(egwNodePool* pool_inout) {
+    while(pool_inout->sHead) {
+        EGWbyte* slab = pool_inout->sHead;
+        pool_inout->sHead = EGW_NODEPOOL_SLABNEXT(slab);
+        free((void*)slab);
+    }
+    
+    memset((void*)pool_inout, 0, sizeof(egwNodePool));
+    
+    return pool_inout;
+}
+
+EGWbyte* egwNodePoolAlloc(egwNodePool* pool_inout) {
+    EGWbyte* node;
+    
+    if(!pool_inout->fHead) {
+        EGWbyte* slab;
+        EGWuint nIndex;
+        
+        if(!(slab = (EGWbyte*)malloc((size_t)EGW_NODEPOOL_SLABHDRSIZE + ((size_t)pool_inout->nSize * (size_t)pool_inout->sNodes)))) return NULL;
+        
+        EGW_NODEPOOL_SLABNEXT(slab) = pool_inout->sHead;
+        EGW_NODEPOOL_SLABNODES(slab) = pool_inout->sNodes;
+        pool_inout->sHead = slab;
+        
+        // Chain in reverse so nodes are handed out in address order
+        for(nIndex = pool_inout->sNodes; nIndex--;) {
+            node = (EGWbyte*)((EGWuintptr)slab + (EGWuintptr)EGW_NODEPOOL_SLABHDRSIZE + ((EGWuintptr)nIndex * (EGWuintptr)pool_inout->nSize));
+            *(EGWbyte**)node = pool_inout->fHead;
+            pool_inout->fHead = node;
+        }
+        
+        if(pool_inout->sNodes < EGW_NODEPOOL_MAXSLABNODES)
+            pool_inout->sNodes = (pool_inout->sNodes << 1 <= EGW_NODEPOOL_MAXSLABNODES ? pool_inout->sNodes << 1 : EGW_NODEPOOL_MAXSLABNODES);
+    }
+    
+    node = pool_inout->fHead;
+    pool_inout->fHead = *(EGWbyte**)node;
+    
+    return node;
+}
+
+void egwNodePoolDealloc(egwNodePool* pool_inout, EGWbyte* node_in) {
+    *(EGWbyte**)node_in = pool_inout->fHead;
+    pool_inout->fHead = node_in;
+}
+
+EGWuint egwNodePoolTrim(egwNodePool* pool_inout) {
+    EGWbyte** slabLink;
+    EGWbyte** nodeLink;
+    EGWbyte* slab;
+    EGWbyte* node;
+    EGWuint freed = 0;
+    
+    if(!pool_inout->fHead) return 0;
+    
+    // Tally free nodes per slab, slabs whose every node is free hold no live nodes
+    for(slab = pool_inout->sHead; slab; slab = EGW_NODEPOOL_SLABNEXT(slab))
+        EGW_NODEPOOL_SLABFREES(slab) = 0;
+    for(node = pool_inout->fHead; node; node = *(EGWbyte**)node)
+        if((slab = egwNodePoolSlabOf(pool_inout, node))) ++EGW_NODEPOOL_SLABFREES(slab);
+    
+    // Unchain nodes of empty slabs before the slabs themselves go away
+    for(nodeLink = &pool_inout->fHead; (node = *nodeLink);) {
+        slab = egwNodePoolSlabOf(pool_inout, node);
+        if(slab && EGW_NODEPOOL_SLABFREES(slab) == EGW_NODEPOOL_SLABNODES(slab))
+            *nodeLink = *(EGWbyte**)node;
+        else
+            nodeLink = (EGWbyte**)node;
+    }
+    
+    for(slabLink = &pool_inout->sHead; (slab = *slabLink);) {
+        if(EGW_NODEPOOL_SLABFREES(slab) == EGW_NODEPOOL_SLABNODES(slab)) {
+            *slabLink = EGW_NODEPOOL_SLABNEXT(slab);
+            free((void*)slab);
+            ++freed;
+        } else
+            slabLink = &EGW_NODEPOOL_SLABNEXT(slab);
+    }
+    
+    return freed;
+}
@@ -26,6 +26,7 @@
 
 #import <string.h>
 #import "egwRedBlackTree.h"
+#import "egwNodePool.h"
 #import "../data/egwCyclicArray.h"
 #import "../math/egwMath.h"
 
@@ -33,12 +34,29 @@
 #define EGW_RBTREE_SIBLING(n) ((n) == (n)->parent->left ? (n)->parent->right : (n)->parent->left)
 #define EGW_RBTREE_UNCLE(n) ((n)->parent == (n)->parent->parent->left ? (n)->parent->parent->right : (n)->parent->parent->left)
 
-static void egwRBTreeCopyRecurse(egwRedBlackTree* tree_inout, EGWmallocfp mallocFunc, EGWelementfp addFunc, egwRedBlackTreeNode* nodeSrc_inout, egwRedBlackTreeNode* nodeDst_inout) {
+static egwRedBlackTreeNode* egwRBTreeAllocNode(egwRedBlackTree* tree_inout) {
+    if(tree_inout->nPool.nSize)
+        return (egwRedBlackTreeNode*)egwNodePoolAlloc(&tree_inout->nPool);
+    else if(tree_inout->dFuncs && tree_inout->dFuncs->fpMalloc)
+        return (egwRedBlackTreeNode*)tree_inout->dFuncs->fpMalloc(((size_t)tree_inout->eSize + sizeof(egwRedBlackTreeNode)));
+    return (egwRedBlackTreeNode*)malloc(((size_t)tree_inout->eSize + sizeof(egwRedBlackTreeNode)));
+}
+
+static void egwRBTreeFreeNode(egwRedBlackTree* tree_inout, egwRedBlackTreeNode* node_inout) {
+    if(tree_inout->nPool.nSize)
+        egwNodePoolDealloc(&tree_inout->nPool, (EGWbyte*)node_inout);
+    else if(tree_inout->dFuncs && tree_inout->dFuncs->fpFree)
+        tree_inout->dFuncs->fpFree((void*)node_inout);
+    else
+        free((void*)node_inout);
+}
+
+static void egwRBTreeCopyRecurse(egwRedBlackTree* tree_inout, EGWelementfp addFunc, egwRedBlackTreeNode* nodeSrc_inout, egwRedBlackTreeNode* nodeDst_inout) {
     if(tree_inout->tRoot && nodeSrc_inout->left) {
         egwRedBlackTreeNode* newNode = NULL;
         EGWuintptr data = 0;
         
-        if(!(newNode = (egwRedBlackTreeNode*)mallocFunc(((size_t)tree_inout->eSize + (size_t)sizeof(egwRedBlackTreeNode))))) { egwRBTreeFree(tree_inout); return; }
+        if(!(newNode = egwRBTreeAllocNode(tree_inout))) { egwRBTreeFree(tree_inout); return; }
         memset((void*)newNode, 0, ((size_t)tree_inout->eSize + (size_t)sizeof(egwRedBlackTreeNode)));
         
         ++tree_inout->eCount;
@@ -55,14 +73,14 @@ static void egwRBTreeCopyRecurse(egwRedBlackTree* tree_inout, EGWmallocfp malloc
         if(addFunc)
             addFunc((EGWbyte*)data);
         
-        egwRBTreeCopyRecurse(tree_inout, mallocFunc, addFunc, nodeSrc_inout->left, nodeDst_inout->left);
+        egwRBTreeCopyRecurse(tree_inout, addFunc, nodeSrc_inout->left, nodeDst_inout->left);
     }
     
     if(tree_inout->tRoot && nodeSrc_inout->right) {
         egwRedBlackTreeNode* newNode = NULL;
         EGWuintptr data = 0;
         
-        if(!(newNode = (egwRedBlackTreeNode*)mallocFunc(((size_t)tree_inout->eSize + (size_t)sizeof(egwRedBlackTreeNode))))) { egwRBTreeFree(tree_inout); return; }
+        if(!(newNode = egwRBTreeAllocNode(tree_inout))) { egwRBTreeFree(tree_inout); return; }
         memset((void*)newNode, 0, ((size_t)tree_inout->eSize + (size_t)sizeof(egwRedBlackTreeNode)));
         
         ++tree_inout->eCount;
@@ -79,14 +97,14 @@ static void egwRBTreeCopyRecurse(egwRedBlackTree* tree_inout, EGWmallocfp malloc
         if(addFunc)
             addFunc((EGWbyte*)data);
         
-        egwRBTreeCopyRecurse(tree_inout, mallocFunc, addFunc, nodeSrc_inout->right, nodeDst_inout->right);
+        egwRBTreeCopyRecurse(tree_inout, addFunc, nodeSrc_inout->right, nodeDst_inout->right);
     }
 }
 
-static void egwRBTreeFreeRecurse(egwRedBlackTree* tree_inout, EGWfreefp freeFunc, egwRedBlackTreeNode* node_inout) {
+static void egwRBTreeFreeRecurse(egwRedBlackTree* tree_inout, egwRedBlackTreeNode* node_inout) {
     if(node_inout) {
-        egwRBTreeFreeRecurse(tree_inout, freeFunc, node_inout->left);
-        egwRBTreeFreeRecurse(tree_inout, freeFunc, node_inout->right);
+        egwRBTreeFreeRecurse(tree_inout, node_inout->left);
+        egwRBTreeFreeRecurse(tree_inout, node_inout->right);
         
         if(tree_inout->dFuncs && tree_inout->dFuncs->fpRemove)
             tree_inout->dFuncs->fpRemove((EGWbyte*)((EGWuintptr)node_inout + (EGWuintptr)sizeof(egwRedBlackTreeNode)));
@@ -95,7 +113,7 @@ static void egwRBTreeFreeRecurse(egwRedBlackTree* tree_inout, EGWfreefp freeFunc
         if(tree_inout->tFlags & EGW_TREE_FLG_FREE)
             free((void*)*(void**)((EGWuintptr)node_inout + (EGWuintptr)sizeof(egwRedBlackTreeNode)));
         
-        freeFunc(node_inout);
+        egwRBTreeFreeNode(tree_inout, node_inout);
     }
 }
 
@@ -423,6 +441,10 @@ egwRedBlackTree* egwRBTreeInit(egwRedBlackTree* tree_out, egwDataFuncs* funcs_in
         memcpy((void*)tree_out->dFuncs, (const void*)funcs_in, sizeof(egwDataFuncs));
     }
     
+    if(!(tree_out->tFlags & EGW_TREE_FLG_NOPOOL) && !(tree_out->dFuncs && (tree_out->dFuncs->fpMalloc || tree_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&tree_out->nPool, (EGWuint)tree_out->eSize + (EGWuint)sizeof(egwRedBlackTreeNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwRBTreeFree(tree_out); return NULL; }
+    }
+    
     return tree_out;
 }
 
@@ -437,14 +459,17 @@ egwRedBlackTree* egwRBTreeCopy(const egwRedBlackTree* tree_in, egwRedBlackTree*
         memcpy((void*)tree_out->dFuncs, (const void*)tree_in->dFuncs, sizeof(egwDataFuncs));
     }
     
+    if(!(tree_out->tFlags & EGW_TREE_FLG_NOPOOL) && !(tree_out->dFuncs && (tree_out->dFuncs->fpMalloc || tree_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&tree_out->nPool, (EGWuint)tree_out->eSize + (EGWuint)sizeof(egwRedBlackTreeNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwRBTreeFree(tree_out); return NULL; }
+    }
+    
     if(tree_in->eCount) {
         // Have to create the root node first before the recursive call to copy
-        EGWmallocfp mallocFunc = (tree_out->dFuncs && tree_out->dFuncs->fpMalloc ? (EGWmallocfp)tree_out->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
         EGWelementfp addFunc = (tree_out->dFuncs && tree_out->dFuncs->fpAdd ? (EGWelementfp)tree_out->dFuncs->fpAdd : (EGWelementfp)NULL);
         egwRedBlackTreeNode* newNode = NULL;
         EGWuintptr data = 0;
         
-        if(!(newNode = (egwRedBlackTreeNode*)mallocFunc(((size_t)tree_out->eSize + (size_t)sizeof(egwRedBlackTreeNode))))) { egwRBTreeFree(tree_out); return NULL; }
+        if(!(newNode = egwRBTreeAllocNode(tree_out))) { egwRBTreeFree(tree_out); return NULL; }
         memset((void*)newNode, 0, ((size_t)tree_out->eSize + (size_t)sizeof(egwRedBlackTreeNode)));
         
         ++tree_out->eCount;
@@ -460,7 +485,7 @@ egwRedBlackTree* egwRBTreeCopy(const egwRedBlackTree* tree_in, egwRedBlackTree*
         if(addFunc)
             addFunc((EGWbyte*)data);
         
-        egwRBTreeCopyRecurse(tree_out, mallocFunc, addFunc, tree_in->tRoot, tree_out->tRoot);
+        egwRBTreeCopyRecurse(tree_out, addFunc, tree_in->tRoot, tree_out->tRoot);
         
         if(!tree_out->tRoot)
             return NULL;
@@ -470,9 +495,9 @@ egwRedBlackTree* egwRBTreeCopy(const egwRedBlackTree* tree_in, egwRedBlackTree*
 }
 
 egwRedBlackTree* egwRBTreeFree(egwRedBlackTree* tree_inout) {
-    EGWfreefp freeFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpFree ? (EGWfreefp)tree_inout->dFuncs->fpFree : (EGWfreefp)&free);
+    egwRBTreeFreeRecurse(tree_inout, tree_inout->tRoot);
     
-    egwRBTreeFreeRecurse(tree_inout, freeFunc, tree_inout->tRoot);
+    egwNodePoolFree(&tree_inout->nPool);
     
     if(tree_inout->dFuncs)
         free((void*)(tree_inout->dFuncs));
@@ -486,8 +511,7 @@ EGWint egwRBTreeAdd(egwRedBlackTree* tree_inout, const EGWbyte* data_in) {
     egwRedBlackTreeNode* newNode = NULL;
     EGWcomparefp compareFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpCompare ? (EGWcomparefp)tree_inout->dFuncs->fpCompare : (EGWcomparefp)&memcmp);
     
-    {   EGWmallocfp mallocFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpMalloc ? (EGWmallocfp)tree_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-        if(!(newNode = (egwRedBlackTreeNode*)mallocFunc(((size_t)tree_inout->eSize + (size_t)sizeof(egwRedBlackTreeNode))))) { return 0; }
+    {   if(!(newNode = egwRBTreeAllocNode(tree_inout))) { return 0; }
         memset((void*)newNode, 0, ((size_t)tree_inout->eSize + (size_t)sizeof(egwRedBlackTreeNode)));
     }
     
@@ -576,9 +600,7 @@ EGWint egwRBTreeRemove(egwRedBlackTree* tree_inout, egwRedBlackTreeNode* node_in
     if(child && !node_inout->parent)
         child->nFlags = EGW_RBTNODE_FLG_BLACKNODE;
     
-    {   EGWfreefp freeFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpFree ? (EGWfreefp)(tree_inout->dFuncs->fpFree) : (EGWfreefp)&free);
-        freeFunc((void*)node_inout);
-    }
+    egwRBTreeFreeNode(tree_inout, node_inout);
     
     --tree_inout->eCount;
     
@@ -598,9 +620,7 @@ EGWuint egwRBTreeRemoveAny(egwRedBlackTree* tree_inout, const EGWbyte* data_in)
 }
 
 EGWint egwRBTreeRemoveAll(egwRedBlackTree* tree_inout) {
-    EGWfreefp freeFunc = (tree_inout->dFuncs && tree_inout->dFuncs->fpFree ? (EGWfreefp)(tree_inout->dFuncs->fpFree) : (EGWfreefp)&free);
-    
-    egwRBTreeFreeRecurse(tree_inout, freeFunc, tree_inout->tRoot);
+    egwRBTreeFreeRecurse(tree_inout, tree_inout->tRoot);
     
     tree_inout->eCount = 0;
     tree_inout->tRoot = NULL;
@@ -0,0 +1,98 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @defgroup geWizES_data_requestring egwRequestRing
+/// @ingroup geWizES_data
+/// Request Ring.
+/// @{
+
+/// @file egwRequestRing.h
+/// Request Ring Interface.
+
+#import "egwDataTypes.h"
+
+
+// !!!: ***** Initialization *****
+
+/// Request Ring Initialization Routine.
+/// Initializes request ring with provided parameters.
+/// @note Capacity is rounded up to the next power of two. Requests that do not fit spill onto a locked overflow list rather than being dropped.
+/// @param [out] ring_out Request ring output of initialization.
+/// @param [in] elmSize_in Element size (bytes).
+/// @param [in] intCap_in Ring capacity (>0).
+/// @param [in] flags_in Ring attribute flags (EGW_ARRAY_FLG_RETAIN only).
+/// @return @a ring_out (for nesting), otherwise NULL if failure initializing.
+egwRequestRing* egwReqRingInit(egwRequestRing* ring_out, EGWuint elmSize_in, EGWuint intCap_in, EGWuint flags_in);
+
+/// Request Ring Free Routine.
+/// Frees the contents of the request ring, releasing any requests still enqueued.
+/// @param [in,out] ring_inout Request ring input/output structure.
+/// @return @a ring_inout (for nesting), otherwise NULL if failure free'ing.
+egwRequestRing* egwReqRingFree(egwRequestRing* ring_inout);
+
+
+// !!!: ***** Addition *****
+
+/// Request Ring Enqueue Routine.
+/// Enqueues a request into the ring without locking, spilling onto the locked overflow list if the ring is full.
+/// @note This routine is safe to call from multiple threads at once.
+/// @note If the ring retains, the request's first pointer is retained here and ownership passes to the dequeuer.
+/// @param [in,out] ring_inout Request ring input/output structure.
+/// @param [in] data_in Element data buffer (contents copy-over).
+/// @return 1 upon success (either ring or overflow), otherwise 0 upon failure.
+EGWint egwReqRingEnqueue(egwRequestRing* ring_inout, const EGWbyte* data_in);
+
+
+// !!!: ***** Removal *****
+
+/// Request Ring Dequeue Routine.
+/// Dequeues a batch of requests in enqueue order, draining the ring and then any overflow list.
+/// @note This routine must only be called from a single consumer thread. The overflow list is only tried (non-blocking) once the ring is empty.
+/// @note If the ring retains, the caller owns each dequeued request's first pointer and must release it once handled.
+/// @param [in,out] ring_inout Request ring input/output structure.
+/// @param [out] data_out Element data buffer array (at least @a maxCount_in elements).
+/// @param [in] maxCount_in Maximum number of requests to dequeue.
+/// @return Number of requests dequeued.
+EGWuint egwReqRingDequeue(egwRequestRing* ring_inout, EGWbyte* data_out, EGWuint maxCount_in);
+
+
+// !!!: ***** Metrics *****
+
+/// Request Ring Empty Check Routine.
+/// Determines if the ring and its overflow list are (momentarily) empty.
+/// @param [in] ring_in Request ring input structure.
+/// @return 1 if empty, otherwise 0.
+EGWint egwReqRingIsEmpty(const egwRequestRing* ring_in);
+
+/// Request Ring Overflows Routine.
+/// Returns the total number of requests that have spilled onto the overflow list.
+/// @param [in] ring_in Request ring input structure.
+/// @return Overflowed request count.
+EGWuint egwReqRingOverflows(const egwRequestRing* ring_in);
+
+/// Request Ring Peak Count Routine.
+/// Returns the largest ring occupancy seen at the start of a dequeue.
+/// @param [in] ring_in Request ring input structure.
+/// @return Peak ring occupancy count.
+EGWuint egwReqRingPeakCount(const egwRequestRing* ring_in);
+
+/// @}
@@ -0,0 +1,184 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file egwRequestRing.m
+/// @ingroup geWizES_data_requestring
+/// Request Ring Implementation.
+
+#import <libkern/OSAtomic.h>
+#import "egwRequestRing.h"
+#import "egwCyclicArray.h"
+#import "../math/egwMath.h"
+
+
+// NOTE: Each slot leads with a sequence stamp that tells producers and the consumer whose turn the slot is on (bounded MPSC queue with per-slot sequencing). Element data starts 8 bytes in to keep pointers aligned. -jw
+#define EGW_REQRING_SLOTSEQ(ring, pos)      ((volatile EGWuint32*)((EGWuintptr)((ring)->rData) + ((EGWuintptr)((pos) & (ring)->sMask) * (EGWuintptr)((ring)->sSize))))
+#define EGW_REQRING_SLOTDATA(ring, pos)     ((EGWbyte*)((EGWuintptr)((ring)->rData) + ((EGWuintptr)((pos) & (ring)->sMask) * (EGWuintptr)((ring)->sSize)) + (EGWuintptr)8))
+
+
+static EGWuint egwReqRingPop(egwRequestRing* ring_inout, EGWbyte* data_out, EGWuint maxCount_in) {
+    EGWuint count = 0;
+    
+    {   EGWuint32 occupancy = ring_inout->pHead - ring_inout->cTail;
+        if(occupancy > ring_inout->pCount && occupancy <= ring_inout->sMask + 1)
+            ring_inout->pCount = occupancy;
+    }
+    
+    while(count < maxCount_in) {
+        volatile EGWuint32* seq = EGW_REQRING_SLOTSEQ(ring_inout, ring_inout->cTail);
+        
+        if((EGWint32)(*seq - (ring_inout->cTail + 1)) < 0)
+            break; // empty, or producer claimed but not yet published
+        
+        OSMemoryBarrier();
+        memcpy((void*)((EGWuintptr)data_out + ((EGWuintptr)count * (EGWuintptr)ring_inout->eSize)), (const void*)EGW_REQRING_SLOTDATA(ring_inout, ring_inout->cTail), (size_t)ring_inout->eSize);
+        OSMemoryBarrier();
+        
+        *seq = ring_inout->cTail + ring_inout->sMask + 1; // hand slot back to producers one lap ahead
+        ++ring_inout->cTail;
+        ++count;
+    }
+    
+    return count;
+}
+
+egwRequestRing* egwReqRingInit(egwRequestRing* ring_out, EGWuint elmSize_in, EGWuint intCap_in, EGWuint flags_in) {
+    EGWuint32 slotCount = 1;
+    EGWuint32 index;
+    
+    memset((void*)ring_out, 0, sizeof(egwRequestRing));
+    
+    elmSize_in = (EGWuint)egwMax2i(1, (EGWint)elmSize_in);
+    while(slotCount < (EGWuint32)intCap_in && slotCount < 0x40000000) slotCount <<= 1;
+    
+    ring_out->aFlags = (EGWuint32)(flags_in & EGW_ARRAY_FLG_RETAIN);
+    ring_out->eSize = (EGWuint32)elmSize_in;
+    ring_out->sSize = (EGWuint32)((8 + elmSize_in + 7) & ~7);
+    ring_out->sMask = slotCount - 1;
+    
+    if(pthread_mutex_init(&ring_out->oLock, NULL)) { return NULL; }
+    if(!(ring_out->rData = (EGWbyte*)malloc((size_t)ring_out->sSize * (size_t)slotCount))) { pthread_mutex_destroy(&ring_out->oLock); return NULL; }
+    if(!(egwCycArrayInit(&ring_out->oList, NULL, elmSize_in, 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100 | EGW_ARRAY_FLG_SHRNKBY2X | EGW_ARRAY_FLG_SHRKCND25)))) { egwReqRingFree(ring_out); return NULL; }
+    
+    for(index = 0; index < slotCount; ++index)
+        *EGW_REQRING_SLOTSEQ(ring_out, index) = index;
+    
+    return ring_out;
+}
+
+egwRequestRing* egwReqRingFree(egwRequestRing* ring_inout) {
+    if(ring_inout->rData) {
+        if(ring_inout->aFlags & EGW_ARRAY_FLG_RETAIN) {
+            EGWbyte* data = (EGWbyte*)malloc((size_t)ring_inout->eSize);
+            
+            if(data) {
+                while(egwReqRingDequeue(ring_inout, data, 1))
+                    [(id<NSObject>)*(void**)data release];
+                free((void*)data);
+            }
+        }
+        
+        free((void*)(ring_inout->rData));
+        ring_inout->rData = NULL;
+        
+        egwCycArrayFree(&ring_inout->oList);
+        pthread_mutex_destroy(&ring_inout->oLock);
+    }
+    
+    memset((void*)ring_inout, 0, sizeof(egwRequestRing));
+    
+    return ring_inout;
+}
+
+EGWint egwReqRingEnqueue(egwRequestRing* ring_inout, const EGWbyte* data_in) {
+    if(ring_inout->aFlags & EGW_ARRAY_FLG_RETAIN)
+        [(id<NSObject>)*(void**)data_in retain];
+    
+    // NOTE: Once anything has spilled, all producers spill until the consumer empties the overflow list, otherwise a later request could overtake an earlier spilled one. -jw
+    if(!ring_inout->oSpill) {
+        EGWuint32 pos = ring_inout->pHead;
+        
+        while(1) {
+            EGWint32 diff = (EGWint32)(*EGW_REQRING_SLOTSEQ(ring_inout, pos) - pos);
+            
+            if(diff == 0) {
+                if(OSAtomicCompareAndSwap32Barrier((int32_t)pos, (int32_t)(pos + 1), (volatile int32_t*)&ring_inout->pHead)) {
+                    memcpy((void*)EGW_REQRING_SLOTDATA(ring_inout, pos), (const void*)data_in, (size_t)ring_inout->eSize);
+                    OSMemoryBarrier();
+                    *EGW_REQRING_SLOTSEQ(ring_inout, pos) = pos + 1; // publish to consumer
+                    return 1;
+                }
+                pos = ring_inout->pHead;
+            } else if(diff < 0)
+                break; // full
+            else
+                pos = ring_inout->pHead;
+        }
+    }
+    
+    pthread_mutex_lock(&ring_inout->oLock);
+    if(!egwCycArrayAddTail(&ring_inout->oList, data_in)) {
+        pthread_mutex_unlock(&ring_inout->oLock);
+        if(ring_inout->aFlags & EGW_ARRAY_FLG_RETAIN)
+            [(id<NSObject>)*(void**)data_in release];
+        return 0;
+    }
+    ring_inout->oSpill = 1;
+    OSAtomicIncrement32Barrier((volatile int32_t*)&ring_inout->oCount);
+    pthread_mutex_unlock(&ring_inout->oLock);
+    
+    return 1;
+}
+
+EGWuint egwReqRingDequeue(egwRequestRing* ring_inout, EGWbyte* data_out, EGWuint maxCount_in) {
+    EGWuint count = egwReqRingPop(ring_inout, data_out, maxCount_in);
+    
+    if(count < maxCount_in && ring_inout->oSpill && pthread_mutex_trylock(&ring_inout->oLock) == 0) {
+        // NOTE: Ring is re-drained under lock first since anything a producer published there before spilling must come out ahead of its spill. -jw
+        count += egwReqRingPop(ring_inout, (EGWbyte*)((EGWuintptr)data_out + ((EGWuintptr)count * (EGWuintptr)ring_inout->eSize)), maxCount_in - count);
+        
+        while(count < maxCount_in && ring_inout->oList.eCount) {
+            egwCycArrayGetElementHead(&ring_inout->oList, (EGWbyte*)((EGWuintptr)data_out + ((EGWuintptr)count * (EGWuintptr)ring_inout->eSize)));
+            egwCycArrayRemoveHead(&ring_inout->oList);
+            ++count;
+        }
+        
+        if(!ring_inout->oList.eCount)
+            ring_inout->oSpill = 0;
+        
+        pthread_mutex_unlock(&ring_inout->oLock);
+    }
+    
+    return count;
+}
+
+EGWint egwReqRingIsEmpty(const egwRequestRing* ring_in) {
+    return ((EGWint32)(*EGW_REQRING_SLOTSEQ(ring_in, ring_in->cTail) - (ring_in->cTail + 1)) < 0 && !ring_in->oSpill ? 1 : 0);
+}
+
+EGWuint egwReqRingOverflows(const egwRequestRing* ring_in) {
+    return (EGWuint)ring_in->oCount;
+}
+
+EGWuint egwReqRingPeakCount(const egwRequestRing* ring_in) {
+    return (EGWuint)ring_in->pCount;
+}
@@ -26,8 +26,26 @@
 
 #import <string.h>
 #import "egwSinglyLinkedList.h"
+#import "egwNodePool.h"
 
 
+static egwSinglyLinkedListNode* egwSLListAllocNode(egwSinglyLinkedList* list_inout) {
+    if(list_inout->nPool.nSize)
+        return (egwSinglyLinkedListNode*)egwNodePoolAlloc(&list_inout->nPool);
+    else if(list_inout->dFuncs && list_inout->dFuncs->fpMalloc)
+        return (egwSinglyLinkedListNode*)list_inout->dFuncs->fpMalloc(((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode)));
+    return (egwSinglyLinkedListNode*)malloc(((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode)));
+}
+
+static void egwSLListFreeNode(egwSinglyLinkedList* list_inout, egwSinglyLinkedListNode* node_inout) {
+    if(list_inout->nPool.nSize)
+        egwNodePoolDealloc(&list_inout->nPool, (EGWbyte*)node_inout);
+    else if(list_inout->dFuncs && list_inout->dFuncs->fpFree)
+        list_inout->dFuncs->fpFree((void*)node_inout);
+    else
+        free((void*)node_inout);
+}
+
 static egwSinglyLinkedListNode* egwSLListSortMerge(egwSinglyLinkedList* list_inout, egwSinglyLinkedListNode* nodeL_in, egwSinglyLinkedListNode* nodeR_in) {
     if(!nodeL_in)
         return nodeR_in;
@@ -91,6 +109,10 @@ egwSinglyLinkedList* egwSLListInit(egwSinglyLinkedList* list_out, egwDataFuncs*
         memcpy((void*)list_out->dFuncs, (const void*)funcs_in, sizeof(egwDataFuncs));
     }
     
+    if(!(list_out->lFlags & EGW_LIST_FLG_NOPOOL) && !(list_out->dFuncs && (list_out->dFuncs->fpMalloc || list_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&list_out->nPool, (EGWuint)list_out->eSize + (EGWuint)sizeof(egwSinglyLinkedListNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwSLListFree(list_out); return NULL; }
+    }
+    
     return list_out;
 }
 
@@ -109,15 +131,18 @@ egwSinglyLinkedList* egwSLListCopy(const egwSinglyLinkedList* list_in, egwSingly
         memcpy((void*)list_out->dFuncs, (const void*)list_in->dFuncs, sizeof(egwDataFuncs));
     }
     
+    if(!(list_out->lFlags & EGW_LIST_FLG_NOPOOL) && !(list_out->dFuncs && (list_out->dFuncs->fpMalloc || list_out->dFuncs->fpFree))) {
+        if(!(egwNodePoolInit(&list_out->nPool, (EGWuint)list_out->eSize + (EGWuint)sizeof(egwSinglyLinkedListNode), EGW_NODEPOOL_DFLTSLABNODES))) { egwSLListFree(list_out); return NULL; }
+    }
+    
     if(list_in->eCount) {
-        EGWmallocfp mallocFunc = (list_out->dFuncs && list_out->dFuncs->fpMalloc ? (EGWmallocfp)list_out->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
         EGWelementfp addFunc = (list_out->dFuncs && list_out->dFuncs->fpAdd ? (EGWelementfp)list_out->dFuncs->fpAdd : (EGWelementfp)NULL);
         egwSinglyLinkedListNode* node = list_in->lHead;
         egwSinglyLinkedListNode* newNode = NULL;
         EGWuintptr data = 0;
         
         while(node) {
-            if(!(newNode = (egwSinglyLinkedListNode*)mallocFunc(((size_t)list_out->eSize + sizeof(egwSinglyLinkedListNode))))) { egwSLListFree(list_out); return NULL; }
+            if(!(newNode = egwSLListAllocNode(list_out))) { egwSLListFree(list_out); return NULL; }
             memset((void*)newNode, 0, ((size_t)list_out->eSize + sizeof(egwSinglyLinkedListNode)));
             
             if(list_out->lTail)
@@ -142,8 +167,6 @@ egwSinglyLinkedList* egwSLListCopy(const egwSinglyLinkedList* list_in, egwSingly
 }
 
 egwSinglyLinkedList* egwSLListFree(egwSinglyLinkedList* list_inout) {
-    EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-    
     while(list_inout->lHead) {
         egwSinglyLinkedListNode* node = list_inout->lHead;
         
@@ -155,9 +178,11 @@ egwSinglyLinkedList* egwSLListFree(egwSinglyLinkedList* list_inout) {
             free((void*)*(void**)((EGWuintptr)node + (EGWuintptr)sizeof(egwSinglyLinkedListNode)));
         
         list_inout->lHead = list_inout->lHead->next;
-        freeFunc(node);
+        egwSLListFreeNode(list_inout, node);
     }
     
+    egwNodePoolFree(&list_inout->nPool);
+    
     if(list_inout->dFuncs)
         free((void*)(list_inout->dFuncs));
     
@@ -171,8 +196,7 @@ EGWint egwSLListAddAt(egwSinglyLinkedList* list_inout, EGWuint index_in, const E
         if(index_in < list_inout->eCount - 1) {
             egwSinglyLinkedListNode* newNode = NULL;
             
-            {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-                if(!(newNode = (egwSinglyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode))))) { return 0; }
+            {   if(!(newNode = egwSLListAllocNode(list_inout))) { return 0; }
                 memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode)));
             }
             
@@ -208,8 +232,7 @@ EGWint egwSLListAddAt(egwSinglyLinkedList* list_inout, EGWuint index_in, const E
 EGWint egwSLListAddHead(egwSinglyLinkedList* list_inout, const EGWbyte* data_in) {
     egwSinglyLinkedListNode* newNode = NULL;
     
-    {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-        if(!(newNode = (egwSinglyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode))))) { return 0; }
+    {   if(!(newNode = egwSLListAllocNode(list_inout))) { return 0; }
         memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode)));
     }
     
@@ -235,8 +258,7 @@ EGWint egwSLListAddHead(egwSinglyLinkedList* list_inout, const EGWbyte* data_in)
 EGWint egwSLListAddTail(egwSinglyLinkedList* list_inout, const EGWbyte* data_in) {
     egwSinglyLinkedListNode* newNode = NULL;
     
-    {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-        if(!(newNode = (egwSinglyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode))))) { return 0; }
+    {   if(!(newNode = egwSLListAllocNode(list_inout))) { return 0; }
         memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode)));
     }
     
@@ -264,8 +286,7 @@ EGWint egwSLListAddAfter(egwSinglyLinkedList* list_inout, egwSinglyLinkedListNod
         if(list_inout->lTail != node_inout) {
             egwSinglyLinkedListNode* newNode = NULL;
             
-            {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-                if(!(newNode = (egwSinglyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode))))) { return 0; }
+            {   if(!(newNode = egwSLListAllocNode(list_inout))) { return 0; }
                 memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode)));
             }
             
@@ -294,8 +315,7 @@ EGWint egwSLListAddBefore(egwSinglyLinkedList* list_inout, egwSinglyLinkedListNo
         if(list_inout->lHead != node_inout) {
             egwSinglyLinkedListNode* newNode = NULL;
             
-            {   EGWmallocfp mallocFunc = (list_inout->dFuncs && list_inout->dFuncs->fpMalloc ? (EGWmallocfp)list_inout->dFuncs->fpMalloc : (EGWmallocfp)&malloc);
-                if(!(newNode = (egwSinglyLinkedListNode*)mallocFunc(((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode))))) { return 0; }
+            {   if(!(newNode = egwSLListAllocNode(list_inout))) { return 0; }
                 memset((void*)newNode, 0, ((size_t)list_inout->eSize + sizeof(egwSinglyLinkedListNode)));
             }
             
@@ -345,9 +365,7 @@ EGWint egwSLListRemove(egwSinglyLinkedList* list_inout, egwSinglyLinkedListNode*
                 list_inout->lTail = NULL;
         }
         
-        {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-            freeFunc((void*)node_inout);
-        }
+        egwSLListFreeNode(list_inout, node_inout);
         
         --list_inout->eCount;
         
@@ -380,9 +398,7 @@ EGWint egwSLListRemoveAt(egwSinglyLinkedList* list_inout, EGWuint index_in) {
             
             prev->next = node->next;
             
-            {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-                freeFunc((void*)node);
-            }
+            egwSLListFreeNode(list_inout, node);
             
             --list_inout->eCount;
             
@@ -409,9 +425,7 @@ EGWint egwSLListRemoveHead(egwSinglyLinkedList* list_inout) {
         if(!list_inout->lHead)
             list_inout->lTail = NULL;
         
-        {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-            freeFunc((void*)node);
-        }
+        egwSLListFreeNode(list_inout, node);
         
         --list_inout->eCount;
         
@@ -442,9 +456,7 @@ EGWint egwSLListRemoveTail(egwSinglyLinkedList* list_inout) {
         } else
             list_inout->lHead = list_inout->lTail = NULL;
         
-        {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-            freeFunc((void*)node);
-        }
+        egwSLListFreeNode(list_inout, node);
         
         --list_inout->eCount;
         
@@ -470,9 +482,7 @@ EGWint egwSLListRemoveAfter(egwSinglyLinkedList* list_inout, egwSinglyLinkedList
             
             node_inout->next = node->next;
             
-            {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-                freeFunc((void*)node);
-            }
+            egwSLListFreeNode(list_inout, node);
             
             --list_inout->eCount;
             
@@ -506,9 +516,7 @@ EGWint egwSLListRemoveBefore(egwSinglyLinkedList* list_inout, egwSinglyLinkedLis
             else
                 prev->next = node->next;
             
-            {   EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-                freeFunc((void*)node);
-            }
+            egwSLListFreeNode(list_inout, node);
             
             --list_inout->eCount;
             
@@ -607,8 +615,6 @@ EGWuint egwSLListRemoveAny(egwSinglyLinkedList* list_inout, const EGWbyte* data_
 }
 
 EGWint egwSLListRemoveAll(egwSinglyLinkedList* list_inout) {
-    EGWfreefp freeFunc = (list_inout->dFuncs && list_inout->dFuncs->fpFree ? (EGWfreefp)list_inout->dFuncs->fpFree : (EGWfreefp)&free);
-    
     while(list_inout->lHead) {
         egwSinglyLinkedListNode* node = list_inout->lHead;
         
@@ -620,7 +626,7 @@ EGWint egwSLListRemoveAll(egwSinglyLinkedList* list_inout) {
             free((void*)*(void**)((EGWuintptr)node + (EGWuintptr)sizeof(egwSinglyLinkedListNode)));
         
         list_inout->lHead = list_inout->lHead->next;
-        freeFunc(node);
+        egwSLListFreeNode(list_inout, node);
     }
     
     list_inout->eCount = 0;
@@ -159,8 +159,10 @@
 #import "sys/egwGfxContext.h"
 #import "sys/egwGfxContextAGL.h"
 #import "sys/egwGfxContextNSGL.h"
+#import "sys/egwGfxContextNull.h"
 #import "sys/egwGfxContextEAGLES.h"
 #import "sys/egwGfxRenderer.h"
+#import "sys/egwGfxCommands.h"
 #import "sys/egwPhyContext.h"
 #import "sys/egwPhyContextSW.h"
 #import "sys/egwPhyActuator.h"
@@ -178,6 +180,9 @@
 #import "data/egwData.h"
 #import "data/egwArray.h"
 #import "data/egwCyclicArray.h"
+#import "data/egwRequestRing.h"
+#import "data/egwNodePool.h"
+#import "data/egwHashTable.h"
 #import "data/egwSinglyLinkedList.h"
 #import "data/egwDoublyLinkedList.h"
 #import "data/egwAVLTree.h"
@@ -228,6 +233,7 @@
 #import "obj/egwObjectBranch.h"
 #import "obj/egwSwitchBranch.h"
 #import "obj/egwTransformBranch.h"
+#import "obj/egwSpatialIndex.h"
 #import "obj/egwDLODBranch.h"
 
 #import "phy/egwPhysics.h"
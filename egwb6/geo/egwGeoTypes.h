@@ -55,6 +55,9 @@
 #define EGW_GEOMETRY_STRG_VBODYNAMIC 0x02  ///< Dynamic VBO usage.
 #define EGW_GEOMETRY_STRG_EXVBO      0x0f  ///< Used to extract VBO usage from bit-field.
 
+// Mesh face indexing
+#define EGW_MESH_MAXCMPCTCOUNT     65536  ///< Maximum array element count indexable by compact (16-bit) face indices, meshes beyond this store wide (32-bit) face indices.
+
 // Particle system flags
 #define EGW_PSYSFLAG_NONE           0x0000  ///< No particle system flags.
 #define EGW_PSYSFLAG_EMITCNTDWN     0x0001  ///< Emitter emits along a timer countdown instead of total particle count (emitter frequency cannot be 0).
@@ -253,6 +256,18 @@ typedef union {
     EGWuint8 bytes[6];                      ///< Byte array.
 } egwJITFace;
 
+/// Joint Indexed Triangle Face (Wide).
+/// Face indexing structure capable of indexing joint vertices (T = Vi,Ni,Ti) in a mesh larger than EGW_MESH_MAXCMPCTCOUNT.
+typedef union {
+    struct {
+        EGWuint32 i1;                       ///< Triangle joint VNT arrays index 1.
+        EGWuint32 i2;                       ///< Triangle joint VNT arrays index 2.
+        EGWuint32 i3;                       ///< Triangle joint VNT arrays index 3.
+    } face;                                 ///< Triangle component indices.
+    EGWuint32 index[3];                     ///< Triangle indices array.
+    EGWuint8 bytes[12];                     ///< Byte array.
+} egwJITFace32;
+
 /// Disjoint Indexed Triangle Face.
 /// Face indexing structure capable of indexing disjoint vertices (T = Vvi,Nni,Tti) in a mesh.
 typedef union {
@@ -271,13 +286,31 @@ typedef union {
     EGWuint8 bytes[18];                     ///< Byte array.
 } egwDITFace;
 
+/// Disjoint Indexed Triangle Face (Wide).
+/// Face indexing structure capable of indexing disjoint vertices (T = Vvi,Nni,Tti) in a mesh larger than EGW_MESH_MAXCMPCTCOUNT.
+typedef union {
+    struct {
+        EGWuint32 iv1;                      ///< Triangle vertex array index 1.
+        EGWuint32 in1;                      ///< Triangle normal array index 1.
+        EGWuint32 it1;                      ///< Triangle texture array index 1.
+        EGWuint32 iv2;                      ///< Triangle vertex array index 2.
+        EGWuint32 in2;                      ///< Triangle normal array index 2.
+        EGWuint32 it2;                      ///< Triangle texture array index 2.
+        EGWuint32 iv3;                      ///< Triangle vertex array index 3.
+        EGWuint32 in3;                      ///< Triangle normal array index 3.
+        EGWuint32 it3;                      ///< Triangle texture array index 3.
+    } face;                                 ///< Triangle component indices.
+    EGWuint32 index[9];                     ///< Triangle indices array.
+    EGWuint8 bytes[36];                     ///< Byte array.
+} egwDITFace32;
+
 
 // !!!: ***** Static Polygon Meshes *****
 
 /// Static Triangles Vertex Array Mesh (Float).
 /// Static mesh structure.
 typedef struct {
-    EGWuint16 vCount;                       ///< Vertex count.
+    EGWuint32 vCount;                       ///< Vertex count.
     egwVector3f* vCoords;                   ///< Vertex coords array (owned).
     egwVector3f* nCoords;                   ///< Normal coords array (owned).
     egwVector2f* tCoords;                   ///< Texture coords array (owned).
@@ -286,25 +319,31 @@ typedef struct {
 /// Static Joint Indexed Triangles Vertex Array Mesh (Float).
 /// Static mesh structure with face indexing via joint lookup.
 typedef struct {
-    EGWuint16 vCount;                       ///< Vertex count.
-    EGWuint16 fCount;                       ///< Face count.
+    EGWuint32 vCount;                       ///< Vertex count.
+    EGWuint32 fCount;                       ///< Face count.
     egwVector3f* vCoords;                   ///< Vertex coords array (owned).
     egwVector3f* nCoords;                   ///< Normal coords array (owned).
     egwVector2f* tCoords;                   ///< Texture coords array (owned).
-    egwJITFace* fIndicies;                  ///< Face indexing array (owned).
+    union {
+        egwJITFace* fIndicies;              ///< Compact face indexing array (owned, valid if !egwMeshIsWideIndexed(vCount)).
+        egwJITFace32* fIndicies32;          ///< Wide face indexing array (owned, valid if egwMeshIsWideIndexed(vCount)).
+    };                                      ///< Face indexing array (single allocation, compact or wide).
 } egwSJITVAMeshf;
 
 /// Static Disjoint Indexed Triangles Vertex Array Mesh (Float).
 /// Static mesh structure with face indexing via disjoint lookup.
 typedef struct {
-    EGWuint16 vCount;                       ///< Vertex count.
-    EGWuint16 nCount;                       ///< Normal count.
-    EGWuint16 tCount;                       ///< Texture count.
-    EGWuint16 fCount;                       ///< Face count.
+    EGWuint32 vCount;                       ///< Vertex count.
+    EGWuint32 nCount;                       ///< Normal count.
+    EGWuint32 tCount;                       ///< Texture count.
+    EGWuint32 fCount;                       ///< Face count.
     egwVector3f* vCoords;                   ///< Vertex coords array (owned).
     egwVector3f* nCoords;                   ///< Normal coords array (owned).
     egwVector2f* tCoords;                   ///< Texture coords array (owned).
-    egwDITFace* fIndicies;                  ///< Face indexing array (owned).
+    union {
+        egwDITFace* fIndicies;              ///< Compact face indexing array (owned, valid if !egwMeshIsWideIndexed(max(vCount, nCount, tCount))).
+        egwDITFace32* fIndicies32;          ///< Wide face indexing array (owned, valid if egwMeshIsWideIndexed(max(vCount, nCount, tCount))).
+    };                                      ///< Face indexing array (single allocation, compact or wide).
 } egwSDITVAMeshf;
 
 
@@ -313,7 +352,7 @@ typedef struct {
 /// Key Framed Triangles Vertex Array Mesh.
 /// KF animated mesh structure.
 typedef struct {
-    EGWuint16 vCount;                       ///< Vertex count.
+    EGWuint32 vCount;                       ///< Vertex count.
     EGWuint16 vfCount;                      ///< Vertex key frame count.
     EGWuint16 nfCount;                      ///< Normal key frame count.
     EGWuint16 tfCount;                      ///< Texture key frame count.
@@ -331,15 +370,18 @@ typedef struct {
 /// Key Framed Joint Indexed Triangles Vertex Array Mesh.
 /// KF animated mesh structure with face indexing via joint lookup.
 typedef struct {
-    EGWuint16 vCount;                       ///< Vertex count.
-    EGWuint16 fCount;                       ///< Face count.
+    EGWuint32 vCount;                       ///< Vertex count.
+    EGWuint32 fCount;                       ///< Face count.
     EGWuint16 vfCount;                      ///< Vertex key frame count.
     EGWuint16 nfCount;                      ///< Normal key frame count.
     EGWuint16 tfCount;                      ///< Texture key frame count.
     egwVector3f* vkCoords;                  ///< Vertex key framed coords array (owned).
     egwVector3f* nkCoords;                  ///< Normal key framed coords array (owned).
     egwVector2f* tkCoords;                  ///< Texture key framed coords array (owned).
-    egwJITFace* fIndicies;                  ///< Face indexing array (owned).
+    union {
+        egwJITFace* fIndicies;              ///< Compact face indexing array (owned, valid if !egwMeshIsWideIndexed(vCount)).
+        egwJITFace32* fIndicies32;          ///< Wide face indexing array (owned, valid if egwMeshIsWideIndexed(vCount)).
+    };                                      ///< Face indexing array (single allocation, compact or wide).
     EGWtime* vtIndicies;                    ///< Vertex time indicies (owned, may be shared against another time index array).
     EGWtime* ntIndicies;                    ///< Normal time indicies (owned, may be shared against another time index array).
     EGWtime* ttIndicies;                    ///< Texture time indicies (owned, may be shared against another time index array).
@@ -351,17 +393,20 @@ typedef struct {
 /// Key Framed Disjoint Indexed Triangles Vertex Array Mesh.
 /// KF animated mesh structure with face indexing via disjoint lookup.
 typedef struct {
-    EGWuint16 vCount;                       ///< Vertex count.
-    EGWuint16 nCount;                       ///< Normal count.
-    EGWuint16 tCount;                       ///< Texture count.
-    EGWuint16 fCount;                       ///< Face count.
+    EGWuint32 vCount;                       ///< Vertex count.
+    EGWuint32 nCount;                       ///< Normal count.
+    EGWuint32 tCount;                       ///< Texture count.
+    EGWuint32 fCount;                       ///< Face count.
     EGWuint16 vfCount;                      ///< Vertex key frame count.
     EGWuint16 nfCount;                      ///< Normal key frame count.
     EGWuint16 tfCount;                      ///< Texture key frame count.
     egwVector3f* vkCoords;                  ///< Vertex key framed coords array (owned).
     egwVector3f* nkCoords;                  ///< Normal key framed coords array (owned).
     egwVector2f* tkCoords;                  ///< Texture key framed coords array (owned).
-    egwDITFace* fIndicies;                  ///< Face indexing array (owned).
+    union {
+        egwDITFace* fIndicies;              ///< Compact face indexing array (owned, valid if !egwMeshIsWideIndexed(max(vCount, nCount, tCount))).
+        egwDITFace32* fIndicies32;          ///< Wide face indexing array (owned, valid if egwMeshIsWideIndexed(max(vCount, nCount, tCount))).
+    };                                      ///< Face indexing array (single allocation, compact or wide).
     EGWtime* vtIndicies;                    ///< Vertex time indicies (owned, may be shared against another time index array).
     EGWtime* ntIndicies;                    ///< Normal time indicies (owned, may be shared against another time index array).
     EGWtime* ttIndicies;                    ///< Texture time indicies (owned, may be shared against another time index array).
@@ -438,9 +483,36 @@ typedef struct {
     EGWtime ltLeft;                         ///< Life time left (countdown).
     EGWtime ltAlive;                        ///< Life time alive (countup).
     egwColor4f color;                       ///< Coloration (non-clamped).
-    egwMatrix44f* twcsTrans;                ///< Total world transform at creation time (MMCS->WCS).
+    EGWuint twcsIndex;                      ///< Total world transform at creation time table index (MMCS->WCS).
 } egwPSParticle;
 
+/// Particle System Particle Pool.
+/// Particle system structure-of-arrays particle storage.
+/// @note Each stream is tightly packed and ordered from oldest (head) to newest (tail) emitted particle, removing from the head only advances the stream window.
+/// @note Emit-time transforms are interned into a reference counted table whose entries are recycled, thus steady state world emission does no heap allocation.
+typedef struct {
+    EGWbyte* rData;                         ///< Raw stream data (owned).
+    egwVector3f* position;                  ///< Position stream (MCS, or WCS if emitted to WCS, aliased).
+    egwVector3f* velocity;                  ///< Velocity stream (MCS, or WCS if emitted to WCS, aliased).
+    EGWsingle* size;                        ///< Relative particle size stream (aliased).
+    EGWsingle* weight;                      ///< Particle weight stream (aliased).
+    EGWtime* ltLeft;                        ///< Life time left (countdown) stream (aliased).
+    EGWtime* ltAlive;                       ///< Life time alive (countup) stream (aliased).
+    egwColor4f* color;                      ///< Coloration (non-clamped) stream (aliased).
+    EGWuint* twcsIndex;                     ///< Total world transform at creation time table index stream (aliased).
+    EGWuint pCount;                         ///< Current particle count.
+    EGWuint pMaxCount;                      ///< Maximum particle count (capacity).
+    EGWuint pHead;                          ///< Consumed slots ahead of the streams (ring window offset).
+    EGWbyte* tData;                         ///< Raw transform table data (owned).
+    egwMatrix44f* tTable;                   ///< Interned total world transforms at creation time table (MMCS->WCS, aliased).
+    EGWuint* tRefs;                         ///< Transform table entry reference counts (aliased).
+    EGWuint* tFree;                         ///< Transform table free entry index stack (aliased).
+    EGWuint tCount;                         ///< Transform table entries in use (high water mark).
+    EGWuint tFreeCount;                     ///< Transform table free entry count.
+    EGWuint tMaxCount;                      ///< Transform table maximum entry count (capacity).
+    EGWuint tLast;                          ///< Transform table most recently interned entry index.
+} egwPSParticlePool;
+
 
 // !!!: ***** Event Delegate Protocols *****
 
@@ -664,6 +664,28 @@ egwPlane4f* egwPlaneTransform444f(const egwMatrix44f* mat_lhs, const egwPlane4f*
 
 // !!!: ***** Mesh Operations *****
 
+/// Mesh Wide Indexing Check Routine.
+/// Determines if face indices into arrays of the provided element count are stored wide (32-bit) rather than compact (16-bit).
+/// @param [in] count_in Largest indexed array element count.
+/// @return 1 if face indices are stored wide, otherwise 0.
+EGWint egwMeshIsWideIndexed(EGWuint count_in);
+
+/// Mesh Face Index Get Routine.
+/// Reads a single face index from a compact or wide face indexing array.
+/// @param [in] fIndicies_in Face indexing array (mesh fIndicies/fIndicies32 union, read through fIndicies32 layout if @a wide_in).
+/// @param [in] wide_in Wide indexing flag (as per egwMeshIsWideIndexed).
+/// @param [in] index_in Flat index offset (face * 3 + corner for joint faces, face * 9 + component for disjoint faces).
+/// @return Face index value.
+EGWuint egwMeshFaceIndexGet(const void* fIndicies_in, EGWint wide_in, EGWuint index_in);
+
+/// Mesh Face Index Set Routine.
+/// Writes a single face index into a compact or wide face indexing array.
+/// @param [in,out] fIndicies_inout Face indexing array (mesh fIndicies/fIndicies32 union, written through fIndicies32 layout if @a wide_in).
+/// @param [in] wide_in Wide indexing flag (as per egwMeshIsWideIndexed).
+/// @param [in] index_in Flat index offset (face * 3 + corner for joint faces, face * 9 + component for disjoint faces).
+/// @param [in] value_in Face index value.
+void egwMeshFaceIndexSet(void* fIndicies_inout, EGWint wide_in, EGWuint index_in, EGWuint value_in);
+
 /// Static Triangle Vertex Array Mesh Allocation Routine.
 /// Allocates mesh data with provided parameters.
 /// @param [out] mesh_out Mesh output of allocation.
@@ -671,7 +693,7 @@ egwPlane4f* egwPlaneTransform444f(const egwMatrix44f* mat_lhs, const egwPlane4f*
 /// @param [in] normalsC_in Normals count.
 /// @param [in] texuvsC_in Texture UVs count.
 /// @return @a mesh_out (for nesting), otherwise NULL if failure allocating.
-egwSTVAMeshf* egwMeshAllocSTVAf(egwSTVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in);
+egwSTVAMeshf* egwMeshAllocSTVAf(egwSTVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in);
 
 /// Static Jointly Indexed Triangle Vertex Array Mesh Allocation Routine.
 /// Allocates mesh data with provided parameters.
@@ -681,7 +703,7 @@ egwSTVAMeshf* egwMeshAllocSTVAf(egwSTVAMeshf* mesh_out, EGWuint16 verticesC_in,
 /// @param [in] texuvsC_in Texture UVs count.
 /// @param [in] facesC_in Faces count.
 /// @return @a mesh_out (for nesting), otherwise NULL if failure allocating.
-egwSJITVAMeshf* egwMeshAllocSJITVAf(egwSJITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in);
+egwSJITVAMeshf* egwMeshAllocSJITVAf(egwSJITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in);
 
 /// Static Disjointly Indexed Triangle Vertex Array Mesh Allocation Routine.
 /// Allocates mesh data with provided parameters.
@@ -691,7 +713,7 @@ egwSJITVAMeshf* egwMeshAllocSJITVAf(egwSJITVAMeshf* mesh_out, EGWuint16 vertices
 /// @param [in] texuvsC_in Texture UVs count.
 /// @param [in] facesC_in Faces count.
 /// @return @a mesh_out (for nesting), otherwise NULL if failure allocating.
-egwSDITVAMeshf* egwMeshAllocSDITVAf(egwSDITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in);
+egwSDITVAMeshf* egwMeshAllocSDITVAf(egwSDITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in);
 
 /// Key Framed Triangle Vertex Array Mesh Allocation Routine.
 /// Allocates key framed mesh data with provided parameters.
@@ -703,7 +725,7 @@ egwSDITVAMeshf* egwMeshAllocSDITVAf(egwSDITVAMeshf* mesh_out, EGWuint16 vertices
 /// @param [in] nrmlFramesC_in Normal frames count.
 /// @param [in] txuvFramesC_in Texture UV frames count.
 /// @return @a mesh_out (for nesting), otherwise NULL if failure allocating.
-egwKFTVAMeshf* egwMeshAllocKFTVAf(egwKFTVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in);
+egwKFTVAMeshf* egwMeshAllocKFTVAf(egwKFTVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in);
 
 /// Key Framed Jointly Indexed Triangle Vertex Array Mesh Allocation Routine.
 /// Allocates key framed mesh data with provided parameters.
@@ -716,7 +738,7 @@ egwKFTVAMeshf* egwMeshAllocKFTVAf(egwKFTVAMeshf* mesh_out, EGWuint16 verticesC_i
 /// @param [in] nrmlFramesC_in Normal frames count.
 /// @param [in] txuvFramesC_in Texture UV frames count.
 /// @return @a mesh_out (for nesting), otherwise NULL if failure allocating.
-egwKFJITVAMeshf* egwMeshAllocKFJITVAf(egwKFJITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in);
+egwKFJITVAMeshf* egwMeshAllocKFJITVAf(egwKFJITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in);
 
 /// Key Framed Disjointly Indexed Triangle Vertex Array Mesh Allocation Routine.
 /// Allocates key framed mesh data with provided parameters.
@@ -729,7 +751,7 @@ egwKFJITVAMeshf* egwMeshAllocKFJITVAf(egwKFJITVAMeshf* mesh_out, EGWuint16 verti
 /// @param [in] nrmlFramesC_in Normal frames count.
 /// @param [in] txuvFramesC_in Texture UV frames count.
 /// @return @a mesh_out (for nesting), otherwise NULL if failure allocating.
-egwKFDITVAMeshf* egwMeshAllocKFDITVAf(egwKFDITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in);
+egwKFDITVAMeshf* egwMeshAllocKFDITVAf(egwKFDITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in);
 
 /// Static Triangle Vertex Array Mesh Free Routine.
 /// Frees the contents of the mesh.
@@ -1202,7 +1202,7 @@ egwVector3f* egwPlanePointPointClosest4f(const egwPlane4f* plane_lhs, const egwV
                                            egwVecDotProd3f((egwVector3f*)&plane_lhs->normal, egwVecSubtract3f(point_rhs, (egwVector3f*)&plane_lhs->origin, &temp)),
                                            &temp),
                             point_out);
-    
+                            
 }
 
 EGWsingle egwPlanePointClosestDist3f(const egwPlane3f* plane_lhs, const egwVector2f* point_rhs) {
@@ -1255,7 +1255,24 @@ egwPlane4f* egwPlaneTransform444f(const egwMatrix44f* mat_lhs, const egwPlane4f*
     return plane_out;
 }
 
-egwSTVAMeshf* egwMeshAllocSTVAf(egwSTVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in) {
+EGWint egwMeshIsWideIndexed(EGWuint count_in) {
+    return (count_in > EGW_MESH_MAXCMPCTCOUNT ? 1 : 0);
+}
+
+EGWuint egwMeshFaceIndexGet(const void* fIndicies_in, EGWint wide_in, EGWuint index_in) {
+    if(wide_in)
+        return (EGWuint)(((const EGWuint32*)fIndicies_in)[index_in]);
+    return (EGWuint)(((const EGWuint16*)fIndicies_in)[index_in]);
+}
+
+void egwMeshFaceIndexSet(void* fIndicies_inout, EGWint wide_in, EGWuint index_in, EGWuint value_in) {
+    if(wide_in)
+        ((EGWuint32*)fIndicies_inout)[index_in] = (EGWuint32)value_in;
+    else
+        ((EGWuint16*)fIndicies_inout)[index_in] = (EGWuint16)value_in;
+}
+
+egwSTVAMeshf* egwMeshAllocSTVAf(egwSTVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in) {
     memset((void*)mesh_out, 0, sizeof(egwSTVAMeshf));
     
     mesh_out->vCount = (verticesC_in > 0 ? verticesC_in : (normalsC_in > 0 ? normalsC_in : (texuvsC_in > 0 ? texuvsC_in : 0)));
@@ -1269,7 +1286,7 @@ egwSTVAMeshf* egwMeshAllocSTVAf(egwSTVAMeshf* mesh_out, EGWuint16 verticesC_in,
     return mesh_out;
 }
 
-egwSJITVAMeshf* egwMeshAllocSJITVAf(egwSJITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in) {
+egwSJITVAMeshf* egwMeshAllocSJITVAf(egwSJITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in) {
     memset((void*)mesh_out, 0, sizeof(egwSJITVAMeshf));
     
     mesh_out->vCount = (verticesC_in > 0 ? verticesC_in : (normalsC_in > 0 ? normalsC_in : (texuvsC_in > 0 ? texuvsC_in : 0)));
@@ -1279,13 +1296,13 @@ egwSJITVAMeshf* egwMeshAllocSJITVAf(egwSJITVAMeshf* mesh_out, EGWuint16 vertices
         if(verticesC_in && !(mesh_out->vCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->vCount)))) { egwMeshFreeSJITVAf(mesh_out); return NULL; }
         if(normalsC_in && !(mesh_out->nCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->vCount)))) { egwMeshFreeSJITVAf(mesh_out); return NULL; }
         if(texuvsC_in && !(mesh_out->tCoords = (egwVector2f*)malloc(sizeof(egwVector2f) * (size_t)(mesh_out->vCount)))) { egwMeshFreeSJITVAf(mesh_out); return NULL; }
-        if(!(mesh_out->fIndicies = (egwJITFace*)malloc(sizeof(egwJITFace) * (size_t)(mesh_out->fCount)))) { egwMeshFreeSJITVAf(mesh_out); return NULL; }
+        if(!(mesh_out->fIndicies = (egwJITFace*)malloc((egwMeshIsWideIndexed(mesh_out->vCount) ? sizeof(egwJITFace32) : sizeof(egwJITFace)) * (size_t)(mesh_out->fCount)))) { egwMeshFreeSJITVAf(mesh_out); return NULL; }
     } else { egwMeshFreeSJITVAf(mesh_out); return NULL; }
     
     return mesh_out;
 }
 
-egwSDITVAMeshf* egwMeshAllocSDITVAf(egwSDITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in) {
+egwSDITVAMeshf* egwMeshAllocSDITVAf(egwSDITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in) {
     memset((void*)mesh_out, 0, sizeof(egwSDITVAMeshf));
     
     mesh_out->vCount = verticesC_in;
@@ -1297,13 +1314,13 @@ egwSDITVAMeshf* egwMeshAllocSDITVAf(egwSDITVAMeshf* mesh_out, EGWuint16 vertices
         if(verticesC_in && !(mesh_out->vCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->vCount)))) { egwMeshFreeSDITVAf(mesh_out); return NULL; }
         if(normalsC_in && !(mesh_out->nCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->nCount)))) { egwMeshFreeSDITVAf(mesh_out); return NULL; }
         if(texuvsC_in && !(mesh_out->tCoords = (egwVector2f*)malloc(sizeof(egwVector2f) * (size_t)(mesh_out->tCount)))) { egwMeshFreeSDITVAf(mesh_out); return NULL; }
-        if(!(mesh_out->fIndicies = (egwDITFace*)malloc(sizeof(egwDITFace) * (size_t)(mesh_out->fCount)))) { egwMeshFreeSDITVAf(mesh_out); return NULL; }
+        if(!(mesh_out->fIndicies = (egwDITFace*)malloc((egwMeshIsWideIndexed(egwMax2ui(mesh_out->vCount, egwMax2ui(mesh_out->nCount, mesh_out->tCount))) ? sizeof(egwDITFace32) : sizeof(egwDITFace)) * (size_t)(mesh_out->fCount)))) { egwMeshFreeSDITVAf(mesh_out); return NULL; }
     } else { egwMeshFreeSDITVAf(mesh_out); return NULL; }
     
     return mesh_out;
 }
 
-egwKFTVAMeshf* egwMeshAllocKFTVAf(egwKFTVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in) {
+egwKFTVAMeshf* egwMeshAllocKFTVAf(egwKFTVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in) {
     memset((void*)mesh_out, 0, sizeof(egwKFTVAMeshf));
     
     mesh_out->vCount = (verticesC_in > 0 ? verticesC_in : (normalsC_in > 0 ? normalsC_in : (texuvsC_in > 0 ? texuvsC_in : 0)));
@@ -1323,7 +1340,7 @@ egwKFTVAMeshf* egwMeshAllocKFTVAf(egwKFTVAMeshf* mesh_out, EGWuint16 verticesC_i
     return mesh_out;
 }
 
-egwKFJITVAMeshf* egwMeshAllocKFJITVAf(egwKFJITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in) {
+egwKFJITVAMeshf* egwMeshAllocKFJITVAf(egwKFJITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in) {
     memset((void*)mesh_out, 0, sizeof(egwKFJITVAMeshf));
     
     mesh_out->vCount = (verticesC_in > 0 ? verticesC_in : (normalsC_in > 0 ? normalsC_in : (texuvsC_in > 0 ? texuvsC_in : 0)));
@@ -1336,7 +1353,7 @@ egwKFJITVAMeshf* egwMeshAllocKFJITVAf(egwKFJITVAMeshf* mesh_out, EGWuint16 verti
         if(verticesC_in && !(mesh_out->vkCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->vCount) * (size_t)(mesh_out->vfCount ? mesh_out->vfCount : 1)))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
         if(normalsC_in && !(mesh_out->nkCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->vCount) * (size_t)(mesh_out->nfCount ? mesh_out->nfCount : 1)))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
         if(texuvsC_in && !(mesh_out->tkCoords = (egwVector2f*)malloc(sizeof(egwVector2f) * (size_t)(mesh_out->vCount) * (size_t)(mesh_out->tfCount ? mesh_out->tfCount : 1)))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
-        if(!(mesh_out->fIndicies = (egwJITFace*)malloc(sizeof(egwJITFace) * (size_t)(mesh_out->fCount)))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
+        if(!(mesh_out->fIndicies = (egwJITFace*)malloc((egwMeshIsWideIndexed(mesh_out->vCount) ? sizeof(egwJITFace32) : sizeof(egwJITFace)) * (size_t)(mesh_out->fCount)))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
         if(verticesC_in && vertFramesC_in && !(mesh_out->vtIndicies = (EGWtime*)malloc((sizeof(EGWtime) * (size_t)(mesh_out->vfCount))))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
         if(normalsC_in && nrmlFramesC_in && !(mesh_out->ntIndicies = (EGWtime*)malloc((sizeof(EGWtime) * (size_t)(mesh_out->nfCount))))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
         if(verticesC_in && txuvFramesC_in && !(mesh_out->ttIndicies = (EGWtime*)malloc((sizeof(EGWtime) * (size_t)(mesh_out->tfCount))))) { egwMeshFreeKFJITVAf(mesh_out); return NULL; }
@@ -1345,7 +1362,7 @@ egwKFJITVAMeshf* egwMeshAllocKFJITVAf(egwKFJITVAMeshf* mesh_out, EGWuint16 verti
     return mesh_out;
 }
 
-egwKFDITVAMeshf* egwMeshAllocKFDITVAf(egwKFDITVAMeshf* mesh_out, EGWuint16 verticesC_in, EGWuint16 normalsC_in, EGWuint16 texuvsC_in, EGWuint16 facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in) {
+egwKFDITVAMeshf* egwMeshAllocKFDITVAf(egwKFDITVAMeshf* mesh_out, EGWuint verticesC_in, EGWuint normalsC_in, EGWuint texuvsC_in, EGWuint facesC_in, EGWuint16 vertFramesC_in, EGWuint16 nrmlFramesC_in, EGWuint16 txuvFramesC_in) {
     memset((void*)mesh_out, 0, sizeof(egwKFDITVAMeshf));
     
     mesh_out->vCount = verticesC_in;
@@ -1360,7 +1377,7 @@ egwKFDITVAMeshf* egwMeshAllocKFDITVAf(egwKFDITVAMeshf* mesh_out, EGWuint16 verti
         if(verticesC_in && !(mesh_out->vkCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->vCount) * (size_t)(mesh_out->vfCount ? mesh_out->vfCount : 1)))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
         if(normalsC_in && !(mesh_out->nkCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(mesh_out->nCount) * (size_t)(mesh_out->nfCount ? mesh_out->nfCount : 1)))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
         if(texuvsC_in && !(mesh_out->tkCoords = (egwVector2f*)malloc(sizeof(egwVector2f) * (size_t)(mesh_out->tCount) * (size_t)(mesh_out->tfCount ? mesh_out->tfCount : 1)))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
-        if(!(mesh_out->fIndicies = (egwDITFace*)malloc(sizeof(egwDITFace) * (size_t)(mesh_out->fCount)))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
+        if(!(mesh_out->fIndicies = (egwDITFace*)malloc((egwMeshIsWideIndexed(egwMax2ui(mesh_out->vCount, egwMax2ui(mesh_out->nCount, mesh_out->tCount))) ? sizeof(egwDITFace32) : sizeof(egwDITFace)) * (size_t)(mesh_out->fCount)))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
         if(verticesC_in && vertFramesC_in && !(mesh_out->vtIndicies = (EGWtime*)malloc((sizeof(EGWtime) * (size_t)(mesh_out->vfCount))))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
         if(normalsC_in && nrmlFramesC_in && !(mesh_out->ntIndicies = (EGWtime*)malloc((sizeof(EGWtime) * (size_t)(mesh_out->nfCount))))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
         if(verticesC_in && txuvFramesC_in && !(mesh_out->ttIndicies = (EGWtime*)malloc((sizeof(EGWtime) * (size_t)(mesh_out->tfCount))))) { egwMeshFreeKFDITVAf(mesh_out); return NULL; }
@@ -1480,6 +1497,7 @@ egwSJITVAMeshf* egwMeshConvertSTVAfSJITVAf(const egwSTVAMeshf* mesh_in, egwSJITV
         
         if(egwMeshAllocSJITVAf(mesh_out, (mesh_in->vCoords ? vCount : 0), (mesh_in->nCoords ? vCount : 0), (mesh_in->tCoords ? vCount : 0), (mesh_in->vCount / 3))) {
             EGWint faceIndex;
+            EGWint wide = egwMeshIsWideIndexed(mesh_out->vCount);
             vCount = 0;
             
             for(faceIndex = 0, vertexIndex = 0; faceIndex < mesh_out->fCount && vertexIndex < mesh_in->vCount; ++faceIndex, vertexIndex += 3) {
@@ -1487,36 +1505,36 @@ egwSJITVAMeshf* egwMeshConvertSTVAfSJITVAf(const egwSTVAMeshf* mesh_in, egwSJITV
                 for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex) {
                     if((foundFlags & 0x007) && (!(mesh_in->vCoords && mesh_out->vCoords) || egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+0]), &(mesh_out->vCoords[scanIndex])))
                        && (!(mesh_in->nCoords && mesh_out->nCoords) || egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+0]), &(mesh_out->nCoords[scanIndex])))
-                       && (!(mesh_in->tCoords && mesh_out->tCoords) || egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+0]), &(mesh_out->tCoords[scanIndex])))) { mesh_out->fIndicies[faceIndex].face.i1 = scanIndex; foundFlags = foundFlags & ~0x007; } }
+                       && (!(mesh_in->tCoords && mesh_out->tCoords) || egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+0]), &(mesh_out->tCoords[scanIndex])))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 0, scanIndex); foundFlags = foundFlags & ~0x007; } }
                 if(foundFlags & 0x007) {
                     if(mesh_in->vCoords && mesh_out->vCoords) egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+0]), &(mesh_out->vCoords[vCount]));
                     if(mesh_in->nCoords && mesh_out->nCoords) egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+0]), &(mesh_out->nCoords[vCount]));
                     if(mesh_in->tCoords && mesh_out->tCoords) egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+0]), &(mesh_out->tCoords[vCount]));
-                    mesh_out->fIndicies[faceIndex].face.i1 = vCount++;
+                    egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 0, vCount++);
                 }
                 
                 foundFlags = 0x070;
                 for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex) {
                     if((foundFlags & 0x070) && (!(mesh_in->vCoords && mesh_out->vCoords) || egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+1]), &(mesh_out->vCoords[scanIndex])))
                        && (!(mesh_in->nCoords && mesh_out->nCoords) || egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+1]), &(mesh_out->nCoords[scanIndex])))
-                       && (!(mesh_in->tCoords && mesh_out->tCoords) || egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+1]), &(mesh_out->tCoords[scanIndex])))) { mesh_out->fIndicies[faceIndex].face.i2 = scanIndex; foundFlags = foundFlags & ~0x070; } }
+                       && (!(mesh_in->tCoords && mesh_out->tCoords) || egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+1]), &(mesh_out->tCoords[scanIndex])))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 1, scanIndex); foundFlags = foundFlags & ~0x070; } }
                 if(foundFlags & 0x070) {
                     if(mesh_in->vCoords && mesh_out->vCoords) egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+1]), &(mesh_out->vCoords[vCount]));
                     if(mesh_in->nCoords && mesh_out->nCoords) egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+1]), &(mesh_out->nCoords[vCount]));
                     if(mesh_in->tCoords && mesh_out->tCoords) egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+1]), &(mesh_out->tCoords[vCount]));
-                    mesh_out->fIndicies[faceIndex].face.i2 = vCount++;
+                    egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 1, vCount++);
                 }
                 
                 foundFlags = 0x700;
                 for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex) {
                     if((foundFlags & 0x700) && (!(mesh_in->vCoords && mesh_out->vCoords) || egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+2]), &(mesh_out->vCoords[scanIndex])))
                        && (!(mesh_in->nCoords && mesh_out->nCoords) || egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+2]), &(mesh_out->nCoords[scanIndex])))
-                       && (!(mesh_in->tCoords && mesh_out->tCoords) || egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+2]), &(mesh_out->tCoords[scanIndex])))) { mesh_out->fIndicies[faceIndex].face.i3 = scanIndex; foundFlags = foundFlags & ~0x700; } }
+                       && (!(mesh_in->tCoords && mesh_out->tCoords) || egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+2]), &(mesh_out->tCoords[scanIndex])))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 2, scanIndex); foundFlags = foundFlags & ~0x700; } }
                 if(foundFlags & 0x700) {
                     if(mesh_in->vCoords && mesh_out->vCoords) egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+2]), &(mesh_out->vCoords[vCount]));
                     if(mesh_in->nCoords && mesh_out->nCoords) egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+2]), &(mesh_out->nCoords[vCount]));
                     if(mesh_in->tCoords && mesh_out->tCoords) egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+2]), &(mesh_out->tCoords[vCount]));
-                    mesh_out->fIndicies[faceIndex].face.i3 = vCount++;
+                    egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 2, vCount++);
                 }
             }
             
@@ -1548,58 +1566,59 @@ egwSDITVAMeshf* egwMeshConvertSTVAfSDITVAf(const egwSTVAMeshf* mesh_in, egwSDITV
         
         if(egwMeshAllocSDITVAf(mesh_out, vCount, nCount, tCount, (mesh_in->vCount / 3))) {
             EGWint faceIndex;
+            EGWint wide = egwMeshIsWideIndexed(egwMax2ui(mesh_out->vCount, egwMax2ui(mesh_out->nCount, mesh_out->tCount)));
             vCount = nCount = tCount = 0;
             
             for(faceIndex = 0, vertexIndex = 0; faceIndex < mesh_out->fCount && vertexIndex < mesh_in->vCount; ++faceIndex, vertexIndex += 3) {
                 if(mesh_out->vCoords) {
                     foundFlags = 0x001;
                     for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x001) && egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+0]), &(mesh_out->vCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.iv1 = scanIndex; foundFlags = foundFlags & ~0x001; }
-                    if(foundFlags & 0x001) { egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+0]), &(mesh_out->vCoords[vCount])); mesh_out->fIndicies[faceIndex].face.iv1 = vCount++; }
+                        if((foundFlags & 0x001) && egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+0]), &(mesh_out->vCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 0, scanIndex); foundFlags = foundFlags & ~0x001; }
+                    if(foundFlags & 0x001) { egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+0]), &(mesh_out->vCoords[vCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 0, vCount++); }
                     
                     foundFlags = 0x010;
                     for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x010) && egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+1]), &(mesh_out->vCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.iv2 = scanIndex; foundFlags = foundFlags & ~0x010; }
-                    if(foundFlags & 0x010) { egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+1]), &(mesh_out->vCoords[vCount])); mesh_out->fIndicies[faceIndex].face.iv2 = vCount++; }
+                        if((foundFlags & 0x010) && egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+1]), &(mesh_out->vCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 3, scanIndex); foundFlags = foundFlags & ~0x010; }
+                    if(foundFlags & 0x010) { egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+1]), &(mesh_out->vCoords[vCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 3, vCount++); }
                     
                     foundFlags = 0x100;
                     for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x100) && egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+2]), &(mesh_out->vCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.iv3 = scanIndex; foundFlags = foundFlags & ~0x100; }
-                    if(foundFlags & 0x100) { egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+2]), &(mesh_out->vCoords[vCount])); mesh_out->fIndicies[faceIndex].face.iv3 = vCount++; }
+                        if((foundFlags & 0x100) && egwVecIsEqual3f(&(mesh_in->vCoords[vertexIndex+2]), &(mesh_out->vCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 6, scanIndex); foundFlags = foundFlags & ~0x100; }
+                    if(foundFlags & 0x100) { egwVecCopy3f(&(mesh_in->vCoords[vertexIndex+2]), &(mesh_out->vCoords[vCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 6, vCount++); }
                 }
                 
                 if(mesh_out->nCoords) {
                     foundFlags = 0x002;
                     for(scanIndex = 0; scanIndex < nCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x002) && egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+0]), &(mesh_out->nCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.in1 = scanIndex; foundFlags = foundFlags & ~0x002; }
-                    if(foundFlags & 0x002) { egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+0]), &(mesh_out->nCoords[nCount])); mesh_out->fIndicies[faceIndex].face.in1 = nCount++; }
+                        if((foundFlags & 0x002) && egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+0]), &(mesh_out->nCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 1, scanIndex); foundFlags = foundFlags & ~0x002; }
+                    if(foundFlags & 0x002) { egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+0]), &(mesh_out->nCoords[nCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 1, nCount++); }
                     
                     foundFlags = 0x020;
                     for(scanIndex = 0; scanIndex < nCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x020) && egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+1]), &(mesh_out->nCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.in2 = scanIndex; foundFlags = foundFlags & ~0x020; }
-                    if(foundFlags & 0x020) { egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+1]), &(mesh_out->nCoords[nCount])); mesh_out->fIndicies[faceIndex].face.in2 = nCount++; }
+                        if((foundFlags & 0x020) && egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+1]), &(mesh_out->nCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 4, scanIndex); foundFlags = foundFlags & ~0x020; }
+                    if(foundFlags & 0x020) { egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+1]), &(mesh_out->nCoords[nCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 4, nCount++); }
                     
                     foundFlags = 0x200;
                     for(scanIndex = 0; scanIndex < nCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x200) && egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+2]), &(mesh_out->nCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.in3 = scanIndex; foundFlags = foundFlags & ~0x200; }
-                    if(foundFlags & 0x200) { egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+2]), &(mesh_out->nCoords[nCount])); mesh_out->fIndicies[faceIndex].face.in3 = nCount++; }
+                        if((foundFlags & 0x200) && egwVecIsEqual3f(&(mesh_in->nCoords[vertexIndex+2]), &(mesh_out->nCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 7, scanIndex); foundFlags = foundFlags & ~0x200; }
+                    if(foundFlags & 0x200) { egwVecCopy3f(&(mesh_in->nCoords[vertexIndex+2]), &(mesh_out->nCoords[nCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 7, nCount++); }
                 }
                 
                 if(mesh_out->tCoords) {
                     foundFlags = 0x004;
                     for(scanIndex = 0; scanIndex < tCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x004) && egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+0]), &(mesh_out->tCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.it1 = scanIndex; foundFlags = foundFlags & ~0x004; }
-                    if(foundFlags & 0x004) { egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+0]), &(mesh_out->tCoords[tCount])); mesh_out->fIndicies[faceIndex].face.it1 = tCount++; }
+                        if((foundFlags & 0x004) && egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+0]), &(mesh_out->tCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 2, scanIndex); foundFlags = foundFlags & ~0x004; }
+                    if(foundFlags & 0x004) { egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+0]), &(mesh_out->tCoords[tCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 2, tCount++); }
                     
                     foundFlags = 0x040;
                     for(scanIndex = 0; scanIndex < tCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x040) && egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+1]), &(mesh_out->tCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.it2 = scanIndex; foundFlags = foundFlags & ~0x040; }
-                    if(foundFlags & 0x040) { egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+1]), &(mesh_out->tCoords[tCount])); mesh_out->fIndicies[faceIndex].face.it2 = tCount++; }
+                        if((foundFlags & 0x040) && egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+1]), &(mesh_out->tCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 5, scanIndex); foundFlags = foundFlags & ~0x040; }
+                    if(foundFlags & 0x040) { egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+1]), &(mesh_out->tCoords[tCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 5, tCount++); }
                     
                     foundFlags = 0x400;
                     for(scanIndex = 0; scanIndex < tCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x400) && egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+2]), &(mesh_out->tCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.it3 = scanIndex; foundFlags = foundFlags & ~0x400; }
-                    if(foundFlags & 0x400) { egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+2]), &(mesh_out->tCoords[tCount])); mesh_out->fIndicies[faceIndex].face.it3 = tCount++; }
+                        if((foundFlags & 0x400) && egwVecIsEqual2f(&(mesh_in->tCoords[vertexIndex+2]), &(mesh_out->tCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 8, scanIndex); foundFlags = foundFlags & ~0x400; }
+                    if(foundFlags & 0x400) { egwVecCopy2f(&(mesh_in->tCoords[vertexIndex+2]), &(mesh_out->tCoords[tCount])); egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 8, tCount++); }
                 }
             }
             
@@ -1612,22 +1631,24 @@ egwSDITVAMeshf* egwMeshConvertSTVAfSDITVAf(const egwSTVAMeshf* mesh_in, egwSDITV
 }
 
 egwSTVAMeshf* egwMeshConvertSJITVAfSTVAf(const egwSJITVAMeshf* mesh_in, egwSTVAMeshf* mesh_out) {
+    EGWint wide = egwMeshIsWideIndexed(mesh_in->vCount);
+    
     if(egwMeshAllocSTVAf(mesh_out, (mesh_in->vCoords ? mesh_in->fCount * 3 : 0), (mesh_in->nCoords ? mesh_in->fCount * 3 : 0), (mesh_in->tCoords ? mesh_in->fCount * 3 : 0))) {
         for(EGWint faceIndex = 0, vertexIndex = 0; faceIndex < mesh_in->fCount && vertexIndex < mesh_out->vCount; ++faceIndex, vertexIndex += 3) {
             if(mesh_in->vCoords && mesh_out->vCoords) {
-                egwVecCopy3f(&(mesh_in->vCoords[mesh_in->fIndicies[faceIndex].face.i1]), &(mesh_out->vCoords[vertexIndex+0]));
-                egwVecCopy3f(&(mesh_in->vCoords[mesh_in->fIndicies[faceIndex].face.i2]), &(mesh_out->vCoords[vertexIndex+1]));
-                egwVecCopy3f(&(mesh_in->vCoords[mesh_in->fIndicies[faceIndex].face.i3]), &(mesh_out->vCoords[vertexIndex+2]));
+                egwVecCopy3f(&(mesh_in->vCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 0)]), &(mesh_out->vCoords[vertexIndex+0]));
+                egwVecCopy3f(&(mesh_in->vCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 1)]), &(mesh_out->vCoords[vertexIndex+1]));
+                egwVecCopy3f(&(mesh_in->vCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 2)]), &(mesh_out->vCoords[vertexIndex+2]));
             }
             if(mesh_in->nCoords && mesh_out->nCoords) {
-                egwVecCopy3f(&(mesh_in->nCoords[mesh_in->fIndicies[faceIndex].face.i1]), &(mesh_out->nCoords[vertexIndex+0]));
-                egwVecCopy3f(&(mesh_in->nCoords[mesh_in->fIndicies[faceIndex].face.i2]), &(mesh_out->nCoords[vertexIndex+1]));
-                egwVecCopy3f(&(mesh_in->nCoords[mesh_in->fIndicies[faceIndex].face.i3]), &(mesh_out->nCoords[vertexIndex+2]));
+                egwVecCopy3f(&(mesh_in->nCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 0)]), &(mesh_out->nCoords[vertexIndex+0]));
+                egwVecCopy3f(&(mesh_in->nCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 1)]), &(mesh_out->nCoords[vertexIndex+1]));
+                egwVecCopy3f(&(mesh_in->nCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 2)]), &(mesh_out->nCoords[vertexIndex+2]));
             }
             if(mesh_in->tCoords && mesh_out->tCoords) {
-                egwVecCopy2f(&(mesh_in->tCoords[mesh_in->fIndicies[faceIndex].face.i1]), &(mesh_out->tCoords[vertexIndex+0]));
-                egwVecCopy2f(&(mesh_in->tCoords[mesh_in->fIndicies[faceIndex].face.i2]), &(mesh_out->tCoords[vertexIndex+1]));
-                egwVecCopy2f(&(mesh_in->tCoords[mesh_in->fIndicies[faceIndex].face.i3]), &(mesh_out->tCoords[vertexIndex+2]));
+                egwVecCopy2f(&(mesh_in->tCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 0)]), &(mesh_out->tCoords[vertexIndex+0]));
+                egwVecCopy2f(&(mesh_in->tCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 1)]), &(mesh_out->tCoords[vertexIndex+1]));
+                egwVecCopy2f(&(mesh_in->tCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 2)]), &(mesh_out->tCoords[vertexIndex+2]));
             }
         }
         
@@ -1650,22 +1671,24 @@ egwSDITVAMeshf* egwMeshConvertSJITVAfSDITVAf(const egwSJITVAMeshf* mesh_in, egwS
 }
 
 egwSTVAMeshf* egwMeshConvertSDITVAfSTVAf(const egwSDITVAMeshf* mesh_in, egwSTVAMeshf* mesh_out) {
+    EGWint wide = egwMeshIsWideIndexed(egwMax2ui(mesh_in->vCount, egwMax2ui(mesh_in->nCount, mesh_in->tCount)));
+    
     if(egwMeshAllocSTVAf(mesh_out, (mesh_in->vCoords ? mesh_in->fCount * 3 : 0), (mesh_in->nCoords ? mesh_in->fCount * 3 : 0), (mesh_in->tCoords ? mesh_in->fCount * 3 : 0))) {
         for(EGWint faceIndex = 0, vertexIndex = 0; faceIndex < mesh_in->fCount && vertexIndex < mesh_out->vCount; ++faceIndex, vertexIndex += 3) {
             if(mesh_in->vCoords && mesh_out->vCoords) {
-                egwVecCopy3f(&(mesh_in->vCoords[mesh_in->fIndicies[faceIndex].face.iv1]), &(mesh_out->vCoords[vertexIndex+0]));
-                egwVecCopy3f(&(mesh_in->vCoords[mesh_in->fIndicies[faceIndex].face.iv2]), &(mesh_out->vCoords[vertexIndex+1]));
-                egwVecCopy3f(&(mesh_in->vCoords[mesh_in->fIndicies[faceIndex].face.iv3]), &(mesh_out->vCoords[vertexIndex+2]));
+                egwVecCopy3f(&(mesh_in->vCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 0)]), &(mesh_out->vCoords[vertexIndex+0]));
+                egwVecCopy3f(&(mesh_in->vCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 3)]), &(mesh_out->vCoords[vertexIndex+1]));
+                egwVecCopy3f(&(mesh_in->vCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 6)]), &(mesh_out->vCoords[vertexIndex+2]));
             }
             if(mesh_in->nCoords && mesh_out->nCoords) {
-                egwVecCopy3f(&(mesh_in->nCoords[mesh_in->fIndicies[faceIndex].face.in1]), &(mesh_out->nCoords[vertexIndex+0]));
-                egwVecCopy3f(&(mesh_in->nCoords[mesh_in->fIndicies[faceIndex].face.in2]), &(mesh_out->nCoords[vertexIndex+1]));
-                egwVecCopy3f(&(mesh_in->nCoords[mesh_in->fIndicies[faceIndex].face.in3]), &(mesh_out->nCoords[vertexIndex+2]));
+                egwVecCopy3f(&(mesh_in->nCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 1)]), &(mesh_out->nCoords[vertexIndex+0]));
+                egwVecCopy3f(&(mesh_in->nCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 4)]), &(mesh_out->nCoords[vertexIndex+1]));
+                egwVecCopy3f(&(mesh_in->nCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 7)]), &(mesh_out->nCoords[vertexIndex+2]));
             }
             if(mesh_in->tCoords && mesh_out->tCoords) {
-                egwVecCopy2f(&(mesh_in->tCoords[mesh_in->fIndicies[faceIndex].face.it1]), &(mesh_out->tCoords[vertexIndex+0]));
-                egwVecCopy2f(&(mesh_in->tCoords[mesh_in->fIndicies[faceIndex].face.it2]), &(mesh_out->tCoords[vertexIndex+1]));
-                egwVecCopy2f(&(mesh_in->tCoords[mesh_in->fIndicies[faceIndex].face.it3]), &(mesh_out->tCoords[vertexIndex+2]));
+                egwVecCopy2f(&(mesh_in->tCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 2)]), &(mesh_out->tCoords[vertexIndex+0]));
+                egwVecCopy2f(&(mesh_in->tCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 5)]), &(mesh_out->tCoords[vertexIndex+1]));
+                egwVecCopy2f(&(mesh_in->tCoords[egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 8)]), &(mesh_out->tCoords[vertexIndex+2]));
             }
         }
         
@@ -1705,6 +1728,7 @@ egwKFJITVAMeshf* egwMeshConvertKFTVAfKFJITVAf(const egwKFTVAMeshf* mesh_in, egwK
         
         if(egwMeshAllocKFJITVAf(mesh_out, (mesh_in->vkCoords ? vCount : 0), (mesh_in->nkCoords ? vCount : 0), (mesh_in->tkCoords ? vCount : 0), (mesh_in->vCount / 3), mesh_in->vfCount, mesh_in->nfCount, mesh_in->tfCount)) {
             EGWint faceIndex;
+            EGWint wide = egwMeshIsWideIndexed(mesh_out->vCount);
             vCount = 0;
             
             for(faceIndex = 0, vertexIndex = 0; faceIndex < mesh_out->fCount && vertexIndex < mesh_in->vCount; ++faceIndex, vertexIndex += 3) {
@@ -1712,7 +1736,7 @@ egwKFJITVAMeshf* egwMeshConvertKFTVAfKFJITVAf(const egwKFTVAMeshf* mesh_in, egwK
                 for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex) {
                     if((foundFlags & 0x007) && (!(mesh_in->vkCoords && mesh_out->vkCoords) || egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+0]), &(mesh_out->vkCoords[scanIndex])))
                        && (!(mesh_in->nkCoords && mesh_out->nkCoords) || egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+0]), &(mesh_out->nkCoords[scanIndex])))
-                       && (!(mesh_in->tkCoords && mesh_out->tkCoords) || egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+0]), &(mesh_out->tkCoords[scanIndex])))) { mesh_out->fIndicies[faceIndex].face.i1 = scanIndex; foundFlags = foundFlags & ~0x007; } }
+                       && (!(mesh_in->tkCoords && mesh_out->tkCoords) || egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+0]), &(mesh_out->tkCoords[scanIndex])))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 0, scanIndex); foundFlags = foundFlags & ~0x007; } }
                 if(foundFlags & 0x007) {
                     if(mesh_in->vkCoords && mesh_out->vkCoords)
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset)
@@ -1723,14 +1747,14 @@ egwKFJITVAMeshf* egwMeshConvertKFTVAfKFJITVAf(const egwKFTVAMeshf* mesh_in, egwK
                     if(mesh_in->tkCoords && mesh_out->tkCoords)
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset)
                             egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+0]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vCount]));
-                    mesh_out->fIndicies[faceIndex].face.i1 = vCount++;
+                    egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 0, vCount++);
                 }
                 
                 foundFlags = 0x070;
                 for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex) {
                     if((foundFlags & 0x070) && (!(mesh_in->vkCoords && mesh_out->vkCoords) || egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+1]), &(mesh_out->vkCoords[scanIndex])))
                        && (!(mesh_in->nkCoords && mesh_out->nkCoords) || egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+1]), &(mesh_out->nkCoords[scanIndex])))
-                       && (!(mesh_in->tkCoords && mesh_out->tkCoords) || egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+1]), &(mesh_out->tkCoords[scanIndex])))) { mesh_out->fIndicies[faceIndex].face.i2 = scanIndex; foundFlags = foundFlags & ~0x070; } }
+                       && (!(mesh_in->tkCoords && mesh_out->tkCoords) || egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+1]), &(mesh_out->tkCoords[scanIndex])))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 1, scanIndex); foundFlags = foundFlags & ~0x070; } }
                 if(foundFlags & 0x070) {
                     if(mesh_in->vkCoords && mesh_out->vkCoords)
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset)
@@ -1741,14 +1765,14 @@ egwKFJITVAMeshf* egwMeshConvertKFTVAfKFJITVAf(const egwKFTVAMeshf* mesh_in, egwK
                     if(mesh_in->tkCoords && mesh_out->tkCoords)
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset)
                             egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+1]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vCount]));
-                    mesh_out->fIndicies[faceIndex].face.i2 = vCount++;
+                    egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 1, vCount++);
                 }
                 
                 foundFlags = 0x700;
                 for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex) {
                     if((foundFlags & 0x700) && (!(mesh_in->vkCoords && mesh_out->vkCoords) || egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+2]), &(mesh_out->vkCoords[scanIndex])))
                        && (!(mesh_in->nkCoords && mesh_out->nkCoords) || egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+2]), &(mesh_out->nkCoords[scanIndex])))
-                       && (!(mesh_in->tkCoords && mesh_out->tkCoords) || egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+2]), &(mesh_out->tkCoords[scanIndex])))) { mesh_out->fIndicies[faceIndex].face.i3 = scanIndex; foundFlags = foundFlags & ~0x700; } }
+                       && (!(mesh_in->tkCoords && mesh_out->tkCoords) || egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+2]), &(mesh_out->tkCoords[scanIndex])))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 2, scanIndex); foundFlags = foundFlags & ~0x700; } }
                 if(foundFlags & 0x700) {
                     if(mesh_in->vkCoords && mesh_out->vkCoords)
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset)
@@ -1759,7 +1783,7 @@ egwKFJITVAMeshf* egwMeshConvertKFTVAfKFJITVAf(const egwKFTVAMeshf* mesh_in, egwK
                     if(mesh_in->tkCoords && mesh_out->tkCoords)
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset)
                             egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+2]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vCount]));
-                    mesh_out->fIndicies[faceIndex].face.i3 = vCount++;
+                    egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 3) + 2, vCount++);
                 }
             }
             
@@ -1791,93 +1815,94 @@ egwKFDITVAMeshf* egwMeshConvertKFTVAfKFDITVAf(const egwKFTVAMeshf* mesh_in, egwK
         
         if(egwMeshAllocKFDITVAf(mesh_out, vCount, nCount, tCount, (mesh_in->vCount / 3), mesh_in->vfCount, mesh_in->nfCount, mesh_in->tfCount)) {
             EGWint faceIndex;
+            EGWint wide = egwMeshIsWideIndexed(egwMax2ui(mesh_out->vCount, egwMax2ui(mesh_out->nCount, mesh_out->tCount)));
             vCount = nCount = tCount = 0;
             
             for(faceIndex = 0, vertexIndex = 0; faceIndex < mesh_out->fCount && vertexIndex < mesh_in->vCount; ++faceIndex, vertexIndex += 3) {
                 if(mesh_out->vkCoords) {
                     foundFlags = 0x001;
                     for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x001) && egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+0]), &(mesh_out->vkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.iv1 = scanIndex; foundFlags = foundFlags & ~0x001; }
+                        if((foundFlags & 0x001) && egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+0]), &(mesh_out->vkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 0, scanIndex); foundFlags = foundFlags & ~0x001; }
                     if(foundFlags & 0x001) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset)
                             egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+0]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vCount]));
-                        mesh_out->fIndicies[faceIndex].face.iv1 = vCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 0, vCount++);
                     }
                     
                     foundFlags = 0x010;
                     for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x010) && egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+1]), &(mesh_out->vkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.iv2 = scanIndex; foundFlags = foundFlags & ~0x010; }
+                        if((foundFlags & 0x010) && egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+1]), &(mesh_out->vkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 3, scanIndex); foundFlags = foundFlags & ~0x010; }
                     if(foundFlags & 0x010) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset)
                             egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+1]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vCount]));
-                        mesh_out->fIndicies[faceIndex].face.iv2 = vCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 3, vCount++);
                     }
                     
                     foundFlags = 0x100;
                     for(scanIndex = 0; scanIndex < vCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x100) && egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+2]), &(mesh_out->vkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.iv3 = scanIndex; foundFlags = foundFlags & ~0x100; }
+                        if((foundFlags & 0x100) && egwVecIsEqual3f(&(mesh_in->vkCoords[vertexIndex+2]), &(mesh_out->vkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 6, scanIndex); foundFlags = foundFlags & ~0x100; }
                     if(foundFlags & 0x100) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset)
                             egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+2]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vCount]));
-                        mesh_out->fIndicies[faceIndex].face.iv3 = vCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 6, vCount++);
                     }
                 }
                 
                 if(mesh_out->nkCoords) {
                     foundFlags = 0x002;
                     for(scanIndex = 0; scanIndex < nCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x002) && egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+0]), &(mesh_out->nkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.in1 = scanIndex; foundFlags = foundFlags & ~0x002; }
+                        if((foundFlags & 0x002) && egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+0]), &(mesh_out->nkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 1, scanIndex); foundFlags = foundFlags & ~0x002; }
                     if(foundFlags & 0x002) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->nfCount ? mesh_in->nfCount : 1); ++frameOffset)
                             egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+0]), &(mesh_out->nkCoords[(mesh_out->nCount * frameOffset) + nCount]));
-                        mesh_out->fIndicies[faceIndex].face.in1 = nCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 1, nCount++);
                     }
                     
                     foundFlags = 0x020;
                     for(scanIndex = 0; scanIndex < nCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x020) && egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+1]), &(mesh_out->nkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.in2 = scanIndex; foundFlags = foundFlags & ~0x020; }
+                        if((foundFlags & 0x020) && egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+1]), &(mesh_out->nkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 4, scanIndex); foundFlags = foundFlags & ~0x020; }
                     if(foundFlags & 0x020) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->nfCount ? mesh_in->nfCount : 1); ++frameOffset)
                             egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+1]), &(mesh_out->nkCoords[(mesh_out->nCount * frameOffset) + nCount]));
-                        mesh_out->fIndicies[faceIndex].face.in2 = nCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 4, nCount++);
                     }
                     
                     foundFlags = 0x200;
                     for(scanIndex = 0; scanIndex < nCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x200) && egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+2]), &(mesh_out->nkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.in3 = scanIndex; foundFlags = foundFlags & ~0x200; }
+                        if((foundFlags & 0x200) && egwVecIsEqual3f(&(mesh_in->nkCoords[vertexIndex+2]), &(mesh_out->nkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 7, scanIndex); foundFlags = foundFlags & ~0x200; }
                     if(foundFlags & 0x200) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->nfCount ? mesh_in->nfCount : 1); ++frameOffset)
                             egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+2]), &(mesh_out->nkCoords[(mesh_out->nCount * frameOffset) + nCount]));
-                        mesh_out->fIndicies[faceIndex].face.in3 = nCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 7, nCount++);
                     }
                 }
                 
                 if(mesh_out->tkCoords) {
                     foundFlags = 0x004;
                     for(scanIndex = 0; scanIndex < tCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x004) && egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+0]), &(mesh_out->tkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.it1 = scanIndex; foundFlags = foundFlags & ~0x004; }
+                        if((foundFlags & 0x004) && egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+0]), &(mesh_out->tkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 2, scanIndex); foundFlags = foundFlags & ~0x004; }
                     if(foundFlags & 0x004) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset)
                             egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+0]), &(mesh_out->tkCoords[(mesh_out->tCount * frameOffset) + tCount]));
-                        mesh_out->fIndicies[faceIndex].face.it1 = tCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 2, tCount++);
                     }
                     
                     foundFlags = 0x040;
                     for(scanIndex = 0; scanIndex < tCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x040) && egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+1]), &(mesh_out->tkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.it2 = scanIndex; foundFlags = foundFlags & ~0x040; }
+                        if((foundFlags & 0x040) && egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+1]), &(mesh_out->tkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 5, scanIndex); foundFlags = foundFlags & ~0x040; }
                     if(foundFlags & 0x040) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset)
                             egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+1]), &(mesh_out->tkCoords[(mesh_out->tCount * frameOffset) + tCount]));
-                        mesh_out->fIndicies[faceIndex].face.it2 = tCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 5, tCount++);
                     }
                     
                     foundFlags = 0x400;
                     for(scanIndex = 0; scanIndex < tCount && foundFlags; ++scanIndex)
-                        if((foundFlags & 0x400) && egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+2]), &(mesh_out->tkCoords[scanIndex]))) { mesh_out->fIndicies[faceIndex].face.it3 = scanIndex; foundFlags = foundFlags & ~0x400; }
+                        if((foundFlags & 0x400) && egwVecIsEqual2f(&(mesh_in->tkCoords[vertexIndex+2]), &(mesh_out->tkCoords[scanIndex]))) { egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 8, scanIndex); foundFlags = foundFlags & ~0x400; }
                     if(foundFlags & 0x400) {
                         for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset)
                             egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + vertexIndex+2]), &(mesh_out->tkCoords[(mesh_out->tCount * frameOffset) + tCount]));
-                        mesh_out->fIndicies[faceIndex].face.it3 = tCount++;
+                        egwMeshFaceIndexSet((void*)mesh_out->fIndicies, wide, (faceIndex * 9) + 8, tCount++);
                     }
                 }
             }
@@ -1891,27 +1916,29 @@ egwKFDITVAMeshf* egwMeshConvertKFTVAfKFDITVAf(const egwKFTVAMeshf* mesh_in, egwK
 }
 
 egwKFTVAMeshf* egwMeshConvertKFJITVAfKFTVAf(const egwKFJITVAMeshf* mesh_in, egwKFTVAMeshf* mesh_out) {
+    EGWint wide = egwMeshIsWideIndexed(mesh_in->vCount);
+    
     if(egwMeshAllocKFTVAf(mesh_out, (mesh_in->vkCoords ? mesh_in->fCount * 3 : 0), (mesh_in->nkCoords ? mesh_in->fCount * 3 : 0), (mesh_in->tkCoords ? mesh_in->fCount * 3 : 0), mesh_in->vfCount, mesh_in->nfCount, mesh_in->tfCount)) {
         for(EGWint faceIndex = 0, vertexIndex = 0; faceIndex < mesh_in->fCount && vertexIndex < mesh_out->vCount; ++faceIndex, vertexIndex += 3) {
             if(mesh_in->vkCoords && mesh_out->vkCoords) {
                 for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset) {
-                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i1]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
-                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i2]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
-                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i3]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
+                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 0)]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
+                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 1)]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
+                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 2)]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
                 }
             }
             if(mesh_in->nkCoords && mesh_out->nkCoords) {
                 for(EGWint frameOffset = 0; frameOffset < (mesh_in->nfCount ? mesh_in->nfCount : 1); ++frameOffset) {
-                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i1]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
-                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i2]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
-                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i3]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
+                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 0)]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
+                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 1)]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
+                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 2)]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
                 }
             }
             if(mesh_in->tkCoords && mesh_out->tkCoords) {
                 for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset) {
-                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i1]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
-                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i2]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
-                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.i3]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
+                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 0)]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
+                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 1)]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
+                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 3) + 2)]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
                 }
             }
         }
@@ -1935,27 +1962,29 @@ egwKFDITVAMeshf* egwMeshConvertKFJITVAfKFDITVAf(const egwKFJITVAMeshf* mesh_in,
 }
 
 egwKFTVAMeshf* egwMeshConvertKFDITVAfKFTVAf(const egwKFDITVAMeshf* mesh_in, egwKFTVAMeshf* mesh_out) {
+    EGWint wide = egwMeshIsWideIndexed(egwMax2ui(mesh_in->vCount, egwMax2ui(mesh_in->nCount, mesh_in->tCount)));
+    
     if(egwMeshAllocKFTVAf(mesh_out, (mesh_in->vkCoords ? mesh_in->fCount * 3 : 0), (mesh_in->nkCoords ? mesh_in->fCount * 3 : 0), (mesh_in->tkCoords ? mesh_in->fCount * 3 : 0), mesh_in->vfCount, mesh_in->nfCount, mesh_in->tfCount)) {
         for(EGWint faceIndex = 0, vertexIndex = 0; faceIndex < mesh_in->fCount && vertexIndex < mesh_out->vCount; ++faceIndex, vertexIndex += 3) {
             if(mesh_in->vkCoords && mesh_out->vkCoords) {
                 for(EGWint frameOffset = 0; frameOffset < (mesh_in->vfCount ? mesh_in->vfCount : 1); ++frameOffset) {
-                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.iv1]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
-                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.iv2]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
-                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.iv3]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
+                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 0)]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
+                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 3)]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
+                    egwVecCopy3f(&(mesh_in->vkCoords[(mesh_in->vCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 6)]), &(mesh_out->vkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
                 }
             }
             if(mesh_in->nkCoords && mesh_out->nkCoords) {
                 for(EGWint frameOffset = 0; frameOffset < (mesh_in->nfCount ? mesh_in->nfCount : 1); ++frameOffset) {
-                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->nCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.in1]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
-                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->nCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.in2]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
-                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->nCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.in3]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
+                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->nCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 1)]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
+                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->nCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 4)]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
+                    egwVecCopy3f(&(mesh_in->nkCoords[(mesh_in->nCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 7)]), &(mesh_out->nkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
                 }
             }
             if(mesh_in->tkCoords && mesh_out->tkCoords) {
                 for(EGWint frameOffset = 0; frameOffset < (mesh_in->tfCount ? mesh_in->tfCount : 1); ++frameOffset) {
-                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->tCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.it1]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
-                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->tCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.it2]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
-                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->tCount * frameOffset) + mesh_in->fIndicies[faceIndex].face.it3]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
+                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->tCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 2)]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+0]));
+                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->tCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 5)]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+1]));
+                    egwVecCopy2f(&(mesh_in->tkCoords[(mesh_in->tCount * frameOffset) + egwMeshFaceIndexGet((const void*)mesh_in->fIndicies, wide, (faceIndex * 9) + 8)]), &(mesh_out->tkCoords[(mesh_out->vCount * frameOffset) + vertexIndex+2]));
                 }
             }
         }
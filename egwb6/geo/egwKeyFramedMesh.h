@@ -125,7 +125,7 @@
 /// @param [in] shdrStack Associated shader stack (retained). May be nil (uses default).
 /// @param [in] txtrStack Associated texture stack (retained). May be nil (for non-textured).
 /// @return Self upon success, otherwise nil.
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount vertexPolationMode:(EGWuint32)vrtPolationMode normalFrameCount:(EGWuint16)nrmFrmCount normalPolationMode:(EGWuint32)nrmPolationMode textureFrameCount:(EGWuint16)texFrmCount texturePolationMode:(EGWuint32)texPolationMode geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack;
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount vertexPolationMode:(EGWuint32)vrtPolationMode normalFrameCount:(EGWuint16)nrmFrmCount normalPolationMode:(EGWuint32)nrmPolationMode textureFrameCount:(EGWuint16)texFrmCount texturePolationMode:(EGWuint32)texPolationMode geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack;
 
 /// Copy Initializer.
 /// Copies a mesh asset with provided unique settings.
@@ -206,7 +206,7 @@
 /// @param [in] nrmFrmCount Normal key frames count [0|[1,inf]].
 /// @param [in] texFrmCount Texture key frames count [0|[1,inf]].
 /// @return Self upon success, otherwise nil.
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount normalFrameCount:(EGWuint16)nrmFrmCount textureFrameCount:(EGWuint16)texFrmCount;
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount normalFrameCount:(EGWuint16)nrmFrmCount textureFrameCount:(EGWuint16)texFrmCount;
 
 
 /// Base Offset (byTransform) Method.
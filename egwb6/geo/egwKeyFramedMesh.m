@@ -30,6 +30,7 @@
 #import "../sys/egwGfxContext.h"
 #import "../sys/egwGfxContextNSGL.h"  // NOTE: Below code has a dependence on GL.
 #import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwGfxRenderer.h"
 #import "../math/egwVector.h"
 #import "../math/egwMatrix.h"
@@ -62,6 +63,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         _egwRJT.fpRFlags = (EGWuint32(*)(id, SEL))[inst methodForSelector:@selector(renderingFlags)];
         _egwRJT.fpRFrame = (EGWuint16(*)(id, SEL))[inst methodForSelector:@selector(renderingFrame)];
         _egwRJT.fpRSource = (const egwVector4f*(*)(id, SEL))[inst methodForSelector:@selector(renderingSource)];
+        _egwRJT.fpRBVol = (id<egwPBounding>(*)(id, SEL))[inst methodForSelector:@selector(renderingBounding)];
         _egwRJT.fpRSync = (egwValidater*(*)(id, SEL))[inst methodForSelector:@selector(renderingSync)];
         _egwRJT.fpLStack = (egwLightStack*(*)(id, SEL))[inst methodForSelector:@selector(lightStack)];
         _egwRJT.fpMStack = (egwMaterialStack*(*)(id, SEL))[inst methodForSelector:@selector(materialStack)];
@@ -145,7 +147,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     return self;
 }
 
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount vertexPolationMode:(EGWuint32)vrtPolationMode normalFrameCount:(EGWuint16)nrmFrmCount normalPolationMode:(EGWuint32)nrmPolationMode textureFrameCount:(EGWuint16)texFrmCount texturePolationMode:(EGWuint32)texPolationMode geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack {
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount vertexPolationMode:(EGWuint32)vrtPolationMode normalFrameCount:(EGWuint16)nrmFrmCount normalPolationMode:(EGWuint32)nrmPolationMode textureFrameCount:(EGWuint16)texFrmCount texturePolationMode:(EGWuint32)texPolationMode geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack {
     if(!vrtxCount || !faceCount || vrtxCount > 3 * faceCount || !(vrtFrmCount || nrmFrmCount || texFrmCount) || !(self = [super init])) { [self release]; return (self = nil); }
     
     if(!(_base = [[egwKeyFramedMeshBase alloc] initBlankWithIdentity:assetIdent vertexCount:vrtxCount faceCount:faceCount vertexFrameCount:vrtFrmCount normalFrameCount:nrmFrmCount textureFrameCount:texFrmCount])) { [self release]; return (self = nil); }
@@ -382,14 +384,14 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     
     if(_kfMesh->vtIndicies) {
         EGWtime vrtAbsT = _eAbsT;
-        
+    
     HandleVCyclic: // !!!: KF: handle cyclic v-knot.
-        
+    
         if((_vTrack.pMode & EGW_POLATION_EXEXTRA) & EGW_POLATION_EXCYCLIC)
             vrtAbsT = egwClampm(egwModm(vrtAbsT - _kfMesh->vtIndicies[0], _kfMesh->vtIndicies[_kfMesh->vfCount-1] - _kfMesh->vtIndicies[0]) + _kfMesh->vtIndicies[0], _kfMesh->vtIndicies[0], _kfMesh->vtIndicies[_kfMesh->vfCount-1]);
-        
+    
     FindVIndex: // !!!: KF: find v-index.
-        
+    
         if(_vTrack.kIndex == -1) { // Binsearch the frame index up
             if(vrtAbsT >= _kfMesh->vtIndicies[0] - EGW_TIME_EPSILON) {
                 if(vrtAbsT <= _kfMesh->vtIndicies[_kfMesh->vfCount-1] + EGW_TIME_EPSILON) {
@@ -408,9 +410,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
             } else _vTrack.kIndex = 0;
             _vTrack.line.okFrame = NULL;
         }
-        
+    
     VerifyVIndex: // !!!: KF: verify v-index.
-        
+    
         if(lookForward) { // Look forward
             if(_kfMesh->vfCount > 1 && (
                 (_vTrack.kIndex >= 1 && _vTrack.kIndex < _kfMesh->vfCount && !(vrtAbsT <= _kfMesh->vtIndicies[_vTrack.kIndex] + EGW_TIME_EPSILON && vrtAbsT >= _kfMesh->vtIndicies[_vTrack.kIndex-1] - EGW_TIME_EPSILON)) || // Past current knot end
@@ -446,9 +448,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
             }
         }
-        
+    
     FindVOffsets: // !!!: KF: find v-frame offsets.
-        
+    
         if(!_vTrack.line.okFrame) { // Acts as a sentinel to force update when NULL
             if(_kfMesh->vfCount > 1 && _vTrack.kIndex >= 1 && _vTrack.kIndex < _kfMesh->vfCount) { // Interpolate required
                 EGWint indexOffset = (((_vTrack.pMode & EGW_POLATION_EXINTER) & EGW_POLATION_EXKNTPSHBKX1) ? 1 : 0) +
@@ -484,9 +486,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
             }
         }
-        
+    
     WriteVVector: // !!!: KF: write v-vector.
-        
+    
         if(_vTrack.line.okFrame) {
             if(_vTrack.kIndex >= 1 && _vTrack.kIndex < _kfMesh->vfCount) // Interpolate required
                 _vTrack.fpIpoFunc(&_vTrack.line, vrtAbsT, (EGWbyte*)_ipMesh.vCoords);
@@ -503,14 +505,14 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     
     if(_kfMesh->ntIndicies) {
         EGWtime nrmAbsT = _eAbsT;
-        
+    
     HandleNCyclic: // !!!: KF: handle cyclic n-knot.
-        
+    
         if((_nTrack.pMode & EGW_POLATION_EXEXTRA) & EGW_POLATION_EXCYCLIC)
             nrmAbsT = egwClampm(egwModm(nrmAbsT - _kfMesh->ntIndicies[0], _kfMesh->ntIndicies[_kfMesh->nfCount-1] - _kfMesh->ntIndicies[0]) + _kfMesh->ntIndicies[0], _kfMesh->ntIndicies[0], _kfMesh->ntIndicies[_kfMesh->nfCount-1]);
-        
+    
     FindNIndex: // !!!: KF: find n-index.
-        
+    
         if(_kfMesh->ntIndicies == _kfMesh->vtIndicies) { // Frame index overlap special case
             if(_nTrack.kIndex != _vTrack.kIndex) {
                 _nTrack.kIndex = _vTrack.kIndex;
@@ -537,9 +539,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
             } else _nTrack.kIndex = 0;
             _nTrack.line.okFrame = NULL;
         }
-        
+    
     VerifyNIndex: // !!!: KF: verify n-index.
-        
+    
         if(lookForward) { // Look forward
             if(_kfMesh->nfCount > 1 && (
                 (_nTrack.kIndex >= 1 && _nTrack.kIndex < _kfMesh->nfCount && !(nrmAbsT <= _kfMesh->ntIndicies[_nTrack.kIndex] + EGW_TIME_EPSILON && nrmAbsT >= _kfMesh->ntIndicies[_nTrack.kIndex-1] - EGW_TIME_EPSILON)) || // Past current knot end
@@ -575,9 +577,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
             }
         }
-        
+    
     FindNOffsets: // !!!: KF: find n-frame offsets.
-        
+    
         if(!_nTrack.line.okFrame) { // Acts as a sentinel to force update when NULL
             if(_kfMesh->nfCount > 1 && _nTrack.kIndex >= 1 && _nTrack.kIndex < _kfMesh->nfCount) { // Interpolate required
                 EGWint indexOffset = (((_nTrack.pMode & EGW_POLATION_EXINTER) & EGW_POLATION_EXKNTPSHBKX1) ? 1 : 0) +
@@ -613,9 +615,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
             }
         }
-        
+    
     WriteNVector: // !!!: KF: write n-vector.
-        
+    
         if(_nTrack.line.okFrame) {
             if(_nTrack.kIndex >= 1 && _nTrack.kIndex < _kfMesh->nfCount) // Interpolate required
                 _nTrack.fpIpoFunc(&_nTrack.line, nrmAbsT, (EGWbyte*)_ipMesh.nCoords);
@@ -629,14 +631,14 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     
     if(_kfMesh->ttIndicies) {
         EGWtime texAbsT = _eAbsT;
-        
+    
     HandleTCyclic: // !!!: KF: handle cyclic t-knot.
-        
+    
         if((_tTrack.pMode & EGW_POLATION_EXEXTRA) & EGW_POLATION_EXCYCLIC)
             texAbsT = egwClampm(egwModm(texAbsT - _kfMesh->ttIndicies[0], _kfMesh->ttIndicies[_kfMesh->tfCount-1] - _kfMesh->ttIndicies[0]) + _kfMesh->ttIndicies[0], _kfMesh->ttIndicies[0], _kfMesh->ttIndicies[_kfMesh->tfCount-1]);
-        
+    
     FindTIndex: // !!!: KF: find t-index.
-        
+    
         if(_kfMesh->ttIndicies == _kfMesh->vtIndicies) { // Frame index overlap special case
             if(_tTrack.kIndex != _vTrack.kIndex) {
                 _tTrack.kIndex = _vTrack.kIndex;
@@ -669,9 +671,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
             } else _tTrack.kIndex = 0;
             _tTrack.line.okFrame = NULL;
         }
-        
+    
     VerifyTIndex: // !!!: KF: verify t-index.
-        
+    
         if(lookForward) { // Look forward
             if(_kfMesh->tfCount > 1 && (
                 (_tTrack.kIndex >= 1 && _tTrack.kIndex < _kfMesh->tfCount && !(texAbsT <= _kfMesh->ttIndicies[_tTrack.kIndex] + EGW_TIME_EPSILON && texAbsT >= _kfMesh->ttIndicies[_tTrack.kIndex-1] - EGW_TIME_EPSILON)) || // Past current knot end
@@ -707,9 +709,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
             }
         }
-        
+    
     FindTOffsets: // !!!: KF: find t-frame offsets.
-        
+    
         if(!_tTrack.line.okFrame) { // Acts as a sentinel to force update when NULL
             if(_kfMesh->tfCount > 1 && _tTrack.kIndex >= 1 && _tTrack.kIndex < _kfMesh->tfCount) { // Interpolate required
                 EGWint indexOffset = (((_tTrack.pMode & EGW_POLATION_EXINTER) & EGW_POLATION_EXKNTPSHBKX1) ? 1 : 0) +
@@ -745,9 +747,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
             }
         }
-        
+    
     WriteTVector: // !!!: KF: write t-vector.
-        
+    
         if(_tTrack.line.okFrame) {
             if(_tTrack.kIndex >= 1 && _tTrack.kIndex < _kfMesh->tfCount) // Interpolate required
                 _tTrack.fpIpoFunc(&_tTrack.line, texAbsT, (EGWbyte*)_ipMesh.tCoords);
@@ -850,7 +852,8 @@ static egwRenderableJumpTable _egwRJT = { NULL };
             
             egw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _geoEID);
             
-            glDrawElements(GL_TRIANGLES, (GLsizei)(_ipMesh.fCount * 3), GL_UNSIGNED_SHORT, (const GLvoid*)(EGWuintptr)0);
+            glDrawElements(GL_TRIANGLES, (GLsizei)(_ipMesh.fCount * 3), (egwMeshIsWideIndexed(_ipMesh.vCount) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT), (const GLvoid*)(EGWuintptr)0);
+            egwGfxCntxNullCountDraws(1);
         } else {
             if(egw_glBindBuffer(GL_ARRAY_BUFFER, 0) || !(flags & EGW_GFXOBJ_RPLYFLG_SAMELASTBASE)) {
                 glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)_ipMesh.vCoords);
@@ -860,7 +863,8 @@ static egwRenderableJumpTable _egwRJT = { NULL };
             
             egw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             
-            glDrawElements(GL_TRIANGLES, (GLsizei)(_ipMesh.fCount * 3), GL_UNSIGNED_SHORT, (const GLvoid*)_ipMesh.fIndicies);
+            glDrawElements(GL_TRIANGLES, (GLsizei)(_ipMesh.fCount * 3), (egwMeshIsWideIndexed(_ipMesh.vCount) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT), (const GLvoid*)_ipMesh.fIndicies);
+            egwGfxCntxNullCountDraws(1);
         }
         
         glPopMatrix();
@@ -1398,7 +1402,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     return self;
 }
 
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount normalFrameCount:(EGWuint16)nrmFrmCount textureFrameCount:(EGWuint16)texFrmCount {
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount vertexFrameCount:(EGWuint16)vrtFrmCount normalFrameCount:(EGWuint16)nrmFrmCount textureFrameCount:(EGWuint16)texFrmCount {
     if(!vrtxCount || !faceCount || vrtxCount > 3 * faceCount || !(vrtFrmCount || nrmFrmCount || texFrmCount) || !(self = [super init])) { [self release]; return (self = nil); }
     
     if(!(_ident = [assetIdent retain])) { [self release]; return (self = nil); }
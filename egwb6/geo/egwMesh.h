@@ -103,7 +103,7 @@
 /// @param [in] shdrStack Associated shader stack (retained). May be nil (uses default).
 /// @param [in] txtrStack Associated texture stack (retained). May be nil (for non-textured).
 /// @return Self upon success, otherwise nil.
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack;
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack;
 
 /// Box Mesh Initializer.
 /// Initializes the mesh asset as a box created from provided settings.
@@ -236,7 +236,7 @@
 /// @param [in] faceCount Polygon mesh face count [1,inf].
 /// @param [in] storage Geometry storage/VBO setting (EGW_GEOMETRY_STRG_*).
 /// @return Self upon success, otherwise nil.
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount geometryStorage:(EGWuint)storage;
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount geometryStorage:(EGWuint)storage;
 
 /// Box Mesh Initializer.
 /// Initializes the mesh asset base as a box created from provided settings.
@@ -31,7 +31,9 @@
 #import "../sys/egwGfxContext.h"
 #import "../sys/egwGfxContextNSGL.h"  // NOTE: Below code has a dependence on GL.
 #import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwGfxRenderer.h"
+#import "../sys/egwGfxCommands.h"
 #import "../math/egwVector.h"
 #import "../math/egwMatrix.h"
 #import "../gfx/egwGraphics.h"
@@ -62,6 +64,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         _egwRJT.fpRFlags = (EGWuint32(*)(id, SEL))[inst methodForSelector:@selector(renderingFlags)];
         _egwRJT.fpRFrame = (EGWuint16(*)(id, SEL))[inst methodForSelector:@selector(renderingFrame)];
         _egwRJT.fpRSource = (const egwVector4f*(*)(id, SEL))[inst methodForSelector:@selector(renderingSource)];
+        _egwRJT.fpRBVol = (id<egwPBounding>(*)(id, SEL))[inst methodForSelector:@selector(renderingBounding)];
         _egwRJT.fpRSync = (egwValidater*(*)(id, SEL))[inst methodForSelector:@selector(renderingSync)];
         _egwRJT.fpLStack = (egwLightStack*(*)(id, SEL))[inst methodForSelector:@selector(lightStack)];
         _egwRJT.fpMStack = (egwMaterialStack*(*)(id, SEL))[inst methodForSelector:@selector(materialStack)];
@@ -70,6 +73,8 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         _egwRJT.fpSetRFrame = (void(*)(id, SEL, EGWuint16))[inst methodForSelector:@selector(setRenderingFrame:)];
         _egwRJT.fpOpaque = (BOOL(*)(id, SEL))[inst methodForSelector:@selector(isOpaque)];
         _egwRJT.fpRendering = (BOOL(*)(id, SEL))[inst methodForSelector:@selector(isRendering)];
+        _egwRJT.fpRecord = (void(*)(id, SEL, EGWuint, egwGfxCommandBuffer*))[inst methodForSelector:@selector(recordWithFlags:intoCommands:)];
+        _egwRJT.fpBatch = (BOOL(*)(id, SEL, EGWuint, const id*, EGWuint, egwGfxBatchScratch*))[inst methodForSelector:@selector(renderBatchWithFlags:instances:count:scratch:)];
     }
     
     return (id)inst;
@@ -106,7 +111,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     return self;
 }
 
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack {
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount geometryStorage:(EGWuint)storage lightStack:(egwLightStack*)lghtStack materialStack:(egwMaterialStack*)mtrlStack shaderStack:(egwShaderStack*)shdrStack textureStack:(egwTextureStack*)txtrStack {
     if(!vrtxCount || !faceCount || vrtxCount > 3 * faceCount || !(self = [super init])) { [self release]; return (self = nil); }
     
     if(!(_base = [[egwMeshBase alloc] initBlankWithIdentity:assetIdent vertexCount:vrtxCount faceCount:faceCount geometryStorage:storage])) { [self release]; return (self = nil); }
@@ -433,7 +438,8 @@ static egwRenderableJumpTable _egwRJT = { NULL };
             
             egw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, *_geoEID);
             
-            glDrawElements(GL_TRIANGLES, (GLsizei)(_pMesh->fCount * 3), GL_UNSIGNED_SHORT, (const GLvoid*)(EGWuintptr)0);
+            glDrawElements(GL_TRIANGLES, (GLsizei)(_pMesh->fCount * 3), (egwMeshIsWideIndexed(_pMesh->vCount) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT), (const GLvoid*)(EGWuintptr)0);
+            egwGfxCntxNullCountDraws(1);
         } else {
             if(egw_glBindBuffer(GL_ARRAY_BUFFER, 0) || !(flags & EGW_GFXOBJ_RPLYFLG_SAMELASTBASE)) {
                 glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)_pMesh->vCoords);
@@ -443,7 +449,8 @@ static egwRenderableJumpTable _egwRJT = { NULL };
             
             egw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             
-            glDrawElements(GL_TRIANGLES, (GLsizei)(_pMesh->fCount * 3), GL_UNSIGNED_SHORT, (const GLvoid*)_pMesh->fIndicies);
+            glDrawElements(GL_TRIANGLES, (GLsizei)(_pMesh->fCount * 3), (egwMeshIsWideIndexed(_pMesh->vCount) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT), (const GLvoid*)_pMesh->fIndicies);
+            egwGfxCntxNullCountDraws(1);
         }
         
         glPopMatrix();
@@ -466,6 +473,135 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     }
 }
 
+- (void)recordWithFlags:(EGWuint32)flags intoCommands:(egwGfxCommandBuffer*)cmdBuffer {
+    egwGfxCmdRecordPushStacks(cmdBuffer, _lStack, _mStack, _sStack, _tStack);
+    egwGfxCmdRecordPushMatrix(cmdBuffer, &_wcsTrans, &_lcsTrans, _mcsTrans);
+    
+    if(*_geoAID && *_geoEID) {
+        egwGfxCmdRecordArrays(cmdBuffer, *_geoAID, (const EGWbyte*)(EGWuintptr)0,
+                              (const EGWbyte*)(EGWuintptr)((EGWuint)sizeof(egwVector3f) * (EGWuint)_pMesh->vCount),
+                              (const EGWbyte*)(EGWuintptr)((EGWuint)sizeof(egwVector3f) * (EGWuint)_pMesh->vCount * 2),
+                              ((flags & EGW_GFXOBJ_RPLYFLG_SAMELASTBASE ? EGW_GFXCMD_FLG_SAMELASTBASE : 0) | (_tStack ? EGW_GFXCMD_FLG_TEXCOORDS : 0)));
+        egwGfxCmdRecordDrawElements(cmdBuffer, *_geoEID, (EGWuint)(_pMesh->fCount * 3), (const EGWbyte*)(EGWuintptr)0,
+                                    (egwMeshIsWideIndexed(_pMesh->vCount) ? EGW_GFXCMD_FLG_WIDEINDICIES : 0));
+    } else {
+        egwGfxCmdRecordArrays(cmdBuffer, 0, (const EGWbyte*)_pMesh->vCoords, (const EGWbyte*)_pMesh->nCoords, (const EGWbyte*)_pMesh->tCoords,
+                              ((flags & EGW_GFXOBJ_RPLYFLG_SAMELASTBASE ? EGW_GFXCMD_FLG_SAMELASTBASE : 0) | (_tStack ? EGW_GFXCMD_FLG_TEXCOORDS : 0)));
+        egwGfxCmdRecordDrawElements(cmdBuffer, 0, (EGWuint)(_pMesh->fCount * 3), (const EGWbyte*)_pMesh->fIndicies,
+                                    (egwMeshIsWideIndexed(_pMesh->vCount) ? EGW_GFXCMD_FLG_WIDEINDICIES : 0));
+    }
+    
+    egwGfxCmdRecordPopMatrix(cmdBuffer);
+    egwGfxCmdRecordPopStacks(cmdBuffer, _lStack, _mStack, _sStack, _tStack);
+}
+
+- (BOOL)renderBatchWithFlags:(EGWuint32)flags instances:(const id*)instances count:(EGWuint)count scratch:(egwGfxBatchScratch*)scratch {
+    // NOTE: No instanced draws exist in OpenGLES 1.x, so runs are pre-transformed on the CPU into merged client arrays (drawn under the camera matrix), thus base geometry must be kept client side (i.e. persistent). -jw
+    EGWuint vCount = (EGWuint)_pMesh->vCount, iCount = (EGWuint)_pMesh->fCount * 3;
+    EGWuint perChunk, cSlots, iIndex, cIndex, cCount, eIndex;
+    BOOL wideBase = (egwMeshIsWideIndexed(vCount) ? YES : NO);
+    
+    if(!(flags & EGW_GFXOBJ_RPLYFLY_DORENDERPASS) || !vCount || !_pMesh->vCoords || !_pMesh->nCoords || !_pMesh->fIndicies || (_tStack && !_pMesh->tCoords))
+        return NO;
+    
+    for(iIndex = 0; iIndex < count; ++iIndex) // hashes only match contents, texture coords are only sent if a texture stack is present
+        if((((egwMesh*)instances[iIndex])->_tStack ? YES : NO) != (_tStack ? YES : NO))
+            return NO;
+    
+    // Compact bases must stay compact once merged (wide indicies are an extension on ES1)
+    perChunk = (wideBase ? count : egwMin2(count, EGW_MESH_MAXCMPCTCOUNT / vCount));
+    
+    // Merged indicies & texture coords only depend on base and chunk size, so they are kept until either changes (a larger built chunk covers smaller runs)
+    if(scratch->cBase != (id<NSObject>)_base || scratch->cPerChunk < perChunk) {
+        [scratch->cBase release]; scratch->cBase = nil;
+        scratch->cPerChunk = 0;
+        scratch->cTCoords = NO;
+    }
+    cSlots = (scratch->cPerChunk ? scratch->cPerChunk : perChunk);
+    
+    if(scratch->vMax < perChunk * vCount) {
+        egwVector3f* vCoords = NULL; egwVector3f* nCoords = NULL;
+        
+        if((vCoords = (egwVector3f*)realloc((void*)scratch->vCoords, sizeof(egwVector3f) * (size_t)(perChunk * vCount)))) scratch->vCoords = vCoords;
+        if((nCoords = (egwVector3f*)realloc((void*)scratch->nCoords, sizeof(egwVector3f) * (size_t)(perChunk * vCount)))) scratch->nCoords = nCoords;
+        if(!vCoords || !nCoords) return NO;
+        
+        scratch->vMax = perChunk * vCount;
+    }
+    
+    if(_tStack && scratch->tMax < cSlots * vCount) {
+        egwVector2f* tCoords = (egwVector2f*)realloc((void*)scratch->tCoords, sizeof(egwVector2f) * (size_t)(cSlots * vCount));
+        if(!tCoords) return NO;
+        scratch->tCoords = tCoords;
+        scratch->tMax = cSlots * vCount;
+    }
+    
+    if(scratch->iSize < cSlots * iCount * (wideBase ? sizeof(EGWuint32) : sizeof(EGWuint16))) {
+        void* fIndicies = realloc(scratch->fIndicies, (size_t)(cSlots * iCount) * (wideBase ? sizeof(EGWuint32) : sizeof(EGWuint16)));
+        if(!fIndicies) return NO;
+        scratch->fIndicies = fIndicies;
+        scratch->iSize = cSlots * iCount * (wideBase ? sizeof(EGWuint32) : sizeof(EGWuint16));
+    }
+    
+    // Indicies & texture coords are the same for every instance slot, only offset by slot
+    if(!scratch->cPerChunk) {
+        for(iIndex = 0; iIndex < cSlots; ++iIndex)
+            for(eIndex = 0; eIndex < iCount; ++eIndex)
+                egwMeshFaceIndexSet(scratch->fIndicies, (wideBase ? 1 : 0), iIndex * iCount + eIndex, iIndex * vCount + egwMeshFaceIndexGet((const void*)_pMesh->fIndicies, (wideBase ? 1 : 0), eIndex));
+        scratch->cBase = [_base retain];
+        scratch->cPerChunk = cSlots;
+    }
+    
+    if(_tStack && !scratch->cTCoords) {
+        for(iIndex = 0; iIndex < cSlots; ++iIndex)
+            memcpy((void*)&scratch->tCoords[iIndex * vCount], (const void*)_pMesh->tCoords, sizeof(egwVector2f) * (size_t)vCount);
+        scratch->cTCoords = YES;
+    }
+    
+    if(_lStack) egwSFPLghtStckPushAndBindLights(_lStack, @selector(pushAndBindLights));
+    else egwAFPGfxCntxBindLights(egwAIGfxCntx, @selector(bindLights));
+    if(_mStack) egwSFPMtrlStckPushAndBindMaterials(_mStack, @selector(pushAndBindMaterials));
+    else egwAFPGfxCntxBindMaterials(egwAIGfxCntx, @selector(bindMaterials));
+    if(_sStack) egwSFPShdrStckPushAndBindShaders(_sStack, @selector(pushAndBindShaders));
+    else egwAFPGfxCntxBindShaders(egwAIGfxCntx, @selector(bindShaders));
+    if(_tStack) egwSFPTxtrStckPushAndBindTextures(_tStack, @selector(pushAndBindTextures));
+    else egwAFPGfxCntxBindTextures(egwAIGfxCntx, @selector(bindTextures));
+    
+    egw_glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)scratch->vCoords);
+    glNormalPointer(GL_FLOAT, (GLsizei)0, (const GLvoid*)scratch->nCoords);
+    if(_tStack) glTexCoordPointer((GLint)2, GL_FLOAT, (GLsizei)0, (const GLvoid*)scratch->tCoords);
+    egw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    
+    for(cIndex = 0; cIndex < count; cIndex += cCount) {
+        cCount = egwMin2(perChunk, count - cIndex);
+        
+        for(iIndex = 0; iIndex < cCount; ++iIndex) {
+            egwMesh* inst = (egwMesh*)instances[cIndex + iIndex];
+            egwMatrix44f twcsTrans, tmcsTrans, tnrmTrans;
+            
+            // Same concatenation as renderWithFlags:, normals go by the inverse transpose (as the API does with the modelview matrix)
+            egwMatMultiply44f(&inst->_wcsTrans, &inst->_lcsTrans, &twcsTrans);
+            egwMatMultiply44f(&twcsTrans, inst->_mcsTrans, &tmcsTrans);
+            egwMatInvert44f(&tmcsTrans, &twcsTrans);
+            egwMatTranspose44f(&twcsTrans, &tnrmTrans);
+            
+            egwVecTransform443fv(&tmcsTrans, _pMesh->vCoords, &egwSIOnef, &scratch->vCoords[iIndex * vCount], -sizeof(egwMatrix44f), 0, -sizeof(EGWsingle), 0, vCount);
+            egwVecTransform443fv(&tnrmTrans, _pMesh->nCoords, &egwSIZerof, &scratch->nCoords[iIndex * vCount], -sizeof(egwMatrix44f), 0, -sizeof(EGWsingle), 0, vCount);
+        }
+        
+        glDrawElements(GL_TRIANGLES, (GLsizei)(cCount * iCount), (wideBase ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT), (const GLvoid*)scratch->fIndicies);
+        egwGfxCntxNullCountDraws(1);
+    }
+    
+    if(_tStack) egwSFPTxtrStckPopTextures(_tStack, @selector(popTextures));
+    if(_sStack) egwSFPShdrStckPopShaders(_sStack, @selector(popShaders));
+    if(_mStack) egwSFPMtrlStckPopMaterials(_mStack, @selector(popMaterials));
+    if(_lStack) egwSFPLghtStckPopLights(_lStack, @selector(popLights));
+    
+    return YES;
+}
+
 - (id<egwPAssetBase>)assetBase {
     return _base;
 }
@@ -642,7 +778,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
 
 - (void)setRenderingFrame:(EGWint)frmNumber {
     _rFrame = frmNumber;
-        
+    
     if((EGW_NODECMPMRG_GRAPHIC & EGW_CORECMP_TYPE_FRAMES) &&
        _parent && !_invkParent && ![_parent isInvokingChild]) {
         _invkParent = YES;
@@ -802,7 +938,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     return self;
 }
 
-- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint16)vrtxCount faceCount:(EGWuint16)faceCount geometryStorage:(EGWuint)storage {
+- (id)initBlankWithIdentity:(NSString*)assetIdent vertexCount:(EGWuint)vrtxCount faceCount:(EGWuint)faceCount geometryStorage:(EGWuint)storage {
     if(!vrtxCount || !faceCount || vrtxCount > 3 * faceCount || !(self = [super init])) { [self release]; return (self = nil); }
     
     if(!(_ident = [assetIdent retain])) { [self release]; return (self = nil); }
@@ -882,6 +1018,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         t = 8;
     } else t = 0;
     
+    NSAssert(!egwMeshIsWideIndexed(_pMesh.vCount), @"Face indicies below are written compact.");
     _pMesh.fIndicies[ 0].face.i1 = 0; _pMesh.fIndicies[ 0].face.i2 = 1; _pMesh.fIndicies[ 0].face.i3 = 2; // LB
     _pMesh.fIndicies[ 1].face.i1 = 2; _pMesh.fIndicies[ 1].face.i2 = 1; _pMesh.fIndicies[ 1].face.i3 = 3; // LT
     _pMesh.fIndicies[ 2].face.i1 = 1; _pMesh.fIndicies[ 2].face.i2 = 5; _pMesh.fIndicies[ 2].face.i3 = 3; // FB
@@ -922,6 +1059,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     
     {   EGWsingle yaw, yawInc, baseHeight, heightInc;
         EGWuint lat, lng, base, faceIndex = 0;
+        EGWint wide = egwMeshIsWideIndexed(_pMesh.vCount);
         
         yawInc = EGW_MATH_2PI / (EGWsingle)lngCuts;
         heightInc = -height;
@@ -963,9 +1101,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 
                 // Intermediate sides face connections (down left cover)
                 if(base == 0) {
-                    _pMesh.fIndicies[faceIndex].face.i1 = base + lngCuts + lng;
-                    _pMesh.fIndicies[faceIndex].face.i2 = base + lngCuts + ((lng + 1) % lngCutsT);
-                    _pMesh.fIndicies[faceIndex].face.i3 = base + lng;
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base + lngCuts + lng);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + lngCuts + ((lng + 1) % lngCutsT));
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + lng);
                     ++faceIndex;
                 }
             }
@@ -1006,9 +1144,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         
         // Special case S base fan connector faces (lat = 1)
         for(lng = 0; lng < (lngCuts - 2); ++lng, ++faceIndex) {
-            _pMesh.fIndicies[faceIndex].face.i1 = base;
-            _pMesh.fIndicies[faceIndex].face.i2 = base + (lng + 2);
-            _pMesh.fIndicies[faceIndex].face.i3 = base + (lng + 1);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + (lng + 2));
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + (lng + 1));
         }
     }
     
@@ -1039,6 +1177,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     
     {   EGWsingle yaw, yawInc, baseHeight, heightInc;
         EGWuint lat, lng, base, faceIndex = 0;
+        EGWint wide = egwMeshIsWideIndexed(_pMesh.vCount);
         
         yawInc = EGW_MATH_2PI / (EGWsingle)lngCuts;
         heightInc = -height;
@@ -1046,9 +1185,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         
         // Special case N base fan connector faces (lat = 0)
         for(lng = 0, base = 0; lng < (lngCuts - 2); ++lng, ++faceIndex) {
-            _pMesh.fIndicies[faceIndex].face.i1 = base;
-            _pMesh.fIndicies[faceIndex].face.i2 = base + (lng + 1);
-            _pMesh.fIndicies[faceIndex].face.i3 = base + (lng + 2);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + (lng + 1));
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + (lng + 2));
         }
         
         // Side vertices
@@ -1070,13 +1209,13 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 
                 // Intermediate sides face connections (down left cover)
                 if(base == 0) {
-                    _pMesh.fIndicies[faceIndex].face.i1 = base + lngCutsT + lng;
-                    _pMesh.fIndicies[faceIndex].face.i2 = base + lng;
-                    _pMesh.fIndicies[faceIndex].face.i3 = base + ((lng + 1) % lngCutsT);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base + lngCutsT + lng);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + lng);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + ((lng + 1) % lngCutsT));
                     ++faceIndex;
-                    _pMesh.fIndicies[faceIndex].face.i1 = base + lngCutsT + lng;
-                    _pMesh.fIndicies[faceIndex].face.i2 = base + ((lng + 1) % lngCutsT);
-                    _pMesh.fIndicies[faceIndex].face.i3 = base + lngCutsT + ((lng + 1) % lngCutsT);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base + lngCutsT + lng);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + ((lng + 1) % lngCutsT));
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + lngCutsT + ((lng + 1) % lngCutsT));
                     ++faceIndex;
                 }
             }
@@ -1127,9 +1266,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         
         // Special case S base fan connector faces (lat = 1)
         for(lng = 0; lng < (lngCuts - 2); ++lng, ++faceIndex) {
-            _pMesh.fIndicies[faceIndex].face.i1 = base;
-            _pMesh.fIndicies[faceIndex].face.i2 = base + (lng + 2);
-            _pMesh.fIndicies[faceIndex].face.i3 = base + (lng + 1);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + (lng + 2));
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + (lng + 1));
         }
     }
     
@@ -1193,12 +1332,13 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         _pMesh.tCoords[8].axis.x = 0.5f; _pMesh.tCoords[8].axis.y = 0.1f; // mMB
     }
     
-    _pMesh.fIndicies[0].face.i1 = 0; _pMesh.fIndicies[0].face.i1 = 1; _pMesh.fIndicies[0].face.i1 = 2; // EF
-    _pMesh.fIndicies[1].face.i1 = 0; _pMesh.fIndicies[1].face.i1 = 2; _pMesh.fIndicies[1].face.i1 = 3; // ER
-    _pMesh.fIndicies[2].face.i1 = 0; _pMesh.fIndicies[2].face.i1 = 3; _pMesh.fIndicies[2].face.i1 = 4; // EB
-    _pMesh.fIndicies[3].face.i1 = 0; _pMesh.fIndicies[3].face.i1 = 4; _pMesh.fIndicies[3].face.i1 = 1; // EL
-    _pMesh.fIndicies[4].face.i1 = 5; _pMesh.fIndicies[4].face.i1 = 7; _pMesh.fIndicies[4].face.i1 = 6; // B1
-    _pMesh.fIndicies[5].face.i1 = 5; _pMesh.fIndicies[5].face.i1 = 8; _pMesh.fIndicies[5].face.i1 = 7; // B2
+    NSAssert(!egwMeshIsWideIndexed(_pMesh.vCount), @"Face indicies below are written compact.");
+    _pMesh.fIndicies[0].face.i1 = 0; _pMesh.fIndicies[0].face.i2 = 1; _pMesh.fIndicies[0].face.i3 = 2; // EF
+    _pMesh.fIndicies[1].face.i1 = 0; _pMesh.fIndicies[1].face.i2 = 2; _pMesh.fIndicies[1].face.i3 = 3; // ER
+    _pMesh.fIndicies[2].face.i1 = 0; _pMesh.fIndicies[2].face.i2 = 3; _pMesh.fIndicies[2].face.i3 = 4; // EB
+    _pMesh.fIndicies[3].face.i1 = 0; _pMesh.fIndicies[3].face.i2 = 4; _pMesh.fIndicies[3].face.i3 = 1; // EL
+    _pMesh.fIndicies[4].face.i1 = 5; _pMesh.fIndicies[4].face.i2 = 7; _pMesh.fIndicies[4].face.i3 = 6; // B1
+    _pMesh.fIndicies[5].face.i1 = 5; _pMesh.fIndicies[5].face.i2 = 8; _pMesh.fIndicies[5].face.i3 = 7; // B2
     
     egwMatCopy44f(&egwSIMatIdentity44f, &_mcsTrans);
     if(!(_mmcsRBVol = [[egwBoundingBox alloc] initWithOpticalSource:&egwSIVecZero3f vertexCount:(_pMesh.vCount) vertexCoords:&(_pMesh.vCoords[0]) vertexCoordsStride:0])) { [self release]; return (self = nil); }
@@ -1227,6 +1367,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
     
     {   EGWsingle yaw, pitch, yawInc, pitchInc, cosPitch, sinPitch;
         EGWuint lat, lng, base, faceIndex = 0;
+        EGWint wide = egwMeshIsWideIndexed(_pMesh.vCount);
         
         yawInc = EGW_MATH_2PI / (EGWsingle)lngCuts;
         pitchInc = EGW_MATH_PI / (EGWsingle)(latCuts - 1);
@@ -1243,9 +1384,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         
         // Special case N pole connector faces (lat = 0)
         for(lng = 0, base = 1; lng < lngCuts; ++lng, ++faceIndex) {
-            _pMesh.fIndicies[faceIndex].face.i1 = base + lng;
-            _pMesh.fIndicies[faceIndex].face.i2 = 0;
-            _pMesh.fIndicies[faceIndex].face.i3 = base + ((lng + 1) % lngCutsT);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base + lng);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, 0);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + ((lng + 1) % lngCutsT));
         }
         
         // Side vertices
@@ -1271,13 +1412,13 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 
                 // Intermediate sides face connections (down left cover)
                 if(lat < (latCuts - 2)) {
-                    _pMesh.fIndicies[faceIndex].face.i1 = base + lngCutsT + lng;
-                    _pMesh.fIndicies[faceIndex].face.i2 = base + lng;
-                    _pMesh.fIndicies[faceIndex].face.i3 = base + ((lng + 1) % lngCutsT);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base + lngCutsT + lng);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + lng);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + ((lng + 1) % lngCutsT));
                     ++faceIndex;
-                    _pMesh.fIndicies[faceIndex].face.i1 = base + lngCutsT + lng;
-                    _pMesh.fIndicies[faceIndex].face.i2 = base + ((lng + 1) % lngCutsT);
-                    _pMesh.fIndicies[faceIndex].face.i3 = base + lngCutsT + ((lng + 1) % lngCutsT);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base + lngCutsT + lng);
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, base + ((lng + 1) % lngCutsT));
+                    egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + lngCutsT + ((lng + 1) % lngCutsT));
                     ++faceIndex;
                 }
             }
@@ -1298,9 +1439,9 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         
         // Special case S pole connector faces (lat = latCuts-1)
         for(lng = 0; lng < lngCuts; ++lng, ++faceIndex) {
-            _pMesh.fIndicies[faceIndex].face.i1 = base + lng;
-            _pMesh.fIndicies[faceIndex].face.i2 = _pMesh.vCount-1;
-            _pMesh.fIndicies[faceIndex].face.i3 = base + ((lng + 1) % lngCutsT);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 0, base + lng);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 1, _pMesh.vCount-1);
+            egwMeshFaceIndexSet((void*)_pMesh.fIndicies, wide, (faceIndex * 3) + 2, base + ((lng + 1) % lngCutsT));
         }
     }    
     
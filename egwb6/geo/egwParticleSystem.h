@@ -51,6 +51,7 @@
 
 #define EGW_PSYS_MINEMITFREQTIMED   0.010   ///< Minimum emitter cutoff frequency for timed release (to prevent infinite loop).
 #define EGW_PSYS_NPQUADSZMLTPLR     0.0075f ///< For non-point-based quads, use this as the particle size to vertex width/height calculation modifier.
+#define EGW_PSYS_NOTRANSFORM        0xffffffff ///< Particle has no emit-time transform table entry (not emitted to WCS).
 
 
 /// Particle System Instance Asset.
@@ -90,6 +91,8 @@
     EGWsingle _mmcsGrndLevel;               ///< Ground level value (MCS).
     EGWtime _eFreq;                         ///< Emitter frequency value.
     EGWtime _efLeft;                        ///< Emitter frequency time left (countdown).
+    egwRandomStream _pRand;                 ///< Emitter random stream.
+    EGWuint32 _pSeed;                       ///< Emitter random stream seed.
     union {
         struct {
             EGWsingle tParts;               ///< Total emitter particles (rounded to int).
@@ -101,7 +104,7 @@
     } _eDur;                                ///< Emitter duration.
     EGWuint16 _mParts;                      ///< Maximum particles (0 for inf, repeated).
     EGWuint16 _psFlags;                     ///< Particle system flags (repeated).
-    egwArray _particles;                    ///< Particles collection array.
+    egwPSParticlePool _particles;           ///< Particles collection pool (SoA).
     egwVector3f _mmUpPos[2];                ///< Particles min/max updated positions (MCS).
     egwSQVAMesh4f* _pMesh;                  ///< Particle mesh (reused, MCS).
     BOOL _isPntSprtAvail;                   ///< Tracks point sprite extension availability.
@@ -167,6 +170,11 @@
 /// @return Maximum particle count (or 0 for infinite).
 - (EGWuint16)maximumParticles;
 
+/// Random Seed Accessor.
+/// Returns the seed value the emitter's random stream was last seeded with.
+/// @return Random stream seed value.
+- (EGWuint32)randomSeed;
+
 /// Particle System Flags Accessor.
 /// Returns the particle system's flags.
 /// @return Particle system flags.
@@ -193,6 +201,11 @@
 /// @param [in] maxPart Maximum number of concurrent particles. May be 0 (for infinite).
 - (void)setMaximumParticles:(EGWuint16)maxPart;
 
+/// Random Seed Mutator.
+/// Reseeds the emitter's random stream with @a seed, such that subsequent emissions are reproducible (e.g. for replays).
+/// @param [in] seed Random stream seed value.
+- (void)setRandomSeed:(EGWuint32)seed;
+
 /// Particle System Flags Mutator.
 /// Sets the particle system's flags.
 /// @param [in] sysFlags Particle system flags (EGW_PRTCLSYSFLAG_*).
@@ -30,11 +30,11 @@
 #import "../sys/egwGfxContext.h"
 #import "../sys/egwGfxContextNSGL.h"  // NOTE: Below code has a dependence on GL.
 #import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwGfxRenderer.h"
 #import "../sys/egwPhyActuator.h"
 #import "../math/egwVector.h"
 #import "../math/egwMatrix.h"
-#import "../data/egwArray.h"
 #import "../gfx/egwGraphics.h"
 #import "../gfx/egwBindingStacks.h"
 #import "../gfx/egwBoundings.h"
@@ -44,15 +44,401 @@
 #import "../obj/egwObjectBranch.h"
 #import "../phy/egwInterpolators.h"
 #import "../misc/egwValidater.h"
+#if defined(EGW_SIMD_SSE)
+#import <xmmintrin.h>
+#elif defined(EGW_SIMD_NEON)
+#import <arm_neon.h>
+#endif
+
+
+#define EGW_PSYS_POOLSTREAMS    8           // Number of particle pool streams.
+#define EGW_PSYS_POOLALIGN(B)   (((size_t)(B) + (size_t)15) & ~(size_t)15) // 16-byte stream alignment (SIMD loads).
+
+static void egwPSysPoolStreams(egwPSParticlePool* pool_in, EGWbyte** streams_out, size_t* elmSizes_out) {
+    streams_out[0] = (EGWbyte*)pool_in->position; elmSizes_out[0] = sizeof(egwVector3f);
+    streams_out[1] = (EGWbyte*)pool_in->velocity; elmSizes_out[1] = sizeof(egwVector3f);
+    streams_out[2] = (EGWbyte*)pool_in->size;     elmSizes_out[2] = sizeof(EGWsingle);
+    streams_out[3] = (EGWbyte*)pool_in->weight;   elmSizes_out[3] = sizeof(EGWsingle);
+    streams_out[4] = (EGWbyte*)pool_in->ltLeft;   elmSizes_out[4] = sizeof(EGWtime);
+    streams_out[5] = (EGWbyte*)pool_in->ltAlive;  elmSizes_out[5] = sizeof(EGWtime);
+    streams_out[6] = (EGWbyte*)pool_in->color;    elmSizes_out[6] = sizeof(egwColor4f);
+    streams_out[7] = (EGWbyte*)pool_in->twcsIndex;elmSizes_out[7] = sizeof(EGWuint);
+}
+
+static void egwPSysPoolBaseStreams(egwPSParticlePool* pool_inout) {
+    EGWbyte* strm = pool_inout->rData;
+    size_t cap = (size_t)pool_inout->pMaxCount;
+    
+    pool_inout->position = (egwVector3f*)strm; strm += EGW_PSYS_POOLALIGN(sizeof(egwVector3f) * cap);
+    pool_inout->velocity = (egwVector3f*)strm; strm += EGW_PSYS_POOLALIGN(sizeof(egwVector3f) * cap);
+    pool_inout->size = (EGWsingle*)strm; strm += EGW_PSYS_POOLALIGN(sizeof(EGWsingle) * cap);
+    pool_inout->weight = (EGWsingle*)strm; strm += EGW_PSYS_POOLALIGN(sizeof(EGWsingle) * cap);
+    pool_inout->ltLeft = (EGWtime*)strm; strm += EGW_PSYS_POOLALIGN(sizeof(EGWtime) * cap);
+    pool_inout->ltAlive = (EGWtime*)strm; strm += EGW_PSYS_POOLALIGN(sizeof(EGWtime) * cap);
+    pool_inout->color = (egwColor4f*)strm; strm += EGW_PSYS_POOLALIGN(sizeof(egwColor4f) * cap);
+    pool_inout->twcsIndex = (EGWuint*)strm;
+    pool_inout->pHead = 0;
+}
+
+static void egwPSysPoolAdvanceHead(egwPSParticlePool* pool_inout, EGWuint count_in) {
+    pool_inout->position += count_in;
+    pool_inout->velocity += count_in;
+    pool_inout->size += count_in;
+    pool_inout->weight += count_in;
+    pool_inout->ltLeft += count_in;
+    pool_inout->ltAlive += count_in;
+    pool_inout->color += count_in;
+    pool_inout->twcsIndex += count_in;
+    pool_inout->pHead += count_in;
+    pool_inout->pCount -= count_in;
+}
+
+static void egwPSysPoolRebase(egwPSParticlePool* pool_inout) {
+    EGWbyte* oldStrms[EGW_PSYS_POOLSTREAMS]; EGWbyte* newStrms[EGW_PSYS_POOLSTREAMS];
+    size_t elmSizes[EGW_PSYS_POOLSTREAMS];
+    EGWint sIndex;
+    
+    if(!pool_inout->pHead) return;
+    
+    egwPSysPoolStreams(pool_inout, oldStrms, elmSizes);
+    egwPSysPoolBaseStreams(pool_inout);
+    if(pool_inout->pCount) {
+        egwPSysPoolStreams(pool_inout, newStrms, elmSizes);
+        for(sIndex = 0; sIndex < EGW_PSYS_POOLSTREAMS; ++sIndex)
+            memmove((void*)newStrms[sIndex], (const void*)oldStrms[sIndex], elmSizes[sIndex] * (size_t)pool_inout->pCount);
+    }
+}
+
+static EGWint egwPSysPoolResize(egwPSParticlePool* pool_inout, EGWuint newCap_in) {
+    egwPSParticlePool newPool;
+    EGWbyte* oldStrms[EGW_PSYS_POOLSTREAMS]; EGWbyte* newStrms[EGW_PSYS_POOLSTREAMS];
+    size_t elmSizes[EGW_PSYS_POOLSTREAMS];
+    size_t totalSize = 0;
+    EGWint sIndex;
+    
+    newCap_in = egwMax2ui(1, newCap_in);
+    if(newCap_in < pool_inout->pCount)
+        return 0;
+    
+    memset((void*)&newPool, 0, sizeof(egwPSParticlePool));
+    egwPSysPoolStreams(&newPool, newStrms, elmSizes);
+    for(sIndex = 0; sIndex < EGW_PSYS_POOLSTREAMS; ++sIndex)
+        totalSize += EGW_PSYS_POOLALIGN(elmSizes[sIndex] * (size_t)newCap_in);
+    
+    if(!(newPool.rData = (EGWbyte*)malloc(totalSize)))
+        return 0;
+    
+    newPool.pMaxCount = newCap_in;
+    egwPSysPoolBaseStreams(&newPool);
+    newPool.pCount = pool_inout->pCount;
+    newPool.tData = pool_inout->tData;
+    newPool.tTable = pool_inout->tTable;
+    newPool.tRefs = pool_inout->tRefs;
+    newPool.tFree = pool_inout->tFree;
+    newPool.tCount = pool_inout->tCount;
+    newPool.tFreeCount = pool_inout->tFreeCount;
+    newPool.tMaxCount = pool_inout->tMaxCount;
+    newPool.tLast = pool_inout->tLast;
+    
+    if(pool_inout->rData) {
+        if(pool_inout->pCount) {
+            egwPSysPoolStreams(pool_inout, oldStrms, elmSizes);
+            egwPSysPoolStreams(&newPool, newStrms, elmSizes);
+            for(sIndex = 0; sIndex < EGW_PSYS_POOLSTREAMS; ++sIndex)
+                memcpy((void*)newStrms[sIndex], (const void*)oldStrms[sIndex], elmSizes[sIndex] * (size_t)pool_inout->pCount);
+        }
+        
+        free((void*)pool_inout->rData);
+    }
+    
+    memcpy((void*)pool_inout, (const void*)&newPool, sizeof(egwPSParticlePool));
+    
+    return 1;
+}
+
+static EGWint egwPSysPoolResizeTransforms(egwPSParticlePool* pool_inout, EGWuint newCap_in) {
+    EGWbyte* newData;
+    size_t tableSize = EGW_PSYS_POOLALIGN(sizeof(egwMatrix44f) * (size_t)newCap_in);
+    size_t indexSize = EGW_PSYS_POOLALIGN(sizeof(EGWuint) * (size_t)newCap_in);
+    
+    if(newCap_in < pool_inout->tCount)
+        return 0;
+    
+    if(!(newData = (EGWbyte*)malloc(tableSize + indexSize + indexSize)))
+        return 0;
+    
+    if(pool_inout->tData) {
+        if(pool_inout->tCount) {
+            memcpy((void*)newData, (const void*)pool_inout->tTable, sizeof(egwMatrix44f) * (size_t)pool_inout->tCount);
+            memcpy((void*)(newData + tableSize), (const void*)pool_inout->tRefs, sizeof(EGWuint) * (size_t)pool_inout->tCount);
+        }
+        if(pool_inout->tFreeCount)
+            memcpy((void*)(newData + tableSize + indexSize), (const void*)pool_inout->tFree, sizeof(EGWuint) * (size_t)pool_inout->tFreeCount);
+        
+        free((void*)pool_inout->tData);
+    }
+    
+    pool_inout->tData = newData;
+    pool_inout->tTable = (egwMatrix44f*)newData;
+    pool_inout->tRefs = (EGWuint*)(newData + tableSize);
+    pool_inout->tFree = (EGWuint*)(newData + tableSize + indexSize);
+    pool_inout->tMaxCount = newCap_in;
+    
+    return 1;
+}
+
+static EGWuint egwPSysPoolInternTransform(egwPSParticlePool* pool_inout, const egwMatrix44f* transform_in) {
+    EGWuint tIndex;
+    
+    // Consecutive emissions overwhelmingly share the same transform, so only the last interned entry is checked
+    if(pool_inout->tLast != EGW_PSYS_NOTRANSFORM && memcmp((const void*)&pool_inout->tTable[pool_inout->tLast], (const void*)transform_in, sizeof(egwMatrix44f)) == 0) {
+        ++pool_inout->tRefs[pool_inout->tLast];
+        return pool_inout->tLast;
+    }
+    
+    if(pool_inout->tFreeCount)
+        tIndex = pool_inout->tFree[--pool_inout->tFreeCount];
+    else {
+        if(pool_inout->tCount >= pool_inout->tMaxCount && !egwPSysPoolResizeTransforms(pool_inout, egwMax2ui(4, pool_inout->tMaxCount << 1)))
+            return EGW_PSYS_NOTRANSFORM;
+        tIndex = pool_inout->tCount++;
+    }
+    
+    egwMatCopy44f(transform_in, &pool_inout->tTable[tIndex]);
+    pool_inout->tRefs[tIndex] = 1;
+    
+    return (pool_inout->tLast = tIndex);
+}
+
+static void egwPSysPoolReleaseTransform(egwPSParticlePool* pool_inout, EGWuint tIndex_in) {
+    if(tIndex_in != EGW_PSYS_NOTRANSFORM && --pool_inout->tRefs[tIndex_in] == 0) {
+        pool_inout->tFree[pool_inout->tFreeCount++] = tIndex_in;
+        if(pool_inout->tLast == tIndex_in)
+            pool_inout->tLast = EGW_PSYS_NOTRANSFORM;
+    }
+}
+
+static egwPSParticlePool* egwPSysPoolInit(egwPSParticlePool* pool_out, EGWuint intCap_in) {
+    memset((void*)pool_out, 0, sizeof(egwPSParticlePool));
+    pool_out->tLast = EGW_PSYS_NOTRANSFORM;
+    
+    if(!egwPSysPoolResize(pool_out, intCap_in))
+        return NULL;
+    
+    return pool_out;
+}
+
+static void egwPSysPoolRemoveAll(egwPSParticlePool* pool_inout) {
+    pool_inout->pCount = 0;
+    egwPSysPoolBaseStreams(pool_inout);
+    
+    // All entries become unreferenced, table storage is kept around for reuse
+    pool_inout->tCount = pool_inout->tFreeCount = 0;
+    pool_inout->tLast = EGW_PSYS_NOTRANSFORM;
+}
+
+static egwPSParticlePool* egwPSysPoolFree(egwPSParticlePool* pool_inout) {
+    if(pool_inout->rData)
+        free((void*)pool_inout->rData);
+    if(pool_inout->tData)
+        free((void*)pool_inout->tData);
+    
+    memset((void*)pool_inout, 0, sizeof(egwPSParticlePool));
+    
+    return pool_inout;
+}
+
+static EGWint egwPSysPoolAddTail(egwPSParticlePool* pool_inout, const egwPSParticle* particle_in) {
+    EGWuint pIndex;
+    
+    if(pool_inout->pHead + pool_inout->pCount >= pool_inout->pMaxCount) {
+        // Slide back down once at least half the window is consumed head space, otherwise grow (keeps head removal amortized O(1))
+        if(pool_inout->pHead && pool_inout->pHead >= pool_inout->pCount)
+            egwPSysPoolRebase(pool_inout);
+        else if(!egwPSysPoolResize(pool_inout, pool_inout->pMaxCount << 1))
+            return 0;
+    }
+    
+    pIndex = pool_inout->pCount++;
+    egwVecCopy3f(&particle_in->position, &pool_inout->position[pIndex]);
+    egwVecCopy3f(&particle_in->velocity, &pool_inout->velocity[pIndex]);
+    pool_inout->size[pIndex] = particle_in->size;
+    pool_inout->weight[pIndex] = particle_in->weight;
+    pool_inout->ltLeft[pIndex] = particle_in->ltLeft;
+    pool_inout->ltAlive[pIndex] = particle_in->ltAlive;
+    memcpy((void*)&pool_inout->color[pIndex], (const void*)&particle_in->color, sizeof(egwColor4f));
+    pool_inout->twcsIndex[pIndex] = particle_in->twcsIndex;
+    
+    return 1;
+}
+
+static void egwPSysPoolRemoveRange(egwPSParticlePool* pool_inout, EGWuint index_in, EGWuint count_in) {
+    EGWbyte* strms[EGW_PSYS_POOLSTREAMS];
+    size_t elmSizes[EGW_PSYS_POOLSTREAMS];
+    EGWuint pIndex;
+    EGWint sIndex;
+    
+    if(index_in >= pool_inout->pCount || !count_in) return;
+    if(count_in > pool_inout->pCount - index_in) count_in = pool_inout->pCount - index_in;
+    
+    for(pIndex = index_in; pIndex < index_in + count_in; ++pIndex)
+        egwPSysPoolReleaseTransform(pool_inout, pool_inout->twcsIndex[pIndex]);
+    
+    if(index_in == 0) { // is head (head is window advance)
+        egwPSysPoolAdvanceHead(pool_inout, count_in);
+        return;
+    }
+    
+    if(index_in + count_in < pool_inout->pCount) { // is not tail (tail is quick shift left)
+        egwPSysPoolStreams(pool_inout, strms, elmSizes);
+        for(sIndex = 0; sIndex < EGW_PSYS_POOLSTREAMS; ++sIndex)
+            memmove((void*)(strms[sIndex] + (elmSizes[sIndex] * (size_t)index_in)),
+                    (const void*)(strms[sIndex] + (elmSizes[sIndex] * (size_t)(index_in + count_in))),
+                    elmSizes[sIndex] * (size_t)(pool_inout->pCount - (index_in + count_in)));
+    }
+    
+    pool_inout->pCount -= count_in;
+}
+
+static EGWuint egwPSysPoolAgeAndCompact(egwPSParticlePool* pool_inout, EGWtime deltaT_in) {
+    EGWuint rIndex, wIndex = 0, count = pool_inout->pCount;
+    
+    // Single linear pass: age every particle, drop the dead, and slide survivors down into the first free slot (keeps age ordering intact)
+    for(rIndex = 0; rIndex < count; ++rIndex) {
+        pool_inout->ltLeft[rIndex] -= deltaT_in;
+        pool_inout->ltAlive[rIndex] += deltaT_in;
+        
+        if(pool_inout->ltLeft[rIndex] <= EGW_TIME_EPSILON)
+            egwPSysPoolReleaseTransform(pool_inout, pool_inout->twcsIndex[rIndex]);
+        else {
+            if(wIndex != rIndex) {
+                egwVecCopy3f(&pool_inout->position[rIndex], &pool_inout->position[wIndex]);
+                egwVecCopy3f(&pool_inout->velocity[rIndex], &pool_inout->velocity[wIndex]);
+                pool_inout->size[wIndex] = pool_inout->size[rIndex];
+                pool_inout->weight[wIndex] = pool_inout->weight[rIndex];
+                pool_inout->ltLeft[wIndex] = pool_inout->ltLeft[rIndex];
+                pool_inout->ltAlive[wIndex] = pool_inout->ltAlive[rIndex];
+                pool_inout->color[wIndex] = pool_inout->color[rIndex];
+                pool_inout->twcsIndex[wIndex] = pool_inout->twcsIndex[rIndex];
+            }
+            ++wIndex;
+        }
+    }
+    
+    pool_inout->pCount = wIndex;
+    
+    return count - wIndex;
+}
+
+static void egwPSysBatchAdd1fv(EGWsingle* vals_inout, const EGWsingle delta_in, EGWuint count) {
+    #if defined(EGW_SIMD_SSE)
+    {   __m128 delta = _mm_set1_ps(delta_in);
+        for(; count >= 4; count -= 4, vals_inout += 4)
+            _mm_storeu_ps(vals_inout, _mm_add_ps(_mm_loadu_ps(vals_inout), delta));
+    }
+    #elif defined(EGW_SIMD_NEON)
+    {   float32x4_t delta = vdupq_n_f32(delta_in);
+        for(; count >= 4; count -= 4, vals_inout += 4)
+            vst1q_f32(vals_inout, vaddq_f32(vld1q_f32(vals_inout), delta));
+    }
+    #endif
+    
+    while(count--)
+        *vals_inout++ += delta_in;
+}
+
+static void egwPSysBatchAddScaled3fv(egwVector3f* vecs_inout, const egwVector3f* delta_in, const EGWsingle scale_in, EGWuint count) {
+    EGWsingle* flts = (EGWsingle*)vecs_inout;
+    EGWsingle dx = delta_in->axis.x * scale_in, dy = delta_in->axis.y * scale_in, dz = delta_in->axis.z * scale_in;
+    
+    #if defined(EGW_SIMD_SSE) || defined(EGW_SIMD_NEON)
+    {   // Four packed vec3s span three 4-wide registers, so the delta is laid out in the same repeating pattern
+        const EGWsingle pattern[12] = { dx, dy, dz, dx, dy, dz, dx, dy, dz, dx, dy, dz };
+        #if defined(EGW_SIMD_SSE)
+            __m128 d0 = _mm_loadu_ps(&pattern[0]), d1 = _mm_loadu_ps(&pattern[4]), d2 = _mm_loadu_ps(&pattern[8]);
+            for(; count >= 4; count -= 4, flts += 12) {
+                _mm_storeu_ps(flts + 0, _mm_add_ps(_mm_loadu_ps(flts + 0), d0));
+                _mm_storeu_ps(flts + 4, _mm_add_ps(_mm_loadu_ps(flts + 4), d1));
+                _mm_storeu_ps(flts + 8, _mm_add_ps(_mm_loadu_ps(flts + 8), d2));
+            }
+        #else
+            float32x4_t d0 = vld1q_f32(&pattern[0]), d1 = vld1q_f32(&pattern[4]), d2 = vld1q_f32(&pattern[8]);
+            for(; count >= 4; count -= 4, flts += 12) {
+                vst1q_f32(flts + 0, vaddq_f32(vld1q_f32(flts + 0), d0));
+                vst1q_f32(flts + 4, vaddq_f32(vld1q_f32(flts + 4), d1));
+                vst1q_f32(flts + 8, vaddq_f32(vld1q_f32(flts + 8), d2));
+            }
+        #endif
+    }
+    #endif
+    
+    for(; count; --count, flts += 3) {
+        flts[0] += dx; flts[1] += dy; flts[2] += dz;
+    }
+}
 
+static void egwPSysBatchAddScaledSum3fv(egwVector3f* vecs_inout, const egwVector3f* addVecs_in, const egwVector3f* delta_in, const EGWsingle scale_in, EGWuint count) {
+    EGWsingle* flts = (EGWsingle*)vecs_inout;
+    const EGWsingle* aflts = (const EGWsingle*)addVecs_in;
+    EGWsingle dx = delta_in->axis.x, dy = delta_in->axis.y, dz = delta_in->axis.z;
+    
+    #if defined(EGW_SIMD_SSE) || defined(EGW_SIMD_NEON)
+    {   const EGWsingle pattern[12] = { dx, dy, dz, dx, dy, dz, dx, dy, dz, dx, dy, dz };
+        #if defined(EGW_SIMD_SSE)
+            __m128 d0 = _mm_loadu_ps(&pattern[0]), d1 = _mm_loadu_ps(&pattern[4]), d2 = _mm_loadu_ps(&pattern[8]);
+            __m128 scale = _mm_set1_ps(scale_in);
+            for(; count >= 4; count -= 4, flts += 12, aflts += 12) {
+                _mm_storeu_ps(flts + 0, _mm_add_ps(_mm_loadu_ps(flts + 0), _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(aflts + 0), d0), scale)));
+                _mm_storeu_ps(flts + 4, _mm_add_ps(_mm_loadu_ps(flts + 4), _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(aflts + 4), d1), scale)));
+                _mm_storeu_ps(flts + 8, _mm_add_ps(_mm_loadu_ps(flts + 8), _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(aflts + 8), d2), scale)));
+            }
+        #else
+            float32x4_t d0 = vld1q_f32(&pattern[0]), d1 = vld1q_f32(&pattern[4]), d2 = vld1q_f32(&pattern[8]);
+            for(; count >= 4; count -= 4, flts += 12, aflts += 12) {
+                vst1q_f32(flts + 0, vmlaq_n_f32(vld1q_f32(flts + 0), vaddq_f32(vld1q_f32(aflts + 0), d0), scale_in));
+                vst1q_f32(flts + 4, vmlaq_n_f32(vld1q_f32(flts + 4), vaddq_f32(vld1q_f32(aflts + 4), d1), scale_in));
+                vst1q_f32(flts + 8, vmlaq_n_f32(vld1q_f32(flts + 8), vaddq_f32(vld1q_f32(aflts + 8), d2), scale_in));
+            }
+        #endif
+    }
+    #endif
+    
+    for(; count; --count, flts += 3, aflts += 3) {
+        flts[0] += (aflts[0] + dx) * scale_in;
+        flts[1] += (aflts[1] + dy) * scale_in;
+        flts[2] += (aflts[2] + dz) * scale_in;
+    }
+}
 
-static void egwPSysRemoveParticle(egwPSParticle* particle) {
-    if(particle->twcsTrans) {
-        free((void*)particle->twcsTrans); particle->twcsTrans = NULL;
+static void egwPSysBatchAddScaled4fv(egwColor4f* vecs_inout, const egwVector4f* delta_in, const EGWsingle scale_in, EGWuint count) {
+    EGWsingle* flts = (EGWsingle*)vecs_inout;
+    EGWsingle dr = delta_in->axis.x * scale_in, dg = delta_in->axis.y * scale_in, db = delta_in->axis.z * scale_in, da = delta_in->axis.w * scale_in;
+    
+    #if defined(EGW_SIMD_SSE)
+    {   __m128 delta = _mm_setr_ps(dr, dg, db, da);
+        for(; count; --count, flts += 4)
+            _mm_storeu_ps(flts, _mm_add_ps(_mm_loadu_ps(flts), delta));
+    }
+    #elif defined(EGW_SIMD_NEON)
+    {   const EGWsingle pattern[4] = { dr, dg, db, da };
+        float32x4_t delta = vld1q_f32(&pattern[0]);
+        for(; count; --count, flts += 4)
+            vst1q_f32(flts, vaddq_f32(vld1q_f32(flts), delta));
+    }
+    #endif
+    
+    for(; count; --count, flts += 4) {
+        flts[0] += dr; flts[1] += dg; flts[2] += db; flts[3] += da;
     }
 }
 
 
+static EGWuint32 egwPSysNextSeed(id emitter_in) {
+    static EGWuint32 seedCounter = 0; // Racy increments are harmless, only used to decorrelate default seeds
+    return (EGWuint32)((EGWuintptr)emitter_in >> 4) ^ (EGWuint32)time(NULL) ^ ((++seedCounter) * (EGWuint32)0x9e3779b9);
+}
+
+
 // !!!: ***** egwParticleSystem *****
 
 @implementation egwParticleSystem
@@ -71,6 +457,7 @@ static egwActuatorJumpTable _egwAJT = { NULL };
         _egwRJT.fpRFlags = (EGWuint32(*)(id, SEL))[inst methodForSelector:@selector(renderingFlags)];
         _egwRJT.fpRFrame = (EGWuint16(*)(id, SEL))[inst methodForSelector:@selector(renderingFrame)];
         _egwRJT.fpRSource = (const egwVector4f*(*)(id, SEL))[inst methodForSelector:@selector(renderingSource)];
+        _egwRJT.fpRBVol = (id<egwPBounding>(*)(id, SEL))[inst methodForSelector:@selector(renderingBounding)];
         _egwRJT.fpRSync = (egwValidater*(*)(id, SEL))[inst methodForSelector:@selector(renderingSync)];
         _egwRJT.fpLStack = (egwLightStack*(*)(id, SEL))[inst methodForSelector:@selector(lightStack)];
         _egwRJT.fpMStack = (egwMaterialStack*(*)(id, SEL))[inst methodForSelector:@selector(materialStack)];
@@ -138,10 +525,9 @@ static egwActuatorJumpTable _egwAJT = { NULL };
     
     _mParts = _sDynamics->mParticles;
     _psFlags = _sDynamics->psFlags;
-    {   egwDataFuncs funcs; memset((void*)&funcs, 0, sizeof(egwDataFuncs));
-        funcs.fpRemove = (EGWelementfp)&egwPSysRemoveParticle;
-        if(!(egwArrayInit(&_particles, &funcs, sizeof(egwPSParticle), (_mParts ? _mParts : 10), (_mParts ? EGW_ARRAY_FLG_DFLT : EGW_ARRAY_FLG_NONE)))) { [self release]; return (self = nil); }
-    }
+    if(!(egwPSysPoolInit(&_particles, (_mParts ? _mParts : 10)))) { [self release]; return (self = nil); }
+    _pSeed = egwPSysNextSeed(self);
+    egwRandSeed(&_pRand, _pSeed);
     
     _isPntSprtAvail = [egwAIGfxCntx isExtAvailable:@"GL_OES_point_sprite"] || [egwAIGfxCntx isExtAvailable:@"GL_ARB_point_sprite"];
     _isPntSzAryAval = [egwAIGfxCntx isExtAvailable:@"GL_OES_point_size_array"];
@@ -183,10 +569,9 @@ static egwActuatorJumpTable _egwAJT = { NULL };
     _psFlags = [(egwParticleSystem*)geometry systemFlags];
     _mmUpPos[0].axis.x = _mmUpPos[0].axis.y = _mmUpPos[0].axis.z = EGW_SFLT_MAX;
     _mmUpPos[1].axis.x = _mmUpPos[1].axis.y = _mmUpPos[1].axis.z = -EGW_SFLT_MAX;
-    {   egwDataFuncs funcs; memset((void*)&funcs, 0, sizeof(egwDataFuncs));
-        funcs.fpRemove = (EGWelementfp)&egwPSysRemoveParticle;
-        if(!(egwArrayInit(&_particles, &funcs, sizeof(egwPSParticle), (_mParts ? _mParts : 10), (_mParts ? EGW_ARRAY_FLG_DFLT : EGW_ARRAY_FLG_NONE)))) { [self release]; return (self = nil); }
-    }
+    if(!(egwPSysPoolInit(&_particles, (_mParts ? _mParts : 10)))) { [self release]; return (self = nil); }
+    _pSeed = egwPSysNextSeed(self); // Copies get their own stream so as not to emit in lockstep
+    egwRandSeed(&_pRand, _pSeed);
     
     _geoStrg = [(egwParticleSystem*)geometry geometryStorage];
     
@@ -243,7 +628,7 @@ static egwActuatorJumpTable _egwAJT = { NULL };
     if(_pMesh) {
         free((void*)_pMesh); _pMesh = NULL;
     }
-    egwArrayFree(&_particles);
+    egwPSysPoolFree(&_particles);
     
     _mcsTrans = NULL;
     _pDynamics = NULL;
@@ -289,9 +674,9 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                     egwMatInvertDet44f(&_twcsTrans, det, &_twcsInverse);
                 
                 if(!(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING)) {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_mmcsRBVol isReset])
-                            [_mmcsRBVol initWithOpticalSource:NULL vertexCount:_particles.eCount vertexCoords:(const egwVector3f*)&(((const egwPSParticle*)_particles.rData)[0].position) vertexCoordsStride:(EGWintptr)sizeof(egwPSParticle)];
+                            [_mmcsRBVol initWithOpticalSource:NULL vertexCount:_particles.pCount vertexCoords:(const egwVector3f*)_particles.position vertexCoordsStride:0];
                         
                         [_wcsRBVol orientateByTransform:&_twcsTrans fromVolume:_mmcsRBVol];
                     } else {
@@ -299,7 +684,7 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                         [_wcsRBVol reset];
                     }
                 } else {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_mmcsRBVol isReset])
                             [_mmcsRBVol initWithOpticalSource:NULL vertexCount:2 vertexCoords:(const egwVector3f*)&_mmUpPos[0] vertexCoordsStride:0];
                         
@@ -311,14 +696,14 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                 }
             } else {
                 if(!(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING)) {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_wcsRBVol isReset])
-                            [_wcsRBVol initWithOpticalSource:NULL vertexCount:_particles.eCount vertexCoords:(const egwVector3f*)&(((const egwPSParticle*)_particles.rData)[0].position) vertexCoordsStride:(EGWintptr)sizeof(egwPSParticle)];
+                            [_wcsRBVol initWithOpticalSource:NULL vertexCount:_particles.pCount vertexCoords:(const egwVector3f*)_particles.position vertexCoordsStride:0];
                     } else {
                         [_wcsRBVol reset];
                     }
                 } else {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_wcsRBVol isReset])
                             [_wcsRBVol initWithOpticalSource:NULL vertexCount:2 vertexCoords:(const egwVector3f*)&_mmUpPos[0] vertexCoordsStride:0];
                     } else {
@@ -333,9 +718,9 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                 egwMatInvertOtg44f(&_twcsTrans, &_twcsInverse);
                 
                 if(!(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING)) {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_mmcsRBVol isReset])
-                            [_mmcsRBVol initWithOpticalSource:NULL vertexCount:_particles.eCount vertexCoords:(const egwVector3f*)&(((const egwPSParticle*)_particles.rData)[0].position) vertexCoordsStride:(EGWintptr)sizeof(egwPSParticle)];
+                            [_mmcsRBVol initWithOpticalSource:NULL vertexCount:_particles.pCount vertexCoords:(const egwVector3f*)_particles.position vertexCoordsStride:0];
                         
                         [_wcsRBVol orientateByTransform:&_twcsTrans fromVolume:_mmcsRBVol];
                     } else {
@@ -343,7 +728,7 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                         [_wcsRBVol reset];
                     }
                 } else {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_mmcsRBVol isReset])
                             [_mmcsRBVol initWithOpticalSource:NULL vertexCount:2 vertexCoords:(const egwVector3f*)&_mmUpPos[0] vertexCoordsStride:0];
                         
@@ -355,14 +740,14 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                 }
             } else {
                 if(!(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING)) {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_wcsRBVol isReset])
-                            [_wcsRBVol initWithOpticalSource:NULL vertexCount:_particles.eCount vertexCoords:(const egwVector3f*)&(((const egwPSParticle*)_particles.rData)[0].position) vertexCoordsStride:(EGWintptr)sizeof(egwPSParticle)];
+                            [_wcsRBVol initWithOpticalSource:NULL vertexCount:_particles.pCount vertexCoords:(const egwVector3f*)_particles.position vertexCoordsStride:0];
                     } else {
                         [_wcsRBVol reset];
                     }
                 } else {
-                    if(_particles.eCount) {
+                    if(_particles.pCount) {
                         if([_wcsRBVol isReset])
                             [_wcsRBVol initWithOpticalSource:NULL vertexCount:2 vertexCoords:(const egwVector3f*)&_mmUpPos[0] vertexCoordsStride:0];
                     } else {
@@ -456,7 +841,7 @@ static egwActuatorJumpTable _egwAJT = { NULL };
 - (void)renderWithFlags:(EGWuint32)flags {
     // NOTE: The code below is non-abstracted OpenGLES dependent. Staying this way till ES2. -jw
     if(flags & EGW_GFXOBJ_RPLYFLY_DORENDERPASS) {
-        if(_particles.eCount) {
+        if(_particles.pCount) {
             if(_lStack) egwSFPLghtStckPushAndBindLights(_lStack, @selector(pushAndBindLights));
             else egwAFPGfxCntxBindLights(egwAIGfxCntx, @selector(bindLights));
             egwAFPGfxCntxBindMaterials(egwAIGfxCntx, @selector(bindMaterials));
@@ -541,27 +926,27 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                         glTexCoordPointer((GLint)2, GL_FLOAT, (GLsizei)0, (const GLvoid*)&_pMesh->tCoords[0]);
                     }
                     
-                    for(EGWint pIndex = 0; pIndex < (EGWint)_particles.eCount; ++pIndex) {
-                        egwPSParticle* particle = &(((egwPSParticle*)_particles.rData)[pIndex]);
-                        EGWsingle size = egwMax2f(0.0f, particle->size * EGW_PSYS_NPQUADSZMLTPLR);
+                    for(EGWint pIndex = 0; pIndex < (EGWint)_particles.pCount; ++pIndex) {
+                        EGWsingle size = egwMax2f(0.0f, _particles.size[pIndex] * EGW_PSYS_NPQUADSZMLTPLR);
                         if(size <= EGW_SFLT_EPSILON)
                             continue;
                         
                         if(_drvTex) {
-                            [_drvTex evaluateToTime:egwClampm(particle->ltAlive, _drvTexBegAbsT, _drvTexEndAbsT)];
+                            [_drvTex evaluateToTime:egwClampm(_particles.ltAlive[pIndex], _drvTexBegAbsT, _drvTexEndAbsT)];
                             _dtJmpTbl->fpTBind(_drvTex, @selector(bindForTexturingStage:withFlags:), _dtJmpTbl->fpTLBStage(_drvTex, @selector(lastTexturingBindingStage)), ((pIndex ? EGW_BNDOBJ_BINDFLG_SAMELASTBASE : 0) | EGW_BNDOBJ_BINDFLG_APISYNCINVLD | (flags & EGW_GFXOBJ_RPLYFLG_MACHSCHNELL ? EGW_BNDOBJ_BINDFLG_MACHSCHNELL : 0)));
                         }
                         
                         glPushMatrix();
                         
-                        egwVecCopy3f(&particle->position, (egwVector3f*)&_broTrans.column[3]);
+                        egwVecCopy3f(&_particles.position[pIndex], (egwVector3f*)&_broTrans.column[3]);
                         glMultMatrixf((const GLfloat*)&_broTrans);
                         glMultMatrixf((const GLfloat*)_mcsTrans);
                         glScalef(size, size, 1.0f);
                         
-                        glColor4f(particle->color.channel.r, particle->color.channel.g, particle->color.channel.b, particle->color.channel.a);
+                        glColor4f(_particles.color[pIndex].channel.r, _particles.color[pIndex].channel.g, _particles.color[pIndex].channel.b, _particles.color[pIndex].channel.a);
                         
                         glDrawArrays(GL_TRIANGLE_FAN, (GLint)0, (GLsizei)4);
+                        egwGfxCntxNullCountDraws(1);
                         
                         glPopMatrix();
                     }
@@ -580,11 +965,12 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                             glEnableClientState(GL_POINT_SIZE_ARRAY_OES);
                             glDisableClientState(GL_NORMAL_ARRAY);
                             
-                            glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].position));
-                            glPointSizePointerOES(GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].size));
-                            glColorPointer((GLint)4, GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].color));
+                            glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.position);
+                            glPointSizePointerOES(GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.size);
+                            glColorPointer((GLint)4, GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.color);
                             
-                            glDrawArrays(GL_POINTS, (GLint)0, (GLsizei)_particles.eCount);
+                            glDrawArrays(GL_POINTS, (GLint)0, (GLsizei)_particles.pCount);
+                            egwGfxCntxNullCountDraws(1);
                             
                             glEnableClientState(GL_NORMAL_ARRAY);
                             glDisableClientState(GL_POINT_SIZE_ARRAY_OES);
@@ -595,25 +981,26 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                         glEnableClientState(GL_COLOR_ARRAY);
                         glDisableClientState(GL_NORMAL_ARRAY);
                         
-                        glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].position));
+                        glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.position);
                         glPointSize((GLfloat)_pDynamics->pSize.origin);
-                        glColorPointer((GLint)4, GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].color));
+                        glColorPointer((GLint)4, GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.color);
                         
-                        glDrawArrays(GL_POINTS, (GLint)0, (GLsizei)_particles.eCount);
+                        glDrawArrays(GL_POINTS, (GLint)0, (GLsizei)_particles.pCount);
+                        egwGfxCntxNullCountDraws(1);
                         
                         glEnableClientState(GL_NORMAL_ARRAY);
                         glDisableClientState(GL_COLOR_ARRAY);
                     } else {
                         glDisableClientState(GL_NORMAL_ARRAY);
                         
-                        for(EGWint pIndex = 0; pIndex < (EGWint)_particles.eCount; ++pIndex) {
-                            egwPSParticle* particle = &(((egwPSParticle*)_particles.rData)[pIndex]);
-                            
-                            glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)&particle->position);
-                            glPointSize((GLfloat)particle->size);
-                            glColor4f(particle->color.channel.r, particle->color.channel.g, particle->color.channel.b, particle->color.channel.a);
+                        glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.position);
+                        
+                        for(EGWint pIndex = 0; pIndex < (EGWint)_particles.pCount; ++pIndex) {
+                            glPointSize((GLfloat)_particles.size[pIndex]);
+                            glColor4f(_particles.color[pIndex].channel.r, _particles.color[pIndex].channel.g, _particles.color[pIndex].channel.b, _particles.color[pIndex].channel.a);
                             
-                            glDrawArrays(GL_POINTS, (GLint)0, (GLsizei)1);
+                            glDrawArrays(GL_POINTS, (GLint)pIndex, (GLsizei)1);
+                            egwGfxCntxNullCountDraws(1);
                         }
                         
                         glEnableClientState(GL_NORMAL_ARRAY);
@@ -651,18 +1038,19 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                 
                 egw_glBindBuffer(GL_ARRAY_BUFFER, 0);
                 
-                glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].position));
+                glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.position);
                 #if defined(GL_POINT_SIZE_ARRAY_OES)
                     if(_isPntSzAryAval)
-                        glPointSizePointerOES(GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].size));
+                        glPointSizePointerOES(GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.size);
                     else
                         glPointSize((GLfloat)_pDynamics->pSize.origin);
                 #else
                     glPointSize((GLfloat)_pDynamics->pSize.origin);
                 #endif
-                glColorPointer((GLint)4, GL_FLOAT, (GLsizei)sizeof(egwPSParticle), (const GLvoid*)&(((const egwPSParticle*)_particles.rData)[0].color));
+                glColorPointer((GLint)4, GL_FLOAT, (GLsizei)0, (const GLvoid*)_particles.color);
                 
-                glDrawArrays(GL_POINTS, (GLint)0, (GLsizei)_particles.eCount);
+                glDrawArrays(GL_POINTS, (GLint)0, (GLsizei)_particles.pCount);
+                egwGfxCntxNullCountDraws(1);
                 
                 if(_tStack) {
                     #if defined(GL_POINT_SPRITE)
@@ -771,24 +1159,24 @@ static egwActuatorJumpTable _egwAJT = { NULL };
             // !!!: Release new particle.
             if(releaseParticle) {
                 // If mParts 0 then infinite otherwise if full have to remove an old guy
-                if(_mParts && _particles.eCount >= _mParts) {
+                if(_mParts && _particles.pCount >= _mParts) {
                     if(!(_psFlags & EGW_PSYSFLAG_EMITOLDRPLC)) {
-                        if(!(_psFlags & EGW_PSYSFLAG_EMITNORPLC)) { // Quick shift (assume oldest is more towards tail)
-                            while(_particles.eCount >= _mParts)
-                                egwArrayRemoveTail(&_particles);
+                        if(!(_psFlags & EGW_PSYSFLAG_EMITNORPLC)) { // Quick shift (assume oldest is more towards head)
+                            egwPSysPoolRemoveRange(&_particles, 0, (_particles.pCount - _mParts) + 1);
                         } else { // No new emission, disable flag
                             releaseParticle = NO;
                         }
                     } else {
-                        if(!(_psFlags & EGW_PSYSFLAG_EMITNORPLC)) { // Find oldest particles and remove
-                            while(_particles.eCount >= _mParts) {
-                                EGWint oldestIndex = 0;
-                                egwPSParticle* parts = (egwPSParticle*)_particles.rData;
+                        if(!(_psFlags & EGW_PSYSFLAG_EMITNORPLC)) {
+                            if(!(_psFlags & EGW_PSYSFLAG_OFFTIMEDTEX)) // Alive times are emission ordered, oldest is always head
+                                egwPSysPoolRemoveRange(&_particles, 0, (_particles.pCount - _mParts) + 1);
+                            else while(_particles.pCount >= _mParts) { // Find oldest particles and remove
+                                EGWuint oldestIndex = 0;
                                 
-                                for(EGWint pIndex = 1; pIndex < (EGWint)_particles.eCount; ++pIndex)
-                                    if(parts[pIndex].ltAlive > parts[oldestIndex].ltAlive)
+                                for(EGWuint pIndex = 1; pIndex < _particles.pCount; ++pIndex)
+                                    if(_particles.ltAlive[pIndex] > _particles.ltAlive[oldestIndex])
                                         oldestIndex = pIndex;
-                                egwArrayRemoveAt(&_particles, (EGWuint)oldestIndex);
+                                egwPSysPoolRemoveRange(&_particles, oldestIndex, 1);
                             }
                         } else { // No new emission, disable flag
                             releaseParticle = NO;
@@ -799,21 +1187,24 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                 // Check for release flag again to implement no new emission control
                 if(releaseParticle) {
                     egwPSParticle particle; //memset((void*)&particle, 0, sizeof(egwPSParticle));
+                    EGWsingle pVars[13];                // Pos(3), vel(3), size, weight, life, color(4)
                     
-                    particle.position.axis.x = _pDynamics->pPosition.origin.axis.x + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pPosition.variant.axis.x);
-                    particle.position.axis.y = _pDynamics->pPosition.origin.axis.y + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pPosition.variant.axis.y);
-                    particle.position.axis.z = _pDynamics->pPosition.origin.axis.z + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pPosition.variant.axis.z);
+                    egwRandVarfv(&_pRand, &pVars[0], 0, 13); // One batched draw per emitted particle
+                    
+                    particle.position.axis.x = _pDynamics->pPosition.origin.axis.x + (pVars[0] * _pDynamics->pPosition.variant.axis.x);
+                    particle.position.axis.y = _pDynamics->pPosition.origin.axis.y + (pVars[1] * _pDynamics->pPosition.variant.axis.y);
+                    particle.position.axis.z = _pDynamics->pPosition.origin.axis.z + (pVars[2] * _pDynamics->pPosition.variant.axis.z);
                     
                     if(!(_psFlags & EGW_PSYSFLAG_VELUSEPYM)) { // Use linear velocity initialize
-                        particle.velocity.axis.x = _pDynamics->pVelocity.origin.axis.x + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pVelocity.variant.axis.x);
-                        particle.velocity.axis.y = _pDynamics->pVelocity.origin.axis.y + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pVelocity.variant.axis.y);
-                        particle.velocity.axis.z = _pDynamics->pVelocity.origin.axis.z + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pVelocity.variant.axis.z);
+                        particle.velocity.axis.x = _pDynamics->pVelocity.origin.axis.x + (pVars[3] * _pDynamics->pVelocity.variant.axis.x);
+                        particle.velocity.axis.y = _pDynamics->pVelocity.origin.axis.y + (pVars[4] * _pDynamics->pVelocity.variant.axis.y);
+                        particle.velocity.axis.z = _pDynamics->pVelocity.origin.axis.z + (pVars[5] * _pDynamics->pVelocity.variant.axis.z);
                     } else { // Use PYM spherical velocity initialize
                         egwVector3f pymVec;
                         
-                        pymVec.axis.x = _pDynamics->pVelocity.origin.axis.x + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pVelocity.variant.axis.x);
-                        pymVec.axis.y = _pDynamics->pVelocity.origin.axis.y + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pVelocity.variant.axis.y);
-                        pymVec.axis.z = _pDynamics->pVelocity.origin.axis.z + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pVelocity.variant.axis.z);
+                        pymVec.axis.x = _pDynamics->pVelocity.origin.axis.x + (pVars[3] * _pDynamics->pVelocity.variant.axis.x);
+                        pymVec.axis.y = _pDynamics->pVelocity.origin.axis.y + (pVars[4] * _pDynamics->pVelocity.variant.axis.y);
+                        pymVec.axis.z = _pDynamics->pVelocity.origin.axis.z + (pVars[5] * _pDynamics->pVelocity.variant.axis.z);
                         
                         if(!egwIsZerof(pymVec.axis.z)) {
                             if(!(flags & EGW_ACTOBJ_RPLYFLG_MACHSCHNELL)) {
@@ -822,35 +1213,38 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                                 particle.velocity.axis.x *= egwCosf(pymVec.axis.y) * pymVec.axis.z;
                                 particle.velocity.axis.y = egwCosf(pymVec.axis.x) * pymVec.axis.z;
                             } else {
-                                particle.velocity.axis.x = egwFastSinf(pymVec.axis.x);
-                                particle.velocity.axis.z = particle.velocity.axis.x * -egwFastSinf(pymVec.axis.y) * pymVec.axis.z;
-                                particle.velocity.axis.x *= egwFastCosf(pymVec.axis.y) * pymVec.axis.z;
-                                particle.velocity.axis.y = egwFastCosf(pymVec.axis.x) * pymVec.axis.z;
+                                EGWsingle pymSin[2], pymCos[2];
+                                
+                                egwSinCosfv(&pymVec.axis.x, &pymSin[0], &pymCos[0], 0, 0, 0, 2); // Pitch & yaw share one reduction
+                                particle.velocity.axis.x = pymSin[0];
+                                particle.velocity.axis.z = particle.velocity.axis.x * -pymSin[1] * pymVec.axis.z;
+                                particle.velocity.axis.x *= pymCos[1] * pymVec.axis.z;
+                                particle.velocity.axis.y = pymCos[0] * pymVec.axis.z;
                             }
                         } else {
                             particle.velocity.axis.x = particle.velocity.axis.y = particle.velocity.axis.z = 0.0f;
                         }
                     }
                     
-                    particle.size = _pDynamics->pSize.origin + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pSize.variant);
-                    particle.weight = _pDynamics->pWeight.origin + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pWeight.variant);
+                    particle.size = _pDynamics->pSize.origin + (pVars[6] * _pDynamics->pSize.variant);
+                    particle.weight = _pDynamics->pWeight.origin + (pVars[7] * _pDynamics->pWeight.variant);
                     
-                    particle.ltLeft = (EGWtime)_pDynamics->pLife.origin + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_pDynamics->pLife.variant);
+                    particle.ltLeft = (EGWtime)_pDynamics->pLife.origin + ((EGWtime)pVars[8] * (EGWtime)_pDynamics->pLife.variant);
                     if(!(_psFlags & EGW_PSYSFLAG_OFFTIMEDTEX)) // Use default alive start
                         particle.ltAlive = _drvTexBegAbsT;
                     else // Offset alive time so that pLife origin marks 0.0
                         particle.ltAlive = _drvTexBegAbsT + ((EGWtime)_pDynamics->pLife.origin - particle.ltLeft);
                     
-                    particle.color.channel.r = _pDynamics->pColor.origin.axis.x + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pColor.variant.axis.x);
-                    particle.color.channel.g = _pDynamics->pColor.origin.axis.y + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pColor.variant.axis.y);
-                    particle.color.channel.b = _pDynamics->pColor.origin.axis.z + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pColor.variant.axis.z);
+                    particle.color.channel.r = _pDynamics->pColor.origin.axis.x + (pVars[9] * _pDynamics->pColor.variant.axis.x);
+                    particle.color.channel.g = _pDynamics->pColor.origin.axis.y + (pVars[10] * _pDynamics->pColor.variant.axis.y);
+                    particle.color.channel.b = _pDynamics->pColor.origin.axis.z + (pVars[11] * _pDynamics->pColor.variant.axis.z);
                     if(!(_psFlags & EGW_PSYSFLAG_ALPHAOUTSHFT)) // Normal alpha set
-                        particle.color.channel.a = _pDynamics->pColor.origin.axis.w + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * _pDynamics->pColor.variant.axis.w);
+                        particle.color.channel.a = _pDynamics->pColor.origin.axis.w + (pVars[12] * _pDynamics->pColor.variant.axis.w);
                     else // Offset so that ltLeft at 0.0 alpha hits 0.0f as well
                         particle.color.channel.a = -_pDynamics->pColor.deltaT.axis.w * particle.ltLeft;
                     
                     if(!(_psFlags & EGW_PSYSFLAG_EMITTOWCS))
-                        particle.twcsTrans = NULL;
+                        particle.twcsIndex = EGW_PSYS_NOTRANSFORM;
                     else {
                         egwVecTransform443f(&_twcsTrans, &particle.position, 1.0f, &particle.position);
                         egwVecTransform443f(&_twcsTrans, &particle.velocity, 0.0f, &particle.velocity);
@@ -858,15 +1252,12 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                         egwVecTransform443f(&_twcsTrans, &size, 0.0f, &size);
                         particle.size = egwMax2f(egwMax2f(egwAbsf(size.axis.x), egwAbsf(size.axis.y)), egwAbsf(size.axis.z));
                         
-                        particle.twcsTrans = (egwMatrix44f*)malloc(sizeof(egwMatrix44f));
-                        if(particle.twcsTrans)
-                            egwMatCopy44f(&_twcsTrans, particle.twcsTrans);
+                        particle.twcsIndex = egwPSysPoolInternTransform(&_particles, &_twcsTrans);
                     }
                     
-                    if(!(egwArrayAddHead(&_particles, (const EGWbyte*)&particle))) {
-                        if(particle.twcsTrans) {
-                            free((void*)particle.twcsTrans); particle.twcsTrans = NULL;
-                        }
+                    if(!(_psFlags & EGW_PSYSFLAG_EMITTOWCS) || particle.twcsIndex != EGW_PSYS_NOTRANSFORM) {
+                        if(!(egwPSysPoolAddTail(&_particles, &particle)))
+                            egwPSysPoolReleaseTransform(&_particles, particle.twcsIndex);
                     }
                 }
                 
@@ -876,203 +1267,166 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                         if(!(_psFlags & EGW_PSYSFLAG_EMITLEFTVAR))
                             _efLeft = egwMax2m(0.0, _eFreq);
                         else
-                            _efLeft = egwMax2m(0.0, _eFreq + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                            _efLeft = egwMax2m(0.0, _eFreq + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                     } else { // Emit for a duration
                         if(!(_psFlags & EGW_PSYSFLAG_EMITLEFTVAR))
                             _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq);
                         else
-                            _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                            _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                     }
                 }
             }
             
-            // !!!: Update particle dynamics (per particle).
-            if(clmpDeltaT > EGW_TIME_EPSILON && _particles.eCount) {
+            // !!!: Update particle dynamics (batched over particle streams).
+            if(clmpDeltaT > EGW_TIME_EPSILON && _particles.pCount) {
                 particlesUpdate = YES;
                 
-                for(EGWint pIndex = _particles.eCount - 1; pIndex >= 0; --pIndex) {
-                    egwPSParticle* particle = &(((egwPSParticle*)_particles.rData)[pIndex]);
+                egwPSysPoolAgeAndCompact(&_particles, clmpDeltaT);
+                
+                if(_particles.pCount) {
+                    EGWuint pCount = _particles.pCount;
+                    // NOTE: Increments are now formed in single precision (previously in EGWtime, then truncated upon add). Streams were always stored & accumulated as singles, and lifetimes still age in EGWtime, so the only loss is the rounding of each increment itself (well under the single rounding already taken by the add). -jw
+                    EGWsingle sClmpDeltaT = (EGWsingle)clmpDeltaT;
+                    EGWsingle mvmntClmpDeltaT;
+                    EGWsingle cor = 0.0f;
                     
-                    particle->ltLeft -= clmpDeltaT;
-                    particle->ltAlive += clmpDeltaT;
+                    // Handle reversed systems by inversing the movement update time value to a negative value
+                    if(!(_aFlags & EGW_ACTOBJ_ACTRFLG_REVERSE))
+                        mvmntClmpDeltaT = sClmpDeltaT;
+                    else
+                        mvmntClmpDeltaT = -sClmpDeltaT;
                     
-                    if(particle->ltLeft <= EGW_TIME_EPSILON)
-                        egwArrayRemoveAt(&_particles, (EGWuint)pIndex);
-                    else {
-                        EGWtime mvmntClmpDeltaT;
+                    switch(_psFlags & EGW_PSYSFLAG_EXBNCGRND) {
+                        case EGW_PSYSFLAG_BNCGRNDCOR25: {
+                            cor = 0.25f;
+                        } break;
+                        case EGW_PSYSFLAG_BNCGRNDCOR50: {
+                            cor = 0.50f;
+                        } break;
+                        case EGW_PSYSFLAG_BNCGRNDCOR75: {
+                            cor = 0.75f;
+                        } break;
+                        case EGW_PSYSFLAG_BNCGRNDCOR100: {
+                            cor = 1.00f;
+                        } break;
+                    }
+                    
+                    if(!(_psFlags & EGW_PSYSFLAG_EMITTOWCS)) {
+                        egwPSysBatchAddScaled3fv(_particles.velocity, _velDelta, mvmntClmpDeltaT, pCount);
                         
-                        // Handle reversed systems by inversing the movement update time value to a negative value
-                        if(!(_aFlags & EGW_ACTOBJ_ACTRFLG_REVERSE))
-                            mvmntClmpDeltaT = clmpDeltaT;
-                        else
-                            mvmntClmpDeltaT = -clmpDeltaT;
+                        egwPSysBatchAdd1fv(_particles.size, _pDynamics->pSize.deltaT * sClmpDeltaT, pCount);
+                        egwPSysBatchAdd1fv(_particles.weight, _pDynamics->pWeight.deltaT * sClmpDeltaT, pCount);
                         
-                        if(!(_psFlags & EGW_PSYSFLAG_EMITTOWCS)) {
-                            particle->velocity.axis.x += (EGWsingle)((EGWtime)_velDelta->axis.x * mvmntClmpDeltaT);
-                            particle->velocity.axis.y += (EGWsingle)((EGWtime)_velDelta->axis.y * mvmntClmpDeltaT);
-                            particle->velocity.axis.z += (EGWsingle)((EGWtime)_velDelta->axis.z * mvmntClmpDeltaT);
-                            
-                            particle->size += (EGWsingle)((EGWtime)_pDynamics->pSize.deltaT * clmpDeltaT);
-                            particle->weight += (EGWsingle)((EGWtime)_pDynamics->pWeight.deltaT * clmpDeltaT);
-                            
-                            if(_isExtForceApp) {
-                                if(!(_psFlags & EGW_PSYSFLAG_EXTFRCISACCL)) { // Treat external force as newtonian force
-                                    if(!egwIsZerof(particle->weight)) {
-                                        EGWtime invWeight = (EGWtime)1.0 / (EGWtime)particle->weight;
-                                        particle->velocity.axis.x += (EGWsingle)((EGWtime)_mmcsExtForce.axis.x * invWeight * clmpDeltaT);
-                                        particle->velocity.axis.y += (EGWsingle)((EGWtime)_mmcsExtForce.axis.y * invWeight * clmpDeltaT);
-                                        particle->velocity.axis.z += (EGWsingle)((EGWtime)_mmcsExtForce.axis.z * invWeight * clmpDeltaT);
+                        if(_isExtForceApp) {
+                            if(!(_psFlags & EGW_PSYSFLAG_EXTFRCISACCL)) { // Treat external force as newtonian force
+                                for(EGWuint pIndex = 0; pIndex < pCount; ++pIndex) {
+                                    if(!egwIsZerof(_particles.weight[pIndex])) {
+                                        EGWsingle invWeightDeltaT = sClmpDeltaT / _particles.weight[pIndex];
+                                        _particles.velocity[pIndex].axis.x += _mmcsExtForce.axis.x * invWeightDeltaT;
+                                        _particles.velocity[pIndex].axis.y += _mmcsExtForce.axis.y * invWeightDeltaT;
+                                        _particles.velocity[pIndex].axis.z += _mmcsExtForce.axis.z * invWeightDeltaT;
                                     }
-                                } else { // Treat external force as direct acceleration
-                                    particle->velocity.axis.x += (EGWsingle)((EGWtime)_mmcsExtForce.axis.x * clmpDeltaT);
-                                    particle->velocity.axis.y += (EGWsingle)((EGWtime)_mmcsExtForce.axis.y * clmpDeltaT);
-                                    particle->velocity.axis.z += (EGWsingle)((EGWtime)_mmcsExtForce.axis.z * clmpDeltaT);
                                 }
-                            }
-                            
-                            particle->position.axis.x += (EGWsingle)(((EGWtime)_pDynamics->pPosition.deltaT.axis.x * mvmntClmpDeltaT) +
-                                                                     ((EGWtime)particle->velocity.axis.x * mvmntClmpDeltaT));
-                            particle->position.axis.y += (EGWsingle)(((EGWtime)_pDynamics->pPosition.deltaT.axis.y * mvmntClmpDeltaT) +
-                                                                     ((EGWtime)particle->velocity.axis.y * mvmntClmpDeltaT));
-                            particle->position.axis.z += (EGWsingle)(((EGWtime)_pDynamics->pPosition.deltaT.axis.z * mvmntClmpDeltaT) +
-                                                                     ((EGWtime)particle->velocity.axis.z * mvmntClmpDeltaT));
-                            
-                            if(particle->position.axis.y <= _mmcsGrndLevel + EGW_SFLT_EPSILON) {
-                                EGWsingle cor = 0.0f;
-                                
-                                switch(_psFlags & EGW_PSYSFLAG_EXBNCGRND) {
-                                    case EGW_PSYSFLAG_BNCGRNDCOR25: {
-                                        cor = 0.25f;
-                                    } break;
-                                    case EGW_PSYSFLAG_BNCGRNDCOR50: {
-                                        cor = 0.50f;
-                                    } break;
-                                    case EGW_PSYSFLAG_BNCGRNDCOR75: {
-                                        cor = 0.75f;
-                                    } break;
-                                    case EGW_PSYSFLAG_BNCGRNDCOR100: {
-                                        cor = 1.00f;
-                                    } break;
+                            } else // Treat external force as direct acceleration
+                                egwPSysBatchAddScaled3fv(_particles.velocity, (const egwVector3f*)&_mmcsExtForce, sClmpDeltaT, pCount);
+                        }
+                        
+                        egwPSysBatchAddScaledSum3fv(_particles.position, _particles.velocity, &_pDynamics->pPosition.deltaT, mvmntClmpDeltaT, pCount);
+                        
+                        if(_mmcsGrndLevel != -EGW_SFLT_MAX) {
+                            for(EGWuint pIndex = 0; pIndex < pCount; ++pIndex) {
+                                if(_particles.position[pIndex].axis.y <= _mmcsGrndLevel + EGW_SFLT_EPSILON) {
+                                    // Technically this is really cheating appropriate back-up-and-reapply-velocity-at-new-rate, but good enough for now
+                                    _particles.velocity[pIndex].axis.x *= cor;
+                                    _particles.velocity[pIndex].axis.z *= cor;
+                                    _particles.velocity[pIndex].axis.y = cor * egwAbsf(_particles.velocity[pIndex].axis.y);
+                                    _particles.position[pIndex].axis.y = _mmcsGrndLevel + (cor * egwAbsf(_mmcsGrndLevel - _particles.position[pIndex].axis.y));
                                 }
-                                
-                                // Technically this is really cheating appropriate back-up-and-reapply-velocity-at-new-rate, but good enough for now
-                                particle->velocity.axis.x *= cor;
-                                particle->velocity.axis.z *= cor;
-                                particle->velocity.axis.y = cor * egwAbsf(particle->velocity.axis.y);
-                                particle->position.axis.y = _mmcsGrndLevel + (cor * egwAbsf(_mmcsGrndLevel - particle->position.axis.y));
                             }
-                        } else {
+                        }
+                    } else {
+                        egwPSysBatchAdd1fv(_particles.weight, _pDynamics->pWeight.deltaT * sClmpDeltaT, pCount);
+                        
+                        for(EGWuint pIndex = 0; pIndex < pCount; ++pIndex) {
+                            egwVector3f* velocity = &_particles.velocity[pIndex];
+                            egwVector3f* position = &_particles.position[pIndex];
+                            const egwMatrix44f* twcsTrans = &_particles.tTable[_particles.twcsIndex[pIndex]];
                             egwVector3f temp;
                             
-                            egwVecTransform443f(particle->twcsTrans, _velDelta, 0.0f, &temp);
-                            particle->velocity.axis.x += (EGWsingle)((EGWtime)temp.axis.x * mvmntClmpDeltaT);
-                            particle->velocity.axis.y += (EGWsingle)((EGWtime)temp.axis.y * mvmntClmpDeltaT);
-                            particle->velocity.axis.z += (EGWsingle)((EGWtime)temp.axis.z * mvmntClmpDeltaT);
+                            egwVecTransform443f(twcsTrans, _velDelta, 0.0f, &temp);
+                            velocity->axis.x += temp.axis.x * mvmntClmpDeltaT;
+                            velocity->axis.y += temp.axis.y * mvmntClmpDeltaT;
+                            velocity->axis.z += temp.axis.z * mvmntClmpDeltaT;
                             
                             temp.axis.x = temp.axis.y = temp.axis.z = _pDynamics->pSize.deltaT;
-                            egwVecTransform443f(particle->twcsTrans, &temp, 0.0f, &temp);
+                            egwVecTransform443f(twcsTrans, &temp, 0.0f, &temp);
                             temp.axis.x = egwMax2f(egwMax2f(egwAbsf(temp.axis.x), egwAbsf(temp.axis.y)), egwAbsf(temp.axis.z));
-                            particle->size += (EGWsingle)((EGWtime)temp.axis.x * clmpDeltaT);
-                            particle->weight += (EGWsingle)((EGWtime)_pDynamics->pWeight.deltaT * clmpDeltaT);
+                            _particles.size[pIndex] += temp.axis.x * sClmpDeltaT;
                             
                             if(_isExtForceApp) {
                                 if(!(_psFlags & EGW_PSYSFLAG_EXTFRCISACCL)) { // Treat external force as newtonian force
-                                    if(!egwIsZerof(particle->weight)) {
-                                        EGWtime invWeight = (EGWtime)1.0 / (EGWtime)particle->weight;
-                                        particle->velocity.axis.x += (EGWsingle)((EGWtime)_wcsExtForce.axis.x * invWeight * clmpDeltaT);
-                                        particle->velocity.axis.y += (EGWsingle)((EGWtime)_wcsExtForce.axis.y * invWeight * clmpDeltaT);
-                                        particle->velocity.axis.z += (EGWsingle)((EGWtime)_wcsExtForce.axis.z * invWeight * clmpDeltaT);
+                                    if(!egwIsZerof(_particles.weight[pIndex])) {
+                                        EGWsingle invWeightDeltaT = sClmpDeltaT / _particles.weight[pIndex];
+                                        velocity->axis.x += _wcsExtForce.axis.x * invWeightDeltaT;
+                                        velocity->axis.y += _wcsExtForce.axis.y * invWeightDeltaT;
+                                        velocity->axis.z += _wcsExtForce.axis.z * invWeightDeltaT;
                                     }
                                 } else { // Treat external force as direct acceleration
-                                    particle->velocity.axis.x += (EGWsingle)((EGWtime)_wcsExtForce.axis.x * clmpDeltaT);
-                                    particle->velocity.axis.y += (EGWsingle)((EGWtime)_wcsExtForce.axis.y * clmpDeltaT);
-                                    particle->velocity.axis.z += (EGWsingle)((EGWtime)_wcsExtForce.axis.z * clmpDeltaT);
+                                    velocity->axis.x += _wcsExtForce.axis.x * sClmpDeltaT;
+                                    velocity->axis.y += _wcsExtForce.axis.y * sClmpDeltaT;
+                                    velocity->axis.z += _wcsExtForce.axis.z * sClmpDeltaT;
                                 }
                             }
                             
-                            egwVecTransform443f(particle->twcsTrans, &_pDynamics->pPosition.deltaT, 0.0f, &temp); // DeltaTs are always directional based
-                            particle->position.axis.x += (EGWsingle)(((EGWtime)temp.axis.x * mvmntClmpDeltaT) +
-                                                                     ((EGWtime)particle->velocity.axis.x * mvmntClmpDeltaT));
-                            particle->position.axis.y += (EGWsingle)(((EGWtime)temp.axis.y * mvmntClmpDeltaT) +
-                                                                     ((EGWtime)particle->velocity.axis.y * mvmntClmpDeltaT));
-                            particle->position.axis.z += (EGWsingle)(((EGWtime)temp.axis.z * mvmntClmpDeltaT) +
-                                                                     ((EGWtime)particle->velocity.axis.z * mvmntClmpDeltaT));
+                            egwVecTransform443f(twcsTrans, &_pDynamics->pPosition.deltaT, 0.0f, &temp); // DeltaTs are always directional based
+                            position->axis.x += (temp.axis.x + velocity->axis.x) * mvmntClmpDeltaT;
+                            position->axis.y += (temp.axis.y + velocity->axis.y) * mvmntClmpDeltaT;
+                            position->axis.z += (temp.axis.z + velocity->axis.z) * mvmntClmpDeltaT;
                             
-                            if(particle->position.axis.y <= _wcsGrndLevel + EGW_SFLT_EPSILON) {
-                                EGWsingle cor = 0.0f;
-                                
-                                switch(_psFlags & EGW_PSYSFLAG_EXBNCGRND) {
-                                    case EGW_PSYSFLAG_BNCGRNDCOR25: {
-                                        cor = 0.25f;
-                                    } break;
-                                    case EGW_PSYSFLAG_BNCGRNDCOR50: {
-                                        cor = 0.50f;
-                                    } break;
-                                    case EGW_PSYSFLAG_BNCGRNDCOR75: {
-                                        cor = 0.75f;
-                                    } break;
-                                    case EGW_PSYSFLAG_BNCGRNDCOR100: {
-                                        cor = 1.00f;
-                                    } break;
-                                }
-                                
+                            if(position->axis.y <= _wcsGrndLevel + EGW_SFLT_EPSILON) {
                                 // Technically this is really cheating appropriate back-up-and-reapply-velocity-at-new-rate, but good enough for now
-                                particle->velocity.axis.x *= cor;
-                                particle->velocity.axis.z *= cor;
-                                particle->velocity.axis.y = cor * egwAbsf(particle->velocity.axis.y);
-                                particle->position.axis.y = _wcsGrndLevel + (cor * egwAbsf(_wcsGrndLevel - particle->position.axis.y));
+                                velocity->axis.x *= cor;
+                                velocity->axis.z *= cor;
+                                velocity->axis.y = cor * egwAbsf(velocity->axis.y);
+                                position->axis.y = _wcsGrndLevel + (cor * egwAbsf(_wcsGrndLevel - position->axis.y));
                             }
-                            
                         }
-                        
-                        if(egwIsEqualf(clmpDeltaT, deltaT)) { // Only do these items on last update
-                            if(_psFlags & EGW_PSYSFLAG_CYCLICPOS) { // Cyclic positioning
-                                while(particle->position.axis.x < _mmStPos[0].axis.x - EGW_SFLT_EPSILON)
-                                    particle->position.axis.x += _pDynamics->pPosition.variant.axis.x;
-                                while(particle->position.axis.x > _mmStPos[1].axis.x + EGW_SFLT_EPSILON)
-                                    particle->position.axis.x -= _pDynamics->pPosition.variant.axis.x;
-                                while(particle->position.axis.y < _mmStPos[0].axis.y - EGW_SFLT_EPSILON)
-                                    particle->position.axis.y += _pDynamics->pPosition.variant.axis.y;
-                                while(particle->position.axis.y > _mmStPos[1].axis.y + EGW_SFLT_EPSILON)
-                                    particle->position.axis.y -= _pDynamics->pPosition.variant.axis.y;
-                                while(particle->position.axis.z < _mmStPos[0].axis.z - EGW_SFLT_EPSILON)
-                                    particle->position.axis.z += _pDynamics->pPosition.variant.axis.z;
-                                while(particle->position.axis.z > _mmStPos[1].axis.z + EGW_SFLT_EPSILON)
-                                    particle->position.axis.z -= _pDynamics->pPosition.variant.axis.z;
-                            }
-                            
-                            if(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING) {
-                                if(particle->position.axis.x < _mmUpPos[0].axis.x) {
-                                    _mmUpPos[0].axis.x = particle->position.axis.x;
-                                    minMaxUpdated = YES;
-                                }
-                                if(particle->position.axis.x > _mmUpPos[1].axis.x) {
-                                    _mmUpPos[1].axis.x = particle->position.axis.x;
-                                    minMaxUpdated = YES;
-                                }
-                                if(particle->position.axis.y < _mmUpPos[0].axis.y) {
-                                    _mmUpPos[0].axis.y = particle->position.axis.y;
-                                    minMaxUpdated = YES;
-                                }
-                                if(particle->position.axis.y > _mmUpPos[1].axis.y) {
-                                    _mmUpPos[1].axis.y = particle->position.axis.y;
-                                    minMaxUpdated = YES;
-                                }
-                                if(particle->position.axis.z < _mmUpPos[0].axis.z) {
-                                    _mmUpPos[0].axis.z = particle->position.axis.z;
-                                    minMaxUpdated = YES;
-                                }
-                                if(particle->position.axis.z > _mmUpPos[1].axis.z) {
-                                    _mmUpPos[1].axis.z = particle->position.axis.z;
-                                    minMaxUpdated = YES;
-                                }
+                    }
+                    
+                    egwPSysBatchAddScaled4fv(_particles.color, &_pDynamics->pColor.deltaT, sClmpDeltaT, pCount);
+                    
+                    if(egwIsEqualf(clmpDeltaT, deltaT)) { // Only do these items on last update
+                        if(_psFlags & EGW_PSYSFLAG_CYCLICPOS) { // Cyclic positioning
+                            for(EGWuint pIndex = 0; pIndex < pCount; ++pIndex) {
+                                egwVector3f* position = &_particles.position[pIndex];
+                                
+                                while(position->axis.x < _mmStPos[0].axis.x - EGW_SFLT_EPSILON)
+                                    position->axis.x += _pDynamics->pPosition.variant.axis.x;
+                                while(position->axis.x > _mmStPos[1].axis.x + EGW_SFLT_EPSILON)
+                                    position->axis.x -= _pDynamics->pPosition.variant.axis.x;
+                                while(position->axis.y < _mmStPos[0].axis.y - EGW_SFLT_EPSILON)
+                                    position->axis.y += _pDynamics->pPosition.variant.axis.y;
+                                while(position->axis.y > _mmStPos[1].axis.y + EGW_SFLT_EPSILON)
+                                    position->axis.y -= _pDynamics->pPosition.variant.axis.y;
+                                while(position->axis.z < _mmStPos[0].axis.z - EGW_SFLT_EPSILON)
+                                    position->axis.z += _pDynamics->pPosition.variant.axis.z;
+                                while(position->axis.z > _mmStPos[1].axis.z + EGW_SFLT_EPSILON)
+                                    position->axis.z -= _pDynamics->pPosition.variant.axis.z;
                             }
                         }
                         
-                        particle->color.channel.r += (EGWsingle)((EGWtime)_pDynamics->pColor.deltaT.axis.x * clmpDeltaT);
-                        particle->color.channel.g += (EGWsingle)((EGWtime)_pDynamics->pColor.deltaT.axis.y * clmpDeltaT);
-                        particle->color.channel.b += (EGWsingle)((EGWtime)_pDynamics->pColor.deltaT.axis.z * clmpDeltaT);
-                        particle->color.channel.a += (EGWsingle)((EGWtime)_pDynamics->pColor.deltaT.axis.w * clmpDeltaT);
+                        if(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING) {
+                            egwVector3f min, max;
+                            
+                            egwVecFindExtentsAxs3fv(_particles.position, &min, &max, 0, pCount);
+                            
+                            if(min.axis.x < _mmUpPos[0].axis.x) { _mmUpPos[0].axis.x = min.axis.x; minMaxUpdated = YES; }
+                            if(max.axis.x > _mmUpPos[1].axis.x) { _mmUpPos[1].axis.x = max.axis.x; minMaxUpdated = YES; }
+                            if(min.axis.y < _mmUpPos[0].axis.y) { _mmUpPos[0].axis.y = min.axis.y; minMaxUpdated = YES; }
+                            if(max.axis.y > _mmUpPos[1].axis.y) { _mmUpPos[1].axis.y = max.axis.y; minMaxUpdated = YES; }
+                            if(min.axis.z < _mmUpPos[0].axis.z) { _mmUpPos[0].axis.z = min.axis.z; minMaxUpdated = YES; }
+                            if(max.axis.z > _mmUpPos[1].axis.z) { _mmUpPos[1].axis.z = max.axis.z; minMaxUpdated = YES; }
+                        }
                     }
                 }
             }
@@ -1083,31 +1437,31 @@ static egwActuatorJumpTable _egwAJT = { NULL };
             // !!!: End condition checking.
             if(!_isFinished && _isEmitFinished) {
                 if(!(_aFlags & EGW_ACTOBJ_ACTRFLG_LOOPING)) { // Check for finish condition
-                    if(_particles.eCount == 0) {
+                    if(_particles.pCount == 0) {
                         _isFinished = YES;
                         
                         [self stopRendering];
                     }
-                } else if(!(_psFlags & EGW_PSYSFLAG_LOOPAFTRNP) || _particles.eCount == 0) { // Check for loop around condition
+                } else if(!(_psFlags & EGW_PSYSFLAG_LOOPAFTRNP) || _particles.pCount == 0) { // Check for loop around condition
                     if(!(_psFlags & EGW_PSYSFLAG_EMITCNTDWN)) { // Emit to total particles
-                        _eDur.counted.tParts = egwMax2f(0.0f, _sDynamics->eDuration.tParticles.origin + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * (EGWsingle)_sDynamics->eDuration.tParticles.variant));
+                        _eDur.counted.tParts = egwMax2f(0.0f, _sDynamics->eDuration.tParticles.origin + (egwRandVarf(&_pRand) * (EGWsingle)_sDynamics->eDuration.tParticles.variant));
                         _eDur.counted.tpCount = 0;
                         if(!(_psFlags & EGW_PSYSFLAG_EMITLEFTVAR)) {
-                            _eFreq = egwMax2m(0.0, (EGWtime)_sDynamics->pFrequency.origin + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                            _eFreq = egwMax2m(0.0, (EGWtime)_sDynamics->pFrequency.origin + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                             _efLeft = egwMax2m(0.0, _eFreq);
                         } else {
                             _eFreq = egwMax2m(0.0, (EGWtime)_sDynamics->pFrequency.origin);
-                            _efLeft = egwMax2m(0.0, _eFreq + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                            _efLeft = egwMax2m(0.0, _eFreq + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                         }
                         _isEmitFinished = (_eDur.counted.tpCount >= (EGWuint32)(_eDur.counted.tParts + 0.5f) ? YES : NO);
                     } else { // Emit for a duration
-                        _eDur.timed.dLeft = egwMax2m((EGWtime)0.0, (EGWtime)_sDynamics->eDuration.eTimeout.origin + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->eDuration.eTimeout.variant));
+                        _eDur.timed.dLeft = egwMax2m((EGWtime)0.0, (EGWtime)_sDynamics->eDuration.eTimeout.origin + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->eDuration.eTimeout.variant));
                         if(!(_psFlags & EGW_PSYSFLAG_EMITLEFTVAR)) {
-                            _eFreq = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, (EGWtime)_sDynamics->pFrequency.origin + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                            _eFreq = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, (EGWtime)_sDynamics->pFrequency.origin + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                             _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq);
                         } else {
                             _eFreq = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, (EGWtime)_sDynamics->pFrequency.origin);
-                            _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                            _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                         }
                         _isEmitFinished = (_eDur.timed.dLeft <= EGW_TIME_EPSILON ? YES : NO);
                     }
@@ -1118,15 +1472,15 @@ static egwActuatorJumpTable _egwAJT = { NULL };
         if(particlesUpdate) {
             if(!(_psFlags & EGW_PSYSFLAG_EMITTOWCS)) {
                 if(!(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING)) {
-                    if(_particles.eCount)
-                        [_mmcsRBVol initWithOpticalSource:NULL vertexCount:_particles.eCount vertexCoords:(const egwVector3f*)&(((const egwPSParticle*)_particles.rData)[0].position) vertexCoordsStride:(EGWintptr)sizeof(egwPSParticle)];
+                    if(_particles.pCount)
+                        [_mmcsRBVol initWithOpticalSource:NULL vertexCount:_particles.pCount vertexCoords:(const egwVector3f*)_particles.position vertexCoordsStride:0];
                     else
                         [_mmcsRBVol reset];
                     
                     _ortPending = YES;
                     [self applyOrientation];
                 } else if(minMaxUpdated) {
-                    if(_particles.eCount)
+                    if(_particles.pCount)
                         [_mmcsRBVol initWithOpticalSource:NULL vertexCount:2 vertexCoords:(const egwVector3f*)&_mmUpPos[0] vertexCoordsStride:0];
                     else
                         [_mmcsRBVol reset];
@@ -1137,12 +1491,12 @@ static egwActuatorJumpTable _egwAJT = { NULL };
                 egwSFPVldtrInvalidate(_rSync, @selector(invalidate));
             } else {
                 if(!(_rFlags & EGW_OBJEXTEND_FLG_LAZYBOUNDING)) {
-                    if(_particles.eCount)
-                        [_wcsRBVol initWithOpticalSource:NULL vertexCount:_particles.eCount vertexCoords:(const egwVector3f*)&(((const egwPSParticle*)_particles.rData)[0].position) vertexCoordsStride:(EGWintptr)sizeof(egwPSParticle)];
+                    if(_particles.pCount)
+                        [_wcsRBVol initWithOpticalSource:NULL vertexCount:_particles.pCount vertexCoords:(const egwVector3f*)_particles.position vertexCoordsStride:0];
                     else
                         [_wcsRBVol reset];
                 } else if(minMaxUpdated) {
-                    if(_particles.eCount)
+                    if(_particles.pCount)
                         [_wcsRBVol initWithOpticalSource:NULL vertexCount:2 vertexCoords:(const egwVector3f*)&_mmUpPos[0] vertexCoordsStride:0];
                     else
                         [_wcsRBVol reset];
@@ -1156,24 +1510,24 @@ static egwActuatorJumpTable _egwAJT = { NULL };
             [_delegate actuator:self did:EGW_ACTION_FINISH];
     } else if(flags & EGW_ACTOBJ_RPLYFLG_DOUPDATESTART) {
         if(!(_psFlags & EGW_PSYSFLAG_EMITCNTDWN)) { // Emit to total particles
-            _eDur.counted.tParts = egwMax2f(0.0f, _sDynamics->eDuration.tParticles.origin + ((((EGWsingle)rand() / (EGWsingle)RAND_MAX) - 0.5f) * (EGWsingle)_sDynamics->eDuration.tParticles.variant));
+            _eDur.counted.tParts = egwMax2f(0.0f, _sDynamics->eDuration.tParticles.origin + (egwRandVarf(&_pRand) * (EGWsingle)_sDynamics->eDuration.tParticles.variant));
             _eDur.counted.tpCount = 0;
             if(!(_psFlags & EGW_PSYSFLAG_EMITLEFTVAR)) {
-                _eFreq = egwMax2m(0.0, (EGWtime)_sDynamics->pFrequency.origin + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                _eFreq = egwMax2m(0.0, (EGWtime)_sDynamics->pFrequency.origin + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                 _efLeft = egwMax2m(0.0, _eFreq);
             } else {
                 _eFreq = egwMax2m(0.0, (EGWtime)_sDynamics->pFrequency.origin);
-                _efLeft = egwMax2m(0.0, _eFreq + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                _efLeft = egwMax2m(0.0, _eFreq + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
             }
             _isEmitFinished = (_eDur.counted.tpCount >= (EGWuint32)(_eDur.counted.tParts + 0.5f) ? YES : NO);
         } else { // Emit for a duration
-            _eDur.timed.dLeft = egwMax2m((EGWtime)0.0, (EGWtime)_sDynamics->eDuration.eTimeout.origin + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->eDuration.eTimeout.variant));
+            _eDur.timed.dLeft = egwMax2m((EGWtime)0.0, (EGWtime)_sDynamics->eDuration.eTimeout.origin + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->eDuration.eTimeout.variant));
             if(!(_psFlags & EGW_PSYSFLAG_EMITLEFTVAR)) {
-                _eFreq = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, (EGWtime)_sDynamics->pFrequency.origin + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                _eFreq = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, (EGWtime)_sDynamics->pFrequency.origin + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
                 _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq);
             } else {
                 _eFreq = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, (EGWtime)_sDynamics->pFrequency.origin);
-                _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq + ((((EGWtime)rand() / (EGWtime)RAND_MAX) - (EGWtime)0.5) * (EGWtime)_sDynamics->pFrequency.variant));
+                _efLeft = egwMax2m((EGWtime)EGW_PSYS_MINEMITFREQTIMED, _eFreq + (egwRandVarm(&_pRand) * (EGWtime)_sDynamics->pFrequency.variant));
             }
             _isEmitFinished = (_eDur.timed.dLeft <= EGW_TIME_EPSILON ? YES : NO);
         }
@@ -1183,7 +1537,7 @@ static egwActuatorJumpTable _egwAJT = { NULL };
             _isPaused = NO;
             _isActuating = YES;
             
-            egwArrayRemoveAll(&_particles);
+            egwPSysPoolRemoveAll(&_particles);
             
             _mmUpPos[0].axis.x = _mmUpPos[0].axis.y = _mmUpPos[0].axis.z = EGW_SFLT_MAX;
             _mmUpPos[1].axis.x = _mmUpPos[1].axis.y = _mmUpPos[1].axis.z = -EGW_SFLT_MAX;
@@ -1284,6 +1638,10 @@ static egwActuatorJumpTable _egwAJT = { NULL };
     return _mParts;
 }
 
+- (EGWuint32)randomSeed {
+    return _pSeed;
+}
+
 - (id<egwPInterpolator>)offsetDriver {
     return _lcsIpo;
 }
@@ -1411,23 +1769,26 @@ static egwActuatorJumpTable _egwAJT = { NULL };
     egwSFPVldtrInvalidate(_rSync, @selector(invalidate));
 }
 
+- (void)setRandomSeed:(EGWuint32)seed {
+    _pSeed = seed;
+    egwRandSeed(&_pRand, _pSeed);
+}
+
 - (void)setMaximumParticles:(EGWuint16)maxPart {
     EGWuint16 oldMParts = _mParts;
     _mParts = maxPart;
     
-    if(_mParts && _mParts < oldMParts && _particles.eCount > _mParts) { // If mParts 0 then infinite
-        if(!(_psFlags & EGW_PSYSFLAG_EMITOLDRPLC)) // Quick shift (assume oldest is more towards tail)
-            while(_particles.eCount > _mParts)
-                egwArrayRemoveTail(&_particles);
+    if(_mParts && _mParts < oldMParts && _particles.pCount > _mParts) { // If mParts 0 then infinite
+        if(!(_psFlags & EGW_PSYSFLAG_EMITOLDRPLC) || !(_psFlags & EGW_PSYSFLAG_OFFTIMEDTEX)) // Quick shift (oldest is head unless alive times are offset)
+            egwPSysPoolRemoveRange(&_particles, 0, _particles.pCount - _mParts);
         else { // Find oldest particles and remove
-            while(_particles.eCount > _mParts) {
-                EGWint oldestIndex = 0;
-                egwPSParticle* parts = (egwPSParticle*)_particles.rData;
+            while(_particles.pCount > _mParts) {
+                EGWuint oldestIndex = 0;
                 
-                for(EGWint pIndex = 1; pIndex < (EGWint)_particles.eCount; ++pIndex)
-                    if(parts[pIndex].ltAlive > parts[oldestIndex].ltAlive)
+                for(EGWuint pIndex = 1; pIndex < _particles.pCount; ++pIndex)
+                    if(_particles.ltAlive[pIndex] > _particles.ltAlive[oldestIndex])
                         oldestIndex = pIndex;
-                egwArrayRemoveAt(&_particles, (EGWuint)oldestIndex);
+                egwPSysPoolRemoveRange(&_particles, oldestIndex, 1);
             }
         }
     }
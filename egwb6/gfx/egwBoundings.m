@@ -45,7 +45,7 @@
     return self;
 }
 
-- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint16)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
+- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
     if(!(self = [super init])) { [self release]; return (self = nil); }
     
     if(optSource)
@@ -160,7 +160,7 @@
     return self;
 }
 
-- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint16)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
+- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
     if(!(self = [super init])) { [self release]; return (self = nil); }
     
     if(optSource)
@@ -279,7 +279,7 @@
     return self;
 }
 
-- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint16)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
+- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
     egwVector3f min, max;
     EGWsingle temp;
     
@@ -592,7 +592,7 @@
     return self;
 }
 
-- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint16)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
+- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
     if(!(self = [super init])) { [self release]; return (self = nil); }
     
     if(optSource)
@@ -928,7 +928,7 @@
     return self;
 }
 
-- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint16)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
+- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
     egwVector3f min, max;
     EGWsingle temp;
     
@@ -1267,7 +1267,7 @@
     return self;
 }
 
-- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint16)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
+- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride {
     egwVector3f min, max;
     
     if(!(self = [super init])) { [self release]; return (self = nil); }
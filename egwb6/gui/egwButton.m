@@ -30,6 +30,7 @@
 #import "../sys/egwGfxContext.h"
 #import "../sys/egwGfxContextNSGL.h"  // NOTE: Below code has a dependence on GL.
 #import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwGfxRenderer.h"
 #import "../math/egwMath.h"
 #import "../math/egwVector.h"
@@ -72,6 +73,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         _egwRJT.fpRFlags = (EGWuint32(*)(id, SEL))[inst methodForSelector:@selector(renderingFlags)];
         _egwRJT.fpRFrame = (EGWuint16(*)(id, SEL))[inst methodForSelector:@selector(renderingFrame)];
         _egwRJT.fpRSource = (const egwVector4f*(*)(id, SEL))[inst methodForSelector:@selector(renderingSource)];
+        _egwRJT.fpRBVol = (id<egwPBounding>(*)(id, SEL))[inst methodForSelector:@selector(renderingBounding)];
         _egwRJT.fpRSync = (egwValidater*(*)(id, SEL))[inst methodForSelector:@selector(renderingSync)];
         _egwRJT.fpLStack = (egwLightStack*(*)(id, SEL))[inst methodForSelector:@selector(lightStack)];
         _egwRJT.fpMStack = (egwMaterialStack*(*)(id, SEL))[inst methodForSelector:@selector(materialStack)];
@@ -486,6 +488,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
                 
                 glDrawArrays(GL_TRIANGLE_FAN, 0, (GLsizei)4);
+                egwGfxCntxNullCountDraws(1);
                 
                 glPopMatrix();
             }
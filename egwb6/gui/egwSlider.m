@@ -30,6 +30,7 @@
 #import "../sys/egwGfxContext.h"
 #import "../sys/egwGfxContextNSGL.h"  // NOTE: Below code has a dependence on GL.
 #import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwGfxRenderer.h"
 #import "../math/egwMath.h"
 #import "../math/egwVector.h"
@@ -72,6 +73,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
         _egwRJT.fpRFlags = (EGWuint32(*)(id, SEL))[inst methodForSelector:@selector(renderingFlags)];
         _egwRJT.fpRFrame = (EGWuint16(*)(id, SEL))[inst methodForSelector:@selector(renderingFrame)];
         _egwRJT.fpRSource = (const egwVector4f*(*)(id, SEL))[inst methodForSelector:@selector(renderingSource)];
+        _egwRJT.fpRBVol = (id<egwPBounding>(*)(id, SEL))[inst methodForSelector:@selector(renderingBounding)];
         _egwRJT.fpRSync = (egwValidater*(*)(id, SEL))[inst methodForSelector:@selector(renderingSync)];
         _egwRJT.fpLStack = (egwLightStack*(*)(id, SEL))[inst methodForSelector:@selector(lightStack)];
         _egwRJT.fpMStack = (egwMaterialStack*(*)(id, SEL))[inst methodForSelector:@selector(materialStack)];
@@ -509,11 +511,13 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                     glTexCoordPointer((GLint)2, GL_FLOAT, (GLsizei)0, (const GLvoid*)(EGWuintptr)((EGWuint)sizeof(egwVector3f) * 4));
                     
                     glDrawArrays(GL_TRIANGLE_FAN, 0, (GLsizei)4);
+                    egwGfxCntxNullCountDraws(1);
                     
                     glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)(EGWuintptr)((EGWuint)sizeof(egwVector3f) * 4 + (EGWuint)sizeof(egwVector2f) * 4));
                     glTexCoordPointer((GLint)2, GL_FLOAT, (GLsizei)0, (const GLvoid*)(EGWuintptr)((EGWuint)sizeof(egwVector3f) * 4 * 2 + (EGWuint)sizeof(egwVector2f) * 4));
                     
                     glDrawArrays(GL_TRIANGLE_FAN, 0, (GLsizei)4);
+                    egwGfxCntxNullCountDraws(1);
                 } else {
                     egw_glBindBuffer(GL_ARRAY_BUFFER, 0);
                     
@@ -521,11 +525,13 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                     glTexCoordPointer((GLint)2, GL_FLOAT, (GLsizei)0, (const GLvoid*)&_isMesh.tftCoords[0]);
                     
                     glDrawArrays(GL_TRIANGLE_FAN, 0, (GLsizei)4);
+                    egwGfxCntxNullCountDraws(1);
                     
                     glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)&_isMesh.tuvCoords[0]);
                     glTexCoordPointer((GLint)2, GL_FLOAT, (GLsizei)0, (const GLvoid*)&_isMesh.tutCoords[0]);
                     
                     glDrawArrays(GL_TRIANGLE_FAN, 0, (GLsizei)4);
+                    egwGfxCntxNullCountDraws(1);
                 }
                 
                 glTranslatef(egwLerpf(_stMesh->vCoords[0].axis.x, _stMesh->vCoords[1].axis.x, _trOffset), 0.0f, 0.00001f);
@@ -553,6 +559,7 @@ static egwRenderableJumpTable _egwRJT = { NULL };
                 }
                 
                 glDrawArrays(GL_TRIANGLE_FAN, 0, (GLsizei)4);
+                egwGfxCntxNullCountDraws(1);
                 
                 glPopMatrix();
             }
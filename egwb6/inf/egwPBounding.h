@@ -44,7 +44,7 @@
 /// @param [in] vertexCoords Vertex vector coordinates array.
 /// @param [in] vCoordsStride Vertex coords stride parameter.
 /// @return Self upon success, otherwise nil.
-- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint16)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride;
+- (id)initWithOpticalSource:(const egwVector3f*)optSource vertexCount:(EGWuint)vertexCount vertexCoords:(const egwVector3f*)vertexCoords vertexCoordsStride:(EGWintptr)vCoordsStride;
 
 
 /// Merge Volumes Method.
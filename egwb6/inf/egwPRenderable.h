@@ -46,6 +46,7 @@ typedef struct {
     EGWuint32 (*fpRFlags)(id, SEL);             ///< FP to renderingFlags.
     EGWuint16 (*fpRFrame)(id, SEL);             ///< FP to renderingFrame.
     const egwVector4f* (*fpRSource)(id, SEL);   ///< FP to renderingSource.
+    id<egwPBounding> (*fpRBVol)(id, SEL);       ///< FP to renderingBounding.
     egwValidater* (*fpRSync)(id, SEL);          ///< FP to renderingSync.
     egwLightStack* (*fpLStack)(id, SEL);        ///< FP to lightStack.
     egwMaterialStack* (*fpMStack)(id, SEL);     ///< FP to materialStack.
@@ -54,6 +55,8 @@ typedef struct {
     void (*fpSetRFrame)(id, SEL, EGWuint16);    ///< FP to setRenderingFrame:.
     BOOL (*fpOpaque)(id, SEL);                  ///< FP to isOpaque.
     BOOL (*fpRendering)(id, SEL);               ///< FP to isRendering.
+    void (*fpRecord)(id, SEL, EGWuint, egwGfxCommandBuffer*);///< FP to recordWithFlags:intoCommands: (NULL if unsupported).
+    BOOL (*fpBatch)(id, SEL, EGWuint, const id*, EGWuint, egwGfxBatchScratch*);///< FP to renderBatchWithFlags:instances:count:scratch: (NULL if unsupported).
 } egwRenderableJumpTable;
 
 
@@ -180,6 +183,29 @@ typedef struct {
 /// @return YES if object is rendering, otherwise NO.
 - (BOOL)isRendering;
 
+
+@optional
+
+/// Record With Flags Method.
+/// Records the render pass of the object with provided rendering reply @a flags into @a cmdBuffer, to be replayed later on the graphics context thread.
+/// @note Do not call this method directly - this method is called automatically by the system, possibly off of the graphics context thread, thus no graphics API calls may be made from within.
+/// @note Objects implementing this method should set fpRecord in their renderable jump table.
+/// @param [in] flags Bit-wise reply flag settings (render pass only).
+/// @param [in,out] cmdBuffer Command buffer to record into.
+- (void)recordWithFlags:(EGWuint32)flags intoCommands:(egwGfxCommandBuffer*)cmdBuffer;
+
+/// Render Batch With Flags Method.
+/// Renders the provided run of @a instances (including self, as the first instance) with provided rendering reply @a flags in as few draw calls as possible.
+/// @note Do not call this method directly - this method is called automatically by the system, only for opaque runs sharing the same jump table, rendering base, and binding stack hashes.
+/// @note Objects implementing this method should set fpBatch in their renderable jump table.
+/// @note Upon success, the graphics API array state is left undefined (i.e. the next render pass must not be told EGW_GFXOBJ_RPLYFLG_SAMELASTBASE).
+/// @param [in] flags Bit-wise reply flag settings (render pass only).
+/// @param [in] instances Array of instance objects to render, in render order.
+/// @param [in] count Instance objects count.
+/// @param [in,out] scratch Renderer owned merged arrays scratch, kept between runs (grown as needed).
+/// @return YES if run was rendered, otherwise NO (e.g. geometry data not kept, after which each instance is rendered individually).
+- (BOOL)renderBatchWithFlags:(EGWuint32)flags instances:(const id*)instances count:(EGWuint)count scratch:(egwGfxBatchScratch*)scratch;
+
 @end
 
 /// @}
@@ -199,6 +199,21 @@
     #define EGW_IASM_GPRB_POP       __asm { pop EGW_ARCH_DEP_REGNAME(bx) }
 #endif
 
+// SIMD Instruction Set Macros
+#define EGW_SIMD_NONE_ID            0x00
+#define EGW_SIMD_SSE_ID             0x01
+#define EGW_SIMD_NEON_ID            0x02
+#if !defined(EGW_SIMD_DISABLE) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+    #define EGW_SIMD_SSE
+    #define EGW_SIMD_IDENT          EGW_SIMD_SSE_ID
+#elif !defined(EGW_SIMD_DISABLE) && (defined(__ARM_NEON__) || defined(__ARM_NEON))
+    #define EGW_SIMD_NEON
+    #define EGW_SIMD_IDENT          EGW_SIMD_NEON_ID
+#else
+    #define EGW_SIMD_NONE
+    #define EGW_SIMD_IDENT          EGW_SIMD_NONE_ID
+#endif
+
 
 // !!!: ***** Typedefs *****
 
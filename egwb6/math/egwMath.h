@@ -1837,6 +1837,56 @@ EGWdouble egwSmoothStepd(const EGWdouble val, const EGWdouble edge_lead, const E
 EGWtriple egwSmoothStept(const EGWtriple val, const EGWtriple edge_lead, const EGWtriple edge_trail);
 
 
+// !!!: ***** Random Routines *****
+
+/// Random Seed Routine.
+/// Initializes the random stream @a rand_out from the provided @a seed value.
+/// @param [out] rand_out Random stream output.
+/// @param [in] seed Seed value.
+/// @note Identical seeds always produce identical streams (e.g. for replays).
+void egwRandSeed(egwRandomStream* rand_out, const EGWuint32 seed);
+
+/// Random Next Routine.
+/// Draws the next 32-bit unsigned integer from the random stream @a rand_inout.
+/// @param [in,out] rand_inout Random stream input/output.
+/// @return Next uniformly distributed value [0,2^32).
+EGWuint32 egwRandNext(egwRandomStream* rand_inout);
+
+/// Random Unit Routine.
+/// Draws the next uniformly distributed value from the random stream @a rand_inout.
+/// @param [in,out] rand_inout Random stream input/output.
+/// @return Next uniformly distributed value [0,1).
+EGWsingle egwRandUnitf(egwRandomStream* rand_inout);
+
+/// Random Variant Routine.
+/// Draws the next uniformly distributed variant from the random stream @a rand_inout.
+/// @param [in,out] rand_inout Random stream input/output.
+/// @return Next uniformly distributed value [-0.5,0.5).
+EGWsingle egwRandVarf(egwRandomStream* rand_inout);
+
+/// Random Time Variant Routine.
+/// Draws the next uniformly distributed time variant from the random stream @a rand_inout, for scaling EGWtime (double) variants without a round trip through single precision.
+/// @param [in,out] rand_inout Random stream input/output.
+/// @return Next uniformly distributed time value [-0.5,0.5), at the full 32-bit resolution of the stream.
+EGWtime egwRandVarm(egwRandomStream* rand_inout);
+
+/// Arrayed Random Unit Routine.
+/// Draws @a count uniformly distributed values from the random stream @a rand_inout.
+/// @param [in,out] rand_inout Random stream input/output.
+/// @param [out] vals_out Array of value outputs [0,1).
+/// @param [in] strideB_out Array advancing skip bytes on value outputs.
+/// @param [in] count Array element count.
+void egwRandUnitfv(egwRandomStream* rand_inout, EGWsingle* vals_out, const EGWintptr strideB_out, EGWuint count);
+
+/// Arrayed Random Variant Routine.
+/// Draws @a count uniformly distributed variants from the random stream @a rand_inout.
+/// @param [in,out] rand_inout Random stream input/output.
+/// @param [out] vals_out Array of value outputs [-0.5,0.5).
+/// @param [in] strideB_out Array advancing skip bytes on value outputs.
+/// @param [in] count Array element count.
+void egwRandVarfv(egwRandomStream* rand_inout, EGWsingle* vals_out, const EGWintptr strideB_out, EGWuint count);
+
+
 // !!!: ***** Fast Routines *****
 
 /// Fast Inverse Square Root Routine.
@@ -1897,4 +1947,40 @@ EGWsingle egwFastArcCosf(const EGWsingle val);
 /// @note Since both numerator and denominator values (and their signs) are available the correct quadrant can be computed in this routine.
 EGWsingle egwFastArcTan2f(const EGWtriple val_nmr, const EGWtriple val_dnm);
 
+/// Arrayed Sine & Cosine Routine.
+/// Computes the sine and cosine of @a count angles at once, sharing a single range reduction per angle.
+/// @param [in] angles_in Array of angle values (radians) [-8192,8192].
+/// @param [out] sins_out Array of sine outputs (may be NULL).
+/// @param [out] coss_out Array of cosine outputs (may be NULL).
+/// @param [in] strideB_in Array advancing skip bytes on angle values.
+/// @param [in] strideB_sout Array advancing skip bytes on sine outputs.
+/// @param [in] strideB_cout Array advancing skip bytes on cosine outputs.
+/// @param [in] count Array element count.
+/// @note Uses a Cody-Waite reduction to [-PI/4,PI/4] and minimax polynomials, absolute error is within 1.0e-7 over [-8192,8192]. Angles outside this range must be reduced beforehand (e.g. egwRadReduceNPIPIf).
+/// @note Packed arrays (all strides zero) are processed four at a time under EGW_SIMD_SSE (SSE2) or EGW_SIMD_NEON, SSE results are identical to the scalar path.
+void egwSinCosfv(const EGWsingle* angles_in, EGWsingle* sins_out, EGWsingle* coss_out, const EGWintptr strideB_in, const EGWintptr strideB_sout, const EGWintptr strideB_cout, EGWuint count);
+
+/// Arrayed Inverse Square Root Routine.
+/// Computes the inverse squared root of @a count values (e.g. 1/sqrt(x)).
+/// @param [in] vals_in Array of value operands.
+/// @param [out] vals_out Array of inverse squared root outputs.
+/// @param [in] strideB_in Array advancing skip bytes on value operands.
+/// @param [in] strideB_out Array advancing skip bytes on value outputs.
+/// @param [in] count Array element count.
+/// @note Packed arrays (all strides zero) use a hardware estimate refined by Newton-Raphson, relative error is within 3.0e-7 on SSE and a couple ulp on ARMv7 NEON (AArch64 is exact), zero yields +inf. Strided arrays and tails use egwInvSqrtf.
+void egwInvSqrtfv(const EGWsingle* vals_in, EGWsingle* vals_out, const EGWintptr strideB_in, const EGWintptr strideB_out, EGWuint count);
+
+/// Arrayed Arc-Tangent Y/X Routine.
+/// Computes the arc-tangent of @a count value pairs (@c vals_nmr / @a vals_dnm) in radians [-PI,PI].
+/// @param [in] vals_nmr Array of value numerator operands.
+/// @param [in] vals_dnm Array of value denominator operands.
+/// @param [out] angles_out Array of angle outputs (radians) [-PI,PI].
+/// @param [in] strideB_nmr Array advancing skip bytes on numerator operands.
+/// @param [in] strideB_dnm Array advancing skip bytes on denominator operands.
+/// @param [in] strideB_out Array advancing skip bytes on angle outputs.
+/// @param [in] count Array element count.
+/// @note Uses an octant reduction to [0,tan(PI/8)] and a minimax polynomial, absolute error is within 3.0e-7, 0/0 yields 0.
+/// @note Packed arrays (all strides zero) are processed four at a time under EGW_SIMD_SSE (SSE2) or EGW_SIMD_NEON, SSE results are identical to the scalar path.
+void egwArcTan2fv(const EGWsingle* vals_nmr, const EGWsingle* vals_dnm, EGWsingle* angles_out, const EGWintptr strideB_nmr, const EGWintptr strideB_dnm, const EGWintptr strideB_out, EGWuint count);
+
 /// @}
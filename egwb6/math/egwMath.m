@@ -26,6 +26,11 @@
 
 #import <math.h>
 #import "egwMath.h"
+#if defined(EGW_SIMD_SSE) && defined(__SSE2__)
+#import <emmintrin.h>
+#elif defined(EGW_SIMD_NEON)
+#import <arm_neon.h>
+#endif
 
 
 const EGWsingle egwSIZerof = 0.0f;
@@ -779,6 +784,68 @@ EGWtriple egwSmoothStept(const EGWtriple val, const EGWtriple edge_lead, const E
     return tmp * tmp * ((EGWtriple)3.0 - (tmp + tmp));
 }
 
+void egwRandSeed(egwRandomStream* rand_out, const EGWuint32 seed) {
+    register EGWuint32 mix = seed;
+    
+    // SplitMix32 expansion of seed into state words, guarantees non-zero state
+    for(EGWuint wIndex = 0; wIndex < 4; ++wIndex) {
+        mix += 0x9e3779b9;
+        register EGWuint32 tmp = mix;
+        tmp = (tmp ^ (tmp >> 16)) * 0x85ebca6b;
+        tmp = (tmp ^ (tmp >> 13)) * 0xc2b2ae35;
+        rand_out->state[wIndex] = tmp ^ (tmp >> 16);
+    }
+    
+    if(!(rand_out->state[0] | rand_out->state[1] | rand_out->state[2] | rand_out->state[3]))
+        rand_out->state[0] = 0x9e3779b9;
+}
+
+EGWuint32 egwRandNext(egwRandomStream* rand_inout) {
+    register EGWuint32 tmp = rand_inout->state[0] ^ (rand_inout->state[0] << 11);
+    rand_inout->state[0] = rand_inout->state[1];
+    rand_inout->state[1] = rand_inout->state[2];
+    rand_inout->state[2] = rand_inout->state[3];
+    return (rand_inout->state[3] = (rand_inout->state[3] ^ (rand_inout->state[3] >> 19)) ^ (tmp ^ (tmp >> 8)));
+}
+
+EGWsingle egwRandUnitf(egwRandomStream* rand_inout) {
+    return (EGWsingle)(egwRandNext(rand_inout) >> 8) * (1.0f / 16777216.0f);
+}
+
+EGWsingle egwRandVarf(egwRandomStream* rand_inout) {
+    return ((EGWsingle)(egwRandNext(rand_inout) >> 8) * (1.0f / 16777216.0f)) - 0.5f;
+}
+
+EGWtime egwRandVarm(egwRandomStream* rand_inout) {
+    return ((EGWtime)egwRandNext(rand_inout) * (1.0 / 4294967296.0)) - 0.5;
+}
+
+void egwRandUnitfv(egwRandomStream* rand_inout, EGWsingle* vals_out, const EGWintptr strideB_out, EGWuint count) {
+    register EGWuint32 s0 = rand_inout->state[0], s1 = rand_inout->state[1], s2 = rand_inout->state[2], s3 = rand_inout->state[3], tmp;
+    
+    while(count--) {
+        tmp = s0 ^ (s0 << 11); s0 = s1; s1 = s2; s2 = s3;
+        s3 = (s3 ^ (s3 >> 19)) ^ (tmp ^ (tmp >> 8));
+        *vals_out = (EGWsingle)(s3 >> 8) * (1.0f / 16777216.0f);
+        vals_out = (EGWsingle*)((EGWintptr)vals_out + (EGWintptr)sizeof(EGWsingle) + strideB_out);
+    }
+    
+    rand_inout->state[0] = s0; rand_inout->state[1] = s1; rand_inout->state[2] = s2; rand_inout->state[3] = s3;
+}
+
+void egwRandVarfv(egwRandomStream* rand_inout, EGWsingle* vals_out, const EGWintptr strideB_out, EGWuint count) {
+    register EGWuint32 s0 = rand_inout->state[0], s1 = rand_inout->state[1], s2 = rand_inout->state[2], s3 = rand_inout->state[3], tmp;
+    
+    while(count--) {
+        tmp = s0 ^ (s0 << 11); s0 = s1; s1 = s2; s2 = s3;
+        s3 = (s3 ^ (s3 >> 19)) ^ (tmp ^ (tmp >> 8));
+        *vals_out = ((EGWsingle)(s3 >> 8) * (1.0f / 16777216.0f)) - 0.5f;
+        vals_out = (EGWsingle*)((EGWintptr)vals_out + (EGWintptr)sizeof(EGWsingle) + strideB_out);
+    }
+    
+    rand_inout->state[0] = s0; rand_inout->state[1] = s1; rand_inout->state[2] = s2; rand_inout->state[3] = s3;
+}
+
 EGWsingle egwFastInvSqrtf(const EGWsingle val) {
     register union {
 		EGWsingle f;
@@ -830,3 +897,211 @@ EGWsingle egwFastArcTan2f(const EGWtriple val_nmr, const EGWtriple val_dnm) {
                                                   (3.0f * EGW_MATH_PI_4) - EGW_MATH_PI_4 * ((val_dnm + absNmr) / (absNmr - val_dnm)) );
     return (val_nmr >= 0.0f ? angle : -angle);
 }
+
+// Cephes single precision sin/cos and atan constants (Cody-Waite split of PI/4, minimax coefficients).
+#define EGW_MATH_SC_4OPI    1.27323954473516f
+#define EGW_MATH_SC_DP1     0.78515625f
+#define EGW_MATH_SC_DP2     2.4187564849853515625e-4f
+#define EGW_MATH_SC_DP3     3.77489497744594108e-8f
+#define EGW_MATH_SC_S0      -1.9515295891e-4f
+#define EGW_MATH_SC_S1      8.3321608736e-3f
+#define EGW_MATH_SC_S2      -1.6666654611e-1f
+#define EGW_MATH_SC_C0      2.443315711809948e-5f
+#define EGW_MATH_SC_C1      -1.388731625493765e-3f
+#define EGW_MATH_SC_C2      4.166664568298827e-2f
+#define EGW_MATH_AT_TPIO8   0.414213562373095f
+#define EGW_MATH_AT_P0      8.05374449538e-2f
+#define EGW_MATH_AT_P1      -1.38776856032e-1f
+#define EGW_MATH_AT_P2      1.99777106478e-1f
+#define EGW_MATH_AT_P3      -3.33329491539e-1f
+
+// NOTE: The scalar lanes below mirror the SIMD paths operation for operation so that tails and strided arrays agree with packed results. -jw
+static inline void egwSinCosLanef(const EGWsingle angle_r, EGWsingle* sin_out, EGWsingle* cos_out) {
+    register union {
+        EGWsingle f;
+        EGWuint32 i;
+    } sv, cv;
+    register EGWsingle x = fabsf(angle_r), y, z;
+    register EGWint j = (EGWint)(x * EGW_MATH_SC_4OPI);
+    
+    j = (j + 1) & ~1; y = (EGWsingle)j;
+    x = ((x - (y * EGW_MATH_SC_DP1)) - (y * EGW_MATH_SC_DP2)) - (y * EGW_MATH_SC_DP3);
+    z = x * x;
+    sv.f = ((((EGW_MATH_SC_S0 * z) + EGW_MATH_SC_S1) * z + EGW_MATH_SC_S2) * z) * x + x;
+    cv.f = ((((EGW_MATH_SC_C0 * z) + EGW_MATH_SC_C1) * z + EGW_MATH_SC_C2) * z) * z - (0.5f * z) + 1.0f;
+    
+    if(j & 2) { y = sv.f; sv.f = cv.f; cv.f = y; } // Polynomials swap on odd quadrants
+    
+    if(sin_out) {
+        sv.i ^= (signbit(angle_r) ? 0x80000000 : 0) ^ ((EGWuint32)(j & 4) << 29); // Sign flips by input sign and upper half-turn
+        *sin_out = sv.f;
+    }
+    if(cos_out) {
+        cv.i ^= (EGWuint32)(~(j - 2) & 4) << 29;
+        *cos_out = cv.f;
+    }
+}
+
+static inline EGWsingle egwArcTan2Lanef(const EGWsingle val_nmr, const EGWsingle val_dnm) {
+    register EGWsingle absNmr = fabsf(val_nmr), absDnm = fabsf(val_dnm);
+    register EGWsingle mx = (absNmr > absDnm ? absNmr : absDnm), mn = (absNmr > absDnm ? absDnm : absNmr);
+    register EGWint big = (mn > mx * EGW_MATH_AT_TPIO8);
+    register EGWsingle nmr = (big ? mn - mx : mn), dnm = (big ? mn + mx : mx);
+    register EGWsingle r = (dnm > 0.0f ? nmr / dnm : 0.0f), z = r * r;
+    
+    r = ((((((EGW_MATH_AT_P0 * z) + EGW_MATH_AT_P1) * z + EGW_MATH_AT_P2) * z + EGW_MATH_AT_P3) * z) * r + r) + (big ? (EGWsingle)EGW_MATH_PI_4 : 0.0f);
+    if(absNmr > absDnm) r = (EGWsingle)EGW_MATH_PI_2 - r;
+    if(val_dnm < 0.0f) r = (EGWsingle)EGW_MATH_PI - r;
+    return (val_nmr < 0.0f ? -r : r);
+}
+
+#if defined(EGW_SIMD_NEON)
+static inline float32x4_t egwMathSIMDDiv4f(float32x4_t nmr, float32x4_t dnm) {
+    #if defined(__aarch64__)
+        return vdivq_f32(nmr, dnm);
+    #else
+        // NOTE: ARMv7 NEON has no vector divide, estimate refined by two Newton-Raphson steps is within a couple ulp of a true divide. -jw
+        float32x4_t est = vrecpeq_f32(dnm);
+        est = vmulq_f32(est, vrecpsq_f32(dnm, est));
+        est = vmulq_f32(est, vrecpsq_f32(dnm, est));
+        return vmulq_f32(nmr, est);
+    #endif
+}
+#endif
+
+void egwSinCosfv(const EGWsingle* angles_in, EGWsingle* sins_out, EGWsingle* coss_out, const EGWintptr strideB_in, const EGWintptr strideB_sout, const EGWintptr strideB_cout, EGWuint count) {
+    #if (defined(EGW_SIMD_SSE) && defined(__SSE2__)) || defined(EGW_SIMD_NEON)
+    if(!strideB_in && !strideB_sout && !strideB_cout) { // Packed layout, four at a time
+        for(; count >= 4; count -= 4) {
+            #if defined(EGW_SIMD_SSE)
+                const __m128 sgnMask = _mm_castsi128_ps(_mm_set1_epi32((EGWint)0x80000000));
+                __m128 x = _mm_loadu_ps(angles_in), sx, y, z, ps, pc, swap;
+                __m128i j;
+                
+                sx = _mm_and_ps(x, sgnMask); x = _mm_andnot_ps(sgnMask, x);
+                j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(EGW_MATH_SC_4OPI)));
+                j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1)); y = _mm_cvtepi32_ps(j);
+                x = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(EGW_MATH_SC_DP1))), _mm_mul_ps(y, _mm_set1_ps(EGW_MATH_SC_DP2))), _mm_mul_ps(y, _mm_set1_ps(EGW_MATH_SC_DP3)));
+                z = _mm_mul_ps(x, x);
+                ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(EGW_MATH_SC_S0), z), _mm_set1_ps(EGW_MATH_SC_S1)), z), _mm_set1_ps(EGW_MATH_SC_S2)), z), x), x);
+                pc = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(EGW_MATH_SC_C0), z), _mm_set1_ps(EGW_MATH_SC_C1)), z), _mm_set1_ps(EGW_MATH_SC_C2)), z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.0f));
+                swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+                
+                if(sins_out)
+                    _mm_storeu_ps(sins_out, _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, pc), _mm_andnot_ps(swap, ps)),
+                                                       _mm_xor_ps(sx, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)))));
+                if(coss_out)
+                    _mm_storeu_ps(coss_out, _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, ps), _mm_andnot_ps(swap, pc)),
+                                                       _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29))));
+            #else
+                float32x4_t x = vld1q_f32(angles_in), y, z, ps, pc;
+                uint32x4_t sx = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000)), swap;
+                int32x4_t j;
+                
+                x = vabsq_f32(x);
+                j = vcvtq_s32_f32(vmulq_f32(x, vdupq_n_f32(EGW_MATH_SC_4OPI)));
+                j = vandq_s32(vaddq_s32(j, vdupq_n_s32(1)), vdupq_n_s32(~1)); y = vcvtq_f32_s32(j);
+                x = vsubq_f32(vsubq_f32(vsubq_f32(x, vmulq_f32(y, vdupq_n_f32(EGW_MATH_SC_DP1))), vmulq_f32(y, vdupq_n_f32(EGW_MATH_SC_DP2))), vmulq_f32(y, vdupq_n_f32(EGW_MATH_SC_DP3)));
+                z = vmulq_f32(x, x);
+                ps = vaddq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(EGW_MATH_SC_S0), z), vdupq_n_f32(EGW_MATH_SC_S1)), z), vdupq_n_f32(EGW_MATH_SC_S2)), z), x), x);
+                pc = vaddq_f32(vsubq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(EGW_MATH_SC_C0), z), vdupq_n_f32(EGW_MATH_SC_C1)), z), vdupq_n_f32(EGW_MATH_SC_C2)), z), z), vmulq_f32(vdupq_n_f32(0.5f), z)), vdupq_n_f32(1.0f));
+                swap = vtstq_s32(j, vdupq_n_s32(2));
+                
+                if(sins_out)
+                    vst1q_f32(sins_out, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, pc, ps)),
+                                                                         veorq_u32(sx, vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(j, vdupq_n_s32(4))), 29)))));
+                if(coss_out)
+                    vst1q_f32(coss_out, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, ps, pc)),
+                                                                         vshlq_n_u32(vreinterpretq_u32_s32(vbicq_s32(vdupq_n_s32(4), vsubq_s32(j, vdupq_n_s32(2)))), 29))));
+            #endif
+            angles_in += 4; if(sins_out) sins_out += 4; if(coss_out) coss_out += 4;
+        }
+    }
+    #endif
+    
+    while(count--) {
+        egwSinCosLanef(*angles_in, sins_out, coss_out);
+        angles_in = (const EGWsingle*)((EGWintptr)angles_in + (EGWintptr)sizeof(EGWsingle) + strideB_in);
+        if(sins_out) sins_out = (EGWsingle*)((EGWintptr)sins_out + (EGWintptr)sizeof(EGWsingle) + strideB_sout);
+        if(coss_out) coss_out = (EGWsingle*)((EGWintptr)coss_out + (EGWintptr)sizeof(EGWsingle) + strideB_cout);
+    }
+}
+
+void egwInvSqrtfv(const EGWsingle* vals_in, EGWsingle* vals_out, const EGWintptr strideB_in, const EGWintptr strideB_out, EGWuint count) {
+    #if (defined(EGW_SIMD_SSE) && defined(__SSE2__)) || defined(EGW_SIMD_NEON)
+    if(!strideB_in && !strideB_out) { // Packed layout, four at a time
+        for(; count >= 4; count -= 4) {
+            #if defined(EGW_SIMD_SSE)
+                __m128 val = _mm_loadu_ps(vals_in), est = _mm_rsqrt_ps(val);
+                __m128 edge = _mm_or_ps(_mm_cmpeq_ps(est, _mm_setzero_ps()), _mm_cmpeq_ps(val, _mm_setzero_ps())); // 1/sqrt(inf) & 1/sqrt(0) stay as estimated
+                __m128 nr = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), est), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_mul_ps(val, est), est)));
+                _mm_storeu_ps(vals_out, _mm_or_ps(_mm_and_ps(edge, est), _mm_andnot_ps(edge, nr)));
+            #else
+                float32x4_t val = vld1q_f32(vals_in);
+                #if defined(__aarch64__)
+                    vst1q_f32(vals_out, vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(val)));
+                #else
+                    float32x4_t est = vrsqrteq_f32(val);
+                    est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(val, est), est));
+                    est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(val, est), est));
+                    vst1q_f32(vals_out, est);
+                #endif
+            #endif
+            vals_in += 4; vals_out += 4;
+        }
+    }
+    #endif
+    
+    while(count--) {
+        *vals_out = egwInvSqrtf(*vals_in);
+        vals_in = (const EGWsingle*)((EGWintptr)vals_in + (EGWintptr)sizeof(EGWsingle) + strideB_in);
+        vals_out = (EGWsingle*)((EGWintptr)vals_out + (EGWintptr)sizeof(EGWsingle) + strideB_out);
+    }
+}
+
+void egwArcTan2fv(const EGWsingle* vals_nmr, const EGWsingle* vals_dnm, EGWsingle* angles_out, const EGWintptr strideB_nmr, const EGWintptr strideB_dnm, const EGWintptr strideB_out, EGWuint count) {
+    #if (defined(EGW_SIMD_SSE) && defined(__SSE2__)) || defined(EGW_SIMD_NEON)
+    if(!strideB_nmr && !strideB_dnm && !strideB_out) { // Packed layout, four at a time
+        for(; count >= 4; count -= 4) {
+            #if defined(EGW_SIMD_SSE)
+                const __m128 sgnMask = _mm_castsi128_ps(_mm_set1_epi32((EGWint)0x80000000)), zero = _mm_setzero_ps();
+                __m128 vy = _mm_loadu_ps(vals_nmr), vx = _mm_loadu_ps(vals_dnm);
+                __m128 ay = _mm_andnot_ps(sgnMask, vy), ax = _mm_andnot_ps(sgnMask, vx), yBig = _mm_cmpgt_ps(ay, ax);
+                __m128 mx = _mm_or_ps(_mm_and_ps(yBig, ay), _mm_andnot_ps(yBig, ax)), mn = _mm_or_ps(_mm_and_ps(yBig, ax), _mm_andnot_ps(yBig, ay));
+                __m128 big = _mm_cmpgt_ps(mn, _mm_mul_ps(mx, _mm_set1_ps(EGW_MATH_AT_TPIO8)));
+                __m128 nmr = _mm_or_ps(_mm_and_ps(big, _mm_sub_ps(mn, mx)), _mm_andnot_ps(big, mn)), dnm = _mm_or_ps(_mm_and_ps(big, _mm_add_ps(mn, mx)), _mm_andnot_ps(big, mx));
+                __m128 r = _mm_and_ps(_mm_cmpgt_ps(dnm, zero), _mm_div_ps(nmr, dnm)), z = _mm_mul_ps(r, r), a;
+                
+                r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(EGW_MATH_AT_P0), z), _mm_set1_ps(EGW_MATH_AT_P1)), z), _mm_set1_ps(EGW_MATH_AT_P2)), z), _mm_set1_ps(EGW_MATH_AT_P3)), z), r), r),
+                               _mm_and_ps(big, _mm_set1_ps(EGW_MATH_PI_4)));
+                a = _mm_sub_ps(_mm_set1_ps(EGW_MATH_PI_2), r); r = _mm_or_ps(_mm_and_ps(yBig, a), _mm_andnot_ps(yBig, r));
+                a = _mm_cmplt_ps(vx, zero); r = _mm_or_ps(_mm_and_ps(a, _mm_sub_ps(_mm_set1_ps(EGW_MATH_PI), r)), _mm_andnot_ps(a, r));
+                _mm_storeu_ps(angles_out, _mm_xor_ps(r, _mm_and_ps(_mm_cmplt_ps(vy, zero), sgnMask)));
+            #else
+                float32x4_t vy = vld1q_f32(vals_nmr), vx = vld1q_f32(vals_dnm), zero = vdupq_n_f32(0.0f);
+                float32x4_t ay = vabsq_f32(vy), ax = vabsq_f32(vx);
+                uint32x4_t yBig = vcgtq_f32(ay, ax), big, pos;
+                float32x4_t mx = vbslq_f32(yBig, ay, ax), mn = vbslq_f32(yBig, ax, ay), nmr, dnm, r, z;
+                
+                big = vcgtq_f32(mn, vmulq_f32(mx, vdupq_n_f32(EGW_MATH_AT_TPIO8)));
+                nmr = vbslq_f32(big, vsubq_f32(mn, mx), mn); dnm = vbslq_f32(big, vaddq_f32(mn, mx), mx);
+                pos = vcgtq_f32(dnm, zero);
+                r = vbslq_f32(pos, egwMathSIMDDiv4f(nmr, vbslq_f32(pos, dnm, vdupq_n_f32(1.0f))), zero); z = vmulq_f32(r, r);
+                r = vaddq_f32(vaddq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(EGW_MATH_AT_P0), z), vdupq_n_f32(EGW_MATH_AT_P1)), z), vdupq_n_f32(EGW_MATH_AT_P2)), z), vdupq_n_f32(EGW_MATH_AT_P3)), z), r), r),
+                              vbslq_f32(big, vdupq_n_f32(EGW_MATH_PI_4), zero));
+                r = vbslq_f32(yBig, vsubq_f32(vdupq_n_f32(EGW_MATH_PI_2), r), r);
+                r = vbslq_f32(vcltq_f32(vx, zero), vsubq_f32(vdupq_n_f32(EGW_MATH_PI), r), r);
+                vst1q_f32(angles_out, vbslq_f32(vcltq_f32(vy, zero), vnegq_f32(r), r));
+            #endif
+            vals_nmr += 4; vals_dnm += 4; angles_out += 4;
+        }
+    }
+    #endif
+    
+    while(count--) {
+        *angles_out = egwArcTan2Lanef(*vals_nmr, *vals_dnm);
+        vals_nmr = (const EGWsingle*)((EGWintptr)vals_nmr + (EGWintptr)sizeof(EGWsingle) + strideB_nmr);
+        vals_dnm = (const EGWsingle*)((EGWintptr)vals_dnm + (EGWintptr)sizeof(EGWsingle) + strideB_dnm);
+        angles_out = (EGWsingle*)((EGWintptr)angles_out + (EGWintptr)sizeof(EGWsingle) + strideB_out);
+    }
+}
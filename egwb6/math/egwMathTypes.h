@@ -430,4 +430,14 @@ typedef union {
     EGWuint8 bytes[48];                     ///< Byte array.
 } egwQuaternion4t;
 
+
+// !!!: ***** Random Streams *****
+
+/// Random Stream.
+/// Seedable xorshift128 pseudo-random number stream state.
+/// @note Streams are not shared, thus each owner may draw from its own stream without locking.
+typedef struct {
+    EGWuint32 state[4];                     ///< Xorshift state words (never all zero).
+} egwRandomStream;
+
 /// @}
@@ -28,6 +28,11 @@
 #import "egwMath.h"
 #import "egwVector.h"
 #import "egwQuaternion.h"
+#if defined(EGW_SIMD_SSE)
+#import <xmmintrin.h>
+#elif defined(EGW_SIMD_NEON)
+#import <arm_neon.h>
+#endif
 
 
 const egwMatrix33f egwSIMatIdentity33f =  {1.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 1.0f};
@@ -36,6 +41,22 @@ const egwMatrix44f egwSIMatIdentity44f =  {1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f,
 const egwMatrix44f egwSIMatZero44f =      {0.0f, 0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f, 0.0f};
 
 
+#if defined(EGW_SIMD_SSE)
+#define egwMatSIMDSplat(v,i)    _mm_shuffle_ps((v), (v), _MM_SHUFFLE((i),(i),(i),(i)))
+#endif
+
+// NOTE: SIMD kernels keep the scalar summation order (column 1 through column 4) so results match the scalar routines. -jw
+#if defined(EGW_SIMD_SSE)
+static inline __m128 egwMatSIMDColumnCombo4f(__m128 c1, __m128 c2, __m128 c3, __m128 c4, __m128 v) {
+    return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c1, egwMatSIMDSplat(v, 0)), _mm_mul_ps(c2, egwMatSIMDSplat(v, 1))), _mm_mul_ps(c3, egwMatSIMDSplat(v, 2))), _mm_mul_ps(c4, egwMatSIMDSplat(v, 3)));
+}
+#elif defined(EGW_SIMD_NEON)
+static inline float32x4_t egwMatSIMDColumnCombo4f(float32x4_t c1, float32x4_t c2, float32x4_t c3, float32x4_t c4, float32x4_t v) {
+    return vaddq_f32(vaddq_f32(vaddq_f32(vmulq_lane_f32(c1, vget_low_f32(v), 0), vmulq_lane_f32(c2, vget_low_f32(v), 1)), vmulq_lane_f32(c3, vget_high_f32(v), 0)), vmulq_lane_f32(c4, vget_high_f32(v), 1));
+}
+#endif
+
+
 egwMatrix33f* egwMatInit33f(egwMatrix33f* mat_out,
                                    const EGWsingle r1c1, const EGWsingle r1c2, const EGWsingle r1c3,
                                    const EGWsingle r2c1, const EGWsingle r2c2, const EGWsingle r2c3,
@@ -1208,6 +1229,29 @@ void egwMatMultiply33fv(const egwMatrix33f* mats_lhs, const egwMatrix33f* mats_r
 }
 
 void egwMatMultiply44fv(const egwMatrix44f* mats_lhs, const egwMatrix44f* mats_rhs, egwMatrix44f* mats_out, const EGWintptr strideB_lhs, const EGWintptr strideB_rhs, const EGWintptr strideB_out, EGWuint count) {
+    #if defined(EGW_SIMD_SSE) || defined(EGW_SIMD_NEON)
+    while(count--) { // Output column j is lhs columns combined by rhs column j, all loads precede stores (aliasing safe)
+        #if defined(EGW_SIMD_SSE)
+            __m128 l1 = _mm_loadu_ps(&mats_lhs->matrix[0]), l2 = _mm_loadu_ps(&mats_lhs->matrix[4]), l3 = _mm_loadu_ps(&mats_lhs->matrix[8]), l4 = _mm_loadu_ps(&mats_lhs->matrix[12]);
+            __m128 r1 = _mm_loadu_ps(&mats_rhs->matrix[0]), r2 = _mm_loadu_ps(&mats_rhs->matrix[4]), r3 = _mm_loadu_ps(&mats_rhs->matrix[8]), r4 = _mm_loadu_ps(&mats_rhs->matrix[12]);
+            _mm_storeu_ps(&mats_out->matrix[0], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r1));
+            _mm_storeu_ps(&mats_out->matrix[4], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r2));
+            _mm_storeu_ps(&mats_out->matrix[8], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r3));
+            _mm_storeu_ps(&mats_out->matrix[12], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r4));
+        #else
+            float32x4_t l1 = vld1q_f32(&mats_lhs->matrix[0]), l2 = vld1q_f32(&mats_lhs->matrix[4]), l3 = vld1q_f32(&mats_lhs->matrix[8]), l4 = vld1q_f32(&mats_lhs->matrix[12]);
+            float32x4_t r1 = vld1q_f32(&mats_rhs->matrix[0]), r2 = vld1q_f32(&mats_rhs->matrix[4]), r3 = vld1q_f32(&mats_rhs->matrix[8]), r4 = vld1q_f32(&mats_rhs->matrix[12]);
+            vst1q_f32(&mats_out->matrix[0], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r1));
+            vst1q_f32(&mats_out->matrix[4], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r2));
+            vst1q_f32(&mats_out->matrix[8], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r3));
+            vst1q_f32(&mats_out->matrix[12], egwMatSIMDColumnCombo4f(l1, l2, l3, l4, r4));
+        #endif
+        
+        mats_lhs = (const egwMatrix44f*)((EGWintptr)mats_lhs + (EGWintptr)sizeof(egwMatrix44f) + strideB_lhs);
+        mats_rhs = (const egwMatrix44f*)((EGWintptr)mats_rhs + (EGWintptr)sizeof(egwMatrix44f) + strideB_rhs);
+        mats_out = (egwMatrix44f*)((EGWintptr)mats_out + (EGWintptr)sizeof(egwMatrix44f) + strideB_out);
+    }
+    #else
     while(count--) {
         if(mats_lhs == mats_out || mats_rhs == mats_out) {
             egwMatrix44f temp;
@@ -1254,6 +1298,7 @@ void egwMatMultiply44fv(const egwMatrix44f* mats_lhs, const egwMatrix44f* mats_r
         mats_rhs = (const egwMatrix44f*)((EGWintptr)mats_rhs + (EGWintptr)sizeof(egwMatrix44f) + strideB_rhs);
         mats_out = (egwMatrix44f*)((EGWintptr)mats_out + (EGWintptr)sizeof(egwMatrix44f) + strideB_out);
     }
+    #endif
 }
 
 egwMatrix33f* egwMatMultiplyHmg33f(const egwMatrix33f* mat_lhs, const egwMatrix33f* mat_rhs, egwMatrix33f* mat_out) {
@@ -2212,6 +2257,26 @@ void egwVecTransform333fv(const egwMatrix33f* mats_lhs, const egwVector3f* vecs_
 }
 
 void egwVecTransform443fv(const egwMatrix44f* mats_lhs, const egwVector3f* vecs_rhs, const EGWsingle* ws_in, egwVector3f* vecs_out, const EGWintptr strideB_lhs, const EGWintptr strideB_rhs, const EGWintptr strideB_in, const EGWintptr strideB_out, EGWuint count) {
+    #if defined(EGW_SIMD_SSE) || defined(EGW_SIMD_NEON)
+    while(count--) {
+        #if defined(EGW_SIMD_SSE)
+            __m128 res = egwMatSIMDColumnCombo4f(_mm_loadu_ps(&mats_lhs->matrix[0]), _mm_loadu_ps(&mats_lhs->matrix[4]), _mm_loadu_ps(&mats_lhs->matrix[8]), _mm_loadu_ps(&mats_lhs->matrix[12]),
+                                                 _mm_setr_ps(vecs_rhs->axis.x, vecs_rhs->axis.y, vecs_rhs->axis.z, *ws_in));
+            _mm_storel_pi((__m64*)vecs_out, res);
+            _mm_store_ss(&vecs_out->axis.z, _mm_movehl_ps(res, res));
+        #else
+            float32x4_t vec = vcombine_f32(vld1_f32(&vecs_rhs->axis.x), vset_lane_f32(*ws_in, vld1_dup_f32(&vecs_rhs->axis.z), 1));
+            float32x4_t res = egwMatSIMDColumnCombo4f(vld1q_f32(&mats_lhs->matrix[0]), vld1q_f32(&mats_lhs->matrix[4]), vld1q_f32(&mats_lhs->matrix[8]), vld1q_f32(&mats_lhs->matrix[12]), vec);
+            vst1_f32(&vecs_out->axis.x, vget_low_f32(res));
+            vst1q_lane_f32(&vecs_out->axis.z, res, 2);
+        #endif
+        
+        mats_lhs = (const egwMatrix44f*)((EGWintptr)mats_lhs + (EGWintptr)sizeof(egwMatrix44f) + strideB_lhs);
+        vecs_rhs = (const egwVector3f*)((EGWintptr)vecs_rhs + (EGWintptr)sizeof(egwVector3f) + strideB_rhs);
+        ws_in = (const EGWsingle*)((EGWintptr)ws_in + (EGWintptr)sizeof(EGWsingle) + strideB_in);
+        vecs_out = (egwVector3f*)((EGWintptr)vecs_out + (EGWintptr)sizeof(egwVector3f) + strideB_out);
+    }
+    #else
     while(count--) {
         if(vecs_rhs == vecs_out) {
             egwVector3f temp;
@@ -2230,9 +2295,27 @@ void egwVecTransform443fv(const egwMatrix44f* mats_lhs, const egwVector3f* vecs_
         ws_in = (const EGWsingle*)((EGWintptr)ws_in + (EGWintptr)sizeof(EGWsingle) + strideB_in);
         vecs_out = (egwVector3f*)((EGWintptr)vecs_out + (EGWintptr)sizeof(egwVector3f) + strideB_out);
     }
+    #endif
 }
 
 void egwVecTransform444fv(const egwMatrix44f* mats_lhs, const egwVector4f* vecs_rhs, egwVector4f* vecs_out, const EGWintptr strideB_lhs, const EGWintptr strideB_rhs, const EGWintptr strideB_out, EGWuint count) {
+    #if defined(EGW_SIMD_SSE) || defined(EGW_SIMD_NEON)
+    while(count--) { // W passes through untransformed, same as scalar
+        #if defined(EGW_SIMD_SSE)
+            __m128 vec = _mm_loadu_ps(vecs_rhs->vector);
+            __m128 res = egwMatSIMDColumnCombo4f(_mm_loadu_ps(&mats_lhs->matrix[0]), _mm_loadu_ps(&mats_lhs->matrix[4]), _mm_loadu_ps(&mats_lhs->matrix[8]), _mm_loadu_ps(&mats_lhs->matrix[12]), vec);
+            _mm_storeu_ps(vecs_out->vector, _mm_shuffle_ps(res, _mm_shuffle_ps(res, vec, _MM_SHUFFLE(3,3,2,2)), _MM_SHUFFLE(2,0,1,0)));
+        #else
+            float32x4_t vec = vld1q_f32(vecs_rhs->vector);
+            float32x4_t res = egwMatSIMDColumnCombo4f(vld1q_f32(&mats_lhs->matrix[0]), vld1q_f32(&mats_lhs->matrix[4]), vld1q_f32(&mats_lhs->matrix[8]), vld1q_f32(&mats_lhs->matrix[12]), vec);
+            vst1q_f32(vecs_out->vector, vsetq_lane_f32(vgetq_lane_f32(vec, 3), res, 3));
+        #endif
+        
+        mats_lhs = (const egwMatrix44f*)((EGWintptr)mats_lhs + (EGWintptr)sizeof(egwMatrix44f) + strideB_lhs);
+        vecs_rhs = (const egwVector4f*)((EGWintptr)vecs_rhs + (EGWintptr)sizeof(egwVector4f) + strideB_rhs);
+        vecs_out = (egwVector4f*)((EGWintptr)vecs_out + (EGWintptr)sizeof(egwVector4f) + strideB_out);
+    }
+    #else
     while(count--) {
         if(vecs_rhs == vecs_out) {
             egwVector3f temp;
@@ -2251,4 +2334,5 @@ void egwVecTransform444fv(const egwMatrix44f* mats_lhs, const egwVector4f* vecs_
         vecs_rhs = (const egwVector4f*)((EGWintptr)vecs_rhs + (EGWintptr)sizeof(egwVector4f) + strideB_rhs);
         vecs_out = (egwVector4f*)((EGWintptr)vecs_out + (EGWintptr)sizeof(egwVector4f) + strideB_out);
     }
+    #endif
 }
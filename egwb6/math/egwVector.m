@@ -26,6 +26,11 @@
 
 #import "egwVector.h"
 #import "egwMath.h"
+#if defined(EGW_SIMD_SSE)
+#import <xmmintrin.h>
+#elif defined(EGW_SIMD_NEON)
+#import <arm_neon.h>
+#endif
 
 
 const egwVector2f egwSIVecZero2f =        {0.0f, 0.0f};
@@ -54,6 +59,33 @@ const egwVector4f egwSIVecNegUnitZ4f =    {0.0f, 0.0f, -1.0f, 0.0f};
 const egwVector4f egwSIVecNegUnitW4f =    {0.0f, 0.0f, 0.0f, -1.0f};
 
 
+#if defined(EGW_SIMD_SSE)
+// Deinterleaves four packed 3-D vectors [x0 y0 z0 x1][y1 z1 x2 y2][z2 x3 y3 z3] into per-axis registers.
+#define egwVecSIMDDeinterleave3f(a,b,c,x,y,z) { \
+    __m128 xt = _mm_shuffle_ps((b), (c), _MM_SHUFFLE(1,1,2,2)); \
+    __m128 yt0 = _mm_shuffle_ps((a), (b), _MM_SHUFFLE(0,0,1,1)), yt1 = _mm_shuffle_ps((b), (c), _MM_SHUFFLE(2,2,3,3)); \
+    __m128 zt0 = _mm_shuffle_ps((a), (b), _MM_SHUFFLE(1,1,2,2)), zt1 = _mm_shuffle_ps((c), (c), _MM_SHUFFLE(3,3,0,0)); \
+    (x) = _mm_shuffle_ps((a), xt, _MM_SHUFFLE(2,0,3,0)); \
+    (y) = _mm_shuffle_ps(yt0, yt1, _MM_SHUFFLE(2,0,2,0)); \
+    (z) = _mm_shuffle_ps(zt0, zt1, _MM_SHUFFLE(2,0,2,0)); }
+#define egwVecSIMDLoadSoA3f(vecs,x,y,z) { \
+    __m128 la = _mm_loadu_ps((const float*)(vecs) + 0), lb = _mm_loadu_ps((const float*)(vecs) + 4), lc = _mm_loadu_ps((const float*)(vecs) + 8); \
+    egwVecSIMDDeinterleave3f(la, lb, lc, x, y, z); }
+#elif defined(EGW_SIMD_NEON)
+static inline float32x4_t egwVecSIMDInvSqrt4f(float32x4_t val) {
+    #if defined(__aarch64__)
+        return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(val));
+    #else
+        // NOTE: ARMv7 NEON has no vector sqrt/divide, estimate refined by two Newton-Raphson steps is within a couple ulp of 1/sqrtf(). -jw
+        float32x4_t est = vrsqrteq_f32(val);
+        est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(val, est), est));
+        est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(val, est), est));
+        return est;
+    #endif
+}
+#endif
+
+
 egwVector2f* egwVecInit2f(egwVector2f* vec_out, const EGWsingle x, const EGWsingle y) {
     vec_out->axis.x = x;
     vec_out->axis.y = y;
@@ -200,6 +232,23 @@ void egwVecDotProd2fv(const egwVector2f* vecs_lhs, const egwVector2f* vecs_rhs,
 }
 
 void egwVecDotProd3fv(const egwVector3f* vecs_lhs, const egwVector3f* vecs_rhs, EGWsingle* dtps_out, const EGWintptr strideB_lhs, const EGWintptr strideB_rhs, const EGWintptr strideB_out, EGWuint count) {
+    #if defined(EGW_SIMD_SSE) || defined(EGW_SIMD_NEON)
+    if(!strideB_lhs && !strideB_rhs && !strideB_out) { // Packed layout, four at a time
+        for(; count >= 4; count -= 4) {
+            #if defined(EGW_SIMD_SSE)
+                __m128 lx, ly, lz, rx, ry, rz;
+                egwVecSIMDLoadSoA3f(vecs_lhs, lx, ly, lz);
+                egwVecSIMDLoadSoA3f(vecs_rhs, rx, ry, rz);
+                _mm_storeu_ps(dtps_out, _mm_add_ps(_mm_add_ps(_mm_mul_ps(lx, rx), _mm_mul_ps(ly, ry)), _mm_mul_ps(lz, rz)));
+            #else
+                float32x4x3_t lhs = vld3q_f32((const float32_t*)vecs_lhs), rhs = vld3q_f32((const float32_t*)vecs_rhs);
+                vst1q_f32(dtps_out, vaddq_f32(vaddq_f32(vmulq_f32(lhs.val[0], rhs.val[0]), vmulq_f32(lhs.val[1], rhs.val[1])), vmulq_f32(lhs.val[2], rhs.val[2])));
+            #endif
+            vecs_lhs += 4; vecs_rhs += 4; dtps_out += 4;
+        }
+    }
+    #endif
+    
     while(count--) {
         *dtps_out = (vecs_lhs->axis.x * vecs_rhs->axis.x) + (vecs_lhs->axis.y * vecs_rhs->axis.y) + (vecs_lhs->axis.z * vecs_rhs->axis.z);
         vecs_lhs = (const egwVector3f*)((EGWintptr)vecs_lhs + (EGWintptr)sizeof(egwVector3f) + strideB_lhs);
@@ -446,6 +495,30 @@ void egwVecNormalize2fv(const egwVector2f* vecs_in, egwVector2f* vecs_out, const
 
 void egwVecNormalize3fv(const egwVector3f* vecs_in, egwVector3f* vecs_out, const EGWintptr strideB_in, const EGWintptr strideB_out, EGWuint count) {
     EGWsingle factor;
+    
+    #if defined(EGW_SIMD_SSE) || defined(EGW_SIMD_NEON)
+    if(!strideB_in && !strideB_out) { // Packed layout, four at a time
+        for(; count >= 4; count -= 4) {
+            #if defined(EGW_SIMD_SSE)
+                __m128 a = _mm_loadu_ps((const float*)vecs_in + 0), b = _mm_loadu_ps((const float*)vecs_in + 4), c = _mm_loadu_ps((const float*)vecs_in + 8);
+                __m128 x, y, z, f;
+                egwVecSIMDDeinterleave3f(a, b, c, x, y, z);
+                f = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z))));
+                // Scale interleaved data directly by spreading factors to match [x0 y0 z0 x1][y1 z1 x2 y2][z2 x3 y3 z3]
+                _mm_storeu_ps((float*)vecs_out + 0, _mm_mul_ps(a, _mm_shuffle_ps(f, f, _MM_SHUFFLE(1,0,0,0))));
+                _mm_storeu_ps((float*)vecs_out + 4, _mm_mul_ps(b, _mm_shuffle_ps(f, f, _MM_SHUFFLE(2,2,1,1))));
+                _mm_storeu_ps((float*)vecs_out + 8, _mm_mul_ps(c, _mm_shuffle_ps(f, f, _MM_SHUFFLE(3,3,3,2))));
+            #else
+                float32x4x3_t v = vld3q_f32((const float32_t*)vecs_in);
+                float32x4_t f = egwVecSIMDInvSqrt4f(vaddq_f32(vaddq_f32(vmulq_f32(v.val[0], v.val[0]), vmulq_f32(v.val[1], v.val[1])), vmulq_f32(v.val[2], v.val[2])));
+                v.val[0] = vmulq_f32(v.val[0], f); v.val[1] = vmulq_f32(v.val[1], f); v.val[2] = vmulq_f32(v.val[2], f);
+                vst3q_f32((float32_t*)vecs_out, v);
+            #endif
+            vecs_in += 4; vecs_out += 4;
+        }
+    }
+    #endif
+    
     while(count--) {
         factor = egwInvSqrtf((vecs_in->axis.x * vecs_in->axis.x) + (vecs_in->axis.y * vecs_in->axis.y) + (vecs_in->axis.z * vecs_in->axis.z));
         vecs_out->axis.x = vecs_in->axis.x * factor;
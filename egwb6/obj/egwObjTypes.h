@@ -40,6 +40,7 @@
 @class egwSwitchBranch;
 @class egwTransformBranch;
 @class egwDLODBranch;
+@class egwSpatialIndex;
 
 
 // !!!: ***** Defines *****
@@ -88,4 +89,24 @@ typedef struct {
     egwValidater* sync;                     ///< Validation sync (retained).
 } egwCoreComponents;
 
+/// Flattened Transform Node.
+/// Describes a node entry of a flattened transform hierarchy.
+typedef struct {
+    id<NSObject> node;                      ///< Node object (weak).
+    EGWint pIndex;                          ///< Parent entry index (-1 for flattening root).
+    EGWuint16 depth;                        ///< Depth from flattening root.
+    EGWuint16 fFlags;                       ///< Flattened node flags.
+} egwFlatTransformNode;
+
+/// Flattened Transform Hierarchy.
+/// Provides a parent-index ordered (breadth first) transform hierarchy stored in parallel arrays for use with batched matrix routines.
+typedef struct {
+    EGWuint fCount;                         ///< Entry count (0 if needs rebuilt).
+    EGWuint fMax;                           ///< Entry capacity.
+    egwFlatTransformNode* nodes;            ///< Node entries (owned).
+    egwMatrix44f* wcsTrans;                 ///< Orientation transforms (LCS->WCS) per entry (owned).
+    egwMatrix44f* lcsTrans;                 ///< Offset transforms (MMCS->LCS) per entry, branch entries only (owned).
+    egwMatrix44f* twcsTrans;                ///< Combined transforms passed to children per entry, branch entries only (owned).
+} egwFlatTransforms;
+
 /// @}
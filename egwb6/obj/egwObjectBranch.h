@@ -61,6 +61,8 @@
     egwCoreComponents* _animateObj;         ///< Animate core object merged component set.
     egwCoreComponents* _cameraObj;          ///< Camera core object merged component set.
     egwCoreComponents* _lightObj;           ///< Light core objects merged component set.
+    
+    egwSpatialIndex* _sIndex;               ///< Spatial index of descendant leaves (retained).
 }
 
 /// Designated Initializer.
@@ -72,6 +74,19 @@
 /// @return Self upon success, otherwise nil.
 - (id)initWithIdentity:(NSString*)assetIdent parentNode:(id<egwPObjectBranch>)parent childNodes:(NSArray*)nodes defaultBounding:(Class)bndClass;
 
+
+/// Spatial Index Accessor.
+/// Returns the spatial index descendant leaves are registered into.
+/// @return Spatial index, otherwise nil if none.
+- (egwSpatialIndex*)spatialIndex;
+
+
+/// Spatial Index Mutator.
+/// Sets the spatial index descendant leaves register their bounding volumes into, propagating to descendant branches.
+/// @note Leaves are indexed by their rendering, interaction, playback, viewing, or illumination bounding (in that order of preference, by core object type) and kept up to date as bounding volumes are merged.
+/// @param [in] index Spatial index (retained). May be nil (for none).
+- (void)setSpatialIndex:(egwSpatialIndex*)index;
+
 @end
 
 /// @}
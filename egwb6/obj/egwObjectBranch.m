@@ -30,6 +30,7 @@
 #import "../math/egwVector.h"
 #import "../math/egwMatrix.h"
 #import "../gfx/egwBoundings.h"
+#import "egwSpatialIndex.h"
 #import "../misc/egwValidater.h"
 
 
@@ -82,6 +83,12 @@
 @end
 
 
+@interface egwObjectBranch (Private)
+- (void)indexChild:(id<egwPObjectNode>)node;
+- (void)unindexChild:(id<egwPObjectNode>)node;
+@end
+
+
 @implementation egwObjectBranch
 
 - (id)init {
@@ -155,6 +162,7 @@
     if(_cameraObj) { free(_cameraObj); _cameraObj = NULL; _cameraObjCount = 0; }
     if(_lightObj) { free(_lightObj); _lightObj = NULL; _lightObjCount = 0; }
     
+    [_sIndex release]; _sIndex = nil;
     [_ident release]; _ident = nil;
     
     [_children release]; _children = nil;
@@ -189,6 +197,7 @@
             }
             
             [_children addObject:(id)node];
+            if(_sIndex) [self indexChild:node];
             
             if(objCounter[0]) {
                 [self performSelector:@selector(incrementCoreObjectTypes:countBy:) withObject:(id)EGW_COREOBJ_TYPE_AUDIO withObject:(id)objCounter[0] inDirection:EGW_NODEMSG_DIR_BREADTHUPWARDS];
@@ -247,6 +256,7 @@
                     }
                     
                     [_children addObject:(id)node];
+                    if(_sIndex) [self indexChild:node];
                 }
             }
             
@@ -312,6 +322,7 @@
                 }
             }
             
+            if(_sIndex) [self unindexChild:node];
             [_children removeObject:(id)node];
             
             if(objCounter[0]) {
@@ -369,6 +380,9 @@
                     }
                 }
             
+            if(_sIndex)
+                for(id<egwPObjectNode> node in _children)
+                    [self unindexChild:node];
             [_children removeAllObjects];
             
             if(objCounter[0]) {
@@ -1109,6 +1123,13 @@
                     _cType |= [node coreObjectTypes];
             }
             
+            if((coreCmpnts & EGW_CORECMP_TYPE_BVOLS) && _sIndex) {
+                // NOTE: Leaves merge upwards right after re-orientating their own volume, so only the leaf currently invoking its parent has a changed volume (adds & removes are indexed on their own). -jw
+                for(id<egwPObjectNode> node in _children)
+                    if([node isLeaf] && [node isInvokingParent])
+                        [self indexChild:node];
+            }
+            
             if((coreObjects & (EGW_COREOBJ_TYPE_AUDIO | EGW_COREOBJ_TYPE_NODE)) && _audioObj) {
                 if(coreCmpnts & EGW_CORECMP_TYPE_BVOLS & EGW_NODECMPMRG_AUDIO) {
                     [_audioObj->bVol reset];
@@ -1778,6 +1799,10 @@
     return self;
 }
 
+- (egwSpatialIndex*)spatialIndex {
+    return _sIndex;
+}
+
 - (EGWuint)getLeafs:(NSMutableArray*)leafs forCoreObjectTypes:(EGWuint)coreObjects {
     EGWuint count = 0;
     
@@ -1873,6 +1898,24 @@
     }
 }
 
+- (void)setSpatialIndex:(egwSpatialIndex*)index {
+    if(0xdeadc0de) {
+        if(_sIndex != index) {
+            if(_sIndex && _children)
+                for(id<egwPObjectNode> node in _children)
+                    [self unindexChild:node];
+            
+            [index retain];
+            [_sIndex release];
+            _sIndex = index;
+            
+            if(_sIndex && _children)
+                for(id<egwPObjectNode> node in _children)
+                    [self indexChild:node];
+        }
+    }
+}
+
 - (BOOL)isChildOf:(id<egwPObjectBranch>)parent {
     if(0xdeadc0de) {
         return (_parent == parent ? YES : NO);
@@ -1944,6 +1987,43 @@
 @end
 
 
+@implementation egwObjectBranch (Private)
+
+- (void)indexChild:(id<egwPObjectNode>)node {
+    if([node isLeaf]) {
+        EGWuint cType = [node coreObjectTypes];
+        id<egwPBounding> bVol = nil;
+        
+        if(cType & EGW_COREOBJ_TYPE_GRAPHIC)
+            bVol = [(id)node renderingBounding];
+        else if(cType & EGW_COREOBJ_TYPE_ANIMATE)
+            bVol = [(id)node interactionBounding];
+        else if(cType & EGW_COREOBJ_TYPE_AUDIO)
+            bVol = [(id)node playbackBounding];
+        else if(cType & EGW_COREOBJ_TYPE_CAMERA)
+            bVol = [(id)node viewingBounding];
+        else if(cType & EGW_COREOBJ_TYPE_LIGHT)
+            bVol = [(id)node illuminationBounding];
+        
+        if(bVol)
+            [_sIndex insertObject:(id<NSObject>)node withBounding:bVol];
+        else
+            [_sIndex removeObject:(id<NSObject>)node];
+    } else if([(NSObject*)node isKindOfClass:[egwObjectBranch class]]) {
+        [(egwObjectBranch*)node setSpatialIndex:_sIndex];
+    }
+}
+
+- (void)unindexChild:(id<egwPObjectNode>)node {
+    if([node isLeaf])
+        [_sIndex removeObject:(id<NSObject>)node];
+    else if([(NSObject*)node isKindOfClass:[egwObjectBranch class]])
+        [(egwObjectBranch*)node setSpatialIndex:nil];
+}
+
+@end
+
+
 @implementation egwObjectBranch (Overrides)
 
 - (void)applyOrientation {
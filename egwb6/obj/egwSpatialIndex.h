@@ -0,0 +1,187 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @defgroup geWizES_obj_spatialindex egwSpatialIndex
+/// @ingroup geWizES_obj
+/// Spatial Index.
+/// @{
+
+/// @file egwSpatialIndex.h
+/// Spatial Index Interface.
+
+#import <pthread.h>
+#import "egwObjTypes.h"
+#import "../inf/egwPBounding.h"
+#import "../inf/egwPHook.h"
+#import "../data/egwDataTypes.h"
+#import "../geo/egwGeoTypes.h"
+#import "../math/egwMathTypes.h"
+
+
+#define EGW_SPTLINDX_DFLTMAXDEPTH   6   ///< Default maximum cell subdivision depth.
+#define EGW_SPTLINDX_MAXDEPTH       12  ///< Maximum allowed cell subdivision depth.
+#define EGW_SPTLINDX_INITNODES      64  ///< Initial cell node capacity (grows as needed).
+#define EGW_SPTLINDX_INITENTRIES    64  ///< Initial entry slot capacity (grows as needed).
+
+
+/// Spatial Index Cell Node Structure.
+/// @note Loose cells accept entries whose enclosing sphere center lies inside the tight cell and whose radius does not exceed the tight half extent, thus the loose bounds are twice the tight bounds.
+typedef struct {
+    egwVector4f center;                     ///< Cell center position.
+    EGWsingle hExtent;                      ///< Tight cell half extent.
+    EGWint parent;                          ///< Parent cell index (-1 for root).
+    EGWint children[8];                     ///< Child cell indicies by octant (-1 for none).
+    EGWint eHead;                           ///< First entry slot index in cell (-1 for none, next free cell index if cell freed).
+    EGWuint sCount;                         ///< Entries count in cell and all sub-cells.
+    EGWuint8 depth;                         ///< Cell subdivision depth (0 for root).
+} egwSpatialNode;
+
+/// Spatial Index Entry Structure.
+/// @note Entries are stored at a stable slot for the lifetime of their registration, free slots are chained through eNext.
+typedef struct {
+    id<NSObject> object;                    ///< Indexed object (weak).
+    id<egwPBounding> bVol;                  ///< Indexed bounding volume (retained).
+    egwSphere4f bSphere;                    ///< Enclosing sphere of bounding volume at last update (negative radius for unbounded catch-all volumes).
+    EGWint node;                            ///< Containing cell index (-1 if slot free).
+    EGWint ePrev;                           ///< Previous entry slot index in cell (-1 for none).
+    EGWint eNext;                           ///< Next entry slot index in cell (-1 for none).
+} egwSpatialEntry;
+
+/// Spatial Index Lookup Structure.
+typedef struct {
+    id<NSObject> object;                    ///< Indexed object (weak).
+    EGWint eIndex;                          ///< Entry slot index.
+} egwSpatialLookup;
+
+/// Spatial Index Ray Hit Structure.
+typedef struct {
+    id<NSObject> object;                    ///< Hit object (weak).
+    EGWsingle s;                            ///< Nearest hit unit along ray.
+} egwSpatialRayHit;
+
+
+/// Spatial Index.
+/// Dynamic loose octree of object bounding volumes providing sublinear frustum, ray, and sphere queries.
+/// @note Placement is by each volume's enclosing sphere, thus frustum and sphere queries are conservative (may return objects that only nearly collide), ray queries are exact.
+/// @note Unbounded volumes (infinite, frustum) are kept at the root and returned by every frustum and sphere query, zero volumes are never indexed.
+/// @note Sub-cells are unlinked from their parent once emptied of all entries and kept on a free list for reuse.
+@interface egwSpatialIndex : NSObject {
+    pthread_mutex_t _iLock;                 ///< Index mutex lock.
+    EGWuint8 _maxDepth;                     ///< Maximum cell subdivision depth.
+    
+    egwSpatialNode* _nodes;                 ///< Cell nodes pool (owned, root at index 0).
+    EGWuint _nCount;                        ///< Cell nodes used count.
+    EGWuint _nMax;                          ///< Cell nodes pool capacity.
+    EGWint _nFree;                          ///< First free cell node index (-1 for none).
+    
+    egwSpatialEntry* _entries;              ///< Entry slots pool (owned).
+    EGWuint _eCount;                        ///< Entry slots high-water count.
+    EGWuint _eMax;                          ///< Entry slots pool capacity.
+    EGWint _eFree;                          ///< First free entry slot index (-1 for none).
+    
+    egwHashTable _lookup;                   ///< Object to entry slot lookup (egwSpatialLookup).
+    
+    egwSpatialRayHit* _hits;                ///< Ray query hits scratch buffer (owned).
+    EGWuint _hMax;                          ///< Ray query hits scratch capacity.
+}
+
+/// Designated Initializer.
+/// Initializes the spatial index with provided settings.
+/// @note Objects lying outside of the world extents are still indexed, but only at the root cell.
+/// @param [in] wCenter World center position.
+/// @param [in] wExtent World half extent (from center to each side).
+/// @param [in] depth Maximum cell subdivision depth (clamped to EGW_SPTLINDX_MAXDEPTH).
+/// @return Self upon success, otherwise nil.
+- (id)initWithWorldCenter:(const egwVector3f*)wCenter worldExtent:(EGWsingle)wExtent maxDepth:(EGWuint)depth;
+
+
+/// Insert Object Method.
+/// Indexes the provided object by its bounding volume.
+/// @note If the object is already indexed its bounding volume is replaced and its placement updated.
+/// @param [in] object Object to index (weak).
+/// @param [in] bVol Bounding volume of object (retained), volume contents are re-read upon updating.
+/// @return YES if object is indexed, otherwise NO (e.g. zero bounding volume, after which the object is no longer indexed).
+- (BOOL)insertObject:(id<NSObject>)object withBounding:(id<egwPBounding>)bVol;
+
+/// Update Object Method.
+/// Re-reads the indexed bounding volume of the provided object and relocates it if need be.
+/// @param [in] object Indexed object.
+/// @return YES if object is indexed, otherwise NO.
+- (BOOL)updateObject:(id<NSObject>)object;
+
+/// Remove Object Method.
+/// Removes the provided object from the index.
+/// @param [in] object Indexed object.
+- (void)removeObject:(id<NSObject>)object;
+
+/// Remove All Objects Method.
+/// Removes all objects from the index and reclaims all sub-cells.
+- (void)removeAllObjects;
+
+/// Query Frustum Method.
+/// Appends all indexed objects colliding with the provided frustum into the provided results array.
+/// @param [in] frustum Frustum to query against.
+/// @param [in,out] results Results array (of element size sizeof(id), contents weak).
+/// @return Number of objects appended.
+- (EGWuint)queryObjectsCollidingWithFrustum:(const egwFrustum4f*)frustum intoArray:(egwArray*)results;
+
+/// Query Ray Method.
+/// Appends all indexed objects colliding with the provided ray into the provided results array, ordered nearest first.
+/// @param [in] ray Ray to query against (only hits at or after ray start unit are considered).
+/// @param [in,out] results Results array (of element size sizeof(id), contents weak).
+/// @return Number of objects appended.
+- (EGWuint)queryObjectsCollidingWithRay:(const egwRay4f*)ray intoArray:(egwArray*)results;
+
+/// Query Sphere Method.
+/// Appends all indexed objects colliding with the provided sphere into the provided results array.
+/// @param [in] sphere Sphere to query against.
+/// @param [in,out] results Results array (of element size sizeof(id), contents weak).
+/// @return Number of objects appended.
+- (EGWuint)queryObjectsCollidingWithSphere:(const egwSphere4f*)sphere intoArray:(egwArray*)results;
+
+
+/// Contains Object Accessor.
+/// Returns boolean indicating whether the provided object is indexed.
+/// @param [in] object Object to check.
+/// @return YES if object is indexed, otherwise NO.
+- (BOOL)containsObject:(id<NSObject>)object;
+
+/// Max Depth Accessor.
+/// Returns the maximum cell subdivision depth.
+/// @return Maximum subdivision depth.
+- (EGWuint)maxDepth;
+
+/// Object Count Accessor.
+/// Returns the number of indexed objects.
+/// @return Indexed objects count.
+- (EGWuint)objectCount;
+
+
+/// Try Hooking Method.
+/// Attempts to hook the nearest indexed hookable object colliding with the provided picking ray.
+/// @param [in] ray Picking ray (WCS).
+/// @return Hooked object upon success, otherwise nil.
+- (id<egwPHook>)tryHookingWithPickingRay:(egwRay4f*)ray;
+
+@end
+
+/// @}
@@ -0,0 +1,607 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file egwSpatialIndex.m
+/// @ingroup geWizES_obj_spatialindex
+/// Spatial Index Implementation.
+
+#import "egwSpatialIndex.h"
+#import "../math/egwMath.h"
+#import "../math/egwVector.h"
+#import "../geo/egwGeometry.h"
+#import "../data/egwArray.h"
+#import "../data/egwHashTable.h"
+#import "../gfx/egwBoundings.h"
+
+
+EGWint egwSpIdxLookupCompare(egwSpatialLookup* lookup1, egwSpatialLookup* lookup2, size_t size) {
+    return ((EGWuintptr)lookup1->object == (EGWuintptr)lookup2->object ? 0 : 1);
+}
+
+EGWuint32 egwSpIdxLookupHash(egwSpatialLookup* lookup, size_t size) {
+    return egwHashTableHashBytes((const EGWbyte*)&lookup->object, sizeof(id<NSObject>));
+}
+
+// Fills in the enclosing sphere of a bounding volume, returns 0 for volumes that should not be indexed.
+static EGWint egwSpIdxEnclosingSphere(id<egwPBounding> bVol, egwSphere4f* sphere_out) {
+    if([(NSObject*)bVol isMemberOfClass:[egwBoundingSphere class]]) {
+        memcpy((void*)sphere_out, (const void*)[(egwBoundingSphere*)bVol boundingObject], sizeof(egwSphere4f));
+    } else if([(NSObject*)bVol isMemberOfClass:[egwBoundingBox class]]) {
+        const egwBox4f* box = [(egwBoundingBox*)bVol boundingObject];
+        sphere_out->origin.axis.x = (box->min.axis.x + box->max.axis.x) * 0.5f;
+        sphere_out->origin.axis.y = (box->min.axis.y + box->max.axis.y) * 0.5f;
+        sphere_out->origin.axis.z = (box->min.axis.z + box->max.axis.z) * 0.5f;
+        sphere_out->origin.axis.w = 1.0f;
+        sphere_out->radius = egwSqrtf(egwVecDistanceSqrd3f((egwVector3f*)&(sphere_out->origin), (egwVector3f*)&(box->max)));
+    } else if([(NSObject*)bVol isMemberOfClass:[egwBoundingCylinder class]]) {
+        const egwCylinder4f* cylinder = [(egwBoundingCylinder*)bVol boundingObject];
+        memcpy((void*)&(sphere_out->origin), (const void*)&(cylinder->origin), sizeof(egwVector4f));
+        sphere_out->radius = egwSqrtf(egwSqrd(cylinder->radius) + egwSqrd(cylinder->hHeight));
+    } else if([(NSObject*)bVol isMemberOfClass:[egwZeroBounding class]]) {
+        return 0;
+    } else {
+        memcpy((void*)&(sphere_out->origin), (const void*)[bVol boundingOrigin], sizeof(egwVector4f));
+        sphere_out->radius = -1.0f;
+    }
+    
+    return 1;
+}
+
+// Fills in the loose bounds box of a cell.
+static void egwSpIdxLooseBox(const egwSpatialNode* node, egwBox4f* box_out) {
+    EGWsingle lExtent = node->hExtent * 2.0f;
+    memcpy((void*)&(box_out->origin), (const void*)&(node->center), sizeof(egwVector4f));
+    box_out->min.axis.x = node->center.axis.x - lExtent; box_out->max.axis.x = node->center.axis.x + lExtent;
+    box_out->min.axis.y = node->center.axis.y - lExtent; box_out->max.axis.y = node->center.axis.y + lExtent;
+    box_out->min.axis.z = node->center.axis.z - lExtent; box_out->max.axis.z = node->center.axis.z + lExtent;
+    box_out->min.axis.w = box_out->max.axis.w = 1.0f;
+}
+
+static EGWuint egwSpIdxQueryFrustum(const egwSpatialNode* nodes, const egwSpatialEntry* entries, EGWint nIndex, const egwFrustum4f* frustum, BOOL contained, egwArray* results) {
+    const egwSpatialNode* node = &nodes[nIndex];
+    EGWuint count = 0;
+    EGWint eIndex, octant;
+    
+    if(!node->sCount) return 0;
+    
+    // Root cell also holds out of world and unbounded entries, so its bounds are never tested
+    if(!contained && nIndex) {
+        egwBox4f lBox; egwSpIdxLooseBox(node, &lBox);
+        EGWint test = egwTestCollisionBoxFrustumf(&lBox, frustum);
+        
+        if(test == EGW_CLSNTEST_BVOL_NONE)
+            return 0;
+        else if(test == EGW_CLSNTEST_BVOL_CONTAINEDBY || test == EGW_CLSNTEST_BVOL_EQUALS)
+            contained = YES;
+    }
+    
+    for(eIndex = node->eHead; eIndex != -1; eIndex = entries[eIndex].eNext) {
+        if(contained || entries[eIndex].bSphere.radius < 0.0f || egwIsCollidingSphereFrustumf(&(entries[eIndex].bSphere), frustum)) {
+            if(!egwArrayAddTail(results, (const EGWbyte*)&entries[eIndex].object))
+                return count;
+            ++count;
+        }
+    }
+    
+    for(octant = 0; octant < 8; ++octant)
+        if(node->children[octant] != -1)
+            count += egwSpIdxQueryFrustum(nodes, entries, node->children[octant], frustum, contained, results);
+    
+    return count;
+}
+
+static EGWuint egwSpIdxQuerySphere(const egwSpatialNode* nodes, const egwSpatialEntry* entries, EGWint nIndex, const egwSphere4f* sphere, egwArray* results) {
+    const egwSpatialNode* node = &nodes[nIndex];
+    EGWuint count = 0;
+    EGWint eIndex, octant;
+    
+    if(!node->sCount) return 0;
+    
+    if(nIndex) {
+        egwBox4f lBox; egwSpIdxLooseBox(node, &lBox);
+        
+        if(!egwIsCollidingSphereBoxf(sphere, &lBox))
+            return 0;
+    }
+    
+    for(eIndex = node->eHead; eIndex != -1; eIndex = entries[eIndex].eNext) {
+        if(entries[eIndex].bSphere.radius < 0.0f || egwIsCollidingSphereSpheref(&(entries[eIndex].bSphere), sphere)) {
+            if(!egwArrayAddTail(results, (const EGWbyte*)&entries[eIndex].object))
+                return count;
+            ++count;
+        }
+    }
+    
+    for(octant = 0; octant < 8; ++octant)
+        if(node->children[octant] != -1)
+            count += egwSpIdxQuerySphere(nodes, entries, node->children[octant], sphere, results);
+    
+    return count;
+}
+
+
+@interface egwSpatialIndex (Private)
+- (BOOL)growHits;
+- (EGWint)allocNodeWithParent:(EGWint)pIndex atOctant:(EGWint)octant;
+- (EGWint)placeSphere:(const egwSphere4f*)sphere;
+- (void)linkEntry:(EGWint)eIndex intoNode:(EGWint)nIndex;
+- (void)unlinkEntry:(EGWint)eIndex;
+- (void)pruneNode:(EGWint)nIndex;
+- (void)freeEntry:(EGWint)eIndex;
+- (EGWint)lookupEntry:(id<NSObject>)object;
+- (void)queryRay:(const egwRay4f*)ray atNode:(EGWint)nIndex hitCount:(EGWuint*)hCount;
+@end
+
+
+@implementation egwSpatialIndex
+
+- (id)init {
+    [self release]; return (self = nil);
+}
+
+- (id)initWithWorldCenter:(const egwVector3f*)wCenter worldExtent:(EGWsingle)wExtent maxDepth:(EGWuint)depth {
+    egwDataFuncs callbacks;
+    EGWint octant;
+    
+    if(!(self = [super init])) { [self release]; return (self = nil); }
+    
+    if(pthread_mutex_init(&_iLock, NULL)) { [self release]; return (self = nil); }
+    
+    _maxDepth = (EGWuint8)(depth <= EGW_SPTLINDX_MAXDEPTH ? depth : EGW_SPTLINDX_MAXDEPTH);
+    _nFree = _eFree = -1;
+    
+    memset((void*)&callbacks, 0, sizeof(egwDataFuncs));
+    callbacks.fpCompare = (EGWcomparefp)&egwSpIdxLookupCompare;
+    callbacks.fpHash = (EGWhashfp)&egwSpIdxLookupHash;
+    if(!(egwHashTableInit(&_lookup, &callbacks, sizeof(egwSpatialLookup), EGW_SPTLINDX_INITENTRIES, EGW_HASH_FLG_DFLT))) { [self release]; return (self = nil); }
+    
+    _nMax = EGW_SPTLINDX_INITNODES;
+    if(!(_nodes = (egwSpatialNode*)malloc((size_t)_nMax * sizeof(egwSpatialNode)))) { [self release]; return (self = nil); }
+    _eMax = EGW_SPTLINDX_INITENTRIES;
+    if(!(_entries = (egwSpatialEntry*)malloc((size_t)_eMax * sizeof(egwSpatialEntry)))) { [self release]; return (self = nil); }
+    
+    _nCount = 1;
+    egwVecCopy3f(wCenter, (egwVector3f*)&(_nodes[0].center)); _nodes[0].center.axis.w = 1.0f;
+    _nodes[0].hExtent = egwAbsf(wExtent);
+    _nodes[0].parent = -1;
+    for(octant = 0; octant < 8; ++octant) _nodes[0].children[octant] = -1;
+    _nodes[0].eHead = -1;
+    _nodes[0].sCount = 0;
+    _nodes[0].depth = 0;
+    
+    return self;
+}
+
+- (void)dealloc {
+    if(_entries) {
+        EGWuint eIndex;
+        for(eIndex = 0; eIndex < _eCount; ++eIndex)
+            if(_entries[eIndex].node != -1) {
+                [_entries[eIndex].bVol release]; _entries[eIndex].bVol = nil;
+            }
+        free((void*)_entries); _entries = NULL;
+    }
+    if(_nodes) { free((void*)_nodes); _nodes = NULL; }
+    if(_hits) { free((void*)_hits); _hits = NULL; }
+    
+    egwHashTableFree(&_lookup);
+    pthread_mutex_destroy(&_iLock);
+    
+    [super dealloc];
+}
+
+- (BOOL)insertObject:(id<NSObject>)object withBounding:(id<egwPBounding>)bVol {
+    egwSphere4f bSphere;
+    EGWint eIndex;
+    
+    if(!object || !bVol) return NO;
+    
+    pthread_mutex_lock(&_iLock);
+    
+    eIndex = [self lookupEntry:object];
+    
+    if(!egwSpIdxEnclosingSphere(bVol, &bSphere)) {
+        if(eIndex != -1) [self freeEntry:eIndex];
+        
+        pthread_mutex_unlock(&_iLock);
+        return NO;
+    }
+    
+    if(eIndex == -1) {
+        egwSpatialLookup lookup;
+        
+        if(_eFree != -1) {
+            eIndex = _eFree; _eFree = _entries[eIndex].eNext;
+        } else {
+            if(_eCount >= _eMax) {
+                egwSpatialEntry* entries = (egwSpatialEntry*)realloc((void*)_entries, (size_t)(_eMax << 1) * sizeof(egwSpatialEntry));
+                if(!entries) { pthread_mutex_unlock(&_iLock); return NO; }
+                _entries = entries; _eMax <<= 1;
+            }
+            eIndex = (EGWint)_eCount++;
+        }
+        
+        lookup.object = object; lookup.eIndex = eIndex;
+        if(!egwHashTableAdd(&_lookup, (const EGWbyte*)&lookup)) {
+            _entries[eIndex].node = -1;
+            _entries[eIndex].eNext = _eFree; _eFree = eIndex;
+            pthread_mutex_unlock(&_iLock);
+            return NO;
+        }
+        
+        _entries[eIndex].object = object;
+        _entries[eIndex].bVol = [bVol retain];
+        _entries[eIndex].node = -1;
+        _entries[eIndex].ePrev = _entries[eIndex].eNext = -1;
+    } else if(_entries[eIndex].bVol != bVol) {
+        [bVol retain];
+        [_entries[eIndex].bVol release];
+        _entries[eIndex].bVol = bVol;
+    }
+    
+    memcpy((void*)&(_entries[eIndex].bSphere), (const void*)&bSphere, sizeof(egwSphere4f));
+    
+    {   EGWint nIndex = [self placeSphere:&bSphere];
+        EGWint oIndex = _entries[eIndex].node;
+        if(oIndex != nIndex) {
+            if(oIndex != -1) [self unlinkEntry:eIndex];
+            [self linkEntry:eIndex intoNode:nIndex];
+            if(oIndex != -1) [self pruneNode:oIndex]; // only after relinking, new path cells may share emptied ancestors
+        }
+    }
+    
+    pthread_mutex_unlock(&_iLock);
+    
+    return YES;
+}
+
+- (BOOL)updateObject:(id<NSObject>)object {
+    id<egwPBounding> bVol = nil;
+    EGWint eIndex;
+    
+    pthread_mutex_lock(&_iLock);
+    if((eIndex = [self lookupEntry:object]) != -1)
+        bVol = [[_entries[eIndex].bVol retain] autorelease];
+    pthread_mutex_unlock(&_iLock);
+    
+    return (bVol ? [self insertObject:object withBounding:bVol] : NO);
+}
+
+- (void)removeObject:(id<NSObject>)object {
+    EGWint eIndex;
+    
+    pthread_mutex_lock(&_iLock);
+    
+    if((eIndex = [self lookupEntry:object]) != -1)
+        [self freeEntry:eIndex];
+    
+    pthread_mutex_unlock(&_iLock);
+}
+
+- (void)removeAllObjects {
+    EGWuint eIndex;
+    EGWint octant;
+    
+    pthread_mutex_lock(&_iLock);
+    
+    for(eIndex = 0; eIndex < _eCount; ++eIndex)
+        if(_entries[eIndex].node != -1) {
+            [_entries[eIndex].bVol release]; _entries[eIndex].bVol = nil;
+        }
+    _eCount = 0; _eFree = -1;
+    egwHashTableRemoveAll(&_lookup);
+    
+    _nCount = 1; _nFree = -1;
+    for(octant = 0; octant < 8; ++octant) _nodes[0].children[octant] = -1;
+    _nodes[0].eHead = -1;
+    _nodes[0].sCount = 0;
+    
+    pthread_mutex_unlock(&_iLock);
+}
+
+- (EGWuint)queryObjectsCollidingWithFrustum:(const egwFrustum4f*)frustum intoArray:(egwArray*)results {
+    EGWuint count;
+    
+    pthread_mutex_lock(&_iLock);
+    count = egwSpIdxQueryFrustum(_nodes, _entries, 0, frustum, NO, results);
+    pthread_mutex_unlock(&_iLock);
+    
+    return count;
+}
+
+- (EGWuint)queryObjectsCollidingWithRay:(const egwRay4f*)ray intoArray:(egwArray*)results {
+    EGWuint hCount = 0, count = 0, hIndex;
+    
+    pthread_mutex_lock(&_iLock);
+    
+    [self queryRay:ray atNode:0 hitCount:&hCount];
+    
+    // Hit counts are small (picking), insertion sort nearest first
+    for(hIndex = 1; hIndex < hCount; ++hIndex) {
+        egwSpatialRayHit hit = _hits[hIndex];
+        EGWuint pIndex = hIndex;
+        
+        while(pIndex && _hits[pIndex-1].s > hit.s) {
+            _hits[pIndex] = _hits[pIndex-1];
+            --pIndex;
+        }
+        
+        _hits[pIndex] = hit;
+    }
+    
+    for(hIndex = 0; hIndex < hCount; ++hIndex) {
+        if(!egwArrayAddTail(results, (const EGWbyte*)&_hits[hIndex].object))
+            break;
+        ++count;
+    }
+    
+    pthread_mutex_unlock(&_iLock);
+    
+    return count;
+}
+
+- (EGWuint)queryObjectsCollidingWithSphere:(const egwSphere4f*)sphere intoArray:(egwArray*)results {
+    EGWuint count;
+    
+    pthread_mutex_lock(&_iLock);
+    count = egwSpIdxQuerySphere(_nodes, _entries, 0, sphere, results);
+    pthread_mutex_unlock(&_iLock);
+    
+    return count;
+}
+
+- (BOOL)containsObject:(id<NSObject>)object {
+    BOOL contains;
+    
+    pthread_mutex_lock(&_iLock);
+    contains = ([self lookupEntry:object] != -1 ? YES : NO);
+    pthread_mutex_unlock(&_iLock);
+    
+    return contains;
+}
+
+- (EGWuint)maxDepth {
+    return (EGWuint)_maxDepth;
+}
+
+- (EGWuint)objectCount {
+    return (EGWuint)_lookup.eCount;
+}
+
+- (id<egwPHook>)tryHookingWithPickingRay:(egwRay4f*)ray {
+    egwArray candidates;
+    id<egwPHook> hooked = nil;
+    
+    if(egwArrayInit(&candidates, NULL, sizeof(id), 8, EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)) {
+        // Candidates are retained for the duration, since hooking may re-enter the object tree
+        if([self queryObjectsCollidingWithRay:ray intoArray:&candidates]) {
+            EGWuint cIndex;
+            
+            for(cIndex = 0; cIndex < candidates.eCount; ++cIndex)
+                [*(id*)egwArrayElementPtrAt(&candidates, cIndex) retain];
+            
+            for(cIndex = 0; cIndex < candidates.eCount; ++cIndex) {
+                id candidate = *(id*)egwArrayElementPtrAt(&candidates, cIndex);
+                
+                if([candidate conformsToProtocol:@protocol(egwPHook)] && [(id<egwPHook>)candidate tryHookingWithPickingRay:ray]) {
+                    hooked = (id<egwPHook>)candidate;
+                    break;
+                }
+            }
+            
+            if(hooked) [[(NSObject*)hooked retain] autorelease];
+            
+            for(cIndex = 0; cIndex < candidates.eCount; ++cIndex)
+                [*(id*)egwArrayElementPtrAt(&candidates, cIndex) release];
+        }
+        
+        egwArrayFree(&candidates);
+    }
+    
+    return hooked;
+}
+
+@end
+
+
+@implementation egwSpatialIndex (Private)
+
+- (BOOL)growHits {
+    EGWuint hMax = (_hMax ? _hMax << 1 : 16);
+    egwSpatialRayHit* hits = (egwSpatialRayHit*)realloc((void*)_hits, (size_t)hMax * sizeof(egwSpatialRayHit));
+    
+    if(!hits) return NO;
+    
+    _hits = hits; _hMax = hMax;
+    return YES;
+}
+
+- (EGWint)allocNodeWithParent:(EGWint)pIndex atOctant:(EGWint)octant {
+    egwSpatialNode* node;
+    EGWsingle cExtent;
+    EGWint nIndex, cOctant;
+    
+    if(_nFree != -1) {
+        nIndex = _nFree; _nFree = _nodes[nIndex].eHead;
+    } else {
+        if(_nCount >= _nMax) {
+            egwSpatialNode* nodes = (egwSpatialNode*)realloc((void*)_nodes, (size_t)(_nMax << 1) * sizeof(egwSpatialNode));
+            if(!nodes) return -1;
+            _nodes = nodes; _nMax <<= 1;
+        }
+        nIndex = (EGWint)_nCount++;
+    }
+    
+    node = &_nodes[nIndex];
+    cExtent = _nodes[pIndex].hExtent * 0.5f;
+    
+    node->center.axis.x = _nodes[pIndex].center.axis.x + (octant & 1 ? cExtent : -cExtent);
+    node->center.axis.y = _nodes[pIndex].center.axis.y + (octant & 2 ? cExtent : -cExtent);
+    node->center.axis.z = _nodes[pIndex].center.axis.z + (octant & 4 ? cExtent : -cExtent);
+    node->center.axis.w = 1.0f;
+    node->hExtent = cExtent;
+    node->parent = pIndex;
+    for(cOctant = 0; cOctant < 8; ++cOctant) node->children[cOctant] = -1;
+    node->eHead = -1;
+    node->sCount = 0;
+    node->depth = _nodes[pIndex].depth + 1;
+    
+    _nodes[pIndex].children[octant] = nIndex;
+    
+    return nIndex;
+}
+
+- (EGWint)placeSphere:(const egwSphere4f*)sphere {
+    EGWint nIndex = 0;
+    
+    if(sphere->radius < 0.0f)
+        return 0;
+    
+    // Out of world entries stay at the root
+    if(egwAbsf(sphere->origin.axis.x - _nodes[0].center.axis.x) > _nodes[0].hExtent ||
+       egwAbsf(sphere->origin.axis.y - _nodes[0].center.axis.y) > _nodes[0].hExtent ||
+       egwAbsf(sphere->origin.axis.z - _nodes[0].center.axis.z) > _nodes[0].hExtent)
+        return 0;
+    
+    while(_nodes[nIndex].depth < _maxDepth && sphere->radius <= _nodes[nIndex].hExtent * 0.5f) {
+        EGWint octant = (sphere->origin.axis.x >= _nodes[nIndex].center.axis.x ? 1 : 0) |
+                        (sphere->origin.axis.y >= _nodes[nIndex].center.axis.y ? 2 : 0) |
+                        (sphere->origin.axis.z >= _nodes[nIndex].center.axis.z ? 4 : 0);
+        EGWint cIndex = _nodes[nIndex].children[octant];
+        
+        if(cIndex == -1 && (cIndex = [self allocNodeWithParent:nIndex atOctant:octant]) == -1)
+            break;
+        
+        nIndex = cIndex;
+    }
+    
+    return nIndex;
+}
+
+- (void)linkEntry:(EGWint)eIndex intoNode:(EGWint)nIndex {
+    egwSpatialEntry* entry = &_entries[eIndex];
+    
+    entry->node = nIndex;
+    entry->ePrev = -1;
+    entry->eNext = _nodes[nIndex].eHead;
+    if(entry->eNext != -1) _entries[entry->eNext].ePrev = eIndex;
+    _nodes[nIndex].eHead = eIndex;
+    
+    for(; nIndex != -1; nIndex = _nodes[nIndex].parent)
+        ++(_nodes[nIndex].sCount);
+}
+
+- (void)unlinkEntry:(EGWint)eIndex {
+    egwSpatialEntry* entry = &_entries[eIndex];
+    EGWint nIndex = entry->node;
+    
+    if(nIndex == -1) return;
+    
+    if(entry->ePrev != -1) _entries[entry->ePrev].eNext = entry->eNext;
+    else _nodes[nIndex].eHead = entry->eNext;
+    if(entry->eNext != -1) _entries[entry->eNext].ePrev = entry->ePrev;
+    entry->ePrev = entry->eNext = -1;
+    entry->node = -1;
+    
+    for(; nIndex != -1; nIndex = _nodes[nIndex].parent)
+        --(_nodes[nIndex].sCount);
+}
+
+- (void)pruneNode:(EGWint)nIndex {
+    // Emptied sub-cells hold no entries below them either, so they are unlinked bottom up till a cell still in use (root is never freed)
+    while(nIndex > 0 && !_nodes[nIndex].sCount) {
+        EGWint pIndex = _nodes[nIndex].parent;
+        EGWint octant;
+        
+        for(octant = 0; octant < 8; ++octant)
+            if(_nodes[nIndex].children[octant] != -1) return;
+        
+        for(octant = 0; octant < 8; ++octant)
+            if(_nodes[pIndex].children[octant] == nIndex) {
+                _nodes[pIndex].children[octant] = -1;
+                break;
+            }
+        
+        _nodes[nIndex].parent = -1;
+        _nodes[nIndex].eHead = _nFree; _nFree = nIndex;
+        
+        nIndex = pIndex;
+    }
+}
+
+- (void)freeEntry:(EGWint)eIndex {
+    egwSpatialLookup lookup; lookup.object = _entries[eIndex].object; lookup.eIndex = eIndex;
+    EGWint nIndex = _entries[eIndex].node;
+    
+    egwHashTableRemove(&_lookup, (const EGWbyte*)&lookup);
+    [self unlinkEntry:eIndex];
+    if(nIndex != -1) [self pruneNode:nIndex];
+    [_entries[eIndex].bVol release]; _entries[eIndex].bVol = nil;
+    _entries[eIndex].object = nil;
+    _entries[eIndex].eNext = _eFree; _eFree = eIndex;
+}
+
+- (EGWint)lookupEntry:(id<NSObject>)object {
+    egwSpatialLookup lookup; lookup.object = object; lookup.eIndex = -1;
+    egwSpatialLookup* found = (egwSpatialLookup*)egwHashTableFind(&_lookup, (const EGWbyte*)&lookup);
+    
+    return (found ? found->eIndex : -1);
+}
+
+- (void)queryRay:(const egwRay4f*)ray atNode:(EGWint)nIndex hitCount:(EGWuint*)hCount {
+    EGWsingle s, t;
+    EGWint eIndex, octant;
+    
+    if(!_nodes[nIndex].sCount) return;
+    
+    if(nIndex) {
+        egwBox4f lBox; egwSpIdxLooseBox(&_nodes[nIndex], &lBox);
+        
+        if(egwTestCollisionBoxLinef(&lBox, &(ray->line), &s, &t) < EGW_CLSNTEST_LINE_TOUCHES || t < ray->s - EGW_SFLT_EPSILON)
+            return;
+    }
+    
+    for(eIndex = _nodes[nIndex].eHead; eIndex != -1; eIndex = _entries[eIndex].eNext) {
+        egwSpatialEntry* entry = &_entries[eIndex];
+        
+        // Sphere pre-test is skipped for unbounded volumes, exact test always follows
+        if(entry->bSphere.radius >= 0.0f &&
+           (egwTestCollisionSphereLinef(&(entry->bSphere), &(ray->line), &s, &t) < EGW_CLSNTEST_LINE_TOUCHES || t < ray->s - EGW_SFLT_EPSILON))
+            continue;
+        
+        if([entry->bVol testCollisionWithLine:&(ray->line) startingAt:&s endingAt:&t] >= EGW_CLSNTEST_LINE_TOUCHES &&
+           ((s >= ray->s - EGW_SFLT_EPSILON) || (t >= ray->s - EGW_SFLT_EPSILON))) {
+            if(*hCount >= _hMax && ![self growHits])
+                return;
+            
+            _hits[*hCount].object = entry->object;
+            _hits[*hCount].s = (s >= ray->s ? s : ray->s);
+            ++(*hCount);
+        }
+    }
+    
+    for(octant = 0; octant < 8; ++octant)
+        if(_nodes[nIndex].children[octant] != -1)
+            [self queryRay:ray atNode:_nodes[nIndex].children[octant] hitCount:hCount];
+}
+
+@end
@@ -47,8 +47,25 @@
     egwMatrix44f _lcsTrans;                 ///< Offset transform (MMCS->LCS).
     id<egwPInterpolator> _wcsIpo;           ///< Orientation driver interpolator (retained).
     id<egwPInterpolator> _lcsIpo;           ///< Offset driver interpolator (retained).
+    
+    BOOL _doFlatten;                        ///< Tracks flattening root status.
+    egwFlatTransforms _flatTrans;           ///< Flattened transform hierarchy (as flattening root).
+    egwTransformBranch* _flatRoot;          ///< Flattening root self is flattened into (weak).
+    EGWuint _flatIndex;                     ///< Entry index into flattening root.
 }
 
+/// Flattened Transforms Accessor.
+/// Returns the flattening root status of this branch.
+/// @return YES if branch is a flattening root, otherwise NO.
+- (BOOL)isFlatteningTransforms;
+
+
+/// Flattened Transforms Mutator.
+/// Sets the flattening root status of this branch, where transforms of descendant transform branches are kept in a flattened parent-index ordered array and propagated in one linear batched sweep.
+/// @note Other branch types (and other flattening roots) are treated as leaves, only leaves whose transform actually changed are notified.
+/// @param [in] status Flattening root status.
+- (void)setFlattenedTransforms:(BOOL)status;
+
 @end
 
 /// @}
@@ -28,6 +28,7 @@
 #import "../inf/egwPOrientated.h"
 #import "../inf/egwPObjLeaf.h"
 #import "../sys/egwSysTypes.h"
+#import "../math/egwMath.h"
 #import "../math/egwVector.h"
 #import "../math/egwMatrix.h"
 #import "../gfx/egwBoundings.h"
@@ -35,6 +36,60 @@
 #import "../misc/egwValidater.h"
 
 
+#define EGW_FLTTRNSFLG_NONE         0x0000  // No flags.
+#define EGW_FLTTRNSFLG_BRANCH       0x0001  // Entry is a flattened transform branch.
+#define EGW_FLTTRNSFLG_DIRTY        0x0002  // Entry transforms need recalculated.
+#define EGW_FLTTRNSFLG_CHANGED      0x0004  // Entry transforms changed in current sweep.
+#define EGW_FLTTRNSFLG_ALWAYSHMG    0x0008  // Entry always orientates homogeneously.
+
+// Used to determine if a transform branch must always orientate homogeneously (only usable inside of class methods).
+#define EGW_TRNSBRNCH_ALWAYSHMG(branch) \
+    (((branch)->_audioObj && ((branch)->_audioObj->flags & EGW_OBJEXTEND_FLG_ALWAYSOTGHMG)) || \
+     ((branch)->_graphicObj && ((branch)->_graphicObj->flags & EGW_OBJEXTEND_FLG_ALWAYSOTGHMG)) || \
+     ((branch)->_animateObj && ((branch)->_animateObj->flags & EGW_OBJEXTEND_FLG_ALWAYSOTGHMG)) || \
+     ((branch)->_cameraObj && ((branch)->_cameraObj->flags & EGW_OBJEXTEND_FLG_ALWAYSOTGHMG)) || \
+     ((branch)->_lightObj && ((branch)->_lightObj->flags & EGW_OBJEXTEND_FLG_ALWAYSOTGHMG)))
+
+
+// !!!: ***** Helper Routines *****
+
+static BOOL egwFlatTransGrow(egwFlatTransforms* flat_inout, EGWuint minCapacity) {
+    EGWuint newCapacity = egwMax2ui(minCapacity, flat_inout->fMax << 1);
+    void* newArray;
+    
+    if(!(newArray = realloc((void*)flat_inout->nodes, sizeof(egwFlatTransformNode) * (size_t)newCapacity))) return NO;
+    flat_inout->nodes = (egwFlatTransformNode*)newArray;
+    if(!(newArray = realloc((void*)flat_inout->wcsTrans, sizeof(egwMatrix44f) * (size_t)newCapacity))) return NO;
+    flat_inout->wcsTrans = (egwMatrix44f*)newArray;
+    if(!(newArray = realloc((void*)flat_inout->lcsTrans, sizeof(egwMatrix44f) * (size_t)newCapacity))) return NO;
+    flat_inout->lcsTrans = (egwMatrix44f*)newArray;
+    if(!(newArray = realloc((void*)flat_inout->twcsTrans, sizeof(egwMatrix44f) * (size_t)newCapacity))) return NO;
+    flat_inout->twcsTrans = (egwMatrix44f*)newArray;
+    
+    flat_inout->fMax = newCapacity; // NOTE: Capacity only raised once all arrays are grown, partial growths are harmless. -jw
+    
+    return YES;
+}
+
+static void egwFlatTransFree(egwFlatTransforms* flat_inout) {
+    if(flat_inout->nodes) { free((void*)flat_inout->nodes); flat_inout->nodes = NULL; }
+    if(flat_inout->wcsTrans) { free((void*)flat_inout->wcsTrans); flat_inout->wcsTrans = NULL; }
+    if(flat_inout->lcsTrans) { free((void*)flat_inout->lcsTrans); flat_inout->lcsTrans = NULL; }
+    if(flat_inout->twcsTrans) { free((void*)flat_inout->twcsTrans); flat_inout->twcsTrans = NULL; }
+    flat_inout->fCount = flat_inout->fMax = 0;
+}
+
+
+// !!!: ***** egwTransformBranch *****
+
+@interface egwTransformBranch (Private)
+- (void)invalidateFlattening;
+- (void)markFlattenedDirtyAt:(EGWuint)index;
+- (BOOL)rebuildFlattening;
+- (void)sweepFlattening;
+@end
+
+
 @implementation egwTransformBranch
 
 - (id)init {
@@ -49,6 +104,11 @@
     egwMatCopy44f(&egwSIMatIdentity44f, &_wcsTrans);
     egwMatCopy44f(&egwSIMatIdentity44f, &_lcsTrans);
     
+    _doFlatten = NO;
+    memset((void*)&_flatTrans, 0, sizeof(egwFlatTransforms));
+    _flatRoot = nil;
+    _flatIndex = 0;
+    
     return self;
 }
 
@@ -90,6 +150,7 @@
 		[copy orientateByTransform:&_wcsTrans];
         [copy trySetOffsetDriver:_lcsIpo];
         [copy trySetOrientateDriver:_wcsIpo];
+        [copy setFlattenedTransforms:_doFlatten];
     }
     
     return copy;
@@ -99,12 +160,18 @@
     if(_lcsIpo) { [_lcsIpo removeTargetWithObject:self]; [_lcsIpo release]; _lcsIpo = nil; }
     if(_wcsIpo) { [_wcsIpo removeTargetWithObject:self]; [_wcsIpo release]; _wcsIpo = nil; }
     
+    if(_doFlatten) { [self invalidateFlattening]; _doFlatten = NO; }
+    egwFlatTransFree(&_flatTrans);
+    
     [super dealloc];
 }
 
 - (void)addChild:(id<egwPObjectNode>)node {
     [super addChild:node];
     
+    if(_doFlatten) [self invalidateFlattening];
+    else if(_flatRoot) [_flatRoot invalidateFlattening];
+    
     // Force passing of TWCS to new children
     _ortPending = YES;
     
@@ -119,6 +186,9 @@
 - (void)addAllChildren:(NSArray*)nodes {
     [super addAllChildren:nodes];
     
+    if(_doFlatten) [self invalidateFlattening];
+    else if(_flatRoot) [_flatRoot invalidateFlattening];
+    
     // Force passing of TWCS to new children
     _ortPending = YES;
     
@@ -133,22 +203,40 @@
 - (void)removeChild:(id<egwPObjectNode>)node {
     if(_ortPending) [self applyOrientation];
     
+    // NOTE: Flattened entries are weak, so links must be broken while node is still retained. -jw
+    if(_doFlatten) [self invalidateFlattening];
+    else if(_flatRoot) [_flatRoot invalidateFlattening];
+    
     [super removeChild:node];
 }
 
 - (void)removeAllChildren {
     if(_ortPending) [self applyOrientation];
     
+    if(_doFlatten) [self invalidateFlattening];
+    else if(_flatRoot) [_flatRoot invalidateFlattening];
+    
     [super removeAllChildren];
 }
 
 - (void)applyOrientation {
+    if(_flatRoot) { // Flattened branches are swept by their flattening root
+        if(_ortPending && !_invkParent) {
+            _invkParent = YES;
+            [_flatRoot applyOrientation];
+            _invkParent = NO;
+        }
+        return;
+    }
+    
     if(_ortPending && !_invkParent) {
         _invkParent = YES;
         
         [(id<egwPOrientated>)_parent applyOrientation]; // NOTE: Because the parent contains self, it will always be an orientated branch line, also parents never call a child's applyOrientation method -jw
         
-        if(_children && !_invkChild) {
+        if(_doFlatten && _children && !_invkChild && (_flatTrans.fCount || [self rebuildFlattening])) {
+            [self sweepFlattening];
+        } else if(_children && !_invkChild) {
             egwMatrix44f twcsTrans;
             if(!((_audioObj && (_audioObj->flags & EGW_OBJEXTEND_FLG_ALWAYSOTGHMG)) ||
                  (_graphicObj && (_graphicObj->flags & EGW_OBJEXTEND_FLG_ALWAYSOTGHMG)) ||
@@ -179,6 +267,8 @@
 - (void)offsetByTransform:(const egwMatrix44f*)lcsTransform {
     egwMatCopy44f(lcsTransform, &_lcsTrans);
     
+    if(_flatRoot) [_flatRoot markFlattenedDirtyAt:_flatIndex];
+    
     if(!_ortPending) {
         _ortPending = YES;
         
@@ -194,6 +284,8 @@
 - (void)orientateByTransform:(const egwMatrix44f*)wcsTransform {
     egwMatCopy44f(wcsTransform, &_wcsTrans);
     
+    if(_flatRoot) [_flatRoot markFlattenedDirtyAt:_flatIndex]; // NOTE: Flattened branch WCS is owned by the flattening root, this will be recalculated from parent -jw
+    
     if(!_ortPending) {
         _ortPending = YES;
         
@@ -361,8 +453,186 @@
     return NO;
 }
 
+- (BOOL)isFlatteningTransforms {
+    return _doFlatten;
+}
+
 - (BOOL)isOrientationPending {
     return _ortPending;
 }
 
+- (void)setFlattenedTransforms:(BOOL)status {
+    if(status && !_doFlatten) {
+        if(_flatRoot) [_flatRoot invalidateFlattening]; // re-flattened as a leaf of enclosing root
+        
+        _doFlatten = YES;
+        _flatTrans.fCount = 0;
+        _ortPending = YES; // rebuilt on next apply
+    } else if(!status && _doFlatten) {
+        [self invalidateFlattening];
+        egwFlatTransFree(&_flatTrans);
+        
+        _doFlatten = NO;
+        
+        if(_parent && [(NSObject*)_parent isKindOfClass:[egwTransformBranch class]]) {
+            egwTransformBranch* parent = (egwTransformBranch*)_parent;
+            if(parent->_doFlatten) [parent invalidateFlattening];
+            else if(parent->_flatRoot) [parent->_flatRoot invalidateFlattening];
+        }
+    }
+}
+
+@end
+
+
+@implementation egwTransformBranch (Private)
+
+- (void)invalidateFlattening {
+    for(EGWuint entryIndex = 1; entryIndex < _flatTrans.fCount; ++entryIndex)
+        if(_flatTrans.nodes[entryIndex].fFlags & EGW_FLTTRNSFLG_BRANCH)
+            ((egwTransformBranch*)(_flatTrans.nodes[entryIndex].node))->_flatRoot = nil;
+    
+    _flatTrans.fCount = 0;
+    _ortPending = YES; // rebuilt on next apply
+}
+
+- (void)markFlattenedDirtyAt:(EGWuint)index {
+    if(index < _flatTrans.fCount) {
+        _flatTrans.nodes[index].fFlags |= EGW_FLTTRNSFLG_DIRTY;
+        _ortPending = YES; // NOTE: Flattened branch already told its own children about the impending orientation -jw
+    }
+}
+
+- (BOOL)rebuildFlattening {
+    egwFlatTransformNode* entry;
+    EGWuint entryIndex;
+    
+    [self invalidateFlattening];
+    
+    if(_flatTrans.fMax < 1 && !egwFlatTransGrow(&_flatTrans, 16)) return NO;
+    
+    entry = &_flatTrans.nodes[0];
+    entry->node = self; // weak
+    entry->pIndex = -1;
+    entry->depth = 0;
+    entry->fFlags = (EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_DIRTY);
+    _flatTrans.fCount = 1;
+    
+    // Breadth first walk keeps parents ahead of children and each depth level contiguous
+    for(entryIndex = 0; entryIndex < _flatTrans.fCount; ++entryIndex) {
+        if(_flatTrans.nodes[entryIndex].fFlags & EGW_FLTTRNSFLG_BRANCH) {
+            egwTransformBranch* branch = (egwTransformBranch*)(_flatTrans.nodes[entryIndex].node);
+            
+            if(branch->_children) {
+                if(_flatTrans.fCount + [branch->_children count] > _flatTrans.fMax &&
+                   !egwFlatTransGrow(&_flatTrans, _flatTrans.fCount + [branch->_children count])) {
+                    [self invalidateFlattening];
+                    return NO;
+                }
+                
+                for(id<egwPObjectNode> node in branch->_children) {
+                    entry = &_flatTrans.nodes[_flatTrans.fCount];
+                    entry->node = node; // weak
+                    entry->pIndex = (EGWint)entryIndex;
+                    entry->depth = _flatTrans.nodes[entryIndex].depth + 1;
+                    entry->fFlags = EGW_FLTTRNSFLG_DIRTY;
+                    
+                    if([(NSObject*)node isKindOfClass:[egwTransformBranch class]] && !((egwTransformBranch*)node)->_doFlatten) {
+                        entry->fFlags |= EGW_FLTTRNSFLG_BRANCH;
+                        ((egwTransformBranch*)node)->_flatRoot = self;
+                        ((egwTransformBranch*)node)->_flatIndex = _flatTrans.fCount;
+                    }
+                    
+                    ++_flatTrans.fCount;
+                }
+            }
+        }
+    }
+    
+    return YES;
+}
+
+- (void)sweepFlattening {
+    egwFlatTransforms* flat = &_flatTrans;
+    egwMatrix44f twcsTrans;
+    EGWuint entryIndex, levelBegin, levelEnd, runEnd;
+    EGWuint16 fFlags;
+    
+    // Root entry, only changes going down if own combined transform changes
+    if(!EGW_TRNSBRNCH_ALWAYSHMG(self))
+        egwMatMultiply44f(&_wcsTrans, &_lcsTrans, &twcsTrans);
+    else
+        egwMatMultiplyHmg44f(&_wcsTrans, &_lcsTrans, &twcsTrans);
+    
+    if((flat->nodes[0].fFlags & EGW_FLTTRNSFLG_DIRTY) || !egwMatIsEqual44f(&twcsTrans, &flat->twcsTrans[0])) {
+        egwMatCopy44f(&twcsTrans, &flat->twcsTrans[0]);
+        flat->nodes[0].fFlags = EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_CHANGED;
+    } else flat->nodes[0].fFlags = EGW_FLTTRNSFLG_BRANCH;
+    
+    // Walk each depth level: pass down parent transforms, then batch multiply combined transforms for runs of changed branches
+    for(levelBegin = 1; levelBegin < flat->fCount; levelBegin = levelEnd) {
+        for(levelEnd = levelBegin; levelEnd < flat->fCount && flat->nodes[levelEnd].depth == flat->nodes[levelBegin].depth; ++levelEnd) {
+            egwFlatTransformNode* entry = &flat->nodes[levelEnd];
+            
+            fFlags = entry->fFlags & ~EGW_FLTTRNSFLG_CHANGED;
+            
+            if((flat->nodes[entry->pIndex].fFlags & EGW_FLTTRNSFLG_CHANGED) || (fFlags & EGW_FLTTRNSFLG_DIRTY)) {
+                if(fFlags & EGW_FLTTRNSFLG_BRANCH) {
+                    egwTransformBranch* branch = (egwTransformBranch*)(entry->node);
+                    
+                    egwMatCopy44f(&flat->twcsTrans[entry->pIndex], &flat->wcsTrans[levelEnd]);
+                    egwMatCopy44f(&branch->_lcsTrans, &flat->lcsTrans[levelEnd]);
+                    
+                    fFlags |= EGW_FLTTRNSFLG_CHANGED;
+                    if(EGW_TRNSBRNCH_ALWAYSHMG(branch)) fFlags |= EGW_FLTTRNSFLG_ALWAYSHMG;
+                    else fFlags &= ~EGW_FLTTRNSFLG_ALWAYSHMG;
+                } else if((fFlags & EGW_FLTTRNSFLG_DIRTY) || !egwMatIsEqual44f(&flat->twcsTrans[entry->pIndex], &flat->wcsTrans[levelEnd])) {
+                    egwMatCopy44f(&flat->twcsTrans[entry->pIndex], &flat->wcsTrans[levelEnd]);
+                    fFlags |= EGW_FLTTRNSFLG_CHANGED;
+                }
+                
+                fFlags &= ~EGW_FLTTRNSFLG_DIRTY;
+            }
+            
+            entry->fFlags = fFlags;
+        }
+        
+        for(entryIndex = levelBegin; entryIndex < levelEnd; entryIndex = runEnd) {
+            fFlags = flat->nodes[entryIndex].fFlags & (EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_CHANGED | EGW_FLTTRNSFLG_ALWAYSHMG);
+            
+            for(runEnd = entryIndex + 1; runEnd < levelEnd && (flat->nodes[runEnd].fFlags & (EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_CHANGED | EGW_FLTTRNSFLG_ALWAYSHMG)) == fFlags; ++runEnd);
+            
+            if((fFlags & (EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_CHANGED)) == (EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_CHANGED)) {
+                if(!(fFlags & EGW_FLTTRNSFLG_ALWAYSHMG))
+                    egwMatMultiply44fv(&flat->wcsTrans[entryIndex], &flat->lcsTrans[entryIndex], &flat->twcsTrans[entryIndex], 0, 0, 0, runEnd - entryIndex);
+                else
+                    egwMatMultiplyHmg44fv(&flat->wcsTrans[entryIndex], &flat->lcsTrans[entryIndex], &flat->twcsTrans[entryIndex], 0, 0, 0, runEnd - entryIndex);
+            }
+        }
+    }
+    
+    // Write back to flattened branches, notify changed leaves
+    _invkChild = YES;
+    // NOTE: Leafs should always be orientated, else this will fail -jw
+    // NOTE: This is going to edit a child, even if that child is in a calling state to the parent -jw
+    for(entryIndex = 1; entryIndex < flat->fCount; ++entryIndex) {
+        if(flat->nodes[entryIndex].fFlags & EGW_FLTTRNSFLG_BRANCH) {
+            egwTransformBranch* branch = (egwTransformBranch*)(flat->nodes[entryIndex].node);
+            
+            if(flat->nodes[entryIndex].fFlags & EGW_FLTTRNSFLG_CHANGED)
+                egwMatCopy44f(&flat->wcsTrans[entryIndex], &branch->_wcsTrans);
+            branch->_ortPending = NO;
+        } else if(flat->nodes[entryIndex].fFlags & EGW_FLTTRNSFLG_CHANGED)
+            [(id<egwPOrientated>)(flat->nodes[entryIndex].node) orientateByTransform:&flat->wcsTrans[entryIndex]];
+    }
+    _invkChild = NO;
+    
+    // Deepest first, changed branches merge their components same as when applying on their own
+    if(EGW_NODECMPMRG_COMBINED & (EGW_CORECMP_TYPE_BVOLS | EGW_CORECMP_TYPE_FRAMES | EGW_CORECMP_TYPE_SOURCES | EGW_CORECMP_TYPE_SYNCS)) {
+        for(entryIndex = flat->fCount - 1; entryIndex > 0; --entryIndex)
+            if((flat->nodes[entryIndex].fFlags & (EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_CHANGED)) == (EGW_FLTTRNSFLG_BRANCH | EGW_FLTTRNSFLG_CHANGED))
+                [(egwTransformBranch*)(flat->nodes[entryIndex].node) mergeCoreComponentTypes:(EGW_NODECMPMRG_COMBINED & (EGW_CORECMP_TYPE_BVOLS | EGW_CORECMP_TYPE_FRAMES | EGW_CORECMP_TYPE_SOURCES | EGW_CORECMP_TYPE_SYNCS)) forCoreObjectTypes:[(egwTransformBranch*)(flat->nodes[entryIndex].node) coreObjectTypes]];
+    }
+}
+
 @end
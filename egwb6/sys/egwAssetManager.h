@@ -38,6 +38,30 @@
 
 #define EGW_ASSTMNGR_SDECTHREADS     1      ///< Total number of stream decoder threads in thread pool.
 #define EGW_ASSTMNGR_SDECPRIORITY    0.50   ///< Stream decoder threads' priority.
+#define EGW_ASSTMNGR_PMLMINENTITIES  4      ///< Minimum manifest asset entities before parallel manifest loading is used.
+
+#define EGW_GAM_HEADERTAG           "EGWGAMR1"  ///< Binary asset manifest header tag, last byte is alpha-numeric revision #.
+#define EGW_GAM_BYTEORDER           0x01020304  ///< Binary asset manifest byte order mark (as read natively).
+#define EGW_GAM_PAYLOADALIGN        16          ///< Binary asset manifest payload array alignment (in bytes).
+#define EGW_GAM_PAYLOADREF          "@gam:"     ///< Binary asset manifest payload reference prefix ("@gam:<format>:<offset>:<count>").
+#define EGW_GAM_PAYLOADFRMT_FLOAT32 'f'         ///< Payload array of single-precision floaters.
+#define EGW_GAM_PAYLOADFRMT_FLOAT64 'd'         ///< Payload array of double-precision floaters.
+#define EGW_GAM_PAYLOADFRMT_INT32   'i'         ///< Payload array of signed 32-bit integers.
+
+
+/// Binary Asset Manifest Header.
+/// Leads a compiled binary asset manifest (.gam) file, as produced by util/gam_conv.py from a .gamx manifest.
+/// @note The manifest section is GAMX text with large numeric text nodes replaced by payload references into the payload section.
+/// @note Payload arrays are raw, native byte order, and aligned to EGW_GAM_PAYLOADALIGN so that the file can be memory mapped and read directly.
+typedef struct {
+    EGWchar tag[8];                         ///< Header tag (EGW_GAM_HEADERTAG, not null terminated).
+    EGWuint32 byteOrder;                    ///< Byte order mark (EGW_GAM_BYTEORDER).
+    EGWuint32 mOffset;                      ///< Manifest section offset (from file start).
+    EGWuint32 mLength;                      ///< Manifest section length (in bytes).
+    EGWuint32 pOffset;                      ///< Payload section offset (from file start, aligned).
+    EGWuint32 pLength;                      ///< Payload section length (in bytes).
+    EGWuint32 reserved;                     ///< Reserved for future use (zero).
+} egwGAMHeader;
 
 
 /// Asset Manager.
@@ -49,6 +73,8 @@
     NSMutableDictionary* _assetsTable;      ///< Assets table dictionary.
     NSString* _workDir;                     ///< Current working directory.
     NSString* _pfPerf;                      ///< Postfix filename perferance.
+    BOOL _pmLoad;                           ///< Parallel manifest loading.
+    pthread_mutex_t _fLock;                 ///< FreeType library lock.
     
     pthread_mutex_t _qLock;                 ///< Work item queues lock.
     pthread_cond_t _wCond;                  ///< Work wait signal condition.
@@ -87,6 +113,7 @@
 /// Assets Load (fromManifest) Method.
 /// Loads all assets into manager from provided @a resourceFile.
 /// @note The resource file _MUST_ be a manifest file.
+/// @note A binary manifest (.gam) is preferred over a text manifest (.gamx) of the same name if it is up to date.
 /// @param [in] resourceFile Resource file to examine.
 /// @return Number of assets loaded.
 - (EGWuint)loadAssetsFromManifest:(NSString*)resourceFile;
@@ -168,12 +195,23 @@
 /// @return Current working directory.
 - (NSString*)workingDirectory;
 
+/// Parallel Manifest Loading Accessor.
+/// Returns whether manifest asset entities are loaded concurrently.
+/// @return YES if parallel manifest loading is enabled, otherwise NO.
+- (BOOL)isParallelManifestLoading;
+
 
 /// Filename Postfix Perferance Mutator.
 /// Sets the filename postfix perferance, used to "prefer" one file type over another, effective on all asset manager loader methods.
 /// @param[in] postfix Filename postfix perferance.
 - (void)setFilenamePostfixPerferance:(NSString*)postfix;
 
+/// Parallel Manifest Loading Mutator.
+/// Sets whether manifest asset entities are loaded concurrently on the task manager's threads.
+/// @note Top-level asset entities are indexed first, then loaded in waves such that entities "ref"erencing assets defined earlier in the same manifest load after them.
+/// @param [in] enable Parallel manifest loading enablement.
+- (void)setParallelManifestLoading:(BOOL)enable;
+
 /// Working Directory Mutator.
 /// Sets the current working directory.
 /// @param [in] directory Working directory.
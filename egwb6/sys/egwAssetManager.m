@@ -25,6 +25,10 @@
 /// Asset Manager Implementation.
 
 #import <stdio.h>
+#import <fcntl.h>
+#import <unistd.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
 #import <zlib.h>
 #import <png.h>
 #import <pthread.h>
@@ -37,6 +41,7 @@
 #import <vorbis/ivorbisfile.h>
 #import "egwAssetManager.h"
 #import "../sys/egwEngine.h"
+#import "../sys/egwTaskManager.h"
 #import "../sys/egwGfxContext.h"
 #import "../sys/egwGfxContextNSGL.h"  // NOTE: Below code has a dependence on GL.
 #import "../sys/egwGfxContextEAGLES.h"
@@ -200,6 +205,21 @@ typedef struct {
     } contents;
 } egwDecodingWorkItem;
 
+typedef struct {
+    xmlChar* eXml;                      // Entity outer XML section (owned)
+    EGWuint eWave;                      // Load wave, one after the latest in-manifest entity it references (0 = independent)
+} egwManifestEntity;
+
+typedef struct {
+    const EGWchar* resourceFile;        // Manifest input file (weak)
+    egwManifestEntity* entities;        // Indexed entities (weak)
+    EGWuint* eOrder;                    // Entity indicies sorted by load wave (weak)
+    const EGWbyte* pData;               // Binary manifest payload section (weak, NULL for text manifests)
+    EGWuint32 pLength;                  // Binary manifest payload section length
+    pthread_mutex_t cLock;              // Load counter lock
+    EGWuint loadCounter;                // Loaded assets counter
+} egwManifestLoadJob;
+
 
 // !!!: ***** egwAssetManager *****
 
@@ -230,6 +250,8 @@ typedef struct {
 // Manifest loaders
 - (EGWuint)loadManifest_GAM:(const EGWchar*)resourceFile;
 - (EGWuint)loadManifest_GAMX:(const EGWchar*)resourceFile;
+- (EGWuint)parseManifest_GAMX:(const EGWchar*)resourceFile withReader:(xmlTextReaderPtr)xmlReadHandle;
+- (EGWuint)parseManifestAssets_GAMX:(const EGWchar*)resourceFile withReader:(xmlTextReaderPtr)xmlReadHandle retVal:(EGWint*)retVal;
 
 // Shared transformers
 - (BOOL)performAudioEnsurances:(egwAudio*)audio fromFile:(const EGWchar*)resourceFile withTransforms:(EGWuint*)transforms;
@@ -294,6 +316,7 @@ static FT_Library _ftLibrary = { NULL };
     _doShutdown = NO;
     
     if(pthread_mutex_init(&_aLock, NULL)) { [self release]; return (self = nil); }
+    if(pthread_mutex_init(&_fLock, NULL)) { [self release]; return (self = nil); }
     if(!(_assetsTable = [[NSMutableDictionary alloc] init])) { [self release]; return (self = nil); }
     
     if(pthread_mutex_init(&_qLock, NULL)) { [self release]; return (self = nil); }
@@ -343,6 +366,7 @@ static FT_Library _ftLibrary = { NULL };
     }
     
     pthread_mutex_destroy(&_aLock);
+    pthread_mutex_destroy(&_fLock);
     [_assetsTable release]; _assetsTable = nil;
     [_workDir release]; _workDir = nil;
     [_pfPerf release]; _pfPerf = nil;
@@ -689,12 +713,20 @@ static FT_Library _ftLibrary = { NULL };
     return _workDir;
 }
 
+- (BOOL)isParallelManifestLoading {
+    return _pmLoad;
+}
+
 - (void)setFilenamePostfixPerferance:(NSString*)postfix {
     [postfix retain];
     [_pfPerf release];
     _pfPerf = postfix;
 }
 
+- (void)setParallelManifestLoading:(BOOL)enable {
+    _pmLoad = enable;
+}
+
 - (void)setWorkingDirectory:(NSString*)directory {
     if(directory && ([directory hasPrefix:@"/"] || [directory hasPrefix:@"./"] || [directory hasPrefix:@"../"])) {
         NSString* dir = nil;
@@ -1574,6 +1606,8 @@ ErrorCleanup:
     FT_Render_Mode renderFlags = FT_RENDER_MODE_NORMAL;
     egwArray kernTable; memset((void*)&kernTable, 0, sizeof(egwArray));
     
+    pthread_mutex_lock(&_fLock); // FreeType library objects are not safe to share between threads (parallel manifest loading)
+    
     if(!egwArrayInit(&kernTable, NULL, sizeof(egwAMKernSet), 10, EGW_ARRAY_FLG_DFLT) ||
        egwIsFreeTypeError(FT_New_Face(_ftLibrary, (const char*)resourceFile, 0, &face), &errorString)) {
         NSLog(@"egwAssetManager: loadGlyphMap_TTF:fromFile:withEffects:pointSize: Failure opening font input file '%s'. Invalid glyph map container object. FTError: %@", resourceFile, (errorString ? errorString : @"FT_Err_Ok."));
@@ -1747,6 +1781,8 @@ ErrorCleanup:
     egwArrayFree(&kernTable);
     FT_Done_Face(face);
     
+    pthread_mutex_unlock(&_fLock);
+    
     return YES;
     
 ErrorCleanup:
@@ -1763,6 +1799,8 @@ ErrorCleanup:
         mapset->kerns = NULL;
     }
     
+    pthread_mutex_unlock(&_fLock);
+    
     return NO;
 }
 
@@ -2165,9 +2203,68 @@ ErrorCleanup:
 
 // !!!: GAM asset manifest loader.
 
+void egwGAMXBindPayload(const EGWbyte* data, EGWuint32 length);
+void egwGAMXBoundPayload(const EGWbyte** data_out, EGWuint32* length_out);
+
 - (EGWuint)loadManifest_GAM:(const EGWchar*)resourceFile {
-    NSLog(@"egwAssetManager: loadManifest_GAM: Not yet implemented.");
-    return 0;
+    int fd = -1;
+    struct stat fstatus;
+    EGWbyte* fileMap = (EGWbyte*)MAP_FAILED;
+    size_t fileSize = 0;
+    const egwGAMHeader* header;
+    xmlTextReaderPtr xmlReadHandle = NULL;
+    EGWuint loadCounter = 0;
+    
+    if((fd = open((const char*)resourceFile, O_RDONLY)) == -1 || fstat(fd, &fstatus) != 0) {
+        NSLog(@"egwAssetManager: loadManifest_GAM: Failure opening manifest input file '%s'.", resourceFile);
+        goto LoadBreak;
+    }
+    
+    if((fileSize = (size_t)fstatus.st_size) < sizeof(egwGAMHeader)) {
+        NSLog(@"egwAssetManager: loadManifest_GAM: Failure reading in manifest input file '%s'. File too small.", resourceFile);
+        goto LoadBreak;
+    }
+    
+    // Payload arrays are read straight out of the mapping, only pages actually touched get read in
+    if((fileMap = (EGWbyte*)mmap(NULL, fileSize, PROT_READ, MAP_FILE | MAP_PRIVATE, fd, 0)) == (EGWbyte*)MAP_FAILED) {
+        NSLog(@"egwAssetManager: loadManifest_GAM: Failure memory mapping manifest input file '%s'.", resourceFile);
+        goto LoadBreak;
+    }
+    
+    header = (const egwGAMHeader*)fileMap;
+    
+    if(memcmp((const void*)header->tag, (const void*)EGW_GAM_HEADERTAG, 8) != 0) {
+        NSLog(@"egwAssetManager: loadManifest_GAM: Failure reading in manifest input file '%s'. Header tag mismatch (should be '%s').", resourceFile, EGW_GAM_HEADERTAG);
+        goto LoadBreak;
+    }
+    
+    if(header->byteOrder != EGW_GAM_BYTEORDER) {
+        NSLog(@"egwAssetManager: loadManifest_GAM: Failure reading in manifest input file '%s'. Byte order mismatch.", resourceFile);
+        goto LoadBreak;
+    }
+    
+    if((EGWuint64)header->mOffset + (EGWuint64)header->mLength > (EGWuint64)fileSize || header->mLength == 0 ||
+       (EGWuint64)header->pOffset + (EGWuint64)header->pLength > (EGWuint64)fileSize || (header->pOffset % EGW_GAM_PAYLOADALIGN) != 0) {
+        NSLog(@"egwAssetManager: loadManifest_GAM: Failure reading in manifest input file '%s'. Section extents out of range.", resourceFile);
+        goto LoadBreak;
+    }
+    
+    if(!(xmlReadHandle = xmlReaderForMemory((const char*)(fileMap + header->mOffset), (int)header->mLength, (const char*)resourceFile, NULL, 0))) {
+        NSLog(@"egwAssetManager: loadManifest_GAM: Failure opening manifest section of input file '%s'.", resourceFile);
+        goto LoadBreak;
+    }
+    
+    egwGAMXBindPayload((const EGWbyte*)(fileMap + header->pOffset), header->pLength);
+    
+    loadCounter = [self parseManifest_GAMX:resourceFile withReader:xmlReadHandle];
+    
+    egwGAMXBindPayload(NULL, 0);
+    
+LoadBreak:
+    if(xmlReadHandle) { xmlFreeTextReader(xmlReadHandle); xmlReadHandle = NULL; }
+    if(fileMap != (EGWbyte*)MAP_FAILED) { munmap((void*)fileMap, fileSize); fileMap = (EGWbyte*)MAP_FAILED; }
+    if(fd != -1) { close(fd); fd = -1; }
+    return loadCounter;
 }
 
 // !!!: GAMX asset manifest loader.
@@ -2178,18 +2275,209 @@ ErrorCleanup:
 
 id<NSObject> egwGAMXParseEntity(const EGWchar* resourceFile, xmlTextReaderPtr xmlReadHandle, EGWint* retVal, EGWuint* loadCounter, const xmlChar* entityNodeName);
 
+// Finds the next attrName="value" attribute in entity section xml_inout (advancing it), returns duplicated value (must xmlFree) or NULL if none left
+static xmlChar* egwManifestNextAttribute(const xmlChar** xml_inout, const EGWchar* attrName) {
+    const xmlChar* scan = *xml_inout;
+    const xmlChar* value;
+    const xmlChar* valueEnd;
+    size_t nameLength = strlen((const char*)attrName);
+    
+    // NOTE: Sections always start with '<', so a name match is never at the very start and scan[-1] is safe -jw
+    while((scan = (const xmlChar*)strstr((const char*)scan, (const char*)attrName))) {
+        value = scan + nameLength;
+        
+        if(scan[-1] <= ' ') {
+            while(*value != '\0' && *value <= ' ') ++value;
+            if(*value == '=') {
+                ++value; while(*value != '\0' && *value <= ' ') ++value;
+                if((*value == '"' || *value == '\'') && (valueEnd = (const xmlChar*)strchr((const char*)(value + 1), (int)*value))) {
+                    *xml_inout = valueEnd + 1;
+                    return xmlStrndup(value + 1, (int)(valueEnd - (value + 1)));
+                }
+            }
+        }
+        
+        scan += nameLength;
+    }
+    
+    *xml_inout = NULL;
+    return NULL;
+}
+
+// Loads indexed entities [begin,end) of the sorted load order, run from any thread (including task manager threads)
+static void egwManifestLoadRange(void* context, EGWuint begin, EGWuint end) {
+    egwManifestLoadJob* job = (egwManifestLoadJob*)context;
+    const EGWbyte* pDataPrev = NULL;
+    EGWuint32 pLengthPrev = 0;
+    EGWuint loadCounter = 0;
+    
+    // Payload binding is per thread, so carry the loading thread's binding over (and restore whatever was bound here)
+    egwGAMXBoundPayload(&pDataPrev, &pLengthPrev);
+    egwGAMXBindPayload(job->pData, job->pLength);
+    
+    for(EGWuint orderIndex = begin; orderIndex < end; ++orderIndex) {
+        NSAutoreleasePool* arPool = [[NSAutoreleasePool alloc] init];
+        const xmlChar* entityXml = job->entities[job->eOrder[orderIndex]].eXml;
+        xmlTextReaderPtr xmlReadHandle = NULL;
+        xmlChar* nodeName = NULL;
+        EGWint retVal = 0;
+        
+        if((xmlReadHandle = xmlReaderForMemory((const char*)entityXml, xmlStrlen(entityXml), (const char*)job->resourceFile, NULL, 0))) {
+            while((retVal = xmlTextReaderRead(xmlReadHandle)) == 1 && xmlTextReaderNodeType(xmlReadHandle) != 1);
+            
+            if(retVal == 1 && (nodeName = xmlTextReaderName(xmlReadHandle))) {
+                id<NSObject> entity = egwGAMXParseEntity(job->resourceFile, xmlReadHandle, &retVal, &loadCounter, nodeName);
+                [entity release]; entity = nil; // Always returns retained, but no more need for it
+            }
+            
+            if(retVal < 0 || retVal > 1)
+                NSLog(@"egwAssetManager: egwManifestLoadRange: Failure parsing in manifest input file '%s'. XML2Error: %d.", job->resourceFile, retVal);
+            
+            if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
+            xmlFreeTextReader(xmlReadHandle); xmlReadHandle = NULL;
+        } else NSLog(@"egwAssetManager: egwManifestLoadRange: Failure opening indexed asset section of manifest input file '%s'.", job->resourceFile);
+        
+        [arPool release]; arPool = nil;
+    }
+    
+    egwGAMXBindPayload(pDataPrev, pLengthPrev);
+    
+    pthread_mutex_lock(&job->cLock);
+    job->loadCounter += loadCounter;
+    pthread_mutex_unlock(&job->cLock);
+}
+
 - (EGWuint)loadManifest_GAMX:(const EGWchar*)resourceFile {
     xmlTextReaderPtr xmlReadHandle = NULL;
-    EGWint retVal, nodeType;
-    xmlChar *nodeName = NULL;
     EGWuint loadCounter = 0;
-    id<NSObject> entity = nil;
     
     if(!(xmlReadHandle = xmlNewTextReaderFilename((const char*)resourceFile))) {
         NSLog(@"egwAssetManager: loadManifest_GAMX: Failure opening manifest input file '%s'.", resourceFile);
-        goto LoadBreak;
+        return loadCounter;
+    }
+    
+    loadCounter = [self parseManifest_GAMX:resourceFile withReader:xmlReadHandle];
+    
+    xmlFreeTextReader(xmlReadHandle); xmlReadHandle = NULL;
+    return loadCounter;
+}
+
+- (EGWuint)parseManifestAssets_GAMX:(const EGWchar*)resourceFile withReader:(xmlTextReaderPtr)xmlReadHandle retVal:(EGWint*)retVal {
+    EGWint nodeType;
+    xmlChar* nodeName = NULL;
+    egwArray entities; memset((void*)&entities, 0, sizeof(egwArray));
+    NSMutableDictionary* definers = nil;
+    EGWuint* waveEnds = NULL;
+    EGWuint waveCount = 0;
+    egwManifestLoadJob job; memset((void*)&job, 0, sizeof(egwManifestLoadJob));
+    
+    if(!egwArrayInit(&entities, NULL, sizeof(egwManifestEntity), 32, EGW_ARRAY_FLG_DFLT) || !(definers = [[NSMutableDictionary alloc] init]) ||
+       pthread_mutex_init(&job.cLock, NULL)) {
+        NSLog(@"egwAssetManager: parseManifestAssets_GAMX:withReader:retVal: Failure parsing in manifest input file '%s'. Failure allocating entity index.", resourceFile);
+        egwArrayFree(&entities);
+        [definers release]; definers = nil;
+        egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"assets");
+        return 0;
+    }
+    
+    // Index pass: copy out each top-level entity section, placing it one wave after the latest earlier entity defining an id it references
+    while((*retVal = xmlTextReaderRead(xmlReadHandle)) == 1) {
+        nodeType = xmlTextReaderNodeType(xmlReadHandle); nodeName = (nodeType == 1 || nodeType == 15 ? xmlTextReaderName(xmlReadHandle) : NULL);
+        
+        if(nodeType == 14) continue;
+        else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"assets") == 0) break;
+        else if(nodeType == 1 && nodeName) {
+            egwManifestEntity entity;
+            entity.eWave = 0;
+            
+            if((entity.eXml = xmlTextReaderReadOuterXml(xmlReadHandle))) {
+                NSNumber* entityIndex = [[NSNumber alloc] initWithUnsignedInt:(unsigned int)entities.eCount];
+                
+                // Refs wait on their definer, redefined ids wait on the first definer (so it's skipped as already loaded, same as serial)
+                for(EGWint attrIndex = 0; attrIndex < 2; ++attrIndex) {
+                    const xmlChar* scan = entity.eXml;
+                    xmlChar* attrValue = NULL;
+                    
+                    while(scan && (attrValue = egwManifestNextAttribute(&scan, (attrIndex == 0 ? (const EGWchar*)"ref" : (const EGWchar*)"id")))) {
+                        NSString* attrIdent = [[NSString alloc] initWithUTF8String:(const char*)attrValue];
+                        NSNumber* definer = (attrIdent ? (NSNumber*)[definers objectForKey:attrIdent] : nil);
+                        
+                        if(definer && [definer unsignedIntValue] != (unsigned int)entities.eCount)
+                            entity.eWave = egwMax2ui(entity.eWave, ((egwManifestEntity*)entities.rData)[[definer unsignedIntValue]].eWave + 1);
+                        else if(attrIndex == 1 && attrIdent)
+                            [definers setObject:entityIndex forKey:attrIdent];
+                        
+                        [attrIdent release]; attrIdent = nil;
+                        xmlFree(attrValue); attrValue = NULL;
+                    }
+                }
+                
+                [entityIndex release]; entityIndex = nil;
+                
+                if(egwArrayAddTail(&entities, (const EGWbyte*)&entity))
+                    waveCount = egwMax2ui(waveCount, entity.eWave + 1);
+                else {
+                    NSLog(@"egwAssetManager: parseManifestAssets_GAMX:withReader:retVal: Failure parsing in manifest input file '%s'. Failure indexing asset node '%s'.", resourceFile, nodeName);
+                    xmlFree(entity.eXml); entity.eXml = NULL;
+                }
+            } else NSLog(@"egwAssetManager: parseManifestAssets_GAMX:withReader:retVal: Failure parsing in manifest input file '%s'. Failure reading asset node '%s'.", resourceFile, nodeName);
+            
+            egwGAMXParseSkip(xmlReadHandle, retVal, nodeName);
+        }
+        
+        if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
+        if(*retVal != 1) break; // retVal can be modified in sub-routines
     }
     
+    if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
+    [definers release]; definers = nil;
+    
+    if(entities.eCount && (job.eOrder = (EGWuint*)malloc(sizeof(EGWuint) * (size_t)entities.eCount)) && (waveEnds = (EGWuint*)calloc((size_t)waveCount + 1, sizeof(EGWuint)))) {
+        job.resourceFile = resourceFile;
+        job.entities = (egwManifestEntity*)entities.rData;
+        egwGAMXBoundPayload(&job.pData, &job.pLength);
+        
+        if(entities.eCount < EGW_ASSTMNGR_PMLMINENTITIES) { // Not worth farming out, load in document order
+            for(EGWuint entityIndex = 0; entityIndex < entities.eCount; ++entityIndex)
+                job.eOrder[entityIndex] = entityIndex;
+            egwManifestLoadRange((void*)&job, 0, entities.eCount);
+        } else {
+            // Counting sort by wave, afterwords waveEnds[w] is the end (and waveEnds[w-1] the start) of wave w in eOrder
+            for(EGWuint entityIndex = 0; entityIndex < entities.eCount; ++entityIndex)
+                ++waveEnds[job.entities[entityIndex].eWave + 1];
+            for(EGWuint waveIndex = 1; waveIndex < waveCount; ++waveIndex)
+                waveEnds[waveIndex] += waveEnds[waveIndex - 1];
+            for(EGWuint entityIndex = 0; entityIndex < entities.eCount; ++entityIndex)
+                job.eOrder[waveEnds[job.entities[entityIndex].eWave]++] = entityIndex;
+            
+            // Each wave joins before the next one starts, so anything a wave references is already published in the assets table
+            for(EGWuint waveIndex = 0; waveIndex < waveCount; ++waveIndex) {
+                EGWuint waveBegin = (waveIndex ? waveEnds[waveIndex - 1] : 0);
+                
+                if(egwSITaskMngr)
+                    [egwSITaskMngr parallelForRangeFrom:waveBegin to:waveEnds[waveIndex] withGrain:1 usingRoutine:&egwManifestLoadRange withContext:(void*)&job];
+                else egwManifestLoadRange((void*)&job, waveBegin, waveEnds[waveIndex]);
+            }
+        }
+    } else if(entities.eCount)
+        NSLog(@"egwAssetManager: parseManifestAssets_GAMX:withReader:retVal: Failure parsing in manifest input file '%s'. Failure allocating load order.", resourceFile);
+    
+    for(EGWuint entityIndex = 0; entityIndex < entities.eCount; ++entityIndex)
+        if(((egwManifestEntity*)entities.rData)[entityIndex].eXml) { xmlFree(((egwManifestEntity*)entities.rData)[entityIndex].eXml); ((egwManifestEntity*)entities.rData)[entityIndex].eXml = NULL; }
+    egwArrayFree(&entities);
+    if(job.eOrder) { free((void*)job.eOrder); job.eOrder = NULL; }
+    if(waveEnds) { free((void*)waveEnds); waveEnds = NULL; }
+    pthread_mutex_destroy(&job.cLock);
+    
+    return job.loadCounter;
+}
+
+- (EGWuint)parseManifest_GAMX:(const EGWchar*)resourceFile withReader:(xmlTextReaderPtr)xmlReadHandle {
+    EGWint retVal, nodeType;
+    xmlChar *nodeName = NULL;
+    EGWuint loadCounter = 0;
+    id<NSObject> entity = nil;
+    
     while((retVal = xmlTextReaderRead(xmlReadHandle)) == 1) {
         nodeType = xmlTextReaderNodeType(xmlReadHandle); nodeName = (nodeType == 1 || nodeType == 15 ? xmlTextReaderName(xmlReadHandle) : NULL);
         
@@ -2218,7 +2506,9 @@ id<NSObject> egwGAMXParseEntity(const EGWchar* resourceFile, xmlTextReaderPtr xm
                 else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"assets") == 0 && !xmlTextReaderIsEmptyElement(xmlReadHandle)) {
                     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
                     
-                    while((retVal = xmlTextReaderRead(xmlReadHandle)) == 1) {
+                    if(_pmLoad)
+                        loadCounter += [self parseManifestAssets_GAMX:resourceFile withReader:xmlReadHandle retVal:&retVal];
+                    else while((retVal = xmlTextReaderRead(xmlReadHandle)) == 1) {
                         nodeType = xmlTextReaderNodeType(xmlReadHandle); nodeName = (nodeType == 1 || nodeType == 15 ? xmlTextReaderName(xmlReadHandle) : NULL);
                         
                         if(nodeType == 14) continue;
@@ -2245,13 +2535,12 @@ id<NSObject> egwGAMXParseEntity(const EGWchar* resourceFile, xmlTextReaderPtr xm
     
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
     if(retVal < 0 || retVal > 1) {
-        NSLog(@"egwAssetManager: loadManifest_GAMX: Failure parsing in manifest input file '%s'. XML2Error: %d.", resourceFile, retVal);
+        NSLog(@"egwAssetManager: parseManifest_GAMX:withReader: Failure parsing in manifest input file '%s'. XML2Error: %d.", resourceFile, retVal);
         goto LoadBreak;
     }
     
 LoadBreak:
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-    if(xmlReadHandle) { xmlFreeTextReader(xmlReadHandle); xmlReadHandle = NULL; }
     return loadCounter;
 }
 
@@ -37,6 +37,7 @@
 #define EGW_ENGINE_GFXAPI_OPENGLES11 0x0002 ///< Use EAGL OpenGLES 1.1 for graphics rendering.
 #define EGW_ENGINE_GFXAPI_OPENGL2    0x0003 ///< Use NS OpenGL 2.0 for graphics rendering.
 #define EGW_ENGINE_GFXAPI_DIRECTX    0x0004 ///< Use DirectX 9.0 (DirectDraw) for graphics rendering (NOT SUPPORTED).
+#define EGW_ENGINE_GFXAPI_NULL       0x0005 ///< Use headless null context for graphics rendering (no output, counts work for benchmarking).
 #define EGW_ENGINE_GFXAPI_INVALID    0x000F ///< Invalid graphics rendering API.
 #define EGW_ENGINE_PHYAPI_SOFTWARE   0x0010 ///< Use software for physical actuating.
 #define EGW_ENGINE_PHYAPI_AEGIAPHYSX 0x0020 ///< Use Ageia PhysX for physical actuating (NOT SUPPORTED).
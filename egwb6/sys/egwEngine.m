@@ -31,6 +31,7 @@
 #import "../sys/egwGfxContext.h"
 #import "../sys/egwGfxContextNSGL.h"
 #import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwPhyContext.h"
 #import "../sys/egwPhyContextSW.h"
 #import "../sys/egwSndContext.h"
@@ -220,6 +221,9 @@ static egwEngine* _singleton = nil;
         case EGW_ENGINE_GFXAPI_OPENGLES11: {
             context = [[egwGfxContextEAGLES alloc] initWithParams:params];
         } break;
+        case EGW_ENGINE_GFXAPI_NULL: {
+            context = [[egwGfxContextNull alloc] initWithParams:params];
+        } break;
     }
     
     if(!context) {
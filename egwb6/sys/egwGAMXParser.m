@@ -25,6 +25,7 @@
 /// GAMX Parser Implementation.
 
 #import <stdio.h>
+#import <pthread.h>
 #import <libxml/xmlreader.h>
 #import "egwAssetManager.h"
 #import "../sys/egwSystem.h"
@@ -155,6 +156,199 @@ void egwGAMXParseSkip(xmlTextReaderPtr xmlReadHandle, EGWint* retVal, const xmlC
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
 }
 
+// !!!: *** Binary Payload Parsers ***
+
+// NOTE: Binary manifests (.gam) are GAMX text with large numeric text nodes replaced by "@gam:<format>:<offset>:<count>"
+// payload references. The payload is bound per loading thread, so the wrappers below read either straight out of the
+// memory mapped payload or fall back to the regular text parse for .gamx manifests. -jw
+
+typedef struct {
+    const EGWbyte* data;        // Payload section start (weak)
+    EGWuint32 length;           // Payload section length
+} egwGAMPayload;
+
+static pthread_key_t _gamPayloadKey;
+static pthread_once_t _gamPayloadOnce = PTHREAD_ONCE_INIT;
+
+static void egwGAMPayloadKeyCreate(void) {
+    pthread_key_create(&_gamPayloadKey, NULL);
+}
+
+// Binds payload section for binary manifest parsing on the calling thread, NULL data unbinds
+void egwGAMXBindPayload(const EGWbyte* data, EGWuint32 length) {
+    egwGAMPayload* payload;
+    
+    pthread_once(&_gamPayloadOnce, egwGAMPayloadKeyCreate);
+    
+    if((payload = (egwGAMPayload*)pthread_getspecific(_gamPayloadKey))) {
+        pthread_setspecific(_gamPayloadKey, NULL);
+        free((void*)payload); payload = NULL;
+    }
+    
+    if(data && (payload = (egwGAMPayload*)malloc(sizeof(egwGAMPayload)))) {
+        payload->data = data;
+        payload->length = length;
+        pthread_setspecific(_gamPayloadKey, (const void*)payload);
+    }
+}
+
+// Retrieves payload section bound on the calling thread (for handing off to other loading threads), NULL data if unbound
+void egwGAMXBoundPayload(const EGWbyte** data_out, EGWuint32* length_out) {
+    const egwGAMPayload* payload;
+    
+    pthread_once(&_gamPayloadOnce, egwGAMPayloadKeyCreate);
+    
+    if((payload = (const egwGAMPayload*)pthread_getspecific(_gamPayloadKey))) {
+        *data_out = payload->data;
+        *length_out = payload->length;
+    } else {
+        *data_out = NULL;
+        *length_out = 0;
+    }
+}
+
+// Reads payload reference string_in into array_out converting to dstFormat ('f','d','t','b','B','s','S','i','I','u'), returns EGW_UINT_MAX if string_in is not a payload reference
+EGWuint egwGAMXParsePayload(const EGWchar* string_in, void* array_out, EGWintptr strideB_out, EGWuint count, EGWchar dstFormat) {
+    const egwGAMPayload* payload;
+    const EGWchar* reference;
+    const EGWbyte* data;
+    EGWchar srcFormat = '\0';
+    EGWuint32 offset = 0, pCount = 0;
+    size_t srcSize, dstSize;
+    
+    while(*string_in != '\0' && *string_in <= ' ') ++string_in;
+    if(strncmp((const char*)string_in, EGW_GAM_PAYLOADREF, strlen(EGW_GAM_PAYLOADREF)) != 0)
+        return EGW_UINT_MAX;
+    
+    // Reference: <format>:<offset>:<count>
+    reference = string_in; string_in += strlen(EGW_GAM_PAYLOADREF);
+    if(*string_in != '\0' && *(string_in+1) == ':') {
+        EGWchar* next = NULL;
+        
+        srcFormat = *string_in;
+        offset = (EGWuint32)strtoul((const char*)(string_in + 2), (char**)&next, 10);
+        if(next && *next == ':')
+            pCount = (EGWuint32)strtoul((const char*)(next + 1), NULL, 10);
+        else srcFormat = '\0';
+    }
+    
+    switch(srcFormat) {
+        case EGW_GAM_PAYLOADFRMT_FLOAT32: srcSize = sizeof(EGWsingle); break;
+        case EGW_GAM_PAYLOADFRMT_FLOAT64: srcSize = sizeof(EGWdouble); break;
+        case EGW_GAM_PAYLOADFRMT_INT32: srcSize = sizeof(EGWint32); break;
+        default: srcSize = 0; break;
+    }
+    switch(dstFormat) {
+        case 'f': dstSize = sizeof(EGWsingle); break;
+        case 'd': dstSize = sizeof(EGWdouble); break;
+        case 't': dstSize = sizeof(EGWtriple); break;
+        case 'b': case 'B': dstSize = sizeof(EGWint8); break;
+        case 's': case 'S': dstSize = sizeof(EGWint16); break;
+        case 'i': case 'I': dstSize = sizeof(EGWint32); break;
+        case 'u': dstSize = sizeof(EGWuint); break;
+        default: dstSize = 0; break;
+    }
+    
+    pthread_once(&_gamPayloadOnce, egwGAMPayloadKeyCreate);
+    
+    if(!(payload = (const egwGAMPayload*)pthread_getspecific(_gamPayloadKey)) || !srcSize || !dstSize ||
+       (offset % (EGWuint32)srcSize) != 0 || offset > payload->length ||
+       (EGWuint64)pCount * (EGWuint64)srcSize > (EGWuint64)(payload->length - offset)) {
+        NSLog(@"egwGAMXParsePayload: Failure reading payload reference '%.32s': Malformed, out of range, or no payload bound.", reference);
+        return 0;
+    }
+    
+    if(pCount < count) count = pCount;
+    data = payload->data + offset;
+    
+    // Same layout, direct copy out of mapped payload
+    if(!strideB_out && srcSize == dstSize &&
+       ((srcFormat == EGW_GAM_PAYLOADFRMT_FLOAT32 && dstFormat == 'f') ||
+        (srcFormat == EGW_GAM_PAYLOADFRMT_FLOAT64 && dstFormat == 'd') ||
+        (srcFormat == EGW_GAM_PAYLOADFRMT_INT32 && (dstFormat == 'i' || dstFormat == 'I' || dstFormat == 'u')))) {
+        memcpy(array_out, (const void*)data, (size_t)count * dstSize);
+        return count;
+    }
+    
+    // Otherwise convert as the text parsers would (integers truncate)
+    for(EGWuint index = 0; index < count; ++index) {
+        EGWdouble value;
+        
+        switch(srcFormat) {
+            case EGW_GAM_PAYLOADFRMT_FLOAT32: value = (EGWdouble)((const EGWsingle*)data)[index]; break;
+            case EGW_GAM_PAYLOADFRMT_FLOAT64: value = ((const EGWdouble*)data)[index]; break;
+            default: value = (EGWdouble)((const EGWint32*)data)[index]; break;
+        }
+        
+        switch(dstFormat) {
+            case 'f': *(EGWsingle*)array_out = (EGWsingle)value; break;
+            case 'd': *(EGWdouble*)array_out = value; break;
+            case 't': *(EGWtriple*)array_out = (EGWtriple)value; break;
+            case 'b': *(EGWint8*)array_out = (EGWint8)(EGWint32)value; break;
+            case 'B': *(EGWuint8*)array_out = (EGWuint8)(EGWint32)value; break;
+            case 's': *(EGWint16*)array_out = (EGWint16)(EGWint32)value; break;
+            case 'S': *(EGWuint16*)array_out = (EGWuint16)(EGWint32)value; break;
+            case 'i': *(EGWint32*)array_out = (EGWint32)value; break;
+            case 'I': *(EGWuint32*)array_out = (EGWuint32)(EGWint64)value; break;
+            case 'u': *(EGWuint*)array_out = (EGWuint)(EGWint64)value; break;
+        }
+        
+        array_out = (void*)((EGWintptr)array_out + (EGWintptr)dstSize + strideB_out);
+    }
+    
+    return count;
+}
+
+EGWuint egwGAMXParseStringi8cv(const EGWchar* string_in, EGWint8* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'b');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringi8cv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringi16cv(const EGWchar* string_in, EGWint16* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 's');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringi16cv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringi32cv(const EGWchar* string_in, EGWint32* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'i');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringi32cv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringui8cv(const EGWchar* string_in, EGWuint8* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'B');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringui8cv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringui16cv(const EGWchar* string_in, EGWuint16* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'S');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringui16cv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringui32cv(const EGWchar* string_in, EGWuint32* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'I');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringui32cv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringuicv(const EGWchar* string_in, EGWuint* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'u');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringuicv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringfcv(const EGWchar* string_in, EGWsingle* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'f');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringfcv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringdcv(const EGWchar* string_in, EGWdouble* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 'd');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringdcv(string_in, array_out, strideB_out, count));
+}
+
+EGWuint egwGAMXParseStringtcv(const EGWchar* string_in, EGWtriple* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint processed = egwGAMXParsePayload(string_in, (void*)array_out, strideB_out, count, 't');
+    return (processed != EGW_UINT_MAX ? processed : egwParseStringtcv(string_in, array_out, strideB_out, count));
+}
+
 // !!!: *** Audio Parsers ***
 
 // Parses <format> sections inside of <audio> sections
@@ -270,7 +464,7 @@ void egwGAMXParseAudio_PCMA(const EGWchar* resourceFile, const xmlChar* entityID
                             EGWuint nodesProcessed = 0;
                             
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed += egwParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)audio->data, 0, sCount);
+                                nodesProcessed += egwGAMXParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)audio->data, 0, sCount);
                             }
                             
                             if(nodesProcessed != (EGWuint)audio->count) { // Pad rest with zeros if short
@@ -283,7 +477,7 @@ void egwGAMXParseAudio_PCMA(const EGWchar* resourceFile, const xmlChar* entityID
                             EGWuint nodesProcessed = 0;
                             
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed += egwParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)audio->data, 0, sCount * 2);
+                                nodesProcessed += egwGAMXParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)audio->data, 0, sCount * 2);
                             }
                             
                             if(nodesProcessed != (EGWuint)audio->count * 2) { // Pad rest with zeros if short
@@ -299,7 +493,7 @@ void egwGAMXParseAudio_PCMA(const EGWchar* resourceFile, const xmlChar* entityID
                 egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"samples");
             } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"rate") == 0) {
                 if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                    egwParseStringui32cv((EGWchar*)nodeValue, (EGWuint32*)&audio->rate, 0, 1);
+                    egwGAMXParseStringui32cv((EGWchar*)nodeValue, (EGWuint32*)&audio->rate, 0, 1);
                 }
                 egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"rate");
             } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"transforms") == 0) {
@@ -629,7 +823,7 @@ void egwGAMXParseGlyphmap_External(const EGWchar* resourceFile, const xmlChar* e
                 egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"url");
             } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"size") == 0) {
                 if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                    egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityFSize, 0, 1);
+                    egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityFSize, 0, 1);
                     entityFSize = egwClampPosf(entityFSize);
                 }
                 egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"size");
@@ -676,7 +870,7 @@ void egwGAMXParseGlyphmap_External(const EGWchar* resourceFile, const xmlChar* e
 void egwGAMXParseGeometry_STVA(const EGWchar* resourceFile, const xmlChar* entityID, xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwSTVAMeshf* geometry) {
     EGWint nodeType;
     xmlChar* nodeName = NULL;
-    xmlChar* nodeValue = NULL;
+    const xmlChar* nodeValue = NULL; // Note: reader owned, valid until next read
     
     if(*retVal != 1) return;
     
@@ -695,10 +889,10 @@ void egwGAMXParseGeometry_STVA(const EGWchar* resourceFile, const xmlChar* entit
                 if(geometry->vCoords) { free((void*)geometry->vCoords); geometry->vCoords = NULL; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&vCount, 0, 1) == 1) {
-                    vCount = egwClampui(vCount, 1, EGW_UINT16_MAX); if(geometry->vCount == 0 || vCount < geometry->vCount) geometry->vCount = vCount;
+                    vCount = egwClampui(vCount, 1, EGW_UINT32_MAX); if(geometry->vCount == 0 || vCount < geometry->vCount) geometry->vCount = vCount;
                     if((geometry->vCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)geometry->vCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->vCoords), 0, geometry->vCount * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->vCoords), 0, geometry->vCount * 3);
                             if(nodesProcessed != geometry->vCount * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSTVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total vertex values read %d does not match %d vertex values reported.", resourceFile, entityID, nodesProcessed, geometry->vCount * 3);
                                 memset((void*)&(((EGWsingle*)(geometry->vCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->vCount * 3) - nodesProcessed));
@@ -717,10 +911,10 @@ void egwGAMXParseGeometry_STVA(const EGWchar* resourceFile, const xmlChar* entit
                 if(geometry->nCoords) { free((void*)geometry->nCoords); geometry->nCoords = NULL; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&nCount, 0, 1) == 1) {
-                    nCount = egwClampui(nCount, 1, EGW_UINT16_MAX); if(geometry->vCount == 0 || nCount < geometry->vCount) geometry->vCount = nCount;
+                    nCount = egwClampui(nCount, 1, EGW_UINT32_MAX); if(geometry->vCount == 0 || nCount < geometry->vCount) geometry->vCount = nCount;
                     if((geometry->nCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)geometry->vCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->nCoords), 0, geometry->vCount * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->nCoords), 0, geometry->vCount * 3);
                             if(nodesProcessed != geometry->vCount * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSTVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total normal values read %d does not match %d normal values reported.", resourceFile, entityID, nodesProcessed, geometry->vCount * 3);
                                 memset((void*)&(((EGWsingle*)(geometry->nCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->vCount * 3) - nodesProcessed));
@@ -739,10 +933,10 @@ void egwGAMXParseGeometry_STVA(const EGWchar* resourceFile, const xmlChar* entit
                 if(geometry->tCoords) { free((void*)geometry->tCoords); geometry->tCoords = NULL; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&tCount, 0, 1) == 1) {
-                    tCount = egwClampui(tCount, 1, EGW_UINT16_MAX); if(geometry->vCount == 0 || tCount < geometry->vCount) geometry->vCount = tCount;
+                    tCount = egwClampui(tCount, 1, EGW_UINT32_MAX); if(geometry->vCount == 0 || tCount < geometry->vCount) geometry->vCount = tCount;
                     if((geometry->tCoords = (egwVector2f*)malloc(sizeof(egwVector2f) * (size_t)geometry->vCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->tCoords), 0, geometry->vCount * 2);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->tCoords), 0, geometry->vCount * 2);
                             if(nodesProcessed != geometry->vCount * 2) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSTVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total texture UV values read %d does not match %d texture UV values reported.", resourceFile, entityID, nodesProcessed, geometry->vCount * 2);
                                 memset((void*)&(((EGWsingle*)(geometry->tCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->vCount * 2) - nodesProcessed));
@@ -759,7 +953,7 @@ void egwGAMXParseGeometry_STVA(const EGWchar* resourceFile, const xmlChar* entit
             }
             
             if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-            if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+            nodeValue = NULL;
             if(*retVal != 1) break;
         }
         
@@ -767,14 +961,14 @@ void egwGAMXParseGeometry_STVA(const EGWchar* resourceFile, const xmlChar* entit
     }
     
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-    if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+    nodeValue = NULL;
 }
 
 // Parses <geometry source="internal" type="joint_indexed_vertex_array"> sections
 void egwGAMXParseGeometry_SJITVA(const EGWchar* resourceFile, const xmlChar* entityID, xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwSJITVAMeshf* geometry) {
     EGWint nodeType;
     xmlChar* nodeName = NULL;
-    xmlChar* nodeValue = NULL;
+    const xmlChar* nodeValue = NULL; // Note: reader owned, valid until next read
     
     if(*retVal != 1) return;
     
@@ -793,10 +987,10 @@ void egwGAMXParseGeometry_SJITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->vCoords) { free((void*)geometry->vCoords); geometry->vCoords = NULL; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&vCount, 0, 1) == 1) {
-                    vCount = egwClampui(vCount, 1, EGW_UINT16_MAX); if(geometry->vCount == 0 || vCount < geometry->vCount) geometry->vCount = vCount;
+                    vCount = egwClampui(vCount, 1, EGW_UINT32_MAX); if(geometry->vCount == 0 || vCount < geometry->vCount) geometry->vCount = vCount;
                     if((geometry->vCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)geometry->vCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->vCoords), 0, geometry->vCount * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->vCoords), 0, geometry->vCount * 3);
                             if(nodesProcessed != geometry->vCount * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total vertex values read %d does not match %d vertex values reported.", resourceFile, entityID, nodesProcessed, geometry->vCount * 3);
                                 memset((void*)&(((EGWsingle*)(geometry->vCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->vCount * 3) - nodesProcessed));
@@ -815,10 +1009,10 @@ void egwGAMXParseGeometry_SJITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->nCoords) { free((void*)geometry->nCoords); geometry->nCoords = NULL; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&nCount, 0, 1) == 1) {
-                    nCount = egwClampui(nCount, 1, EGW_UINT16_MAX); if(geometry->vCount == 0 || nCount < geometry->vCount) geometry->vCount = nCount;
+                    nCount = egwClampui(nCount, 1, EGW_UINT32_MAX); if(geometry->vCount == 0 || nCount < geometry->vCount) geometry->vCount = nCount;
                     if((geometry->nCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)geometry->vCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->nCoords), 0, geometry->vCount * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->nCoords), 0, geometry->vCount * 3);
                             if(nodesProcessed != geometry->vCount * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total normal values read %d does not match %d normal values reported.", resourceFile, entityID, nodesProcessed, geometry->vCount * 3);
                                 memset((void*)&(((EGWsingle*)(geometry->nCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->vCount * 3) - nodesProcessed));
@@ -837,10 +1031,10 @@ void egwGAMXParseGeometry_SJITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->tCoords) { free((void*)geometry->tCoords); geometry->tCoords = NULL; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&tCount, 0, 1) == 1) {
-                    tCount = egwClampui(tCount, 1, EGW_UINT16_MAX); if(geometry->vCount == 0 || tCount < geometry->vCount) geometry->vCount = tCount;
+                    tCount = egwClampui(tCount, 1, EGW_UINT32_MAX); if(geometry->vCount == 0 || tCount < geometry->vCount) geometry->vCount = tCount;
                     if((geometry->tCoords = (egwVector2f*)malloc(sizeof(egwVector2f) * (size_t)geometry->vCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->tCoords), 0, geometry->vCount * 2);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->tCoords), 0, geometry->vCount * 2);
                             if(nodesProcessed != geometry->vCount * 2) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total texture UV values read %d does not match %d texture UV values reported.", resourceFile, entityID, nodesProcessed, geometry->vCount * 2);
                                 memset((void*)&(((EGWsingle*)(geometry->tCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->vCount * 2) - nodesProcessed));
@@ -859,19 +1053,19 @@ void egwGAMXParseGeometry_SJITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->fIndicies) { free((void*)geometry->fIndicies); geometry->fIndicies = NULL; geometry->fCount = 0; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&fCount, 0, 1) == 1) {
-                    geometry->fCount = egwClampui(fCount, 1, EGW_UINT16_MAX);
-                    if((geometry->fIndicies = (egwJITFace*)malloc(sizeof(egwJITFace) * (size_t)geometry->fCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)(geometry->fIndicies), 0, geometry->fCount * 3);
+                    geometry->fCount = egwClampui(fCount, 1, EGW_UINT32_MAX / 3);
+                    if((geometry->fIndicies32 = (egwJITFace32*)malloc(sizeof(egwJITFace32) * (size_t)geometry->fCount))) { // read wide, narrowed after vertex count is known
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringui32cv((const EGWchar*)nodeValue, (EGWuint32*)(geometry->fIndicies32), 0, geometry->fCount * 3);
                             if(nodesProcessed != geometry->fCount * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total face values read %d does not match %d face values reported. Filled remaining buffer with zeros.", resourceFile, entityID, nodesProcessed, geometry->fCount * 3);
-                                memset((void*)&(((EGWsingle*)(geometry->fIndicies))[nodesProcessed]), 0, sizeof(EGWuint16) * ((geometry->fCount * 3) - nodesProcessed));
+                                memset((void*)&(((EGWuint32*)(geometry->fIndicies32))[nodesProcessed]), 0, sizeof(EGWuint32) * ((geometry->fCount * 3) - nodesProcessed));
                             }
                         } else {
                             NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Malformed faces node.", resourceFile, entityID);
                             if(geometry->fIndicies) { free((void*)geometry->fIndicies); geometry->fIndicies = NULL; geometry->fCount = 0; }
                         }
-                    } else NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Failure allocating %d bytes for face indicies.", resourceFile, entityID, ((EGWuint)sizeof(egwJITFace) * geometry->fCount));
+                    } else NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Failure allocating %d bytes for face indicies.", resourceFile, entityID, ((EGWuint)sizeof(egwJITFace32) * geometry->fCount));
                 } else NSLog(@"egwAssetManager: egwGAMXParseSJITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Face indicies count not specified.", resourceFile, entityID);
                 
                 if(entityCount) { xmlFree(entityCount); entityCount = NULL; }
@@ -879,22 +1073,33 @@ void egwGAMXParseGeometry_SJITVA(const EGWchar* resourceFile, const xmlChar* ent
             }
             
             if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-            if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+            nodeValue = NULL;
             if(*retVal != 1) break;
         }
         
+        if(geometry->fIndicies && !egwMeshIsWideIndexed(geometry->vCount)) { // Narrow face indicies into compact storage
+            EGWuint index, count = geometry->fCount * 3;
+            egwJITFace* fIndicies;
+            
+            for(index = 0; index < count; ++index)
+                ((EGWuint16*)(geometry->fIndicies))[index] = (EGWuint16)(((EGWuint32*)(geometry->fIndicies32))[index]);
+            
+            if((fIndicies = (egwJITFace*)realloc((void*)geometry->fIndicies, sizeof(egwJITFace) * (size_t)geometry->fCount)))
+                geometry->fIndicies = fIndicies;
+        }
+        
         egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"geometry");
     }
     
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-    if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+    nodeValue = NULL;
 }
 
 // Parses <geometry source="internal" type="disjoint_indexed_vertex_array"> sections
 void egwGAMXParseGeometry_SDITVA(const EGWchar* resourceFile, const xmlChar* entityID, xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwSDITVAMeshf* geometry) {
     EGWint nodeType;
     xmlChar* nodeName = NULL;
-    xmlChar* nodeValue = NULL;
+    const xmlChar* nodeValue = NULL; // Note: reader owned, valid until next read
     
     if(*retVal != 1) return;
     
@@ -913,10 +1118,10 @@ void egwGAMXParseGeometry_SDITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->vCoords) { free((void*)geometry->vCoords); geometry->vCoords = NULL; geometry->vCount = 0; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&vCount, 0, 1) == 1) {
-                    vCount = egwClampui(vCount, 1, EGW_UINT16_MAX); if(geometry->vCount == 0 || vCount < geometry->vCount) geometry->vCount = vCount;
+                    vCount = egwClampui(vCount, 1, EGW_UINT32_MAX); if(geometry->vCount == 0 || vCount < geometry->vCount) geometry->vCount = vCount;
                     if((geometry->vCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)geometry->vCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->vCoords), 0, geometry->vCount * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->vCoords), 0, geometry->vCount * 3);
                             if(nodesProcessed != geometry->vCount * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total vertex values read %d does not match %d vertex values reported.", resourceFile, entityID, nodesProcessed, geometry->vCount * 3);
                                 memset((void*)&(((EGWsingle*)(geometry->vCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->vCount * 3) - nodesProcessed));
@@ -935,10 +1140,10 @@ void egwGAMXParseGeometry_SDITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->nCoords) { free((void*)geometry->nCoords); geometry->nCoords = NULL; geometry->nCount = 0; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&nCount, 0, 1) == 1) {
-                    nCount = egwClampui(nCount, 1, EGW_UINT16_MAX); if(geometry->nCount == 0 || nCount < geometry->nCount) geometry->nCount = nCount;
+                    nCount = egwClampui(nCount, 1, EGW_UINT32_MAX); if(geometry->nCount == 0 || nCount < geometry->nCount) geometry->nCount = nCount;
                     if((geometry->nCoords = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)geometry->nCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->nCoords), 0, geometry->nCount * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->nCoords), 0, geometry->nCount * 3);
                             if(nodesProcessed != geometry->nCount * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total normal values read %d does not match %d normal values reported.", resourceFile, entityID, nodesProcessed, geometry->nCount * 3);
                                 memset((void*)&(((EGWsingle*)(geometry->nCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->nCount * 3) - nodesProcessed));
@@ -957,10 +1162,10 @@ void egwGAMXParseGeometry_SDITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->tCoords) { free((void*)geometry->tCoords); geometry->tCoords = NULL; geometry->tCount = 0; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&tCount, 0, 1) == 1) {
-                    tCount = egwClampui(tCount, 1, EGW_UINT16_MAX); if(geometry->tCount == 0 || tCount < geometry->tCount) geometry->tCount = tCount;
+                    tCount = egwClampui(tCount, 1, EGW_UINT32_MAX); if(geometry->tCount == 0 || tCount < geometry->tCount) geometry->tCount = tCount;
                     if((geometry->tCoords = (egwVector2f*)malloc(sizeof(egwVector2f) * (size_t)geometry->tCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(geometry->tCoords), 0, geometry->tCount * 2);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(geometry->tCoords), 0, geometry->tCount * 2);
                             if(nodesProcessed != geometry->tCount * 2) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total texture UV values read %d does not match %d texture UV values reported.", resourceFile, entityID, nodesProcessed, geometry->tCount * 2);
                                 memset((void*)&(((EGWsingle*)(geometry->tCoords))[nodesProcessed]), 0, sizeof(EGWsingle) * ((geometry->tCount * 2) - nodesProcessed));
@@ -979,33 +1184,33 @@ void egwGAMXParseGeometry_SDITVA(const EGWchar* resourceFile, const xmlChar* ent
                 if(geometry->fIndicies) { free((void*)geometry->fIndicies); geometry->fIndicies = NULL; geometry->fCount = 0; }
                 
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&fCount, 0, 1) == 1) {
-                    geometry->fCount = egwClampui(fCount, 1, EGW_UINT16_MAX);
-                    if((geometry->fIndicies = (egwDITFace*)malloc(sizeof(egwDITFace) * (size_t)geometry->fCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)(geometry->fIndicies), 0, geometry->fCount * 9);
+                    geometry->fCount = egwClampui(fCount, 1, EGW_UINT32_MAX / 9);
+                    if((geometry->fIndicies32 = (egwDITFace32*)malloc(sizeof(egwDITFace32) * (size_t)geometry->fCount))) { // read wide, narrowed after array counts are known
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringui32cv((const EGWchar*)nodeValue, (EGWuint32*)(geometry->fIndicies32), 0, geometry->fCount * 9);
                             if(nodesProcessed == geometry->fCount * 6 && geometry->tCount == 0) { // texcoord shuffle
-                                EGWuint16* nAdr = (EGWuint16*)((EGWuintptr)(geometry->fIndicies) + ((EGWuintptr)sizeof(EGWuint16) * (EGWuintptr)((geometry->fCount-1) * 9)));
-                                EGWuint16* oAdr = (EGWuint16*)((EGWuintptr)(geometry->fIndicies) + ((EGWuintptr)sizeof(EGWuint16) * (EGWuintptr)((geometry->fCount-1) * 6)));
+                                EGWuint32* nAdr = (EGWuint32*)((EGWuintptr)(geometry->fIndicies32) + ((EGWuintptr)sizeof(EGWuint32) * (EGWuintptr)((geometry->fCount-1) * 9)));
+                                EGWuint32* oAdr = (EGWuint32*)((EGWuintptr)(geometry->fIndicies32) + ((EGWuintptr)sizeof(EGWuint32) * (EGWuintptr)((geometry->fCount-1) * 6)));
                                 
                                 while((EGWuintptr)nAdr >= (EGWuintptr)oAdr) { // these will cross at fIndicies
                                     nAdr[0] = oAdr[0]; nAdr[3] = oAdr[2]; nAdr[6] = oAdr[4]; // vert indicies
                                     nAdr[1] = oAdr[1]; nAdr[4] = oAdr[3]; nAdr[7] = oAdr[5]; // normal indicies
                                     nAdr[2] = 0; nAdr[5] = 0; nAdr[8] = 0; // texture indicies
                                     
-                                    nAdr = (EGWuint16*)((EGWuintptr)nAdr - (EGWuintptr)(sizeof(EGWuint16) * 9));
-                                    oAdr = (EGWuint16*)((EGWuintptr)oAdr - (EGWuintptr)(sizeof(EGWuint16) * 6));
+                                    nAdr = (EGWuint32*)((EGWuintptr)nAdr - (EGWuintptr)(sizeof(EGWuint32) * 9));
+                                    oAdr = (EGWuint32*)((EGWuintptr)oAdr - (EGWuintptr)(sizeof(EGWuint32) * 6));
                                 }
                                 
                                 NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total face values read %d does not match %d face values reported. Reshuffled & dropped texture UV indicies to correct.", resourceFile, entityID, nodesProcessed, geometry->fCount * 9);
                             } else if(nodesProcessed != geometry->fCount * 9) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Warning parsing in manifest input file '%s', for asset '%s': Total face values read %d does not match %d face values reported. Filled remaining buffer with zeros.", resourceFile, entityID, nodesProcessed, geometry->fCount * 9);
-                                memset((void*)&(((EGWsingle*)(geometry->fIndicies))[nodesProcessed]), 0, sizeof(EGWuint16) * ((geometry->fCount * 9) - nodesProcessed));
+                                memset((void*)&(((EGWuint32*)(geometry->fIndicies32))[nodesProcessed]), 0, sizeof(EGWuint32) * ((geometry->fCount * 9) - nodesProcessed));
                             }
                         } else {
                             NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Malformed faces node.", resourceFile, entityID);
                             if(geometry->fIndicies) { free((void*)geometry->fIndicies); geometry->fIndicies = NULL; geometry->fCount = 0; }
                         }
-                    } else NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Failure allocating %d bytes for face indicies.", resourceFile, entityID, ((EGWuint)sizeof(egwDITFace) * geometry->fCount));
+                    } else NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Failure allocating %d bytes for face indicies.", resourceFile, entityID, ((EGWuint)sizeof(egwDITFace32) * geometry->fCount));
                 } else NSLog(@"egwAssetManager: egwGAMXParseSDITVAMesh: Failure parsing in manifest input file '%s', for asset '%s': Face indicies count not specified.", resourceFile, entityID);
                 
                 if(entityCount) { xmlFree(entityCount); entityCount = NULL; }
@@ -1013,15 +1218,26 @@ void egwGAMXParseGeometry_SDITVA(const EGWchar* resourceFile, const xmlChar* ent
             }
             
             if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-            if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+            nodeValue = NULL;
             if(*retVal != 1) break;
         }
         
+        if(geometry->fIndicies && !egwMeshIsWideIndexed(egwMax2ui(geometry->vCount, egwMax2ui(geometry->nCount, geometry->tCount)))) { // Narrow face indicies into compact storage
+            EGWuint index, count = geometry->fCount * 9;
+            egwDITFace* fIndicies;
+            
+            for(index = 0; index < count; ++index)
+                ((EGWuint16*)(geometry->fIndicies))[index] = (EGWuint16)(((EGWuint32*)(geometry->fIndicies32))[index]);
+            
+            if((fIndicies = (egwDITFace*)realloc((void*)geometry->fIndicies, sizeof(egwDITFace) * (size_t)geometry->fCount)))
+                geometry->fIndicies = fIndicies;
+        }
+        
         egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"geometry");
     }
     
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-    if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+    nodeValue = NULL;
 }
 
 // Parses <storage>/<base_storage> sections, pre cursor should be on <storage>/<base_storage>, post cursor on </storage>/<base_storage>, works with current values
@@ -1125,7 +1341,7 @@ void egwGAMXParseKeyFrames_Polation(const EGWchar* resourceFile, const xmlChar*
 void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entityID, xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwKeyFrame* frames) {
     EGWint nodeType;
     xmlChar* nodeName = NULL;
-    xmlChar* nodeValue = NULL;
+    const xmlChar* nodeValue = NULL; // Note: reader owned, valid until next read
     
     if(*retVal != 1) return;
     
@@ -1146,12 +1362,12 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&iCount, 0, 1) == 1) {
                     iCount = egwClampui(iCount, 1, EGW_UINT16_MAX); if(frames->fCount == 0 || iCount < frames->fCount) frames->fCount = iCount;
                     if((frames->tIndicies = (EGWtime*)malloc(sizeof(EGWtime) * (size_t)(frames->fCount)))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
                             EGWuint nodesProcessed = 0;
                             
-                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->tIndicies), 0, (EGWuint)(frames->fCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwParseStringdcv((EGWchar*)nodeValue, (EGWdouble*)(frames->tIndicies), 0, (EGWuint)(frames->fCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwParseStringtcv((EGWchar*)nodeValue, (EGWtriple*)(frames->tIndicies), 0, (EGWuint)(frames->fCount));
+                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->tIndicies), 0, (EGWuint)(frames->fCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwGAMXParseStringdcv((const EGWchar*)nodeValue, (EGWdouble*)(frames->tIndicies), 0, (EGWuint)(frames->fCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwGAMXParseStringtcv((const EGWchar*)nodeValue, (EGWtriple*)(frames->tIndicies), 0, (EGWuint)(frames->fCount));
                             
                             if(nodesProcessed != (EGWuint)(frames->fCount)) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Warning parsing in manifest input file '%s', for asset '%s': Total time indicies read %d does not match %d time indicies reported.", resourceFile, entityID, nodesProcessed, (EGWuint)(frames->fCount));
@@ -1186,8 +1402,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                     if(!entityFormat || strcasecmp((const char*)entityFormat, (const char*)"single") == 0) {
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_SINGLE; entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1197,8 +1413,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_INT32;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringi32cv((EGWchar*)nodeValue, (EGWint32*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringi32cv((const EGWchar*)nodeValue, (EGWint32*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1208,8 +1424,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_UINT32;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringui32cv((EGWchar*)nodeValue, (EGWuint32*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringui32cv((const EGWchar*)nodeValue, (EGWuint32*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1219,8 +1435,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_DOUBLE;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringdcv((EGWchar*)nodeValue, (EGWdouble*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringdcv((const EGWchar*)nodeValue, (EGWdouble*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1230,8 +1446,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_UINT16;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringui16cv((const EGWchar*)nodeValue, (EGWuint16*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1241,8 +1457,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_INT16;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringi16cv((const EGWchar*)nodeValue, (EGWint16*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1252,8 +1468,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_UINT8;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringui8cv((EGWchar*)nodeValue, (EGWuint8*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringui8cv((const EGWchar*)nodeValue, (EGWuint8*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1263,8 +1479,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_INT8;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringi8cv((EGWchar*)nodeValue, (EGWint8*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringi8cv((const EGWchar*)nodeValue, (EGWint8*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1274,8 +1490,8 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
                         frames->kcFormat = EGW_KEYCHANNEL_FRMT_TRIPLE;
                         entityPitch = (EGWuint)(frames->kcFormat & EGW_KEYCHANNEL_FRMT_EXBPC) * (EGWuint)(frames->kcCount) * (EGWuint)(frames->cCount);
                         if((frames->fKeys = (EGWbyte*)malloc((size_t)entityPitch * (size_t)(frames->fCount)))) {
-                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed = egwParseStringtcv((EGWchar*)nodeValue, (EGWtriple*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
+                            if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                                nodesProcessed = egwGAMXParseStringtcv((const EGWchar*)nodeValue, (EGWtriple*)(frames->fKeys), 0, ((EGWuint)(frames->fCount) * (EGWuint)(frames->cCount) * (EGWuint)(frames->kcCount)));
                             } else {
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_VA: Failure parsing in manifest input file '%s', for asset '%s': Malformed key values node.", resourceFile, entityID);
                                 if(frames->fKeys) { free((void*)frames->fKeys); frames->fKeys = NULL; frames->cCount = frames->kcCount = frames->kcFormat = 0; }
@@ -1299,7 +1515,7 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
             }
             
             if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-            if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+            nodeValue = NULL;
             if(*retVal != 1) break;
         }
         
@@ -1307,14 +1523,14 @@ void egwGAMXParseKeyFrames_VA(const EGWchar* resourceFile, const xmlChar* entity
     }
     
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-    if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+    nodeValue = NULL;
 }
 
 // Parses <keyframes source="internal" type="prs_array"> sections
 void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* entityID, xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwOrientKeyFrame4f* frames) {
     EGWint nodeType;
     xmlChar* nodeName = NULL;
-    xmlChar* nodeValue = NULL;
+    const xmlChar* nodeValue = NULL; // Note: reader owned, valid until next read
     
     if(*retVal != 1) return;
     
@@ -1335,12 +1551,12 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&iCount, 0, 1) == 1) {
                     iCount = egwClampui(iCount, 1, EGW_UINT16_MAX); if(frames->pfCount == 0 || iCount < frames->pfCount) frames->pfCount = iCount;
                     if((frames->ptIndicies = (EGWtime*)malloc(sizeof(EGWtime) * (size_t)(frames->pfCount)))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
                             EGWuint nodesProcessed = 0;
                             
-                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->ptIndicies), 0, (EGWuint)(frames->pfCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwParseStringdcv((EGWchar*)nodeValue, (EGWdouble*)(frames->ptIndicies), 0, (EGWuint)(frames->pfCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwParseStringtcv((EGWchar*)nodeValue, (EGWtriple*)(frames->ptIndicies), 0, (EGWuint)(frames->pfCount));
+                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->ptIndicies), 0, (EGWuint)(frames->pfCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwGAMXParseStringdcv((const EGWchar*)nodeValue, (EGWdouble*)(frames->ptIndicies), 0, (EGWuint)(frames->pfCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwGAMXParseStringtcv((const EGWchar*)nodeValue, (EGWtriple*)(frames->ptIndicies), 0, (EGWuint)(frames->pfCount));
                             
                             if(nodesProcessed != (EGWuint)(frames->pfCount)) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_PRSA: Warning parsing in manifest input file '%s', for asset '%s': Total position time indicies read %d does not match %d position time indicies reported.", resourceFile, entityID, nodesProcessed, (EGWuint)(frames->pfCount));
@@ -1362,8 +1578,8 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&iCount, 0, 1) == 1) {
                     iCount = egwClampui(iCount, 1, EGW_UINT16_MAX); if(frames->pfCount == 0 || iCount < frames->pfCount) frames->pfCount = iCount;
                     if((frames->pfKeys = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(frames->pfCount)))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->pfKeys), 0, (EGWuint)(frames->pfCount) * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->pfKeys), 0, (EGWuint)(frames->pfCount) * 3);
                             if(nodesProcessed != (EGWuint)(frames->pfCount) * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_PRSA: Warning parsing in manifest input file '%s', for asset '%s': Total position key values read %d does not match %d position key values reported.", resourceFile, entityID, nodesProcessed, ((EGWuint)(frames->pfCount) * 3));
                                 memset((void*)&(((EGWsingle*)(frames->pfKeys))[nodesProcessed]), 0, sizeof(EGWsingle) * (size_t)(((EGWuint)(frames->pfCount) * 3) - nodesProcessed));
@@ -1384,12 +1600,12 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&iCount, 0, 1) == 1) {
                     iCount = egwClampui(iCount, 1, EGW_UINT16_MAX); if(frames->rfCount == 0 || iCount < frames->rfCount) frames->rfCount = iCount;
                     if((frames->rtIndicies = (EGWtime*)malloc(sizeof(EGWtime) * (size_t)(frames->rfCount)))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
                             EGWuint nodesProcessed = 0;
                             
-                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->rtIndicies), 0, (EGWuint)(frames->rfCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwParseStringdcv((EGWchar*)nodeValue, (EGWdouble*)(frames->rtIndicies), 0, (EGWuint)(frames->rfCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwParseStringtcv((EGWchar*)nodeValue, (EGWtriple*)(frames->rtIndicies), 0, (EGWuint)(frames->rfCount));
+                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->rtIndicies), 0, (EGWuint)(frames->rfCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwGAMXParseStringdcv((const EGWchar*)nodeValue, (EGWdouble*)(frames->rtIndicies), 0, (EGWuint)(frames->rfCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwGAMXParseStringtcv((const EGWchar*)nodeValue, (EGWtriple*)(frames->rtIndicies), 0, (EGWuint)(frames->rfCount));
                             
                             if(nodesProcessed != (EGWuint)(frames->rfCount)) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_PRSA: Warning parsing in manifest input file '%s', for asset '%s': Total rotation time indicies read %d does not match %d rotation time indicies reported.", resourceFile, entityID, nodesProcessed, (EGWuint)(frames->rfCount));
@@ -1411,8 +1627,8 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&iCount, 0, 1) == 1) {
                     iCount = egwClampui(iCount, 1, EGW_UINT16_MAX); if(frames->rfCount == 0 || iCount < frames->rfCount) frames->rfCount = iCount;
                     if((frames->rfKeys = (egwQuaternion4f*)malloc(sizeof(egwQuaternion4f) * (size_t)(frames->rfCount)))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->rfKeys), 0, (EGWuint)(frames->rfCount) * 4);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->rfKeys), 0, (EGWuint)(frames->rfCount) * 4);
                             if(nodesProcessed != (EGWuint)(frames->rfCount) * 4) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_PRSA: Warning parsing in manifest input file '%s', for asset '%s': Total rotation key values read %d does not match %d rotation key values reported.", resourceFile, entityID, nodesProcessed, ((EGWuint)(frames->rfCount) * 4));
                                 memset((void*)&(((EGWsingle*)(frames->rfKeys))[nodesProcessed]), 0, sizeof(EGWsingle) * (size_t)(((EGWuint)(frames->rfCount) * 4) - nodesProcessed));
@@ -1433,12 +1649,12 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&iCount, 0, 1) == 1) {
                     iCount = egwClampui(iCount, 1, EGW_UINT16_MAX); if(frames->sfCount == 0 || iCount < frames->sfCount) frames->sfCount = iCount;
                     if((frames->stIndicies = (EGWtime*)malloc(sizeof(EGWtime) * (size_t)(frames->sfCount)))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
                             EGWuint nodesProcessed = 0;
                             
-                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->stIndicies), 0, (EGWuint)(frames->sfCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwParseStringdcv((EGWchar*)nodeValue, (EGWdouble*)(frames->stIndicies), 0, (EGWuint)(frames->sfCount));
-                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwParseStringtcv((EGWchar*)nodeValue, (EGWtriple*)(frames->stIndicies), 0, (EGWuint)(frames->sfCount));
+                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->stIndicies), 0, (EGWuint)(frames->sfCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwGAMXParseStringdcv((const EGWchar*)nodeValue, (EGWdouble*)(frames->stIndicies), 0, (EGWuint)(frames->sfCount));
+                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwGAMXParseStringtcv((const EGWchar*)nodeValue, (EGWtriple*)(frames->stIndicies), 0, (EGWuint)(frames->sfCount));
                             
                             if(nodesProcessed != (EGWuint)(frames->sfCount)) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_PRSA: Warning parsing in manifest input file '%s', for asset '%s': Total scale time indicies read %d does not match %d scale time indicies reported.", resourceFile, entityID, nodesProcessed, (EGWuint)(frames->sfCount));
@@ -1460,8 +1676,8 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
                 if(entityCount && egwParseStringuicv((EGWchar*)entityCount, (EGWuint*)&iCount, 0, 1) == 1) {
                     iCount = egwClampui(iCount, 1, EGW_UINT16_MAX); if(frames->sfCount == 0 || iCount < frames->sfCount) frames->sfCount = iCount;
                     if((frames->sfKeys = (egwVector3f*)malloc(sizeof(egwVector3f) * (size_t)(frames->sfCount)))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                            EGWuint nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->sfKeys), 0, (EGWuint)(frames->sfCount) * 3);
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
+                            EGWuint nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->sfKeys), 0, (EGWuint)(frames->sfCount) * 3);
                             if(nodesProcessed != (EGWuint)(frames->sfCount) * 3) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_PRSA: Warning parsing in manifest input file '%s', for asset '%s': Total scale key values read %d does not match %d scale key values reported.", resourceFile, entityID, nodesProcessed, ((EGWuint)(frames->sfCount) * 3));
                                 memset((void*)&(((EGWsingle*)(frames->sfKeys))[nodesProcessed]), 0, sizeof(EGWsingle) * (size_t)(((EGWuint)(frames->sfCount) * 3) - nodesProcessed));
@@ -1489,12 +1705,12 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
                     
                     // NOTE: Time indicies can overlap like this (and works better overall if they are), but this parse does introduce the possibility of issues if another time indicie op alloc/free is performed. -jw
                     if((frames->ptIndicies = frames->rtIndicies = frames->stIndicies = (EGWtime*)malloc(sizeof(EGWtime) * (size_t)iCount))) {
-                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
+                        if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderConstValue(xmlReadHandle))) {
                             EGWuint nodesProcessed = 0;
                             
-                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)(frames->ptIndicies), 0, iCount);
-                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwParseStringdcv((EGWchar*)nodeValue, (EGWdouble*)(frames->ptIndicies), 0, iCount);
-                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwParseStringtcv((EGWchar*)nodeValue, (EGWtriple*)(frames->ptIndicies), 0, iCount);
+                            if(sizeof(EGWtime) == sizeof(EGWsingle)) nodesProcessed = egwGAMXParseStringfcv((const EGWchar*)nodeValue, (EGWsingle*)(frames->ptIndicies), 0, iCount);
+                            else if(sizeof(EGWtime) == sizeof(EGWdouble)) nodesProcessed = egwGAMXParseStringdcv((const EGWchar*)nodeValue, (EGWdouble*)(frames->ptIndicies), 0, iCount);
+                            else if(sizeof(EGWtime) == sizeof(EGWtriple)) nodesProcessed = egwGAMXParseStringtcv((const EGWchar*)nodeValue, (EGWtriple*)(frames->ptIndicies), 0, iCount);
                             
                             if(nodesProcessed != iCount) { // Pad rest with zeros if short
                                 NSLog(@"egwAssetManager: egwGAMXParseKeyFrames_PRSA: Warning parsing in manifest input file '%s', for asset '%s': Total time indicies read %d does not match %d time indicies reported.", resourceFile, entityID, nodesProcessed, iCount);
@@ -1512,7 +1728,7 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
             }
             
             if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-            if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+            nodeValue = NULL;
             if(*retVal != 1) break;
         }
         
@@ -1520,7 +1736,7 @@ void egwGAMXParseKeyFrames_PRSA(const EGWchar* resourceFile, const xmlChar* enti
     }
     
     if(nodeName) { xmlFree(nodeName); nodeName = NULL; }
-    if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
+    nodeValue = NULL;
 }
 
 // !!!: *** Surface Parsers ***
@@ -1658,7 +1874,7 @@ void egwGAMXParseSurface_NPPA(const EGWchar* resourceFile, const xmlChar* entity
                             /*EGWuint nodesProcessed = 0;
                             
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed += egwParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount);
+                                nodesProcessed += egwGAMXParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount);
                             }
                             
                             if(nodesProcessed != (EGWuint)surface->count) { // Pad rest with zeros if short
@@ -1672,7 +1888,7 @@ void egwGAMXParseSurface_NPPA(const EGWchar* resourceFile, const xmlChar* entity
                             /*EGWuint nodesProcessed = 0;
                             
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                nodesProcessed += egwParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount * 2);
+                                nodesProcessed += egwGAMXParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount * 2);
                             }
                             
                             if(nodesProcessed != (EGWuint)surface->count * 2) { // Pad rest with zeros if short
@@ -1684,9 +1900,9 @@ void egwGAMXParseSurface_NPPA(const EGWchar* resourceFile, const xmlChar* entity
                         if(egwSrfcAlloc(surface, EGW_SURFACE_FRMT_R8G8B8, (EGWuint16)dCount[0], (EGWuint16)dCount[1], EGW_SURFACE_DFLTBPACKING)) {
                             // TODO: NPPA surface read R8G8B8.
                             /*EGWuint nodesProcessed = 0;
-                             
+                            
                              if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                             nodesProcessed += egwParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount * 2);
+                             nodesProcessed += egwGAMXParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount * 2);
                              }
                              
                              if(nodesProcessed != (EGWuint)surface->count * 2) { // Pad rest with zeros if short
@@ -1698,9 +1914,9 @@ void egwGAMXParseSurface_NPPA(const EGWchar* resourceFile, const xmlChar* entity
                         if(egwSrfcAlloc(surface, EGW_SURFACE_FRMT_R8G8B8A8, (EGWuint16)dCount[0], (EGWuint16)dCount[1], EGW_SURFACE_DFLTBPACKING)) {
                             // TODO: NPPA surface read R8G8B8A8.
                             /*EGWuint nodesProcessed = 0;
-                             
+                            
                              if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                             nodesProcessed += egwParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount * 2);
+                             nodesProcessed += egwGAMXParseStringi16cv((EGWchar*)nodeValue, (EGWint16*)surface->data, 0, sCount * 2);
                              }
                              
                              if(nodesProcessed != (EGWuint)surface->count * 2) { // Pad rest with zeros if short
@@ -1915,11 +2131,11 @@ void egwGAMXParseTransform(xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwMa
         if(xmlTextReaderIsEmptyElement(xmlReadHandle)) { // <transform/>
             if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"matrix"))) { /// matrix only
                 egwMatCopy44f(&egwSIMatIdentity44f, &transform);
-                componentsLeft -= egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)((EGWuintptr)&transform + ((EGWuintptr)sizeof(EGWsingle) * (EGWuintptr)(16 - componentsLeft))), 0, componentsLeft); // row-major
+                componentsLeft -= egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)((EGWuintptr)&transform + ((EGWuintptr)sizeof(EGWsingle) * (EGWuintptr)(16 - componentsLeft))), 0, componentsLeft); // row-major
             } else { /// rotation + position
                 if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"quaternion"))) {
                     egwQuatCopy4f(&egwSIQuatIdentity4f, (egwQuaternion4f*)&transform);
-                    egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 4);
+                    egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 4);
                     egwQuatNormalize4f((egwQuaternion4f*)&transform, (egwQuaternion4f*)&transform);
                     egwMatRotateQuaternion44f(NULL, (egwQuaternion4f*)&transform, &transform);
                 } else { // rest may need converted
@@ -1928,77 +2144,77 @@ void egwGAMXParseTransform(xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwMa
                     
                     if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"axis"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 3);
                         egwMatRotateAxis44f(NULL, (egwVector3f*)&transform, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"axis_angle"))) {
                         egwVecCopy4f(&egwSIVecZero4f, (egwVector4f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 4);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 4);
                         egwVecNormalize3f((egwVector3f*)&transform, (egwVector3f*)&transform);
                         egwMatRotateAxisAngle44f(NULL, (egwVector3f*)&transform, (!nodeUnits ? transform.matrix[3] : egwDegToRadf(transform.matrix[3])), &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerx"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 1);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 1);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 1);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_X, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulery"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 1);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 1);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 1);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_Y, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerz"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 1);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 1);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 1);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_Z, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerxy"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 2);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_XY, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerxz"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 2);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_XZ, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"euleryx"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 2);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_YX, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"euleryz"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 2);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 2);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_YZ, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerxyz"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 3);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_XYZ, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerxzy"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 3);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_XZY, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"euleryxz"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 3);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_YXZ, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"euleryzx"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 3);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_YZX, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerzxy"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 3);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_ZXY, &transform);
                     } else if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"eulerzyx"))) {
                         egwVecCopy3f(&egwSIVecZero3f, (egwVector3f*)&transform);
-                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
+                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&transform, 0, 3);
                         if(nodeUnits) egwDegToRadfv((EGWsingle*)&transform, (EGWsingle*)&transform, 0, 0, 3);
                         egwMatRotateEuler44f(NULL, (egwVector3f*)&transform, EGW_EULERROT_ORDER_ZYX, &transform);
                     } else {
@@ -2010,13 +2226,13 @@ void egwGAMXParseTransform(xmlTextReaderPtr xmlReadHandle, EGWint* retVal, egwMa
                 
                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
                 if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"position")) || (nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"translate"))) {
-                    egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(transform.column[3]), 0, 3);
+                    egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(transform.column[3]), 0, 3);
                 }
                 
                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
                 if((nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"scale")) || (nodeValue = xmlTextReaderGetAttribute(xmlReadHandle, (const xmlChar*)"size"))) {
                     egwVector3f scale; egwVecCopy3f(&egwSIVecOne3f, &scale);
-                    if(egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&scale, 0, 3) == 1)
+                    if(egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&scale, 0, 3) == 1)
                         egwMatUScale44f(&transform, scale.vector[0], &transform);
                     else egwMatScale44f(&transform, &scale, &transform);
                 }
@@ -2312,7 +2528,7 @@ id<NSObject> egwGAMXParseBillboard(const EGWchar* resourceFile, xmlTextReaderPtr
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"geometry") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"vertex_count") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.blnk.vCount, 0, 1);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.blnk.vCount, 0, 1);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"vertex_count");
                                         }
@@ -2336,7 +2552,7 @@ id<NSObject> egwGAMXParseBillboard(const EGWchar* resourceFile, xmlTextReaderPtr
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"geometry") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"dimensions") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityParams.dist.quad.dim[0], 0, 2);
+                                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityParams.dist.quad.dim[0], 0, 2);
                                                 entityParams.dist.quad.dim[0] = egwClampPosf(entityParams.dist.quad.dim[0]);
                                                 entityParams.dist.quad.dim[1] = egwClampPosf(entityParams.dist.quad.dim[1]);
                                             }
@@ -2685,14 +2901,14 @@ id<NSObject> egwGAMXParseCamera(const EGWchar* resourceFile, xmlTextReaderPtr xm
                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)entityNodeName) == 0) break;
                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"grasp_angle") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityGAngle, 0, 1);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityGAngle, 0, 1);
                                 entityGAngle = egwDegToRadf(entityGAngle);
                                 entityGAngle = egwRadReduce02PIf(entityGAngle);
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"grasp_angle");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"fov") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityFOV, 0, 1);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityFOV, 0, 1);
                                 entityFOV = egwClampPosf(entityFOV);
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"fov");
@@ -2719,14 +2935,14 @@ id<NSObject> egwGAMXParseCamera(const EGWchar* resourceFile, xmlTextReaderPtr xm
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"aspect");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"znear") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityZNear, 0, 1);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityZNear, 0, 1);
                                 entityZNear = egwClampPosf(entityZNear);
                                 if(entityZNear > entityZFar) entityZFar = entityZNear;
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"znear");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"zfar") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityZFar, 0, 1);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityZFar, 0, 1);
                                 entityZFar = egwClampPosf(entityZFar);
                                 if(entityZFar < entityZNear) entityZNear = entityZFar;
                             }
@@ -2836,7 +3052,7 @@ id<NSObject> egwGAMXParseCamera(const EGWchar* resourceFile, xmlTextReaderPtr xm
                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)entityNodeName) == 0) break;
                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"grasp_angle") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityGAngle, 0, 1);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityGAngle, 0, 1);
                                 entityGAngle = egwDegToRadf(entityGAngle);
                                 entityGAngle = egwRadReduce02PIf(entityGAngle);
                             }
@@ -3113,7 +3329,7 @@ id<NSObject> egwGAMXParseFont(const EGWchar* resourceFile, xmlTextReaderPtr xmlR
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"color") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
                                 egwColor4f entityColor; entityColor.channel.r = entityColor.channel.g = entityColor.channel.b = 0.0f; entityColor.channel.a = 1.0f;
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityColor, 0, 4);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityColor, 0, 4);
                                 egwClrConvert4fRGBA(egwClrClamp4f(&entityColor, &entityColor), &entityGColor);
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"color");
@@ -3169,7 +3385,7 @@ id<NSObject> egwGAMXParseFont(const EGWchar* resourceFile, xmlTextReaderPtr xmlR
                                 else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"color") == 0) {
                                     if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
                                         egwColor4f entityColor; entityColor.channel.r = entityColor.channel.g = entityColor.channel.b = 0.0f; entityColor.channel.a = 1.0f;
-                                        egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityColor, 0, 4);
+                                        egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityColor, 0, 4);
                                         egwClrConvert4fRGBA(egwClrClamp4f(&entityColor, &entityColor), &entityGColor);
                                     }
                                     egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"color");
@@ -3286,19 +3502,19 @@ id<NSObject> egwGAMXParseInterpolator(const EGWchar* resourceFile, xmlTextReader
                                             egwGAMXParseKeyFrames_ChFormat(resourceFile, entityID, xmlReadHandle, retVal, &entityParams.dist.viblnk.format);
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"frames") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.viblnk.kFrames, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.viblnk.kFrames, 0, 1);
                                                 entityParams.dist.viblnk.kFrames = egwClampui(entityParams.dist.viblnk.kFrames, 1, EGW_UINT16_MAX);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"frames");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"components") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.viblnk.kComponents, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.viblnk.kComponents, 0, 1);
                                                 entityParams.dist.viblnk.kComponents = egwClampui(entityParams.dist.viblnk.kComponents, 1, EGW_UINT16_MAX);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"components");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"channels") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.viblnk.kChannels, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.viblnk.kChannels, 0, 1);
                                                 entityParams.dist.viblnk.kChannels = egwClampui(entityParams.dist.viblnk.kChannels, 1, EGW_UINT16_MAX);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"channels");
@@ -3347,19 +3563,19 @@ id<NSObject> egwGAMXParseInterpolator(const EGWchar* resourceFile, xmlTextReader
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"keyframes") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"pos_frames") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.oiblnk.pFrames, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.oiblnk.pFrames, 0, 1);
                                                 entityParams.dist.oiblnk.pFrames = egwClampui(entityParams.dist.oiblnk.pFrames, 1, EGW_UINT16_MAX);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"pos_frames");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"rot_frames") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.oiblnk.rFrames, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.oiblnk.rFrames, 0, 1);
                                                 entityParams.dist.oiblnk.rFrames = egwClampui(entityParams.dist.oiblnk.rFrames, 1, EGW_UINT16_MAX);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"rot_frames");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"scl_frames") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.oiblnk.sFrames, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.oiblnk.sFrames, 0, 1);
                                                 entityParams.dist.oiblnk.sFrames = egwClampui(entityParams.dist.oiblnk.sFrames, 1, EGW_UINT16_MAX);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"scl_frames");
@@ -3765,7 +3981,7 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 17) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
                                     egwMtrlClamp4f(&entityMaterial, &entityMaterial);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -3774,7 +3990,7 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"illumination");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"attenuation") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && (nodeValue = xmlTextReaderValue(xmlReadHandle)))
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAttenuation, 0, 3);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAttenuation, 0, 3);
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"attenuation");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"base_offset") == 0) {
                             while(egwGAMXParseRunup(xmlReadHandle, retVal) == 1 && *retVal == 1 && (nodeValue = xmlTextReaderName(xmlReadHandle))) {
@@ -3879,7 +4095,7 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)entityNodeName) == 0) break;
                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"direction") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityDirection, 0, 3);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityDirection, 0, 3);
                                 egwVecNormalize3f(&entityDirection, &entityDirection);
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"direction");
@@ -3887,7 +4103,7 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 17) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
                                     egwMtrlClamp4f(&entityMaterial, &entityMaterial);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -3896,7 +4112,7 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"illumination");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"attenuation") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && (nodeValue = xmlTextReaderValue(xmlReadHandle)))
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAttenuation, 0, 3);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAttenuation, 0, 3);
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"attenuation");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"base_offset") == 0) {
                             while(egwGAMXParseRunup(xmlReadHandle, retVal) == 1 && *retVal == 1 && (nodeValue = xmlTextReaderName(xmlReadHandle))) {
@@ -4003,19 +4219,19 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)entityNodeName) == 0) break;
                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"angle") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAngle, 0, 1);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAngle, 0, 1);
                                 entityAngle = egwClampf(entityAngle, 0.0f, 90.0f);
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"angle");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"exponent") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityExponent, 0, 1);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityExponent, 0, 1);
                                 entityExponent = egwClamp01f(entityExponent);
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"exponent");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"direction") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityDirection, 0, 3);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityDirection, 0, 3);
                                 egwVecNormalize3f(&entityDirection, &entityDirection);
                             }
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"direction");
@@ -4023,7 +4239,7 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 17) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
                                     egwMtrlClamp4f(&entityMaterial, &entityMaterial);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4032,7 +4248,7 @@ id<NSObject> egwGAMXParseLight(const EGWchar* resourceFile, xmlTextReaderPtr xml
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"illumination");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"attenuation") == 0) {
                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && (nodeValue = xmlTextReaderValue(xmlReadHandle)))
-                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAttenuation, 0, 3);
+                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&entityAttenuation, 0, 3);
                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"attenuation");
                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"base_offset") == 0) {
                             while(egwGAMXParseRunup(xmlReadHandle, retVal) == 1 && *retVal == 1 && (nodeValue = xmlTextReaderName(xmlReadHandle))) {
@@ -4279,7 +4495,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                                     }
                                     [entityIPORef release]; entityIPORef = nil;
                                 } else if(runup == 3 && readup < 17) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial)[readup], 0, egwClampPosi(17 - readup));
                                     egwMtrlClamp4f(&entityMaterial, &entityMaterial);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4290,7 +4506,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 4) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.ambient)[readup], 0, egwClampPosi(4 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.ambient)[readup], 0, egwClampPosi(4 - readup));
                                     egwClrClamp4f(&entityMaterial.ambient, &entityMaterial.ambient);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4301,7 +4517,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 4) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.diffuse)[readup], 0, egwClampPosi(4 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.diffuse)[readup], 0, egwClampPosi(4 - readup));
                                     egwClrClamp4f(&entityMaterial.diffuse, &entityMaterial.diffuse);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4312,7 +4528,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 4) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.specular)[readup], 0, egwClampPosi(4 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.specular)[readup], 0, egwClampPosi(4 - readup));
                                     egwClrClamp4f(&entityMaterial.specular, &entityMaterial.specular);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4323,7 +4539,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 4) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.emmisive)[readup], 0, egwClampPosi(4 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.emmisive)[readup], 0, egwClampPosi(4 - readup));
                                     egwClrClamp4f(&entityMaterial.emmisive, &entityMaterial.emmisive);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4334,7 +4550,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 1) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.shininess)[readup], 0, egwClampPosi(1 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityMaterial.shininess)[readup], 0, egwClampPosi(1 - readup));
                                     entityMaterial.shininess = egwClamp01f(entityMaterial.shininess);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4401,7 +4617,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                                     }
                                     [entityIPORef release]; entityIPORef = nil;
                                 } else if(runup == 3 && readup < 4) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor)[readup], 0, egwClampPosi(4 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor)[readup], 0, egwClampPosi(4 - readup));
                                     egwClrClamp4f(&entityColor, &entityColor);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4412,7 +4628,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 3) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor)[readup], 0, egwClampPosi(3 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor)[readup], 0, egwClampPosi(3 - readup));
                                     egwClrClamp3f((egwColor3f*)&entityColor, (egwColor3f*)&entityColor);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4423,7 +4639,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 1) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor.channel.r)[readup], 0, egwClampPosi(1 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor.channel.r)[readup], 0, egwClampPosi(1 - readup));
                                     egwClrClamp1f((egwColor1f*)&entityColor.channel.r, (egwColor1f*)&entityColor.channel.r);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4434,7 +4650,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 1) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor.channel.g)[readup], 0, egwClampPosi(1 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor.channel.g)[readup], 0, egwClampPosi(1 - readup));
                                     egwClrClamp1f((egwColor1f*)&entityColor.channel.g, (egwColor1f*)&entityColor.channel.g);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4445,7 +4661,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 1) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor.channel.b)[readup], 0, egwClampPosi(1 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityColor.channel.b)[readup], 0, egwClampPosi(1 - readup));
                                     egwClrClamp1f((egwColor1f*)&entityColor.channel.b, (egwColor1f*)&entityColor.channel.b);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4512,7 +4728,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                                     }
                                     [entityIPORef release]; entityIPORef = nil;
                                 } else if(runup == 3 && readup < 2) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityShade)[readup], 0, egwClampPosi(2 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityShade)[readup], 0, egwClampPosi(2 - readup));
                                     egwClrClamp2f(&entityShade, &entityShade);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4523,7 +4739,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 1) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityShade.channel.l)[readup], 0, egwClampPosi(1 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityShade.channel.l)[readup], 0, egwClampPosi(1 - readup));
                                     egwClrClamp1f((egwColor1f*)&entityShade.channel.l, (egwColor1f*)&entityShade.channel.l);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4534,7 +4750,7 @@ id<NSObject> egwGAMXParseMaterial(const EGWchar* resourceFile, xmlTextReaderPtr
                             EGWint runup, readup = 0;
                             while((runup = egwGAMXParseRunup(xmlReadHandle, retVal)) != 15 && *retVal == 1 && ((runup == 1 ? (nodeValue = xmlTextReaderName(xmlReadHandle)) : (nodeValue = xmlTextReaderValue(xmlReadHandle))))) {
                                 if(runup == 3 && readup < 1) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityShade.channel.a)[readup], 0, egwClampPosi(1 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entityShade.channel.a)[readup], 0, egwClampPosi(1 - readup));
                                     egwClrClamp1f((egwColor1f*)&entityShade.channel.a, (egwColor1f*)&entityShade.channel.a);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -4743,12 +4959,12 @@ id<NSObject> egwGAMXParseMesh(const EGWchar* resourceFile, xmlTextReaderPtr xmlR
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"geometry") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"vertex_count") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.vfc.vCount, 0, 1);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.vfc.vCount, 0, 1);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"vertex_count");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"face_count") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.vfc.fCount, 0, 1);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.vfc.fCount, 0, 1);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"face_count");
                                         }
@@ -4772,7 +4988,7 @@ id<NSObject> egwGAMXParseMesh(const EGWchar* resourceFile, xmlTextReaderPtr xmlR
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"geometry") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"dimensions") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.whd.dim[0]), 0, 3);
+                                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.whd.dim[0]), 0, 3);
                                                 entityParams.dist.whd.dim[0] = egwClampPosf(entityParams.dist.whd.dim[0]);
                                                 entityParams.dist.whd.dim[1] = egwClampPosf(entityParams.dist.whd.dim[1]);
                                                 entityParams.dist.whd.dim[2] = egwClampPosf(entityParams.dist.whd.dim[2]);
@@ -4800,19 +5016,19 @@ id<NSObject> egwGAMXParseMesh(const EGWchar* resourceFile, xmlTextReaderPtr xmlR
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"geometry") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"radius") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.rhl.radius), 0, 1);
+                                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.rhl.radius), 0, 1);
                                                 entityParams.dist.rhl.radius = egwClampPosf(entityParams.dist.rhl.radius);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"radius");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"height") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.rhl.height), 0, 1);
+                                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.rhl.height), 0, 1);
                                                 entityParams.dist.rhl.height = egwClampPosf(entityParams.dist.rhl.height);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"height");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"longitudes") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle)))
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&(entityParams.dist.rhl.longitudes), 0, 1);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&(entityParams.dist.rhl.longitudes), 0, 1);
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"longitudes");
                                         }
                                         
@@ -4836,17 +5052,17 @@ id<NSObject> egwGAMXParseMesh(const EGWchar* resourceFile, xmlTextReaderPtr xmlR
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"geometry") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"radius") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.rll.radius), 0, 1);
+                                                egwGAMXParseStringfcv((EGWchar*)nodeValue, (EGWsingle*)&(entityParams.dist.rll.radius), 0, 1);
                                                 entityParams.dist.rll.radius = egwClampPosf(entityParams.dist.rll.radius);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"radius");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"latitudes") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle)))
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&(entityParams.dist.rll.latitudes), 0, 1);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&(entityParams.dist.rll.latitudes), 0, 1);
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"latitudes");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"longitudes") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle)))
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&(entityParams.dist.rll.longitudes), 0, 1);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&(entityParams.dist.rll.longitudes), 0, 1);
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"longitudes");
                                         }
                                         
@@ -5647,13 +5863,13 @@ id<NSObject> egwGAMXParseTimer(const EGWchar* resourceFile, xmlTextReaderPtr xml
                                         else if(nodeType == 15 && nodeName && strcasecmp((const char*)nodeName, (const char*)"actions") == 0) break;
                                         else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"action_count") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.actblnk.aCount, 0, 1);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.actblnk.aCount, 0, 1);
                                                 if(entityParams.dist.actblnk.aCount < 1) entityParams.dist.actblnk.aCount = 1;
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"action_count");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"default_action") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.actblnk.dAction, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.actblnk.dAction, 0, 1);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"default_action");
                                         }
@@ -5891,12 +6107,12 @@ id<NSObject> egwGAMXParseSound(const EGWchar* resourceFile, xmlTextReaderPtr xml
                                             egwGAMXParseAudio_Format(resourceFile, entityID, xmlReadHandle, retVal, &entityParams.dist.blnk.format);
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"rate") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.blnk.rate, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.blnk.rate, 0, 1);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"rate");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"count") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.blnk.count, 0, 1);
+                                                egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.blnk.count, 0, 1);
                                             }
                                             egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"count");
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"transforms") == 0) {
@@ -5965,7 +6181,7 @@ id<NSObject> egwGAMXParseSound(const EGWchar* resourceFile, xmlTextReaderPtr xml
                                     }
                                     [entityIPORef release]; entityIPORef = nil;
                                 } else if(runup == 3 && readup < 2) {
-                                    readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entitySEffects)[readup], 0, egwClampPosi(2 - readup));
+                                    readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entitySEffects)[readup], 0, egwClampPosi(2 - readup));
                                     egwClrClamp2f((egwColor2f*)&entitySEffects, (egwColor2f*)&entitySEffects);
                                 }
                                 if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -6155,7 +6371,7 @@ id<NSObject> egwGAMXParseSound(const EGWchar* resourceFile, xmlTextReaderPtr xml
                                             }
                                             [entityIPORef release]; entityIPORef = nil;
                                         } else if(runup == 3 && readup < 2) {
-                                            readup += egwParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entitySEffects)[readup], 0, egwClampPosi(2 - readup));
+                                            readup += egwGAMXParseStringfcv((EGWchar*)nodeValue, &((EGWsingle*)&entitySEffects)[readup], 0, egwClampPosi(2 - readup));
                                             egwClrClamp2f((egwColor2f*)&entitySEffects, (egwColor2f*)&entitySEffects);
                                         }
                                         if(nodeValue) { xmlFree(nodeValue); nodeValue = NULL; }
@@ -6320,7 +6536,7 @@ id<NSObject> egwGAMXParseTexture(const EGWchar* resourceFile, xmlTextReaderPtr x
                                             egwGAMXParseSurface_Format(resourceFile, entityID, xmlReadHandle, retVal, &entityParams.dist.blnk.format);
                                         } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"dimensions") == 0) {
                                             if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                                egwParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.blnk.dim[0], 0, 2);
+                                                egwGAMXParseStringui16cv((EGWchar*)nodeValue, (EGWuint16*)&entityParams.dist.blnk.dim[0], 0, 2);
                                                 if(entityParams.dist.blnk.dim[0] < 2) entityParams.dist.blnk.dim[0] = 2;
                                                 if(entityParams.dist.blnk.dim[1] < 2) entityParams.dist.blnk.dim[1] = 2;
                                             }
@@ -6846,7 +7062,7 @@ id<NSObject> egwGAMXParseWidget(const EGWchar* resourceFile, xmlTextReaderPtr xm
                                         egwGAMXParseSurface_Format(resourceFile, entityID, xmlReadHandle, retVal, &entityParams.dist.sprtdimgblnk.format);
                                     } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"frames") == 0) {
                                         if(egwGAMXParseRunup(xmlReadHandle, retVal) == 3 && *retVal == 1 && (nodeValue = xmlTextReaderValue(xmlReadHandle))) {
-                                            egwParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.sprtdimgblnk.fCount, 0, 1);
+                                            egwGAMXParseStringuicv((EGWchar*)nodeValue, (EGWuint*)&entityParams.dist.sprtdimgblnk.fCount, 0, 1);
                                         }
                                         egwGAMXParseSkip(xmlReadHandle, retVal, (const xmlChar*)"frames");
                                     } else if(nodeType == 1 && nodeName && strcasecmp((const char*)nodeName, (const char*)"transforms") == 0) {
@@ -0,0 +1,144 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @defgroup geWizES_sys_gfxcommands egwGfxCommands
+/// @ingroup geWizES_sys
+/// Graphics Render Commands.
+/// @{
+
+/// @file egwGfxCommands.h
+/// Graphics Render Commands Interface.
+
+#import "egwSysTypes.h"
+
+
+#define EGW_GFXCMDBUF_DFLTCAPACITY  256     ///< Default command buffer capacity (grows as needed).
+
+
+// !!!: ***** Command Buffer Routines *****
+
+/// Command Buffer Initialization Routine.
+/// Initializes an empty command buffer with provided parameters.
+/// @param [out] buffer_out Command buffer output.
+/// @param [in] initMax Initial command capacity (0 for default).
+/// @return @a buffer_out (for nesting), otherwise NULL if failure initializing.
+egwGfxCommandBuffer* egwGfxCmdBufferInit(egwGfxCommandBuffer* buffer_out, EGWuint initMax);
+
+/// Command Buffer Free Routine.
+/// Frees the contents of the command buffer.
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @return @a buffer_inout (for nesting).
+egwGfxCommandBuffer* egwGfxCmdBufferFree(egwGfxCommandBuffer* buffer_inout);
+
+/// Command Buffer Reset Routine.
+/// Empties the command buffer for re-recording, keeping its capacity.
+/// @param [in,out] buffer_inout Command buffer input/output.
+void egwGfxCmdBufferReset(egwGfxCommandBuffer* buffer_inout);
+
+/// Command Buffer Append Routine.
+/// Appends a new command record of provided @a type and @a flags onto the command buffer, leaving its data to be filled in.
+/// @note Upon allocation failure the buffer is flagged as overflowed and all further appends fail.
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @param [in] type Command type (EGW_GFXCMD_*).
+/// @param [in] flags Bit-wise command flags (EGW_GFXCMD_FLG_*).
+/// @return Appended command record, otherwise NULL if failure appending.
+egwGfxCommand* egwGfxCmdBufferAppend(egwGfxCommandBuffer* buffer_inout, EGWuint16 type, EGWuint16 flags);
+
+/// Command Buffer Replay Routine.
+/// Executes the recorded commands of the command buffer in order.
+/// @note This routine must be called on the graphics context thread, with the graphics context active.
+/// @param [in] buffer_in Command buffer input.
+void egwGfxCmdBufferReplay(const egwGfxCommandBuffer* buffer_in);
+
+
+// !!!: ***** Batch Scratch Routines *****
+
+/// Batch Scratch Free Routine.
+/// Frees the merged client arrays of the batch scratch and releases its cached rendering base.
+/// @note Only call from the renderer's thread or once it has stopped, the scratch is regrown on next use.
+/// @param [in,out] scratch_inout Batch scratch input/output.
+/// @return @a scratch_inout (for nesting).
+egwGfxBatchScratch* egwGfxBatchScratchFree(egwGfxBatchScratch* scratch_inout);
+
+
+// !!!: ***** Command Recording Routines *****
+
+/// Record Push Stacks Routine.
+/// Records the pushing and binding of provided binding stacks.
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @param [in] lStack Light stack (weak), nil binds context lights.
+/// @param [in] mStack Material stack (weak), nil binds context materials.
+/// @param [in] sStack Shader stack (weak), nil binds context shaders.
+/// @param [in] tStack Texture stack (weak), nil binds context textures.
+void egwGfxCmdRecordPushStacks(egwGfxCommandBuffer* buffer_inout, egwLightStack* lStack, egwMaterialStack* mStack, egwShaderStack* sStack, egwTextureStack* tStack);
+
+/// Record Pop Stacks Routine.
+/// Records the popping of provided binding stacks (in reverse order of pushing).
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @param [in] lStack Light stack (weak), may be nil.
+/// @param [in] mStack Material stack (weak), may be nil.
+/// @param [in] sStack Shader stack (weak), may be nil.
+/// @param [in] tStack Texture stack (weak), may be nil.
+void egwGfxCmdRecordPopStacks(egwGfxCommandBuffer* buffer_inout, egwLightStack* lStack, egwMaterialStack* mStack, egwShaderStack* sStack, egwTextureStack* tStack);
+
+/// Record Push Matrix Routine.
+/// Records the pushing of the modelview matrix, multiplied by the combination of the provided transforms.
+/// @note Transforms are combined at record time (i.e. @a wcsTrans * @a lcsTrans * @a mcsTrans), thus only one matrix multiply is replayed.
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @param [in] wcsTrans World coordinate transform.
+/// @param [in] lcsTrans Local coordinate transform (may be NULL).
+/// @param [in] mcsTrans Model coordinate transform (may be NULL).
+void egwGfxCmdRecordPushMatrix(egwGfxCommandBuffer* buffer_inout, const egwMatrix44f* wcsTrans, const egwMatrix44f* lcsTrans, const egwMatrix44f* mcsTrans);
+
+/// Record Pop Matrix Routine.
+/// Records the popping of the modelview matrix.
+/// @param [in,out] buffer_inout Command buffer input/output.
+void egwGfxCmdRecordPopMatrix(egwGfxCommandBuffer* buffer_inout);
+
+/// Record Arrays Routine.
+/// Records the binding of the array buffer and the setting of the vertex, normal, and texture coordinate array pointers.
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @param [in] bufID Array buffer identifier (0 for client arrays).
+/// @param [in] vCoords Vertex coordinates (3 x float) pointer, or offset if buffered.
+/// @param [in] nCoords Normal coordinates (3 x float) pointer, or offset if buffered.
+/// @param [in] tCoords Texture coordinates (2 x float) pointer, or offset if buffered (NULL if unused and not buffered).
+/// @param [in] flags Bit-wise command flags (EGW_GFXCMD_FLG_SAMELASTBASE, EGW_GFXCMD_FLG_TEXCOORDS).
+void egwGfxCmdRecordArrays(egwGfxCommandBuffer* buffer_inout, EGWuint bufID, const EGWbyte* vCoords, const EGWbyte* nCoords, const EGWbyte* tCoords, EGWuint16 flags);
+
+/// Record Draw Elements Routine.
+/// Records the binding of the element buffer and the drawing of indexed triangles.
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @param [in] bufID Element buffer identifier (0 for client indicies).
+/// @param [in] count Element index count.
+/// @param [in] indicies Element indicies pointer, or offset if buffered.
+/// @param [in] flags Bit-wise command flags (EGW_GFXCMD_FLG_WIDEINDICIES).
+void egwGfxCmdRecordDrawElements(egwGfxCommandBuffer* buffer_inout, EGWuint bufID, EGWuint count, const EGWbyte* indicies, EGWuint16 flags);
+
+/// Record Render Routine.
+/// Records a deferred renderWithFlags: call for an object that does not support recording.
+/// @param [in,out] buffer_inout Command buffer input/output.
+/// @param [in] object Renderable object (weak).
+/// @param [in] fpRender IMP function pointer to object's renderWithFlags: method.
+/// @param [in] flags Rendering reply flags.
+void egwGfxCmdRecordRender(egwGfxCommandBuffer* buffer_inout, id object, void (*fpRender)(id, SEL, EGWuint), EGWuint32 flags);
+
+/// @}
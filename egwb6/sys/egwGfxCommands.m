@@ -0,0 +1,236 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file egwGfxCommands.m
+/// @ingroup geWizES_sys_gfxcommands
+/// Graphics Render Commands Implementation.
+
+#import <stdlib.h>
+#import "egwGfxCommands.h"
+#import "../sys/egwGfxContext.h"
+#import "../sys/egwGfxContextNSGL.h"  // NOTE: Below code has a dependence on GL.
+#import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
+#import "../math/egwMatrix.h"
+#import "../gfx/egwBindingStacks.h"
+
+
+// !!!: ***** Command Buffer Routines *****
+
+egwGfxCommandBuffer* egwGfxCmdBufferInit(egwGfxCommandBuffer* buffer_out, EGWuint initMax) {
+    memset((void*)buffer_out, 0, sizeof(egwGfxCommandBuffer));
+    
+    buffer_out->cMax = (initMax ? initMax : EGW_GFXCMDBUF_DFLTCAPACITY);
+    if(!(buffer_out->commands = (egwGfxCommand*)malloc((size_t)buffer_out->cMax * sizeof(egwGfxCommand)))) { buffer_out->cMax = 0; return NULL; }
+    
+    return buffer_out;
+}
+
+egwGfxCommandBuffer* egwGfxCmdBufferFree(egwGfxCommandBuffer* buffer_inout) {
+    if(buffer_inout->commands) {
+        free((void*)buffer_inout->commands);
+        buffer_inout->commands = NULL;
+    }
+    
+    buffer_inout->cCount = buffer_inout->cMax = 0;
+    buffer_inout->overflowed = NO;
+    
+    return buffer_inout;
+}
+
+void egwGfxCmdBufferReset(egwGfxCommandBuffer* buffer_inout) {
+    buffer_inout->cCount = 0;
+    buffer_inout->overflowed = NO;
+}
+
+egwGfxCommand* egwGfxCmdBufferAppend(egwGfxCommandBuffer* buffer_inout, EGWuint16 type, EGWuint16 flags) {
+    egwGfxCommand* command;
+    
+    if(buffer_inout->cCount >= buffer_inout->cMax) {
+        EGWuint newMax = (buffer_inout->cMax ? buffer_inout->cMax * 2 : EGW_GFXCMDBUF_DFLTCAPACITY);
+        egwGfxCommand* newCommands;
+        
+        if(buffer_inout->overflowed || !(newCommands = (egwGfxCommand*)realloc((void*)buffer_inout->commands, (size_t)newMax * sizeof(egwGfxCommand)))) {
+            buffer_inout->overflowed = YES;
+            return NULL;
+        }
+        
+        buffer_inout->commands = newCommands;
+        buffer_inout->cMax = newMax;
+    }
+    
+    command = &buffer_inout->commands[buffer_inout->cCount++];
+    command->type = type;
+    command->flags = flags;
+    
+    return command;
+}
+
+void egwGfxCmdBufferReplay(const egwGfxCommandBuffer* buffer_in) {
+    // NOTE: The code below is non-abstracted OpenGLES dependent. Staying this way till ES2. -jw
+    const egwGfxCommand* command = buffer_in->commands;
+    const egwGfxCommand* cmdEnd = buffer_in->commands + buffer_in->cCount;
+    
+    if(buffer_in->overflowed) return;
+    
+    for(; command < cmdEnd; ++command) {
+        switch(command->type) {
+            case EGW_GFXCMD_PUSHSTACKS: {
+                if(command->data.stacks.lStack) egwSFPLghtStckPushAndBindLights(command->data.stacks.lStack, @selector(pushAndBindLights));
+                else egwAFPGfxCntxBindLights(egwAIGfxCntx, @selector(bindLights));
+                if(command->data.stacks.mStack) egwSFPMtrlStckPushAndBindMaterials(command->data.stacks.mStack, @selector(pushAndBindMaterials));
+                else egwAFPGfxCntxBindMaterials(egwAIGfxCntx, @selector(bindMaterials));
+                if(command->data.stacks.sStack) egwSFPShdrStckPushAndBindShaders(command->data.stacks.sStack, @selector(pushAndBindShaders));
+                else egwAFPGfxCntxBindShaders(egwAIGfxCntx, @selector(bindShaders));
+                if(command->data.stacks.tStack) egwSFPTxtrStckPushAndBindTextures(command->data.stacks.tStack, @selector(pushAndBindTextures));
+                else egwAFPGfxCntxBindTextures(egwAIGfxCntx, @selector(bindTextures));
+            } break;
+            
+            case EGW_GFXCMD_POPSTACKS: {
+                if(command->data.stacks.tStack) egwSFPTxtrStckPopTextures(command->data.stacks.tStack, @selector(popTextures));
+                if(command->data.stacks.sStack) egwSFPShdrStckPopShaders(command->data.stacks.sStack, @selector(popShaders));
+                if(command->data.stacks.mStack) egwSFPMtrlStckPopMaterials(command->data.stacks.mStack, @selector(popMaterials));
+                if(command->data.stacks.lStack) egwSFPLghtStckPopLights(command->data.stacks.lStack, @selector(popLights));
+            } break;
+            
+            case EGW_GFXCMD_PUSHMATRIX: {
+                glPushMatrix();
+                glMultMatrixf((const GLfloat*)&command->data.transform);
+            } break;
+            
+            case EGW_GFXCMD_POPMATRIX: {
+                glPopMatrix();
+            } break;
+            
+            case EGW_GFXCMD_ARRAYS: {
+                if(egw_glBindBuffer(GL_ARRAY_BUFFER, command->data.arrays.bufID) || !(command->flags & EGW_GFXCMD_FLG_SAMELASTBASE)) {
+                    glVertexPointer((GLint)3, GL_FLOAT, (GLsizei)0, (const GLvoid*)command->data.arrays.vCoords);
+                    glNormalPointer(GL_FLOAT, (GLsizei)0, (const GLvoid*)command->data.arrays.nCoords);
+                    if(command->flags & EGW_GFXCMD_FLG_TEXCOORDS) glTexCoordPointer((GLint)2, GL_FLOAT, (GLsizei)0, (const GLvoid*)command->data.arrays.tCoords);
+                }
+            } break;
+            
+            case EGW_GFXCMD_DRAWELEMENTS: {
+                egw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, command->data.elements.bufID);
+                
+                glDrawElements(GL_TRIANGLES, (GLsizei)command->data.elements.count, (command->flags & EGW_GFXCMD_FLG_WIDEINDICIES ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT), (const GLvoid*)command->data.elements.indicies);
+                egwGfxCntxNullCountDraws(1);
+            } break;
+            
+            case EGW_GFXCMD_RENDER: {
+                command->data.render.fpRender(command->data.render.object, @selector(renderWithFlags:), command->data.render.flags);
+            } break;
+            
+            default: break;
+        }
+    }
+}
+
+
+// !!!: ***** Batch Scratch Routines *****
+
+egwGfxBatchScratch* egwGfxBatchScratchFree(egwGfxBatchScratch* scratch_inout) {
+    if(scratch_inout->vCoords) { free((void*)scratch_inout->vCoords); scratch_inout->vCoords = NULL; }
+    if(scratch_inout->nCoords) { free((void*)scratch_inout->nCoords); scratch_inout->nCoords = NULL; }
+    if(scratch_inout->tCoords) { free((void*)scratch_inout->tCoords); scratch_inout->tCoords = NULL; }
+    if(scratch_inout->fIndicies) { free((void*)scratch_inout->fIndicies); scratch_inout->fIndicies = NULL; }
+    [scratch_inout->cBase release]; scratch_inout->cBase = nil;
+    
+    scratch_inout->vMax = scratch_inout->tMax = scratch_inout->iSize = scratch_inout->cPerChunk = 0;
+    scratch_inout->cTCoords = NO;
+    
+    return scratch_inout;
+}
+
+
+// !!!: ***** Command Recording Routines *****
+
+void egwGfxCmdRecordPushStacks(egwGfxCommandBuffer* buffer_inout, egwLightStack* lStack, egwMaterialStack* mStack, egwShaderStack* sStack, egwTextureStack* tStack) {
+    egwGfxCommand* command = egwGfxCmdBufferAppend(buffer_inout, EGW_GFXCMD_PUSHSTACKS, EGW_GFXCMD_FLG_NONE);
+    
+    if(command) {
+        command->data.stacks.lStack = lStack;
+        command->data.stacks.mStack = mStack;
+        command->data.stacks.sStack = sStack;
+        command->data.stacks.tStack = tStack;
+    }
+}
+
+void egwGfxCmdRecordPopStacks(egwGfxCommandBuffer* buffer_inout, egwLightStack* lStack, egwMaterialStack* mStack, egwShaderStack* sStack, egwTextureStack* tStack) {
+    egwGfxCommand* command = egwGfxCmdBufferAppend(buffer_inout, EGW_GFXCMD_POPSTACKS, EGW_GFXCMD_FLG_NONE);
+    
+    if(command) {
+        command->data.stacks.lStack = lStack;
+        command->data.stacks.mStack = mStack;
+        command->data.stacks.sStack = sStack;
+        command->data.stacks.tStack = tStack;
+    }
+}
+
+void egwGfxCmdRecordPushMatrix(egwGfxCommandBuffer* buffer_inout, const egwMatrix44f* wcsTrans, const egwMatrix44f* lcsTrans, const egwMatrix44f* mcsTrans) {
+    egwGfxCommand* command = egwGfxCmdBufferAppend(buffer_inout, EGW_GFXCMD_PUSHMATRIX, EGW_GFXCMD_FLG_NONE);
+    
+    if(command) {
+        if(lcsTrans) {
+            egwMatMultiply44f(wcsTrans, lcsTrans, &command->data.transform);
+            if(mcsTrans) egwMatMultiply44f(&command->data.transform, mcsTrans, &command->data.transform);
+        } else if(mcsTrans)
+            egwMatMultiply44f(wcsTrans, mcsTrans, &command->data.transform);
+        else
+            egwMatCopy44f(wcsTrans, &command->data.transform);
+    }
+}
+
+void egwGfxCmdRecordPopMatrix(egwGfxCommandBuffer* buffer_inout) {
+    egwGfxCmdBufferAppend(buffer_inout, EGW_GFXCMD_POPMATRIX, EGW_GFXCMD_FLG_NONE);
+}
+
+void egwGfxCmdRecordArrays(egwGfxCommandBuffer* buffer_inout, EGWuint bufID, const EGWbyte* vCoords, const EGWbyte* nCoords, const EGWbyte* tCoords, EGWuint16 flags) {
+    egwGfxCommand* command = egwGfxCmdBufferAppend(buffer_inout, EGW_GFXCMD_ARRAYS, flags);
+    
+    if(command) {
+        command->data.arrays.bufID = bufID;
+        command->data.arrays.vCoords = vCoords;
+        command->data.arrays.nCoords = nCoords;
+        command->data.arrays.tCoords = tCoords;
+    }
+}
+
+void egwGfxCmdRecordDrawElements(egwGfxCommandBuffer* buffer_inout, EGWuint bufID, EGWuint count, const EGWbyte* indicies, EGWuint16 flags) {
+    egwGfxCommand* command = egwGfxCmdBufferAppend(buffer_inout, EGW_GFXCMD_DRAWELEMENTS, flags);
+    
+    if(command) {
+        command->data.elements.bufID = bufID;
+        command->data.elements.count = count;
+        command->data.elements.indicies = indicies;
+    }
+}
+
+void egwGfxCmdRecordRender(egwGfxCommandBuffer* buffer_inout, id object, void (*fpRender)(id, SEL, EGWuint), EGWuint32 flags) {
+    egwGfxCommand* command = egwGfxCmdBufferAppend(buffer_inout, EGW_GFXCMD_RENDER, EGW_GFXCMD_FLG_NONE);
+    
+    if(command) {
+        command->data.render.object = object;
+        command->data.render.fpRender = fpRender;
+        command->data.render.flags = flags;
+    }
+}
@@ -156,7 +156,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                 glTexEnvf(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA);
                 glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_MODULATEX2: {
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
                 
@@ -174,7 +174,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                 glTexEnvf(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA);
                 glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_MODULATEX4: {
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
                 
@@ -192,7 +192,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                 glTexEnvf(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA);
                 glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_DOT3: {
                 // Only way to do this
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
@@ -209,7 +209,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                 glTexEnvf(GL_TEXTURE_ENV, GL_OPERAND0_ALPHA, GL_SRC_ALPHA);
                 glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_ADD: {
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
                 
@@ -227,7 +227,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                 glTexEnvf(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA);
                 glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_ADDSIGNED: {
                 // Only way to do this
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
@@ -246,19 +246,19 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                 glTexEnvf(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA);
                 glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_BLEND: {
                 // Only way to do this
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
                 glTexEnvf(GL_TEXTURE_ENV, GL_RGB_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_DECAL: {
                 // Only way to do this
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
                 glTexEnvf(GL_TEXTURE_ENV, GL_RGB_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_REPLACE: {
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
                 
@@ -272,7 +272,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                 glTexEnvf(GL_TEXTURE_ENV, GL_OPERAND0_ALPHA, GL_SRC_ALPHA);
                 glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
             } break;
-                
+            
             case EGW_TEXTURE_FENV_SUBTRACT: {
                 // Only way to do this
                 glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
@@ -1229,7 +1229,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
         switch(filter) {
             default: {
             } break;
-                
+            
             case EGW_TEXTURE_FLTR_BLHANSTRPC:
             case EGW_TEXTURE_FLTR_TLHANSTRPC: {
                 if([self isExtAvailable:@"GL_EXT_texture_filter_anisotropic"]) {
@@ -1249,7 +1249,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                     goto ErrorCleanup;
                 }
             } break;
-                
+            
             case EGW_TEXTURE_FLTR_BLFANSTRPC:
             case EGW_TEXTURE_FLTR_TLFANSTRPC: {
                 if([self isExtAvailable:@"GL_EXT_texture_filter_anisotropic"]) {
@@ -1464,7 +1464,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                                 lScanline += ((EGWuintptr)lPitch + (EGWuintptr)lPitch);
                             }
                         } break;
-                            
+                        
                         case EGW_SURFACE_FRMT_GS8A8: {
                             egwColorGSA cColor; EGWint iColor[2];
                             
@@ -1504,7 +1504,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                                 lScanline += ((EGWuintptr)lPitch + (EGWuintptr)lPitch);
                             }
                         } break;
-                            
+                        
                         case EGW_SURFACE_FRMT_R5G6B5:
                         case EGW_SURFACE_FRMT_R8G8B8: {
                             egwColorRGB cColor; EGWint iColor[3];
@@ -1550,7 +1550,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                                 lScanline += ((EGWuintptr)lPitch + (EGWuintptr)lPitch);
                             }
                         } break;
-                            
+                        
                         case EGW_SURFACE_FRMT_R5G5B5A1:
                         case EGW_SURFACE_FRMT_R4G4B4A4:
                         case EGW_SURFACE_FRMT_R8G8B8A8: {
@@ -1667,7 +1667,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
                                     lScanline += (EGWuintptr)surface->pitch;
                                 }
                             } break;
-                                
+                            
                             case EGW_SURFACE_FRMT_R5G6B5:
                             case EGW_SURFACE_FRMT_R8G8B8:
                             case EGW_SURFACE_FRMT_R5G5B5A1:
@@ -1756,7 +1756,7 @@ BOOL egw_glBindEnvironment(EGWuint environment) {
     }
     
     return YES;
-    
+
 ErrorCleanup:
     if(apiLocked) {
         if(oldTextureID != NSNotFound) {
@@ -1860,7 +1860,7 @@ ErrorCleanup:
     } else {
         NSLog(@"egwGfxContextAGL: loadBufferArraysID:withSTVAMesh:geometryStorage: Failure making context active on this thread.");
     }
-    
+
 ErrorCleanup:
     if(*arraysBufID)
         *arraysBufID = [egwAIGfxCntxAGL returnUsedBufferID:*arraysBufID];
@@ -1884,7 +1884,14 @@ Cleanup:
         NSLog(@"egwGfxContextAGL: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Invalid arguments passed to method.");
         goto ErrorCleanup;
     }
-    
+
+#if defined(EGW_BUILDMODE_IPHONE)
+    if(egwMeshIsWideIndexed(mesh->vCount) && ![egwAIGfxCntxAGL isExtAvailable:@"GL_OES_element_index_uint"]) {
+        NSLog(@"egwGfxContextAGL: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Mesh of %d vertices requires wide (32-bit) face indices, which are not supported by this device.", mesh->vCount);
+        goto ErrorCleanup;
+    }
+#endif
+
     if([egwAIGfxCntxAGL isActive] || [egwAIGfxCntxAGL makeActive]) {
         NSString* errorString = nil;
         GLenum usage = 0;
@@ -1941,7 +1948,7 @@ Cleanup:
         
         egw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, *elementsBufID);
         if(isAllocatingElements)
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)((EGWuint)sizeof(egwJITFace) * (EGWuint)mesh->fCount), (const GLvoid*)mesh->fIndicies, usage);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)((egwMeshIsWideIndexed(mesh->vCount) ? (EGWuint)sizeof(egwJITFace32) : (EGWuint)sizeof(egwJITFace)) * (EGWuint)mesh->fCount), (const GLvoid*)mesh->fIndicies, usage);
         
         if(egwIsGLError(&errorString)) {
             NSLog(@"egwGfxContextAGL: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Failure buffering mesh data into buffer ID %d/%d. GLError: %@", *arraysBufID, *elementsBufID, (errorString ? errorString : @"GL_NONE"));
@@ -1953,7 +1960,7 @@ Cleanup:
     } else {
         NSLog(@"egwGfxContextAGL: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Failure making context active on this thread.");
     }
-    
+
 ErrorCleanup:
     if(*arraysBufID)
         *arraysBufID = [egwAIGfxCntxAGL returnUsedBufferID:*arraysBufID];
@@ -2030,7 +2037,7 @@ Cleanup:
     } else {
         NSLog(@"egwGfxContextAGL: loadBufferArraysID:withSQVAMesh:geometryStorage: Failure making context active on this thread.");
     }
-    
+
 ErrorCleanup:
     if(*arraysBufID)
         *arraysBufID = [egwAIGfxCntxAGL returnUsedBufferID:*arraysBufID];
@@ -2096,7 +2103,7 @@ Cleanup:
     } else {
         NSLog(@"egwGfxContextAGL: loadBufferArraysID:withRawData:dataSize:geometryStorage: Failure making context active on this thread.");
     }
-    
+
 ErrorCleanup:
     if(*arraysBufID)
         *arraysBufID = [egwAIGfxCntxAGL returnUsedBufferID:*arraysBufID];
@@ -43,6 +43,10 @@
 #import <OpenGLES/ES1/gl.h>
 #import <OpenGLES/ES1/glext.h>
 
+#ifndef GL_UNSIGNED_INT
+#define GL_UNSIGNED_INT 0x1405  // NOTE: Element usage requires GL_OES_element_index_uint. -jw
+#endif
+
 
 /// iPhone OpenGLES Graphics Context.
 /// Contains contextual data related to an iPhone OpenGLES graphics API.
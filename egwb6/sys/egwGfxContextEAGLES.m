@@ -28,6 +28,7 @@
 #import "egwGfxContextEAGLES.h"
 #import "../sys/egwEngine.h"
 #import "../sys/egwGfxContextNSGL.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwGfxRenderer.h"
 #import "../math/egwMath.h"
 #import "../gfx/egwGraphics.h"
@@ -107,6 +108,7 @@ static pthread_mutex_t _apiLock_EAGLES = PTHREAD_MUTEX_INITIALIZER;
         egwAIGfxCntxAGL = self;
         egwAIGfxCntxNSGL = nil;
         egwAIGfxCntxEAGLES = self;
+        egwAIGfxCntxNull = nil;
         _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
         
         egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
@@ -648,6 +650,7 @@ ErrorCleanup:
             egwAIGfxCntxAGL = self;
             egwAIGfxCntxNSGL = nil;
             egwAIGfxCntxEAGLES = self;
+            egwAIGfxCntxNull = nil;
             _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
             
             egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
@@ -705,6 +708,7 @@ ErrorCleanup:
                     egwAIGfxCntxAGL = self;
                     egwAIGfxCntxNSGL = nil;
                     egwAIGfxCntxEAGLES = self;
+                    egwAIGfxCntxNull = nil;
                     _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
                     
                     egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
@@ -823,6 +827,7 @@ ErrorCleanup:
                         egwAIGfxCntxAGL = nil;
                         egwAIGfxCntxNSGL = nil;
                         egwAIGfxCntxEAGLES = nil;
+                        egwAIGfxCntxNull = nil;
                         _inPass = NO;
                         
                         egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))NULL;
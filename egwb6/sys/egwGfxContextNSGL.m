@@ -28,6 +28,7 @@
 #import "egwGfxContextNSGL.h"
 #import "../sys/egwEngine.h"
 #import "../sys/egwGfxContextEAGLES.h"
+#import "../sys/egwGfxContextNull.h"
 #import "../sys/egwGfxRenderer.h"
 #import "../math/egwMath.h"
 #import "../gfx/egwGraphics.h"
@@ -101,6 +102,7 @@ static pthread_mutex_t _apiLock_NSGL = PTHREAD_MUTEX_INITIALIZER;
          egwAIGfxCntxAGL = self;
          egwAIGfxCntxNSGL = self;
          egwAIGfxCntxEAGLES = nil;
+         egwAIGfxCntxNull = nil;
          _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
          
          egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
@@ -198,6 +200,7 @@ ErrorCleanup:
             egwAIGfxCntxAGL = self;
             egwAIGfxCntxNSGL = self;
             egwAIGfxCntxEAGLES = nil;
+            egwAIGfxCntxNull = nil;
             _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
             
             egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
@@ -255,6 +258,7 @@ ErrorCleanup:
                     egwAIGfxCntxAGL = self;
                     egwAIGfxCntxNSGL = self;
                     egwAIGfxCntxEAGLES = nil;
+                    egwAIGfxCntxNull = nil;
                     _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
                     
                     egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
@@ -353,6 +357,7 @@ ErrorCleanup:
                         egwAIGfxCntxAGL = nil;
                         egwAIGfxCntxNSGL = nil;
                         egwAIGfxCntxEAGLES = nil;
+                        egwAIGfxCntxNull = nil;
                         _inPass = NO;
                         
                         egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))NULL;
@@ -0,0 +1,117 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @defgroup geWizES_sys_gfxcontextnull egwGfxContextNull
+/// @ingroup geWizES_sys
+/// Null (Headless) Graphics Context.
+/// @{
+
+/// @file egwGfxContextNull.h
+/// Null (Headless) Graphics Context Interface.
+
+#import "egwSysTypes.h"
+#import "egwGfxContext.h"
+#import "egwGfxContextAGL.h"
+
+
+#define EGW_GFXCNTXNULL_MAXLIGHTS   8       ///< Maximum # of active lights reported by the null context.
+#define EGW_GFXCNTXNULL_MAXTEXTURES 2       ///< Maximum # of active textures reported by the null context.
+#define EGW_GFXCNTXNULL_MAXTEXSIZE  1024    ///< Maximum texture size reported by the null context.
+
+
+/// Null Graphics Context Frame Counters.
+/// Contains per-frame work counters gathered by the null context.
+typedef struct {
+    EGWuint drawCalls;                      ///< Draw submissions (counted at each draw call, including command buffer replays).
+    EGWuint stateChanges;                   ///< Light/material/shader/texture binding changes and enable toggles.
+    EGWuint bytesUploaded;                  ///< Texture and buffer bytes loaded.
+} egwGfxCntxNullCounters;
+
+
+#if defined(EGW_BUILDMODE_GFX_GL)
+#define EGW_BUILDMODE_GFX_NULL
+
+
+/// Null Graphics Context.
+/// Contains a headless graphics context that performs all context-side resource management and binding stack logic without a device, counting work per frame.
+/// @note Texture and buffer identifiers are allocated from counters and loads only account for their sizes, no surface or mesh data is ever copied.
+/// @note Renderables still issue their own GL calls, which are expected to resolve to the GL library's no-op dispatch when no GL context is current.
+@interface egwGfxContextNull : egwGfxContextAGL {
+    EGWuint _lastTexID;                     ///< Last allocated texture identifier.
+    EGWuint _lastBufID;                     ///< Last allocated buffer identifier.
+    
+    egwGfxCntxNullCounters _cCounters;      ///< Current frame counters.
+    egwGfxCntxNullCounters _lCounters;      ///< Last completed frame counters.
+    egwGfxCntxNullCounters _tCounters;      ///< Totaled counters over all completed frames.
+    EGWuint _frames;                        ///< Completed frames count.
+}
+
+/// Reset Counters Method.
+/// Resets the current, last completed, and totaled frame counters.
+- (void)resetCounters;
+
+
+/// Current Frame Counters Accessor.
+/// Returns the counters accumulated since the last completed frame.
+/// @return Current frame counters (weak).
+- (const egwGfxCntxNullCounters*)currentCounters;
+
+/// Last Frame Counters Accessor.
+/// Returns the counters of the last completed frame.
+/// @note Loads performed in between frames are accounted into the following frame.
+/// @return Last frame counters (weak).
+- (const egwGfxCntxNullCounters*)lastFrameCounters;
+
+/// Total Counters Accessor.
+/// Returns the counters totaled over all completed frames since the last reset.
+/// @return Total counters (weak).
+- (const egwGfxCntxNullCounters*)totalCounters;
+
+/// Frames Count Accessor.
+/// Returns the number of completed frames since the last reset.
+/// @return Completed frames count.
+- (EGWuint)framesCount;
+
+@end
+
+
+#else
+
+/// Null Graphics Context (Blank).
+/// Contains a placeholder to the actual class in the invalid build case.
+@interface egwGfxContextNull : egwGfxContextAGL {
+}
+@end
+
+#endif
+
+
+/// Global currently active egwGfxContextNull instance (weak).
+extern egwGfxContextNull* egwAIGfxCntxNull;
+
+/// Null Graphics Context Count Draws Routine.
+/// Counts @a drawCount draw submissions into the current frame counters of the active null context.
+/// @note Called right after each draw call is issued, does nothing when no null context is active.
+/// @param [in] drawCount Draw submissions issued.
+void egwGfxCntxNullCountDraws(EGWuint drawCount);
+
+/// @}
@@ -0,0 +1,863 @@
+// Copyright (C) 2008-2011 JWmicro. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of the JWmicro nor the names of its contributors may
+//    be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file egwGfxContextNull.m
+/// @ingroup geWizES_sys_gfxcontextnull
+/// Null (Headless) Graphics Context Implementation.
+
+#import <pthread.h>
+#import "egwGfxContextNull.h"
+#import "../sys/egwEngine.h"
+#import "../sys/egwGfxContextNSGL.h"
+#import "../sys/egwGfxContextEAGLES.h"
+#import "../math/egwMath.h"
+#import "../gfx/egwGraphics.h"
+#import "../gfx/egwLights.h"
+#import "../gfx/egwTexture.h"
+#import "../geo/egwGeometry.h"
+#import "../misc/egwValidater.h"
+
+
+egwGfxContextNull* egwAIGfxCntxNull = nil;
+
+
+#if defined(EGW_BUILDMODE_GFX_NULL)
+
+@implementation egwGfxContextNull
+
+static pthread_mutex_t _apiLock_Null = PTHREAD_MUTEX_INITIALIZER;
+
+void egwGfxCntxNullCountDraws(EGWuint drawCount) {
+    // NOTE: Only ever called from the rendering thread that owns the active context, same as the binding counters. -jw
+    if(egwAIGfxCntxNull && egwAIGfxCntxNull->_inPass)
+        egwAIGfxCntxNull->_cCounters.drawCalls += drawCount;
+}
+
+- (id)init {
+    return [self initWithParams:nil];
+}
+
+- (id)initWithParams:(void*)params {
+    egwGfxCntxParams* gfxParams = (egwGfxCntxParams*)params;
+    egwGfxContext* oldContext = nil;
+    
+    if(!(self = [super init])) { [self release]; return (self = nil); }
+    
+    // Handle params and set up any particulars (context data is unused)
+    if(!gfxParams) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure creating graphics context: Parameter's structure is NULL.");
+        [self release]; return (self = nil);
+    } else if(gfxParams->fbWidth <= 0 || gfxParams->fbHeight <= 0) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure creating graphics context: Width and height not specified.");
+        [self release]; return (self = nil);
+    }
+    _delegate = (gfxParams->delegate ? [gfxParams->delegate retain] : nil);
+    _width = gfxParams->fbWidth;
+    _height = gfxParams->fbHeight;
+    
+    // Lock API
+    pthread_mutex_lock(&_apiLock_Null);
+    
+    // Bind context (store old one for later)
+    oldContext = egwAIGfxCntx;
+    {   egwAIGfxCntx = self;
+        egwAIGfxCntxAGL = self;
+        egwAIGfxCntxNSGL = nil;
+        egwAIGfxCntxEAGLES = nil;
+        egwAIGfxCntxNull = self;
+        _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
+        
+        egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
+        egwAFPGfxCntxPopLights = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popLights:)];
+        egwAFPGfxCntxBindLights = (void(*)(id, SEL))[self methodForSelector:@selector(bindLights)];
+        egwAFPGfxCntxUnbindLights = (void(*)(id, SEL))[self methodForSelector:@selector(unbindLights)];
+        egwAFPGfxCntxPushMaterial = (void(*)(id, SEL, id<egwPMaterial>, const egwMaterialJumpTable*))[self methodForSelector:@selector(pushMaterial:withMaterialJumpTable:)];
+        egwAFPGfxCntxPopMaterials = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popMaterials:)];
+        egwAFPGfxCntxBindMaterials = (void(*)(id, SEL))[self methodForSelector:@selector(bindMaterials)];
+        egwAFPGfxCntxUnbindMaterials = (void(*)(id, SEL))[self methodForSelector:@selector(unbindMaterials)];
+        egwAFPGfxCntxPushShader = (void(*)(id, SEL, id<egwPShader>, const egwShaderJumpTable*))[self methodForSelector:@selector(pushShader:withShaderJumpTable:)];
+        egwAFPGfxCntxPopShaders = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popShaders:)];
+        egwAFPGfxCntxBindShaders = (void(*)(id, SEL))[self methodForSelector:@selector(bindShaders)];
+        egwAFPGfxCntxUnbindShaders = (void(*)(id, SEL))[self methodForSelector:@selector(unbindShaders)];
+        egwAFPGfxCntxPushTexture = (void(*)(id, SEL, id<egwPTexture>, const egwTextureJumpTable*))[self methodForSelector:@selector(pushTexture:withTextureJumpTable:)];
+        egwAFPGfxCntxPopTextures = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popTextures:)];
+        egwAFPGfxCntxBindTextures = (void(*)(id, SEL))[self methodForSelector:@selector(bindTextures)];
+        egwAFPGfxCntxUnbindTextures = (void(*)(id, SEL))[self methodForSelector:@selector(unbindTextures)];
+        egwAFPGfxCntxIlluminationFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(illuminationFrame)];
+        egwAFPGfxCntxRenderingFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(renderingFrame)];
+        egwAFPGfxCntxAdvanceIlluminationFrame = (void(*)(id, SEL))[self methodForSelector:@selector(advanceIlluminationFrame)];
+        egwAFPGfxCntxAdvanceRenderingFrame = (void(*)(id, SEL))[self methodForSelector:@selector(advanceRenderingFrame)];
+        egwAFPGfxCntxBeginRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(beginRender)];
+        egwAFPGfxCntxInterruptRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(interruptRender)];
+        egwAFPGfxCntxEndRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(endRender)];
+        egwAFPGfxCntxMakeActive = (BOOL(*)(id, SEL))[self methodForSelector:@selector(makeActive)];
+        egwAFPGfxCntxActive = (BOOL(*)(id, SEL))[self methodForSelector:@selector(isActive)];
+        egwAFPGfxCntxPerformSubTasks = (void(*)(id, SEL))[self methodForSelector:@selector(performSubTasks)];
+        egwAFPGfxCntxActiveCamera = (id<egwPCamera>(*)(id, SEL))[self methodForSelector:@selector(activeCamera)];
+        egwAFPGfxCntxActiveCameraViewingFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(activeCameraViewingFrame)];
+        egwAFPGfxCntxSetActiveCamera = (void(*)(id, SEL, id<egwPCamera>))[self methodForSelector:@selector(setActiveCamera:)];
+    }
+    
+    // No extensions are advertised
+    if(!(_extensions = [[NSArray alloc] init])) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    }
+    
+    // Create light holders
+    _actvLights = 0;
+    _maxLights = EGW_GFXCNTXNULL_MAXLIGHTS;
+    if(!(_lightStages = (egwLightStageAGL*)malloc(_maxLights * sizeof(egwLightStageAGL)))) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    } else {
+        for(EGWint lightStage = 0; lightStage < _maxLights; ++lightStage) {
+            _lightStages[lightStage].stack.exstStage = -1;
+            _lightStages[lightStage].stack.nextStage = -1;
+            _lightStages[lightStage].lru.stage = (EGWint8)lightStage;
+            _lightStages[lightStage].stage.nextStack = -1;
+            _lightStages[lightStage].stage.exstBind = nil;
+            _lightStages[lightStage].stage.exstJmpT = NULL;
+            _lightStages[lightStage].stage.nextBind = nil;
+            _lightStages[lightStage].stage.nextJmpT = NULL;
+            _lightStages[lightStage].stage.flags = EGW_STGFLGS_NONE;
+        }
+    }
+    
+    // Create material holders
+    _actvMaterials = 0;
+    _maxMaterials = 1; // NOTE: Kept the same as the GL single-material model. -jw
+    if(!(_materialStages = (egwMaterialStageAGL*)malloc(_maxMaterials * sizeof(egwMaterialStageAGL)))) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    } else {
+        for(EGWint materialStage = 0; materialStage < _maxMaterials; ++materialStage) {
+            _materialStages[materialStage].exstBind = nil;
+            _materialStages[materialStage].exstJmpT = NULL;
+            _materialStages[materialStage].nextBind = nil;
+            _materialStages[materialStage].nextJmpT = NULL;
+            _materialStages[materialStage].flags = EGW_STGFLGS_NONE;
+        }
+    }
+    
+    // Create texture holders
+    _actvTextures = 0;
+    _maxTextures = EGW_GFXCNTXNULL_MAXTEXTURES;
+    if(!(_textureStages = (egwTextureStageAGL*)malloc(_maxTextures * sizeof(egwTextureStageAGL)))) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    } else {
+        for(EGWint textureStage = 0; textureStage < _maxTextures; ++textureStage) {
+            _textureStages[textureStage].exstBind = nil;
+            _textureStages[textureStage].exstJmpT = NULL;
+            _textureStages[textureStage].nextBind = nil;
+            _textureStages[textureStage].nextJmpT = NULL;
+            _textureStages[textureStage].flags = EGW_STGFLGS_NONE;
+        }
+    }
+    
+    _maxTexSize.span.width = _maxTexSize.span.height = (EGWuint16)EGW_GFXCNTXNULL_MAXTEXSIZE;
+    
+    if(!(_availTexIDs = [[NSMutableIndexSet alloc] init])) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    }
+    if(!(_usedTexIDs = [[NSMutableIndexSet alloc] init])) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    }
+    if(!(_dstryTexIDs = [[NSMutableIndexSet alloc] init])) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    }
+    
+    if(!(_availBufIDs = [[NSMutableIndexSet alloc] init])) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    }
+    if(!(_usedBufIDs = [[NSMutableIndexSet alloc] init])) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    }
+    if(!(_dstryBufIDs = [[NSMutableIndexSet alloc] init])) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure allocating object.");
+        goto ErrorCleanup;
+    }
+    
+    _lightsEnabled = NO;
+    _materialsEnabled = NO;
+    _texturesEnabled = NO;
+    
+    // If there is a delegate defined, call its willFinish method
+    if(_delegate && ![_delegate willFinishInitializingGfxContext:self]) {
+        NSLog(@"egwGfxContextNull: initWithParams: Failure in user initialization code.");
+        goto ErrorCleanup;
+    }
+    
+    // If there was an old context, revert back to it, otherwise keep this one enabled.
+    pthread_mutex_unlock(&_apiLock_Null);
+    if(oldContext) [oldContext makeActive];
+    
+    [_delegate didFinishInitializingGfxContext:self];
+    
+    if(EGW_ENGINE_MANAGERS_STARTUPMSGS) NSLog(@"egwGfxContextNull: initWithParams: Graphics context has been initialized.");
+    
+    return self;
+
+ErrorCleanup:
+    _thread = nil;
+    pthread_mutex_unlock(&_apiLock_Null);
+    [oldContext makeActive];
+    [self release]; return (self = nil);
+}
+
+- (void)dealloc {
+    // Forced shutdown - delegates should not be able to cancel
+    {   id<egwDGfxContextEvent> delegate = _delegate;
+        _delegate = nil;
+        [self shutDownContext];
+        _delegate = delegate;
+        [_delegate didShutDownGfxContext:self];
+    }
+    
+    [super dealloc];
+}
+
+- (void)resetCounters {
+    pthread_mutex_lock(&_iLock);
+    
+    memset((void*)&_cCounters, 0, sizeof(egwGfxCntxNullCounters));
+    memset((void*)&_lCounters, 0, sizeof(egwGfxCntxNullCounters));
+    memset((void*)&_tCounters, 0, sizeof(egwGfxCntxNullCounters));
+    _frames = 0;
+    
+    pthread_mutex_unlock(&_iLock);
+}
+
+- (void)performSubTasks {
+    // NOTE: Destroyed identifiers were never backed by API objects, dropping them here keeps the AGL implementation from issuing deletes. -jw
+    if([_dstryTexIDs count] || [_dstryBufIDs count]) {
+        pthread_mutex_lock(&_iLock);
+        [_dstryTexIDs removeAllIndexes];
+        [_dstryBufIDs removeAllIndexes];
+        pthread_mutex_unlock(&_iLock);
+    }
+    
+    [super performSubTasks];
+}
+
+- (void)bindLights {
+    if(_inPass) {
+        if(_actvLights) {
+            if(!_lightsEnabled) ++_cCounters.stateChanges;
+            
+            for(EGWuint illumStage = 0; illumStage < _maxLights; ++illumStage) {
+                if(_lightStages[illumStage].stage.nextBind) {
+                    if(_lightStages[illumStage].stage.exstBind != _lightStages[illumStage].stage.nextBind ||
+                       (_lightStages[illumStage].stage.flags & (EGW_STGFLGS_ISUNBOUND | EGW_STGFLGS_ISINVALIDATED)))
+                        ++_cCounters.stateChanges;
+                } else if(_lightStages[illumStage].stage.exstBind && !(_lightStages[illumStage].stage.flags & EGW_STGFLGS_ISUNBOUND))
+                    ++_cCounters.stateChanges;
+            }
+        } else if(_lightsEnabled) ++_cCounters.stateChanges;
+        
+        [super bindLights];
+    }
+}
+
+- (void)unbindLights {
+    if(_inPass) {
+        for(EGWint lightIndex = 0; lightIndex < _maxLights && _lightStages[lightIndex].stack.exstStage != -1; ++lightIndex)
+            if(!(_lightStages[_lightStages[lightIndex].stack.exstStage].stage.flags & EGW_STGFLGS_ISUNBOUND))
+                ++_cCounters.stateChanges;
+        if(_lightsEnabled) ++_cCounters.stateChanges;
+        
+        [super unbindLights];
+    }
+}
+
+- (void)bindMaterials {
+    if(_inPass) {
+        if(_actvMaterials) {
+            if(!_materialsEnabled) ++_cCounters.stateChanges;
+            
+            for(EGWuint surfacingStage = 0; surfacingStage < _maxMaterials; ++surfacingStage) {
+                if(_materialStages[surfacingStage].exstBind || _materialStages[surfacingStage].nextBind) {
+                    if(_materialStages[surfacingStage].exstBind != _materialStages[surfacingStage].nextBind ||
+                       (_materialStages[surfacingStage].flags & EGW_STGFLGS_ISINVALIDATED))
+                        ++_cCounters.stateChanges;
+                } else break;
+            }
+        } else if(_materialsEnabled) ++_cCounters.stateChanges;
+        
+        [super bindMaterials];
+    }
+}
+
+- (void)unbindMaterials {
+    if(_inPass) {
+        for(EGWint surfacingStage = 0; surfacingStage < _maxMaterials; ++surfacingStage)
+            if(_materialStages[surfacingStage].exstBind)
+                ++_cCounters.stateChanges;
+        if(_materialsEnabled) ++_cCounters.stateChanges;
+        
+        [super unbindMaterials];
+    }
+}
+
+- (void)bindTextures {
+    if(_inPass) {
+        if(_actvTextures) {
+            if(!_texturesEnabled) ++_cCounters.stateChanges;
+            
+            for(EGWuint texturingStage = 0; texturingStage < _maxTextures; ++texturingStage) {
+                if(_textureStages[texturingStage].exstBind || _textureStages[texturingStage].nextBind) {
+                    if(_textureStages[texturingStage].exstBind != _textureStages[texturingStage].nextBind ||
+                       (_textureStages[texturingStage].flags & EGW_STGFLGS_ISINVALIDATED))
+                        ++_cCounters.stateChanges;
+                } else break;
+            }
+        } else if(_texturesEnabled) ++_cCounters.stateChanges;
+        
+        [super bindTextures];
+    }
+}
+
+- (void)unbindTextures {
+    if(_inPass) {
+        for(EGWint texturingStage = 0; texturingStage < _maxTextures; ++texturingStage)
+            if(_textureStages[texturingStage].exstBind)
+                ++_cCounters.stateChanges;
+        if(_texturesEnabled) ++_cCounters.stateChanges;
+        
+        [super unbindTextures];
+    }
+}
+
+- (EGWuint)requestFreeTextureID {
+    EGWuint textureID = NSNotFound;
+    
+    @synchronized(self) {
+        if(_lastTexID < (EGWuint)NSNotFound - 1) {
+            textureID = ++_lastTexID;
+            [_usedTexIDs addIndex:(NSUInteger)textureID];
+        } else {
+            NSLog(@"egwGfxContextNull: requestFreeTextureID: Failure generating new textures. Texture identifiers exhausted.");
+        }
+    }
+    
+    return textureID;
+}
+
+- (EGWuint)requestFreeBufferID {
+    EGWuint bufferID = 0;
+    
+    @synchronized(self) {
+        if(_lastBufID < (EGWuint)NSNotFound - 1) {
+            bufferID = ++_lastBufID;
+            [_usedBufIDs addIndex:(NSUInteger)bufferID];
+        } else {
+            NSLog(@"egwGfxContextNull: requestFreeBufferID: Failure generating new buffers. Buffer identifiers exhausted.");
+        }
+    }
+    
+    return bufferID;
+}
+
+- (BOOL)beginRender {
+    if(!_inPass && egwAIGfxCntx == self && _thread == egwSFPNSThreadCurrentThread(nil, @selector(currentThread))) {
+        _inPass = YES;
+        
+        egwAFPGfxCntxAGLCheckBindings(self, @selector(checkBindings));
+        
+        if(!_fTime && _delegate)
+            _fTime = [[NSDate alloc] initWithTimeIntervalSinceNow:(NSTimeInterval)EGW_GFXCONTEXT_FPSMEASURES];
+        
+        return YES;
+    } else {
+        NSLog(@"egwGfxContextNull: beginRender: Failure beginning render. Already in rendering pass or context not active [on this thread].");
+    }
+    
+    return NO;
+}
+
+- (BOOL)interruptRender {
+    if(_inPass && egwAIGfxCntx == self && _thread == egwSFPNSThreadCurrentThread(nil, @selector(currentThread))) {
+        _inPass = NO;
+        return YES;
+    } else {
+        NSLog(@"egwGfxContextNull: interruptRender: Failure interrupting render. Not in rendering pass or context not active [on this thread].");
+    }
+    
+    return NO;
+}
+
+- (BOOL)endRender {
+    if(_inPass && egwAIGfxCntx == self && _thread == egwSFPNSThreadCurrentThread(nil, @selector(currentThread))) {
+        // Roll current counters into last frame and totals
+        pthread_mutex_lock(&_iLock);
+        memcpy((void*)&_lCounters, (const void*)&_cCounters, sizeof(egwGfxCntxNullCounters));
+        _tCounters.drawCalls += _cCounters.drawCalls;
+        _tCounters.stateChanges += _cCounters.stateChanges;
+        _tCounters.bytesUploaded += _cCounters.bytesUploaded;
+        memset((void*)&_cCounters, 0, sizeof(egwGfxCntxNullCounters));
+        ++_frames;
+        pthread_mutex_unlock(&_iLock);
+        
+        if(_fTime) {
+            ++_fCount;
+            
+            if([_fTime timeIntervalSinceNow] < 0.0) {
+                _fpsAvg = (EGWsingle)_fCount / (EGWsingle)((NSTimeInterval)EGW_GFXCONTEXT_FPSMEASURES - [_fTime timeIntervalSinceNow]);
+                if(_delegate)
+                    [_delegate didUpdateContext:self framesPerSecond:_fpsAvg];
+                [_fTime release]; _fTime = nil; _fCount = 0;
+            }
+        }
+        
+        _inPass = NO;
+        
+        return YES;
+    } else {
+        NSLog(@"egwGfxContextNull: endRender: Failure ending render. Not in rendering pass or context not active [on this thread].");
+    }
+    
+    return NO;
+}
+
+- (BOOL)makeActive {
+    pthread_mutex_lock(&_apiLock_Null);
+    
+    if(!_inPass) {
+        if(_lightStages) {
+            egwAIGfxCntx = self;
+            egwAIGfxCntxAGL = self;
+            egwAIGfxCntxNSGL = nil;
+            egwAIGfxCntxEAGLES = nil;
+            egwAIGfxCntxNull = self;
+            _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
+            
+            egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
+            egwAFPGfxCntxPopLights = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popLights:)];
+            egwAFPGfxCntxBindLights = (void(*)(id, SEL))[self methodForSelector:@selector(bindLights)];
+            egwAFPGfxCntxUnbindLights = (void(*)(id, SEL))[self methodForSelector:@selector(unbindLights)];
+            egwAFPGfxCntxPushMaterial = (void(*)(id, SEL, id<egwPMaterial>, const egwMaterialJumpTable*))[self methodForSelector:@selector(pushMaterial:withMaterialJumpTable:)];
+            egwAFPGfxCntxPopMaterials = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popMaterials:)];
+            egwAFPGfxCntxBindMaterials = (void(*)(id, SEL))[self methodForSelector:@selector(bindMaterials)];
+            egwAFPGfxCntxUnbindMaterials = (void(*)(id, SEL))[self methodForSelector:@selector(unbindMaterials)];
+            egwAFPGfxCntxPushShader = (void(*)(id, SEL, id<egwPShader>, const egwShaderJumpTable*))[self methodForSelector:@selector(pushShader:withShaderJumpTable:)];
+            egwAFPGfxCntxPopShaders = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popShaders:)];
+            egwAFPGfxCntxBindShaders = (void(*)(id, SEL))[self methodForSelector:@selector(bindShaders)];
+            egwAFPGfxCntxUnbindShaders = (void(*)(id, SEL))[self methodForSelector:@selector(unbindShaders)];
+            egwAFPGfxCntxPushTexture = (void(*)(id, SEL, id<egwPTexture>, const egwTextureJumpTable*))[self methodForSelector:@selector(pushTexture:withTextureJumpTable:)];
+            egwAFPGfxCntxPopTextures = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popTextures:)];
+            egwAFPGfxCntxBindTextures = (void(*)(id, SEL))[self methodForSelector:@selector(bindTextures)];
+            egwAFPGfxCntxUnbindTextures = (void(*)(id, SEL))[self methodForSelector:@selector(unbindTextures)];
+            egwAFPGfxCntxIlluminationFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(illuminationFrame)];
+            egwAFPGfxCntxRenderingFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(renderingFrame)];
+            egwAFPGfxCntxAdvanceIlluminationFrame = (void(*)(id, SEL))[self methodForSelector:@selector(advanceIlluminationFrame)];
+            egwAFPGfxCntxAdvanceRenderingFrame = (void(*)(id, SEL))[self methodForSelector:@selector(advanceRenderingFrame)];
+            egwAFPGfxCntxBeginRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(beginRender)];
+            egwAFPGfxCntxInterruptRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(interruptRender)];
+            egwAFPGfxCntxEndRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(endRender)];
+            egwAFPGfxCntxMakeActive = (BOOL(*)(id, SEL))[self methodForSelector:@selector(makeActive)];
+            egwAFPGfxCntxActive = (BOOL(*)(id, SEL))[self methodForSelector:@selector(isActive)];
+            egwAFPGfxCntxPerformSubTasks = (void(*)(id, SEL))[self methodForSelector:@selector(performSubTasks)];
+            egwAFPGfxCntxActiveCamera = (id<egwPCamera>(*)(id, SEL))[self methodForSelector:@selector(activeCamera)];
+            egwAFPGfxCntxActiveCameraViewingFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(activeCameraViewingFrame)];
+            egwAFPGfxCntxSetActiveCamera = (void(*)(id, SEL, id<egwPCamera>))[self methodForSelector:@selector(setActiveCamera:)];
+            
+            pthread_mutex_unlock(&_apiLock_Null);
+            return YES;
+        } else {
+            NSLog(@"egwGfxContextNull: makeActive: Failure making active. Context is not valid.");
+        }
+    } else {
+        NSLog(@"egwGfxContextNull: makeActive: Failure making active. Already in rendering pass.");
+    }
+    
+    pthread_mutex_unlock(&_apiLock_Null);
+    return NO;
+}
+
+- (BOOL)makeActiveAndLocked {
+    if(!_inPass) {
+        if(_lightStages) {
+            pthread_mutex_lock(&_apiLock_Null);
+            
+            if(!_inPass) {
+                if(_lightStages) {
+                    egwAIGfxCntx = self;
+                    egwAIGfxCntxAGL = self;
+                    egwAIGfxCntxNSGL = nil;
+                    egwAIGfxCntxEAGLES = nil;
+                    egwAIGfxCntxNull = self;
+                    _thread = egwSFPNSThreadCurrentThread(nil, @selector(currentThread));
+                    
+                    egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))[self methodForSelector:@selector(pushLight:withLightJumpTable:)];
+                    egwAFPGfxCntxPopLights = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popLights:)];
+                    egwAFPGfxCntxBindLights = (void(*)(id, SEL))[self methodForSelector:@selector(bindLights)];
+                    egwAFPGfxCntxUnbindLights = (void(*)(id, SEL))[self methodForSelector:@selector(unbindLights)];
+                    egwAFPGfxCntxPushMaterial = (void(*)(id, SEL, id<egwPMaterial>, const egwMaterialJumpTable*))[self methodForSelector:@selector(pushMaterial:withMaterialJumpTable:)];
+                    egwAFPGfxCntxPopMaterials = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popMaterials:)];
+                    egwAFPGfxCntxBindMaterials = (void(*)(id, SEL))[self methodForSelector:@selector(bindMaterials)];
+                    egwAFPGfxCntxUnbindMaterials = (void(*)(id, SEL))[self methodForSelector:@selector(unbindMaterials)];
+                    egwAFPGfxCntxPushShader = (void(*)(id, SEL, id<egwPShader>, const egwShaderJumpTable*))[self methodForSelector:@selector(pushShader:withShaderJumpTable:)];
+                    egwAFPGfxCntxPopShaders = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popShaders:)];
+                    egwAFPGfxCntxBindShaders = (void(*)(id, SEL))[self methodForSelector:@selector(bindShaders)];
+                    egwAFPGfxCntxUnbindShaders = (void(*)(id, SEL))[self methodForSelector:@selector(unbindShaders)];
+                    egwAFPGfxCntxPushTexture = (void(*)(id, SEL, id<egwPTexture>, const egwTextureJumpTable*))[self methodForSelector:@selector(pushTexture:withTextureJumpTable:)];
+                    egwAFPGfxCntxPopTextures = (void(*)(id, SEL, EGWuint))[self methodForSelector:@selector(popTextures:)];
+                    egwAFPGfxCntxBindTextures = (void(*)(id, SEL))[self methodForSelector:@selector(bindTextures)];
+                    egwAFPGfxCntxUnbindTextures = (void(*)(id, SEL))[self methodForSelector:@selector(unbindTextures)];
+                    egwAFPGfxCntxIlluminationFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(illuminationFrame)];
+                    egwAFPGfxCntxRenderingFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(renderingFrame)];
+                    egwAFPGfxCntxAdvanceIlluminationFrame = (void(*)(id, SEL))[self methodForSelector:@selector(advanceIlluminationFrame)];
+                    egwAFPGfxCntxAdvanceRenderingFrame = (void(*)(id, SEL))[self methodForSelector:@selector(advanceRenderingFrame)];
+                    egwAFPGfxCntxBeginRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(beginRender)];
+                    egwAFPGfxCntxInterruptRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(interruptRender)];
+                    egwAFPGfxCntxEndRender = (BOOL(*)(id, SEL))[self methodForSelector:@selector(endRender)];
+                    egwAFPGfxCntxMakeActive = (BOOL(*)(id, SEL))[self methodForSelector:@selector(makeActive)];
+                    egwAFPGfxCntxActive = (BOOL(*)(id, SEL))[self methodForSelector:@selector(isActive)];
+                    egwAFPGfxCntxPerformSubTasks = (void(*)(id, SEL))[self methodForSelector:@selector(performSubTasks)];
+                    egwAFPGfxCntxActiveCamera = (id<egwPCamera>(*)(id, SEL))[self methodForSelector:@selector(activeCamera)];
+                    egwAFPGfxCntxActiveCameraViewingFrame = (EGWuint16(*)(id, SEL))[self methodForSelector:@selector(activeCameraViewingFrame)];
+                    egwAFPGfxCntxSetActiveCamera = (void(*)(id, SEL, id<egwPCamera>))[self methodForSelector:@selector(setActiveCamera:)];
+                    
+                    return YES;
+                } else {
+                    NSLog(@"egwGfxContextNull: makeActiveAndLocked: Failure making active. Context is not valid.");
+                    pthread_mutex_unlock(&_apiLock_Null);
+                }
+            } else {
+                NSLog(@"egwGfxContextNull: makeActiveAndLocked: Failure making active. Already in rendering pass.");
+                pthread_mutex_unlock(&_apiLock_Null);
+            }
+        } else {
+            NSLog(@"egwGfxContextNull: makeActiveAndLocked: Failure making active. Context is not valid.");
+        }
+    } else {
+        NSLog(@"egwGfxContextNull: makeActiveAndLocked: Failure making active. Already in rendering pass.");
+    }
+    
+    return NO;
+}
+
+- (BOOL)resizeBufferWidth:(EGWuint16)width bufferHeight:(EGWuint16)height {
+    if(!_inPass) {
+        _width = width;
+        _height = height;
+        return YES;
+    }
+    
+    return NO;
+}
+
+- (void)shutDownContext {
+    if(!_doShutdown) {
+        @synchronized(self) {
+            if(!_doShutdown) {
+                // Allow delegate to cancel shutDownContext, else proceed
+                if(_delegate && ![_delegate willShutDownGfxContext:self]) return;
+                _doShutdown = YES;
+                
+                if(EGW_ENGINE_MANAGERS_SHUTDOWNMSGS) NSLog(@"egwGfxContextNull: shutDownContext: Shutting down graphics context.");
+                
+                // Wait for renderer status to deactivate
+                if(_inPass) {
+                    NSDate* waitTill = [[NSDate alloc] initWithTimeIntervalSinceNow:(NSTimeInterval)EGW_ENGINE_MANAGERS_TIMETOWAIT];
+                    while(_inPass) {
+                        if([waitTill timeIntervalSinceNow] < (NSTimeInterval)0.0) {
+                            NSLog(@"egwGfxContextNull: shutDownContext: Failure waiting for renderer running status to deactivate.");
+                            break;
+                        }
+                        
+                        [NSThread sleepForTimeInterval:EGW_ENGINE_MANAGERS_TIMETOSLEEP];
+                    }
+                    [waitTill release];
+                }
+                
+                pthread_mutex_lock(&_apiLock_Null);
+                
+                // Identifiers were never backed by API objects, drop them so that none get deleted
+                [_dstryTexIDs removeAllIndexes];
+                [_usedTexIDs removeAllIndexes];
+                [_availTexIDs removeAllIndexes];
+                [_dstryBufIDs removeAllIndexes];
+                [_usedBufIDs removeAllIndexes];
+                [_availBufIDs removeAllIndexes];
+                
+                [super shutDownContext];
+                
+                if(egwAIGfxCntx == self) {
+                    egwAIGfxCntx = nil;
+                    egwAIGfxCntxAGL = nil;
+                    egwAIGfxCntxNSGL = nil;
+                    egwAIGfxCntxEAGLES = nil;
+                    egwAIGfxCntxNull = nil;
+                    _inPass = NO;
+                    
+                    egwAFPGfxCntxPushLight = (void(*)(id, SEL, id<egwPLight>, const egwLightJumpTable*))NULL;
+                    egwAFPGfxCntxPopLights = (void(*)(id, SEL, EGWuint))NULL;
+                    egwAFPGfxCntxBindLights = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxUnbindLights = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxPushMaterial = (void(*)(id, SEL, id<egwPMaterial>, const egwMaterialJumpTable*))NULL;
+                    egwAFPGfxCntxPopMaterials = (void(*)(id, SEL, EGWuint))NULL;
+                    egwAFPGfxCntxBindMaterials = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxUnbindMaterials = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxPushShader = (void(*)(id, SEL, id<egwPShader>, const egwShaderJumpTable*))NULL;
+                    egwAFPGfxCntxPopShaders = (void(*)(id, SEL, EGWuint))NULL;
+                    egwAFPGfxCntxBindShaders = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxUnbindShaders = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxPushTexture = (void(*)(id, SEL, id<egwPTexture>, const egwTextureJumpTable*))NULL;
+                    egwAFPGfxCntxPopTextures = (void(*)(id, SEL, EGWuint))NULL;
+                    egwAFPGfxCntxBindTextures = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxUnbindTextures = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxIlluminationFrame = (EGWuint16(*)(id, SEL))NULL;
+                    egwAFPGfxCntxRenderingFrame = (EGWuint16(*)(id, SEL))NULL;
+                    egwAFPGfxCntxAdvanceIlluminationFrame = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxAdvanceRenderingFrame = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxBeginRender = (BOOL(*)(id, SEL))NULL;
+                    egwAFPGfxCntxInterruptRender = (BOOL(*)(id, SEL))NULL;
+                    egwAFPGfxCntxEndRender = (BOOL(*)(id, SEL))NULL;
+                    egwAFPGfxCntxMakeActive = (BOOL(*)(id, SEL))NULL;
+                    egwAFPGfxCntxActive = (BOOL(*)(id, SEL))NULL;
+                    egwAFPGfxCntxPerformSubTasks = (void(*)(id, SEL))NULL;
+                    egwAFPGfxCntxActiveCamera = (id<egwPCamera>(*)(id, SEL))NULL;
+                    egwAFPGfxCntxActiveCameraViewingFrame = (EGWuint16(*)(id, SEL))NULL;
+                    egwAFPGfxCntxSetActiveCamera = (void(*)(id, SEL, id<egwPCamera>))NULL;
+                }
+                _thread = nil;
+                
+                pthread_mutex_unlock(&_apiLock_Null);
+                [_delegate didShutDownGfxContext:self];
+                
+                if(EGW_ENGINE_MANAGERS_SHUTDOWNMSGS) NSLog(@"egwGfxContextNull: shutDownContext: Graphics context shut down.");
+            }
+        }
+    }
+}
+
++ (EGWint)apiIdent {
+    return EGW_ENGINE_GFXAPI_NULL;
+}
+
++ (pthread_mutex_t*)apiMutex {
+    return &_apiLock_Null;
+}
+
+- (const egwGfxCntxNullCounters*)currentCounters {
+    return &_cCounters;
+}
+
+- (const egwGfxCntxNullCounters*)lastFrameCounters {
+    return &_lCounters;
+}
+
+- (const egwGfxCntxNullCounters*)totalCounters {
+    return &_tCounters;
+}
+
+- (EGWuint)framesCount {
+    return _frames;
+}
+
+@end
+
+
+@implementation egwGfxContextNull (TextureLoading)
+
+- (BOOL)loadTextureID:(EGWuint*)textureID withSurface:(egwSurface*)surface texturingTransforms:(EGWuint)transforms texturingFilter:(EGWuint)filter texturingSWrap:(EGWuint16)sWrap texturingTWrap:(EGWuint16)tWrap {
+    EGWuint bytes;
+    
+    if(!textureID || !surface || !surface->data) {
+        NSLog(@"egwGfxContextNull: loadTextureID:withSurface:texturingTransforms:texturingFilter:texturingSWrap:texturingTWrap: Invalid arguments passed to method.");
+        return NO;
+    }
+    
+    if(*textureID == 0 || *textureID == NSNotFound) {
+        if((*textureID = [self requestFreeTextureID]) == NSNotFound) {
+            NSLog(@"egwGfxContextNull: loadTextureID:withSurface:texturingTransforms:texturingFilter:texturingSWrap:texturingTWrap: Failure requesting free texture ID.");
+            return NO;
+        }
+    }
+    
+    if(filter & EGW_TEXTURE_FLTR_DFLTNMIP)
+        filter = (_dfltFilter & EGW_TEXTURE_FLTR_EXNMIPPED);
+    else if(filter & EGW_TEXTURE_FLTR_DFLTMIP)
+        filter = (_dfltFilter & EGW_TEXTURE_FLTR_EXMIPPED);
+    
+    bytes = (EGWuint)surface->pitch * (EGWuint)surface->size.span.height;
+    
+    // Account for generated mip levels the same size a device would be handed
+    if((filter & EGW_TEXTURE_FLTR_EXMIPPED) && !(surface->format & EGW_SURFACE_FRMT_EXCMPRSD)) {
+        EGWuint width = (EGWuint)surface->size.span.width;
+        EGWuint height = (EGWuint)surface->size.span.height;
+        EGWuint Bpp = (EGWuint)(surface->format & EGW_SURFACE_FRMT_EXBPP) >> 3;
+        
+        while(width > 1 || height > 1) {
+            width = (width > 1 ? width >> 1 : 1);
+            height = (height > 1 ? height >> 1 : 1);
+            bytes += width * height * Bpp;
+        }
+    }
+    
+    pthread_mutex_lock(&_iLock);
+    _cCounters.bytesUploaded += bytes;
+    pthread_mutex_unlock(&_iLock);
+    
+    return YES;
+}
+
+@end
+
+
+@implementation egwGfxContextNull (BufferLoading)
+
+- (BOOL)loadBufferArraysID:(EGWuint*)arraysBufID withSTVAMesh:(const egwSTVAMeshf*)mesh geometryStorage:(EGWuint)storage {
+    if(!arraysBufID || !mesh || !mesh->vCoords || !mesh->nCoords) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withSTVAMesh:geometryStorage: Invalid arguments passed to method.");
+        return NO;
+    }
+    
+    if(!(storage & EGW_GEOMETRY_STRG_EXVBO)) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withSTVAMesh:geometryStorage: Invalid geometry VBO storage setting '%p'.", storage);
+        return NO;
+    }
+    
+    if(!(*arraysBufID) && !(*arraysBufID = [self requestFreeBufferID])) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withSTVAMesh:geometryStorage: Failure getting new buffer ID for arrays buffer.");
+        return NO;
+    }
+    
+    pthread_mutex_lock(&_iLock);
+    _cCounters.bytesUploaded += (mesh->vCoords ? (EGWuint)sizeof(egwVector3f) * (EGWuint)mesh->vCount : (EGWuint)0) +
+                                (mesh->nCoords ? (EGWuint)sizeof(egwVector3f) * (EGWuint)mesh->vCount : (EGWuint)0) +
+                                (mesh->tCoords ? (EGWuint)sizeof(egwVector2f) * (EGWuint)mesh->vCount : (EGWuint)0);
+    pthread_mutex_unlock(&_iLock);
+    
+    return YES;
+}
+
+- (BOOL)loadBufferArraysID:(EGWuint*)arraysBufID bufferElementsID:(EGWuint*)elementsBufID withSJITVAMesh:(const egwSJITVAMeshf*)mesh geometryStorage:(EGWuint)storage {
+    if(!arraysBufID || !elementsBufID || !mesh || !mesh->vCoords || !mesh->nCoords || !mesh->fIndicies) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Invalid arguments passed to method.");
+        return NO;
+    }
+    
+    if(!(storage & EGW_GEOMETRY_STRG_EXVBO)) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Invalid geometry VBO storage setting '%p'.", storage);
+        return NO;
+    }
+    
+    if(!(*arraysBufID) && !(*arraysBufID = [self requestFreeBufferID])) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Failure getting new buffer ID for arrays buffer.");
+        return NO;
+    }
+    
+    if(!(*elementsBufID) && !(*elementsBufID = [self requestFreeBufferID])) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:bufferElementsID:withSJITVAMesh:geometryStorage: Failure getting new buffer ID for array elements buffer.");
+        *arraysBufID = [self returnUsedBufferID:*arraysBufID];
+        return NO;
+    }
+    
+    pthread_mutex_lock(&_iLock);
+    _cCounters.bytesUploaded += (mesh->vCoords ? (EGWuint)sizeof(egwVector3f) * (EGWuint)mesh->vCount : (EGWuint)0) +
+                                (mesh->nCoords ? (EGWuint)sizeof(egwVector3f) * (EGWuint)mesh->vCount : (EGWuint)0) +
+                                (mesh->tCoords ? (EGWuint)sizeof(egwVector2f) * (EGWuint)mesh->vCount : (EGWuint)0) +
+                                (egwMeshIsWideIndexed(mesh->vCount) ? (EGWuint)sizeof(egwJITFace32) : (EGWuint)sizeof(egwJITFace)) * (EGWuint)mesh->fCount;
+    pthread_mutex_unlock(&_iLock);
+    
+    return YES;
+}
+
+- (BOOL)loadBufferArraysID:(EGWuint*)arraysBufID withSQVAMesh:(const egwSQVAMesh4f*)mesh geometryStorage:(EGWuint)storage {
+    if(!arraysBufID || !mesh) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withSQVAMesh:geometryStorage: Invalid arguments passed to method.");
+        return NO;
+    }
+    
+    if(!(storage & EGW_GEOMETRY_STRG_EXVBO)) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withSQVAMesh:geometryStorage: Invalid geometry VBO storage setting '%p'.", storage);
+        return NO;
+    }
+    
+    if(!(*arraysBufID) && !(*arraysBufID = [self requestFreeBufferID])) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withSQVAMesh:geometryStorage: Failure getting new buffer ID for arrays buffer.");
+        return NO;
+    }
+    
+    pthread_mutex_lock(&_iLock);
+    _cCounters.bytesUploaded += (EGWuint)sizeof(egwSQVAMesh4f);
+    pthread_mutex_unlock(&_iLock);
+    
+    return YES;
+}
+
+- (BOOL)loadBufferArraysID:(EGWuint*)arraysBufID withRawData:(const EGWbyte*)rawData dataSize:(EGWuint)dataSize geometryStorage:(EGWuint)storage {
+    if(!arraysBufID || !rawData) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withRawData:dataSize:geometryStorage: Invalid arguments passed to method.");
+        return NO;
+    }
+    
+    if(!(storage & EGW_GEOMETRY_STRG_EXVBO)) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withRawData:dataSize:geometryStorage: Invalid geometry VBO storage setting '%p'.", storage);
+        return NO;
+    }
+    
+    if(!(*arraysBufID) && !(*arraysBufID = [self requestFreeBufferID])) {
+        NSLog(@"egwGfxContextNull: loadBufferArraysID:withRawData:dataSize:geometryStorage: Failure getting new buffer ID for arrays buffer.");
+        return NO;
+    }
+    
+    pthread_mutex_lock(&_iLock);
+    _cCounters.bytesUploaded += dataSize;
+    pthread_mutex_unlock(&_iLock);
+    
+    return YES;
+}
+
+@end
+
+
+#else
+
+void egwGfxCntxNullCountDraws(EGWuint drawCount) {
+}
+
+@implementation egwGfxContextNull
+
+- (id)init {
+    NSLog(@"egwGfxContextNull: init: Cannot initialize object due to build mode settings. YOU'RE DOING IT WRONG!");
+    
+    [self release]; return (self = nil);
+}
+
+- (id)initWithParams:(void*)params {
+    NSLog(@"egwGfxContextNull: initWithParams: Cannot initialize object due to build mode settings. YOU'RE DOING IT WRONG!");
+    
+    [self release]; return (self = nil);
+}
+
+@end
+
+#endif
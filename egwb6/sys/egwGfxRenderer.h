@@ -39,11 +39,16 @@
 #import "../data/egwDataTypes.h"
 
 
-#define EGW_GFXRNDRR_RNDRMODE_DFLT          0x0302  ///< Default render mode.
+#define EGW_GFXRNDRR_RNDRMODE_DFLT          0x1702  ///< Default render mode.
 #define EGW_GFXRNDRR_RNDRMODE_IMMEDIATE     0x0001  ///< Use immediate rendering mode.
 #define EGW_GFXRNDRR_RNDRMODE_DEFERRED      0x0002  ///< Use deferred rendering mode (i.e. sorted list).
 #define EGW_GFXRNDRR_RNDRMODE_PERSISTENT    0x0100  ///< Use a persistent object list (i.e. manual removal). Note: If unused, all objects are removed after each frame and must be re-enqueued.
 #define EGW_GFXRNDRR_RNDRMODE_FRAMECHECK    0x0200  ///< Use delayed object removal (i.e. frame number check).
+#define EGW_GFXRNDRR_RNDRMODE_FRUSTUMCULL   0x0400  ///< Use frustum culling of rendering bounding volumes against perspective queue cameras.
+#define EGW_GFXRNDRR_RNDRMODE_RADIXSORT     0x0800  ///< Use flat render lists that are radix sorted by packed 64-bit sort keys each frame (i.e. instead of red-black trees).
+#define EGW_GFXRNDRR_RNDRMODE_PARALLELVLD   0x1000  ///< Use the task thread pool for the pre frame check, validation & sort descriptor pass (render pass stays on renderer thread).
+#define EGW_GFXRNDRR_RNDRMODE_RECORDED      0x2000  ///< Use the task thread pool to record render passes into command buffers, then replay them on renderer thread (objects that cannot record are called upon replay).
+#define EGW_GFXRNDRR_RNDRMODE_BATCHED       0x4000  ///< Use merged draws for runs of opaque objects sharing the same rendering base and binding stack hashes (objects that cannot batch are rendered individually).
 
 #define EGW_GFXRNDRR_RNDRQUEUE_ALL          0x00ff  ///< All rendering queues.
 #define EGW_GFXRNDRR_RNDRQUEUE_FIRSTPASS    0x0001  ///< First pass rendering queue.
@@ -60,6 +65,13 @@
 #define EGW_GFXRNDRR_RNDRQUEUE_PAUSE        0x0400  ///< Pause/resume object in queue list structure.
 
 #define EGW_GFXRNDRR_DFLTPRIORITY   0.75    ///< Default graphics renderer priority.
+#define EGW_GFXRNDRR_RQSTRINGSIZE   256     ///< Lock-free request ring capacity (requests beyond this spill onto a locked overflow list).
+#define EGW_GFXRNDRR_RQSTBATCHSIZE  32      ///< Request ring dequeue batch size.
+#define EGW_GFXRNDRR_PVLDMINITEMS   64      ///< Minimum work items before the validation pass is farmed out to the task thread pool.
+#define EGW_GFXRNDRR_RCMDMINITEMS   32      ///< Minimum work items in a render pass before it is recorded instead of rendered directly.
+#define EGW_GFXRNDRR_RCMDBUFFERS    8       ///< Render command buffers (recording chunks) per render pass.
+#define EGW_GFXRNDRR_BATCHMINITEMS  4       ///< Minimum work items in a run before it is batched instead of rendered individually.
+#define EGW_GFXRNDRR_BATCHMAXITEMS  128     ///< Maximum work items in a single batched run.
 
 
 /// Graphics Renderer.
@@ -68,9 +80,10 @@
     egwGfxRdrParams _params;                ///< Renderer parameters (copy).
     
     pthread_mutex_t _qLock;                 ///< Render queue mutex lock.
-    pthread_mutex_t _rLock;                 ///< Request queue mutex lock.
     
     egwRedBlackTree _rQueues[8];            ///< Render queues (contents retained).
+    egwArray _rLists[8];                    ///< Flat render lists, for radix sort mode (contents retained).
+    egwArray _rSorts[2];                    ///< Flat render list sort entries and radix scratch, for radix sort mode (weak).
     egwTaskCameraData _rCameras[8];         ///< Rendering task cameras data (contents retained).
     
     EGWuint _rReplies[8];                   ///< Render replies array (alias).
@@ -78,7 +91,12 @@
     EGWuint8 _shadeMods[8];                 ///< Shading modifiers per queue.
     
     egwArray _pendingList;                  ///< Queue work item pending list for remove/resort (weak).
-    egwArray _requestList;                  ///< Queue work request list for insertion/removal.
+    egwArray _validList;                    ///< Queue work item validation list for pre frame check, grouped by tree root for validation (weak).
+    egwRequestRing _requestRing;            ///< Queue work request ring for insertion/removal (lock-free, contents retained).
+    egwArray _recordList;                   ///< Render pass record entries, for recorded mode (weak).
+    egwGfxCommandBuffer _rCmdBufs[EGW_GFXRNDRR_RCMDBUFFERS];///< Render command buffers, for recorded mode (owned).
+    egwArray _batchList;                    ///< Render pass batch run entries, for batched mode (weak).
+    egwGfxBatchScratch _batchScratch;       ///< Merged arrays scratch of batched runs, for batched mode (owned).
     
     id<NSObject> _lBase;                    ///< Last base tracker (retained).
     EGWuint16 _tFrame;                      ///< Rendering task frame.
@@ -124,6 +142,11 @@
 /// @return Rendering camera object.
 - (id<egwPCamera>)renderingCameraForQueue:(EGWuint)queueIdent;
 
+/// Request Overflows Accessor.
+/// Returns the number of requests that have overflowed the lock-free request ring onto its locked overflow list.
+/// @return Overflowed request count.
+- (EGWuint)requestOverflows;
+
 
 /// Rendering Camera Mutator.
 /// Sets the @a camera object used as the rendering source for queue @a queueIdent.
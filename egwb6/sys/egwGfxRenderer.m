@@ -28,12 +28,17 @@
 #import "egwGfxRenderer.h"
 #import "../sys/egwEngine.h"
 #import "../sys/egwTaskManager.h"
+#import "../inf/egwPObjNode.h"
 #import "../sys/egwGfxContext.h"
+#import "../sys/egwGfxCommands.h"
 #import "../math/egwMath.h"
 #import "../math/egwVector.h"
+#import "../geo/egwGeometry.h"
 #import "../data/egwArray.h"
+#import "../data/egwRequestRing.h"
 #import "../data/egwRedBlackTree.h"
 #import "../gfx/egwBindingStacks.h"
+#import "../gfx/egwBoundings.h"
 #import "../gfx/egwCameras.h"
 #import "../misc/egwValidater.h"
 
@@ -46,6 +51,7 @@ egwGfxRenderer* egwSIGfxRdr = nil;
 #define EGW_RDRWRKITM_SORTDESCLEN   14      // Sort description max length
 #define EGW_RDRWRKITMFLG_NONE       0x00    // No flags
 #define EGW_RDRWRKITMFLG_RANPASS    0x01    // Render pass already ran
+#define EGW_RDRWRKITMFLG_CULLED     0x02    // Render item culled from current pass
 #define EGW_RDRWRKITMFLG_ATPMASK    0xf0    // Render item adds to pending list mask
 #define EGW_RDRWRKITMFLG_DELETE     0x10    // Render item needs deleted
 #define EGW_RDRWRKITMFLG_RESORT     0x20    // Render item needs resorted / validated
@@ -76,11 +82,47 @@ typedef struct {
     EGWuint16 tFrame;                       // Task item frame.
     EGWuint8 tFlags;                        // Task item flags.
     EGWuint8 qIndex;                        // Source queue of item, for insert/resort/remove.
+    EGWuint8 cPlane;                        // Last culling frustum plane index (plane coherency).
+    BOOL isNode;                            // Object is an object tree node (validation grouped by tree root).
     id<egwPRenderable> object;              // Ref to graphics object (retained).
     egwValidater* sync;                     // Ref to validation sync (strong).
     const egwRenderableJumpTable* rJmpT;    // Ref to renderable jump table.
 } egwRenderingWorkItem;
 
+typedef struct {
+    EGWuint64 sortKey;                      // Packed sort key (see egwRWISortKey).
+    egwRenderingWorkItem* item;             // Ref to work item (weak).
+} egwRenderingWorkSortEntry;
+
+typedef struct {
+    egwRedBlackTreeIter tIter;              // Tree queue iterator.
+    EGWbyte* fPos;                          // Flat list current position (NULL if tree queue).
+    EGWbyte* fEnd;                          // Flat list ending position.
+    EGWuint fStride;                        // Flat list element stride.
+    BOOL fSorted;                           // Flat list is of sort entries.
+} egwRenderingQueueIter;
+
+typedef struct {
+    egwRenderingWorkSortEntry* entries;     // Validation entries, sort key is validation group (weak).
+    EGWuint eCount;                         // Validation entries count.
+    egwTaskCameraData* rCameras;            // Rendering task cameras (weak).
+    EGWuint16 rFrame;                       // Rendering frame for pre frame check.
+    EGWuint8 sOverrides;                    // Sort descriptor update overrides per queue (viewing camera invalidated).
+    BOOL doResorts;                         // Leave resort flag up on sort descriptor change (tree queues).
+} egwRenderingValidateJob;
+
+typedef struct {
+    egwRenderingWorkItem* item;             // Ref to work item (weak).
+    EGWuint32 replyFlags;                   // Rendering reply flags (including same last base).
+} egwRenderingRecordEntry;
+
+typedef struct {
+    egwRenderingRecordEntry* entries;       // Record entries, in render order (weak).
+    EGWuint eCount;                         // Record entries count.
+    EGWuint ePerBuffer;                     // Record entries per command buffer.
+    egwGfxCommandBuffer* cmdBuffers;        // Command buffers, one per chunk of entries (weak).
+} egwRenderingRecordJob;
+
 EGWint egwRWICompare(egwRenderingWorkItem* item1, egwRenderingWorkItem* item2, size_t size) {
     if(item1->sortDesc.isOpaque == 1 && item2->sortDesc.isOpaque == 1) {
         if(item1->sortDesc.data.opaque.shdrStkHash == item2->sortDesc.data.opaque.shdrStkHash) {
@@ -102,6 +144,39 @@ EGWint egwRWICompare(egwRenderingWorkItem* item1, egwRenderingWorkItem* item2, s
         return (item1->sortDesc.isOpaque ? -1 : 1);
 }
 
+EGWint egwRQEnumerateTreeStart(egwRedBlackTree* tree, egwRenderingQueueIter* iter) {
+    iter->fPos = iter->fEnd = NULL;
+    return egwRBTreeEnumerateStart(tree, EGW_ITERATE_MODE_BSTLSR, &iter->tIter);
+}
+
+EGWint egwRQEnumerateListStart(egwArray* list, egwRenderingQueueIter* iter) {
+    iter->fPos = list->rData;
+    iter->fEnd = list->rData + ((EGWuintptr)list->eCount * (EGWuintptr)sizeof(egwRenderingWorkItem));
+    iter->fStride = sizeof(egwRenderingWorkItem);
+    iter->fSorted = NO;
+    return (list->eCount ? 1 : 0);
+}
+
+EGWint egwRQEnumerateSortStart(egwRenderingWorkSortEntry* entries, EGWuint count, egwRenderingQueueIter* iter) {
+    iter->fPos = (EGWbyte*)entries;
+    iter->fEnd = (EGWbyte*)(entries + count);
+    iter->fStride = sizeof(egwRenderingWorkSortEntry);
+    iter->fSorted = YES;
+    return (count ? 1 : 0);
+}
+
+egwRenderingWorkItem* egwRQEnumerateNextPtr(egwRenderingQueueIter* iter) {
+    if(iter->fPos) {
+        if(iter->fPos < iter->fEnd) {
+            EGWbyte* pos = iter->fPos;
+            iter->fPos += iter->fStride;
+            return (iter->fSorted ? ((egwRenderingWorkSortEntry*)pos)->item : (egwRenderingWorkItem*)pos);
+        }
+        return NULL;
+    }
+    return (egwRenderingWorkItem*)egwRBTreeEnumerateNextPtr(&iter->tIter);
+}
+
 void egwRWIAdd(egwRenderingWorkItem* item) {
     item->rJmpT->fpRetain(item->object, @selector(retain));
     //[item->sync retain];
@@ -113,6 +188,96 @@ void egwRWIRemove(egwRenderingWorkItem* item) {
     item->sync = nil;
 }
 
+EGWuint64 egwRWISortKey(const egwRenderingWorkItem* item) {
+    // NOTE: Key mirrors egwRWICompare ordering: opaques first (high bit clear) ordered by folded 16-bit shader, texture, material, then light stack hashes, then transparents ordered by ascending distance. Hash folding can interleave colliding stacks, which only costs state changes, not correctness. -jw
+    if(item->sortDesc.isOpaque) {
+        return ((((EGWuint64)((item->sortDesc.data.opaque.shdrStkHash ^ (item->sortDesc.data.opaque.shdrStkHash >> 16)) & 0x7fff)) << 48) |
+                (((EGWuint64)((item->sortDesc.data.opaque.txtrStkHash ^ (item->sortDesc.data.opaque.txtrStkHash >> 16)) & 0xffff)) << 32) |
+                (((EGWuint64)((item->sortDesc.data.opaque.mtrlStkHash ^ (item->sortDesc.data.opaque.mtrlStkHash >> 16)) & 0xffff)) << 16) |
+                ((EGWuint64)((item->sortDesc.data.opaque.lghtStkHash ^ (item->sortDesc.data.opaque.lghtStkHash >> 16)) & 0xffff)));
+    } else {
+        union { EGWsingle f; EGWuint32 u; } dist;
+        dist.f = (EGWsingle)item->sortDesc.data.trans.distFromCam;
+        dist.u = (dist.u & 0x80000000 ? ~dist.u : dist.u | 0x80000000); // order-preserving float bits
+        return (((EGWuint64)1) << 63) | (((EGWuint64)dist.u) << 31);
+    }
+}
+
+egwRenderingWorkSortEntry* egwRWIRadixSort(egwRenderingWorkSortEntry* entries, egwRenderingWorkSortEntry* scratch, EGWuint count) {
+    // NOTE: LSD radix sort over 8 byte digits, all histograms built in one sweep. Digits where every key shares the same byte are skipped, which is most of them for transparents and small scenes. Sort is stable, so equal keys keep list order. -jw
+    EGWuint32 counts[8][256];
+    egwRenderingWorkSortEntry* src = entries;
+    egwRenderingWorkSortEntry* dst = scratch;
+    EGWuint index, digit;
+    
+    memset((void*)counts, 0, sizeof(counts));
+    
+    for(index = 0; index < count; ++index) {
+        EGWuint64 key = entries[index].sortKey;
+        for(digit = 0; digit < 8; ++digit, key >>= 8)
+            ++counts[digit][key & 0xff];
+    }
+    
+    for(digit = 0; digit < 8; ++digit) {
+        EGWuint32* digitCounts = counts[digit];
+        EGWuint32 offset = 0, total;
+        EGWuint shift = digit << 3;
+        
+        if(digitCounts[(src[0].sortKey >> shift) & 0xff] == count)
+            continue; // all keys share this digit
+        
+        for(index = 0; index < 256; ++index) {
+            total = digitCounts[index];
+            digitCounts[index] = offset;
+            offset += total;
+        }
+        
+        for(index = 0; index < count; ++index)
+            dst[digitCounts[(src[index].sortKey >> shift) & 0xff]++] = src[index];
+        
+        { egwRenderingWorkSortEntry* swap = src; src = dst; dst = swap; }
+    }
+    
+    return src;
+}
+
+EGWint egwRWICullSphere(egwRenderingWorkItem* item, const egwFrustum4f* frustum, const egwSphere4f* sphere) {
+    // NOTE: Frustum planes are laid out contiguously, starting at xMin. The plane that last culled this item is tested first since it is the most likely to cull it again next frame. -jw
+    const egwPlane4f* planes = &(frustum->xMin);
+    EGWuint pIndex = item->cPlane, pCount;
+    
+    for(pCount = 0; pCount < 6; ++pCount) {
+        if(egwVecDotProd3f((egwVector3f*)&(planes[pIndex].normal), (egwVector3f*)&(sphere->origin)) + planes[pIndex].d + sphere->radius < -EGW_SFLT_EPSILON) {
+            item->cPlane = (EGWuint8)pIndex;
+            return 1;
+        }
+        if(++pIndex >= 6) pIndex = 0;
+    }
+    
+    return 0;
+}
+
+EGWint egwRWICullBox(egwRenderingWorkItem* item, const egwFrustum4f* frustum, const egwBox4f* box) {
+    const egwPlane4f* planes = &(frustum->xMin);
+    EGWuint pIndex = item->cPlane, pCount;
+    egwVector3f edge;
+    
+    for(pCount = 0; pCount < 6; ++pCount) {
+        // Test box corner furthest along plane normal (p-vertex), box is culled only if it too is outside
+        edge.axis.x = (planes[pIndex].normal.axis.x >= -EGW_SFLT_EPSILON ? box->max.axis.x : box->min.axis.x);
+        edge.axis.y = (planes[pIndex].normal.axis.y >= -EGW_SFLT_EPSILON ? box->max.axis.y : box->min.axis.y);
+        edge.axis.z = (planes[pIndex].normal.axis.z >= -EGW_SFLT_EPSILON ? box->max.axis.z : box->min.axis.z);
+        
+        if(egwVecDotProd3f((egwVector3f*)&(planes[pIndex].normal), &edge) + planes[pIndex].d < -EGW_SFLT_EPSILON) {
+            item->cPlane = (EGWuint8)pIndex;
+            return 1;
+        }
+        if(++pIndex >= 6) pIndex = 0;
+    }
+    
+    return 0;
+}
+
 EGWint egwRWIUpdate(egwRenderingWorkItem* item, egwTaskCameraData* rCamera) {
     {   EGWuint isOpaque = item->rJmpT->fpOpaque(item->object, @selector(isOpaque));
         if(item->sortDesc.isOpaque != isOpaque) {
@@ -195,6 +360,163 @@ EGWint egwRWIUpdate(egwRenderingWorkItem* item, egwTaskCameraData* rCamera) {
     return 0;
 }
 
+void egwRWICheck(egwRenderingWorkSortEntry* entry, const egwRenderingValidateJob* job) {
+    egwRenderingWorkItem* item = entry->item;
+    EGWuint16 wItmRFrame = item->rJmpT->fpRFrame(item->object, @selector(renderingFrame));
+    
+    // Flag out-of-date objects for removal
+    if(((job->rFrame != EGW_FRAME_ALWAYSPASS && wItmRFrame != EGW_FRAME_ALWAYSPASS && wItmRFrame != job->rFrame) ||
+        wItmRFrame == EGW_FRAME_ALWAYSFAIL || job->rFrame == EGW_FRAME_ALWAYSFAIL) ||
+       !item->rJmpT->fpRendering(item->object, @selector(isRendering))) {
+        item->tFlags |= EGW_RDRWRKITMFLG_DELETE;
+    } else if((job->sOverrides & (1 << item->qIndex)) || egwSFPVldtrIsInvalidated(item->sync, @selector(isInvalidated))) {
+        // NOTE: Orientation updates walk up through (and merge into) shared parents, so items are grouped by tree root (or by object when not in a tree, which also groups an object's items across queues). -jw
+        id group = (item->isNode ? (id)[(id<egwPObjectNode>)item->object root] : nil);
+        
+        item->tFlags |= EGW_RDRWRKITMFLG_RESORT;
+        entry->sortKey = (EGWuint64)(uintptr_t)(group ? group : (id)item->object);
+    }
+}
+
+void egwRWICheckRange(void* context, EGWuint begin, EGWuint end) {
+    egwRenderingValidateJob* job = (egwRenderingValidateJob*)context;
+    
+    for(; begin < end; ++begin)
+        egwRWICheck(&job->entries[begin], job);
+}
+
+void egwRWIValidateRange(void* context, EGWuint begin, EGWuint end) {
+    egwRenderingValidateJob* job = (egwRenderingValidateJob*)context;
+    egwRenderingWorkItem* item;
+    
+    // Widen chunk to whole validation groups, a group belongs to the chunk holding its first entry
+    while(begin < end && begin && job->entries[begin].sortKey == job->entries[begin-1].sortKey) ++begin;
+    if(begin >= end) return;
+    while(end < job->eCount && job->entries[end].sortKey == job->entries[end-1].sortKey) ++end;
+    
+    for(; begin < end; ++begin) {
+        item = job->entries[begin].item;
+        
+        // NOTE: Validation will spark an orientation update, if pending, this must happen before the sort descriptor is built -jw
+        egwSFPVldtrValidate(item->sync, @selector(validate)); // NOTE: This is a redundent call if on several queues, but those items share a group -jw
+        
+        if(!egwRWIUpdate(item, &job->rCameras[item->qIndex]) || !job->doResorts)
+            item->tFlags &= ~EGW_RDRWRKITMFLG_RESORT;
+    }
+}
+
+void egwRWIRecordRange(void* context, EGWuint begin, EGWuint end) {
+    egwRenderingRecordJob* job = (egwRenderingRecordJob*)context;
+    egwRenderingRecordEntry* entry;
+    EGWuint eIndex, eEnd;
+    
+    for(; begin < end; ++begin) { // Each index is a command buffer recording its own chunk of entries, keeping render order when replayed in sequence
+        egwGfxCmdBufferReset(&job->cmdBuffers[begin]);
+        
+        for(eIndex = begin * job->ePerBuffer, eEnd = egwMin2(eIndex + job->ePerBuffer, job->eCount); eIndex < eEnd; ++eIndex) {
+            entry = &job->entries[eIndex];
+            
+            if(entry->item->rJmpT->fpRecord)
+                entry->item->rJmpT->fpRecord(entry->item->object, @selector(recordWithFlags:intoCommands:), entry->replyFlags, &job->cmdBuffers[begin]);
+            else
+                egwGfxCmdRecordRender(&job->cmdBuffers[begin], entry->item->object, entry->item->rJmpT->fpRender, entry->replyFlags);
+        }
+    }
+}
+
+void egwRWIReplayRecords(egwArray* recordList, egwGfxCommandBuffer* cmdBuffers) {
+    // Record pass into command buffers across the task thread pool, then replay buffers in order on this thread
+    // NOTE: Culling, validation, & same last base tracking already ran, recording only reads object transforms & geometry state. -jw
+    egwRenderingRecordEntry* recordEntries = (egwRenderingRecordEntry*)(recordList->rData);
+    EGWuint rIndex;
+    
+    if(recordList->eCount >= EGW_GFXRNDRR_RCMDMINITEMS) {
+        egwRenderingRecordJob job;
+        EGWuint bIndex, bCount;
+        
+        job.entries = recordEntries;
+        job.eCount = (EGWuint)recordList->eCount;
+        job.ePerBuffer = (job.eCount + EGW_GFXRNDRR_RCMDBUFFERS - 1) / EGW_GFXRNDRR_RCMDBUFFERS;
+        job.cmdBuffers = cmdBuffers;
+        bCount = (job.eCount + job.ePerBuffer - 1) / job.ePerBuffer;
+        
+        [egwSITaskMngr parallelForRangeFrom:0 to:bCount withGrain:1 usingRoutine:&egwRWIRecordRange withContext:(void*)&job];
+        
+        for(bIndex = 0; bIndex < bCount; ++bIndex) {
+            if(!cmdBuffers[bIndex].overflowed)
+                egwGfxCmdBufferReplay(&cmdBuffers[bIndex]);
+            else { // Out of memory while recording, render chunk directly
+                for(rIndex = bIndex * job.ePerBuffer; rIndex < egwMin2((bIndex + 1) * job.ePerBuffer, job.eCount); ++rIndex)
+                    recordEntries[rIndex].item->rJmpT->fpRender(recordEntries[rIndex].item->object, @selector(renderWithFlags:), recordEntries[rIndex].replyFlags);
+            }
+        }
+    } else { // Too few items to be worth recording
+        for(rIndex = 0; rIndex < (EGWuint)recordList->eCount; ++rIndex)
+            recordEntries[rIndex].item->rJmpT->fpRender(recordEntries[rIndex].item->object, @selector(renderWithFlags:), recordEntries[rIndex].replyFlags);
+    }
+    
+    recordList->eCount = 0;
+}
+
+void egwRWIRenderEntry(egwRenderingRecordEntry* entry, egwArray* recordList) {
+    if(recordList) { // Defer into record list, render directly if list cannot grow (must flush list first to keep order)
+        egwRenderingRecordEntry* recordEntries;
+        EGWuint rIndex;
+        
+        if(egwArrayAddTail(recordList, (const EGWbyte*)entry))
+            return;
+        
+        recordEntries = (egwRenderingRecordEntry*)(recordList->rData);
+        for(rIndex = 0; rIndex < (EGWuint)recordList->eCount; ++rIndex)
+            recordEntries[rIndex].item->rJmpT->fpRender(recordEntries[rIndex].item->object, @selector(renderWithFlags:), recordEntries[rIndex].replyFlags);
+        recordList->eCount = 0;
+    }
+    
+    entry->item->rJmpT->fpRender(entry->item->object, @selector(renderWithFlags:), entry->replyFlags);
+}
+
+BOOL egwRWIIsBatchable(egwRenderingWorkItem* item) {
+    return (item->sortDesc.isOpaque == 1 && item->rJmpT->fpBatch ? YES : NO);
+}
+
+BOOL egwRWIIsSameBatch(egwRenderingWorkItem* item1, egwRenderingWorkItem* item2) {
+    // NOTE: Stack hashes are refreshed by the validation pass each frame, sorted opaque queues already place equal stacks next to each other. -jw
+    return (item1->rJmpT == item2->rJmpT &&
+            item1->sortDesc.data.opaque.lghtStkHash == item2->sortDesc.data.opaque.lghtStkHash &&
+            item1->sortDesc.data.opaque.mtrlStkHash == item2->sortDesc.data.opaque.mtrlStkHash &&
+            item1->sortDesc.data.opaque.shdrStkHash == item2->sortDesc.data.opaque.shdrStkHash &&
+            item1->sortDesc.data.opaque.txtrStkHash == item2->sortDesc.data.opaque.txtrStkHash &&
+            item1->rJmpT->fpRBase(item1->object, @selector(renderingBase)) == item2->rJmpT->fpRBase(item2->object, @selector(renderingBase)) ? YES : NO);
+}
+
+BOOL egwRWIFlushBatch(egwArray* batchList, egwArray* recordList, egwGfxCommandBuffer* cmdBuffers, egwGfxBatchScratch* scratch) {
+    egwRenderingRecordEntry* batchEntries = (egwRenderingRecordEntry*)(batchList->rData);
+    EGWuint bIndex, bCount = (EGWuint)batchList->eCount;
+    BOOL didBatch = NO;
+    
+    if(bCount >= EGW_GFXRNDRR_BATCHMINITEMS) {
+        id instances[EGW_GFXRNDRR_BATCHMAXITEMS];
+        
+        for(bIndex = 0; bIndex < bCount; ++bIndex)
+            instances[bIndex] = batchEntries[bIndex].item->object;
+        
+        if(recordList && recordList->eCount) // Entries deferred before this run must reach the context first
+            egwRWIReplayRecords(recordList, cmdBuffers);
+        
+        didBatch = batchEntries[0].item->rJmpT->fpBatch(batchEntries[0].item->object, @selector(renderBatchWithFlags:instances:count:scratch:),
+                                                        (batchEntries[0].replyFlags & ~EGW_GFXOBJ_RPLYFLG_SAMELASTBASE), (const id*)&instances[0], bCount, scratch);
+    }
+    
+    if(!didBatch) { // Run too short or declined, render each individually (same last base flags are still accurate)
+        for(bIndex = 0; bIndex < bCount; ++bIndex)
+            egwRWIRenderEntry(&batchEntries[bIndex], recordList);
+    }
+    
+    batchList->eCount = 0;
+    
+    return didBatch;
+}
+
 
 // !!!: ***** egwGfxRenderer *****
 
@@ -271,8 +593,21 @@ static egwGfxRenderer* _singleton = nil;
     if(!(egwRBTreeInit(&_rQueues[5], &callbacks, sizeof(egwRenderingWorkItem), EGW_TREE_FLG_DFLT))) { [self release]; return (self = nil); }
     if(!(egwRBTreeInit(&_rQueues[6], &callbacks, sizeof(egwRenderingWorkItem), EGW_TREE_FLG_DFLT))) { [self release]; return (self = nil); }
     if(!(egwRBTreeInit(&_rQueues[7], &callbacks, sizeof(egwRenderingWorkItem), EGW_TREE_FLG_DFLT))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[0], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[1], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[2], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[3], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[4], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[5], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[6], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rLists[7], &callbacks, sizeof(egwRenderingWorkItem), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rSorts[0], NULL, sizeof(egwRenderingWorkSortEntry), 10, EGW_ARRAY_FLG_NONE))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_rSorts[1], NULL, sizeof(egwRenderingWorkSortEntry), 10, EGW_ARRAY_FLG_NONE))) { [self release]; return (self = nil); }
     if(!(egwArrayInit(&_pendingList, NULL, sizeof(void*), 10, (EGW_ARRAY_FLG_GROWBY25 | EGW_ARRAY_FLG_GRWCND100 | EGW_ARRAY_FLG_SHRNKBY2X)))) { [self release]; return (self = nil); }
-    if(!(egwArrayInit(&_requestList, NULL, sizeof(egwRenderingWorkReq), 10, (EGW_ARRAY_FLG_GROWBY10 | EGW_ARRAY_FLG_GRWCND100 | EGW_ARRAY_FLG_SHRNKBY2X | EGW_ARRAY_FLG_RETAIN)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_validList, NULL, sizeof(egwRenderingWorkSortEntry), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_recordList, NULL, sizeof(egwRenderingRecordEntry), 10, (EGW_ARRAY_FLG_GROWBY2X | EGW_ARRAY_FLG_GRWCND100)))) { [self release]; return (self = nil); }
+    if(!(egwArrayInit(&_batchList, NULL, sizeof(egwRenderingRecordEntry), EGW_GFXRNDRR_BATCHMAXITEMS, EGW_ARRAY_FLG_NONE))) { [self release]; return (self = nil); }
+    if(!(egwReqRingInit(&_requestRing, sizeof(egwRenderingWorkReq), EGW_GFXRNDRR_RQSTRINGSIZE, EGW_ARRAY_FLG_RETAIN))) { [self release]; return (self = nil); }
     _rReplies[0] = EGW_GFXOBJ_RPLYFLY_DORENDERPASS | (EGW_GFXOBJ_RPLYFLG_RENDERPASSMASK & (EGWuint)1);
     _rReplies[1] = EGW_GFXOBJ_RPLYFLY_DORENDERPASS | (EGW_GFXOBJ_RPLYFLG_RENDERPASSMASK & (EGWuint)2);
     _rReplies[2] = EGW_GFXOBJ_RPLYFLY_DORENDERPASS | (EGW_GFXOBJ_RPLYFLG_RENDERPASSMASK & (EGWuint)3);
@@ -284,7 +619,6 @@ static egwGfxRenderer* _singleton = nil;
     
     // Allocate mutex lock
     if(pthread_mutex_init(&_qLock, NULL)) { [self release]; return (self = nil); }
-    if(pthread_mutex_init(&_rLock, NULL)) { [self release]; return (self = nil); }
     
     // Associated instance with active context
     if(!(egwAIGfxCntx && [egwAIGfxCntx associateTask:self])) { [self release]; return (self = nil); }
@@ -299,7 +633,13 @@ static egwGfxRenderer* _singleton = nil;
     
     [_lBase release]; _lBase = nil;
     egwArrayFree(&_pendingList);
-    egwArrayFree(&_requestList);
+    egwArrayFree(&_validList);
+    egwArrayFree(&_recordList);
+    egwArrayFree(&_batchList);
+    egwGfxBatchScratchFree(&_batchScratch);
+    for(EGWuint bIndex = 0; bIndex < EGW_GFXRNDRR_RCMDBUFFERS; ++bIndex)
+        egwGfxCmdBufferFree(&_rCmdBufs[bIndex]);
+    egwReqRingFree(&_requestRing);
     [_rCameras[0].camera release]; _rCameras[0].camera = nil;
     [_rCameras[1].camera release]; _rCameras[1].camera = nil;
     [_rCameras[2].camera release]; _rCameras[2].camera = nil;
@@ -336,8 +676,17 @@ static egwGfxRenderer* _singleton = nil;
     egwRBTreeFree(&_rQueues[5]);
     egwRBTreeFree(&_rQueues[6]);
     egwRBTreeFree(&_rQueues[7]);
+    egwArrayFree(&_rLists[0]);
+    egwArrayFree(&_rLists[1]);
+    egwArrayFree(&_rLists[2]);
+    egwArrayFree(&_rLists[3]);
+    egwArrayFree(&_rLists[4]);
+    egwArrayFree(&_rLists[5]);
+    egwArrayFree(&_rLists[6]);
+    egwArrayFree(&_rLists[7]);
+    egwArrayFree(&_rSorts[0]);
+    egwArrayFree(&_rSorts[1]);
     pthread_mutex_destroy(&_qLock);
-    pthread_mutex_destroy(&_rLock);
     
     [super dealloc];
 }
@@ -354,13 +703,11 @@ static egwGfxRenderer* _singleton = nil;
         if(_params.mode & EGW_GFXRNDRR_RNDRMODE_FRAMECHECK)
             workItemReq.rJmpT->fpSetRFrame(renderableObject, @selector(setRenderingFrame:), egwAFPGfxCntxRenderingFrame(egwAIGfxCntx, @selector(renderingFrame)));
         
-        workItemReq.object = renderableObject; // weak, retained on add
+        workItemReq.object = renderableObject; // weak, retained on enqueue
         workItemReq.flags = EGW_GFXRNDRR_RNDRQUEUE_INSERT | (rFlags & EGW_GFXRNDRR_RNDRQUEUE_ALL);
         
-        // Lock mutex and add to request queue
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -373,13 +720,11 @@ static egwGfxRenderer* _singleton = nil;
         egwRenderingWorkReq workItemReq;
         workItemReq.rJmpT = [renderableObject renderableJumpTable];
         
-        workItemReq.object = renderableObject; // weak, retained on add
+        workItemReq.object = renderableObject; // weak, retained on enqueue
         workItemReq.flags = EGW_GFXRNDRR_RNDRQUEUE_PAUSE;
         
-        // Lock mutex and add to request queue
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -388,13 +733,11 @@ static egwGfxRenderer* _singleton = nil;
         egwRenderingWorkReq workItemReq;
         workItemReq.rJmpT = [renderableObject renderableJumpTable];
         
-        workItemReq.object = renderableObject; // weak, retained on add
+        workItemReq.object = renderableObject; // weak, retained on enqueue
         workItemReq.flags = EGW_GFXRNDRR_RNDRQUEUE_REMOVE;
         
-        // Lock mutex and add to request queue
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -424,7 +767,13 @@ static egwGfxRenderer* _singleton = nil;
                 
                 [_lBase release]; _lBase = nil;
                 egwArrayFree(&_pendingList);
-                egwArrayFree(&_requestList);
+                egwArrayFree(&_validList);
+                egwArrayFree(&_recordList);
+                egwArrayFree(&_batchList);
+                egwGfxBatchScratchFree(&_batchScratch);
+                for(EGWuint bIndex = 0; bIndex < EGW_GFXRNDRR_RCMDBUFFERS; ++bIndex)
+                    egwGfxCmdBufferFree(&_rCmdBufs[bIndex]);
+                egwReqRingFree(&_requestRing);
                 [_rCameras[0].camera release]; _rCameras[0].camera = nil;
                 [_rCameras[1].camera release]; _rCameras[1].camera = nil;
                 [_rCameras[2].camera release]; _rCameras[2].camera = nil;
@@ -461,6 +810,16 @@ static egwGfxRenderer* _singleton = nil;
                 egwRBTreeFree(&_rQueues[5]);
                 egwRBTreeFree(&_rQueues[6]);
                 egwRBTreeFree(&_rQueues[7]);
+                egwArrayFree(&_rLists[0]);
+                egwArrayFree(&_rLists[1]);
+                egwArrayFree(&_rLists[2]);
+                egwArrayFree(&_rLists[3]);
+                egwArrayFree(&_rLists[4]);
+                egwArrayFree(&_rLists[5]);
+                egwArrayFree(&_rLists[6]);
+                egwArrayFree(&_rLists[7]);
+                egwArrayFree(&_rSorts[0]);
+                egwArrayFree(&_rSorts[1]);
                 
                 // Done last due to potential to have self dealloc'ed immediately afterwords
                 [egwAIGfxCntx deassociateTask:self];
@@ -471,6 +830,10 @@ static egwGfxRenderer* _singleton = nil;
     }
 }
 
+- (EGWuint)requestOverflows {
+    return egwReqRingOverflows(&_requestRing);
+}
+
 - (id<egwPCamera>)renderingCameraForQueue:(EGWuint)queueIdent {
     if(queueIdent & EGW_GFXRNDRR_RNDRQUEUE_FIRSTPASS)
         return _rCameras[0].camera;
@@ -663,11 +1026,9 @@ static egwGfxRenderer* _singleton = nil;
 - (void)performTask {
     egwRenderingWorkReq* workReq = nil;
     egwRenderingWorkItem* workItem = nil;
-    egwRedBlackTreeIter workItmIter;
-    egwArrayIter workReqIter;
+    egwRenderingQueueIter workItmIter;
     id<egwPRenderable> workObject = nil;
     EGWint qIndex;
-	EGWuint16 wItmRFrame;
     
     if(_doShutdown) goto TaskBreak;
     pthread_mutex_lock(&_qLock);
@@ -710,11 +1071,15 @@ static egwGfxRenderer* _singleton = nil;
     }
     
     // Move items from outer queue into internal queue system
-    if(_requestList.eCount > 0) {
-        if(pthread_mutex_trylock(&_rLock) == 0) {
-            if(_requestList.eCount > 0) {
-                if(egwArrayEnumerateStart(&_requestList, EGW_ITERATE_MODE_DFLT, &workReqIter)) {
-                    while((workReq = (egwRenderingWorkReq*)egwArrayEnumerateNextPtr(&workReqIter))) {
+    if(!egwReqRingIsEmpty(&_requestRing)) {
+        {   egwRenderingWorkReq workReqs[EGW_GFXRNDRR_RQSTBATCHSIZE];
+            EGWuint reqCount, reqIndex;
+            
+            do {
+                if((reqCount = egwReqRingDequeue(&_requestRing, (EGWbyte*)workReqs, EGW_GFXRNDRR_RQSTBATCHSIZE)) > 0) {
+                    for(reqIndex = 0; reqIndex < reqCount; ++reqIndex) {
+                        workReq = &workReqs[reqIndex];
+                        
                         if(workReq->flags & EGW_GFXRNDRR_RNDRQUEUE_INSERT) { // Insert into the queues
                             if(!workReq->rJmpT->fpRendering(workReq->object, @selector(isRendering))) {
                                 workReq->rJmpT->fpRender(workReq->object, @selector(renderWithFlags:), EGW_GFXOBJ_RPLYFLG_DORENDERSTART);
@@ -724,17 +1089,23 @@ static egwGfxRenderer* _singleton = nil;
                                 // NOTE: Validation will spark an orientation update, if pending, this must happen before the sort descriptor is built -jw 
                                 egwSFPVldtrValidate(rSync, @selector(validate));
                                 
+                                BOOL isNode = [(id)workReq->object conformsToProtocol:@protocol(egwPObjectNode)];
+                                
                                 for(qIndex = 0; qIndex < 8; ++qIndex) {
                                     if(workReq->flags & (EGW_GFXRNDRR_RNDRQUEUE_FIRSTPASS << qIndex)) {
                                         egwRenderingWorkItem newWorkItem; memset((void*)&newWorkItem, 0, sizeof(egwRenderingWorkItem)); 
                                         newWorkItem.object = workReq->object; // weak! (rbAdd CB will do retain)
                                         newWorkItem.sync = rSync; // weak! (rbAdd CB will do retain)
                                         newWorkItem.qIndex = qIndex;
+                                        newWorkItem.isNode = isNode;
                                         newWorkItem.rJmpT = workReq->rJmpT;
                                         
                                         egwRWIUpdate(&newWorkItem, &_rCameras[qIndex]); // sort descriptor must be set before insert into rbTree
                                         
-                                        egwRBTreeAdd(&_rQueues[qIndex], (const EGWbyte*)&newWorkItem); // contents copy-over (+ retain due to CB)
+                                        if(_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT)
+                                            egwArrayAddTail(&_rLists[qIndex], (const EGWbyte*)&newWorkItem); // contents copy-over (+ retain due to CB)
+                                        else
+                                            egwRBTreeAdd(&_rQueues[qIndex], (const EGWbyte*)&newWorkItem); // contents copy-over (+ retain due to CB)
                                     }
                                 }
                             } else { // Send start message (restart trick), but skip enque
@@ -750,65 +1121,110 @@ static egwGfxRenderer* _singleton = nil;
                         }
                     }
                     
-                    egwArrayRemoveAll(&_requestList);
+                    for(reqIndex = 0; reqIndex < reqCount; ++reqIndex)
+                        [workReqs[reqIndex].object release]; // retained by request ring on enqueue
                 }
-            }
-            
-            pthread_mutex_unlock(&_rLock);
+            } while(reqCount == EGW_GFXRNDRR_RQSTBATCHSIZE);
         }
     }
     
     // First pass: Perform PRE frame check, resync objects.
+    // NOTE: Frame checks, validations (orientation updates) and sort descriptor updates are farmed out to the task thread pool, queue modifications and render messages stay on this thread. -jw
     
-    {   BOOL updateSortDescWithViewingCameraOverride = NO;
-        EGWuint16 rFrame;
+    {   egwRenderingValidateJob job;
+        egwRenderingWorkSortEntry validEntry;
+        BOOL doParallel;
+        EGWuint8 lSweeps = 0;
+        EGWuint eIndex, vCount;
+        
+        memset((void*)&job, 0, sizeof(egwRenderingValidateJob));
+        job.rCameras = &_rCameras[0];
+        job.doResorts = (_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT ? NO : YES); // NOTE: Flat lists are re-keyed and radix sorted in full every frame, so only the sort descriptor needs updated. -jw
         
         if(_params.mode & EGW_GFXRNDRR_RNDRMODE_FRAMECHECK)
-            rFrame = egwAFPGfxCntxRenderingFrame(egwAIGfxCntx, @selector(renderingFrame));
-        else rFrame = EGW_FRAME_ALWAYSPASS;
+            job.rFrame = egwAFPGfxCntxRenderingFrame(egwAIGfxCntx, @selector(renderingFrame));
+        else job.rFrame = EGW_FRAME_ALWAYSPASS;
+        
+        // Gather items not yet checked this frame
+        _validList.eCount = 0;
+        validEntry.sortKey = 0;
         
         for(qIndex = 0; qIndex < 8; ++qIndex) {
             // If the camera for the pass invalidates, then nothing is considered sorted anymore
             if(_params.mode & EGW_GFXRNDRR_RNDRMODE_DEFERRED && _rCameras[qIndex].camera && egwSFPVldtrIsInvalidated(_rCameras[qIndex].sync, @selector(isInvalidated)))
-                updateSortDescWithViewingCameraOverride = YES;
+                job.sOverrides |= (1 << qIndex);
             
-            if(egwRBTreeEnumerateStart(&_rQueues[qIndex], EGW_ITERATE_MODE_BSTLSR, &workItmIter)) {
-                while((workItem = (egwRenderingWorkItem*)egwRBTreeEnumerateNextPtr(&workItmIter))) {
+            if(_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT ? egwRQEnumerateListStart(&_rLists[qIndex], &workItmIter) : egwRQEnumerateTreeStart(&_rQueues[qIndex], &workItmIter)) {
+                while((workItem = egwRQEnumerateNextPtr(&workItmIter))) {
                     if(workItem->tFrame != _tFrame) {
-                        workObject = workItem->object;
-                        
                         workItem->tFlags = EGW_RDRWRKITMFLG_NONE;
+                        workItem->tFrame = _tFrame;
+                        validEntry.item = workItem;
                         
-                        // Remove out-of-date objects from queue
-                        wItmRFrame = workItem->rJmpT->fpRFrame(workObject, @selector(renderingFrame));
-						if(((rFrame != EGW_FRAME_ALWAYSPASS && wItmRFrame != EGW_FRAME_ALWAYSPASS && wItmRFrame != rFrame) ||
-                            wItmRFrame == EGW_FRAME_ALWAYSFAIL || rFrame == EGW_FRAME_ALWAYSFAIL) ||
-                           !workItem->rJmpT->fpRendering(workObject, @selector(isRendering))) {
-                            workItem->rJmpT->fpRender(workObject, @selector(renderWithFlags:), EGW_GFXOBJ_RPLYFLG_DORENDERSTOP);
-                            
-                            workItem->tFlags |= EGW_RDRWRKITMFLG_DELETE; 
-                            if(!((workItem->tFlags & ~EGW_RDRWRKITMFLG_DELETE) & EGW_RDRWRKITMFLG_ATPMASK)) 
-                                egwArrayAddTail(&_pendingList, (const EGWbyte*)&workItem); // save for remove, pointer copy-over
-                            
-                            continue;
-                        }
-                        
-                        // Validate & set sort descriptor for deferred mode
-                        if(updateSortDescWithViewingCameraOverride || egwSFPVldtrIsInvalidated(workItem->sync, @selector(isInvalidated))) {
-                            // NOTE: Validation here could mess up other queues -> saved for later to catch all invalidations. -jw
-                            // NOTE: If updateSortDescOverride is high, then yes, we do a lot of array copies. -jw
+                        if(!egwArrayAddTail(&_validList, (const EGWbyte*)&validEntry)) { // Validation list full, check now and leave resort to pending list
+                            egwRWICheck(&validEntry, &job);
                             
-                            workItem->tFlags |= EGW_RDRWRKITMFLG_RESORT;
-                            if(!((workItem->tFlags & ~EGW_RDRWRKITMFLG_RESORT) & EGW_RDRWRKITMFLG_ATPMASK))
+                            if(workItem->tFlags & EGW_RDRWRKITMFLG_DELETE) {
+                                workItem->rJmpT->fpRender(workItem->object, @selector(renderWithFlags:), EGW_GFXOBJ_RPLYFLG_DORENDERSTOP);
+                                if(_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT)
+                                    lSweeps |= (1 << qIndex);
+                                else
+                                    egwArrayAddTail(&_pendingList, (const EGWbyte*)&workItem); // save for remove, pointer copy-over
+                            } else if(workItem->tFlags & EGW_RDRWRKITMFLG_RESORT)
                                 egwArrayAddTail(&_pendingList, (const EGWbyte*)&workItem); // save for resort / validation, pointer copy-over
                         }
-                        
-                        workItem->tFrame = _tFrame;
                     }
                 }
             }
+        }
+        
+        job.entries = (egwRenderingWorkSortEntry*)(_validList.rData);
+        job.eCount = (EGWuint)_validList.eCount;
+        doParallel = ((_params.mode & EGW_GFXRNDRR_RNDRMODE_PARALLELVLD) && egwSITaskMngr ? YES : NO);
+        
+        // Check frames & sync invalidations
+        if(doParallel && job.eCount >= EGW_GFXRNDRR_PVLDMINITEMS)
+            [egwSITaskMngr parallelForRangeFrom:0 to:job.eCount withGrain:0 usingRoutine:&egwRWICheckRange withContext:(void*)&job];
+        else egwRWICheckRange((void*)&job, 0, job.eCount);
+        
+        // Stop out-of-date objects and compact items needing validated to front
+        for(eIndex = vCount = 0; eIndex < job.eCount; ++eIndex) {
+            workItem = job.entries[eIndex].item;
             
-            updateSortDescWithViewingCameraOverride = NO;
+            if(workItem->tFlags & EGW_RDRWRKITMFLG_DELETE) {
+                workItem->rJmpT->fpRender(workItem->object, @selector(renderWithFlags:), EGW_GFXOBJ_RPLYFLG_DORENDERSTOP);
+                if(_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT)
+                    lSweeps |= (1 << workItem->qIndex);
+                else
+                    egwArrayAddTail(&_pendingList, (const EGWbyte*)&workItem); // save for remove, pointer copy-over
+            } else if(workItem->tFlags & EGW_RDRWRKITMFLG_RESORT)
+                job.entries[vCount++] = job.entries[eIndex];
+        }
+        job.eCount = vCount;
+        
+        // Validate & set sort descriptors, each validation group on one thread
+        if(job.eCount) {
+            if(doParallel && job.eCount >= EGW_GFXRNDRR_PVLDMINITEMS) {
+                if(_rSorts[1].eMaxCount < job.eCount)
+                    egwArrayResize(&_rSorts[1], job.eCount);
+                
+                if(_rSorts[1].eMaxCount >= job.eCount) {
+                    job.entries = egwRWIRadixSort(job.entries, (egwRenderingWorkSortEntry*)(_rSorts[1].rData), job.eCount); // makes groups contiguous
+                    [egwSITaskMngr parallelForRangeFrom:0 to:job.eCount withGrain:0 usingRoutine:&egwRWIValidateRange withContext:(void*)&job];
+                } else egwRWIValidateRange((void*)&job, 0, job.eCount);
+            } else egwRWIValidateRange((void*)&job, 0, job.eCount);
+            
+            // NOTE: Trees cannot be modified from task pool threads, items left flagged have changed sort descriptors and are resorted here. -jw
+            if(job.doResorts) {
+                for(eIndex = 0; eIndex < job.eCount; ++eIndex) {
+                    workItem = job.entries[eIndex].item;
+                    
+                    if(workItem->tFlags & EGW_RDRWRKITMFLG_RESORT) {
+                        egwRBTreeResortElement(&_rQueues[workItem->qIndex], egwRBTreeNodePtr((const EGWbyte*)workItem));
+                        workItem->tFlags &= ~EGW_RDRWRKITMFLG_RESORT;
+                    }
+                }
+            }
         }
         
         // Tree needs to be modified before second pass to reflect removes, sort desc updates, etc
@@ -817,20 +1233,40 @@ static egwGfxRenderer* _singleton = nil;
             --_pendingList.eCount;
             egwRenderingWorkItem* workItem = ((egwRenderingWorkItem**)(_pendingList.rData))[_pendingList.eCount];
             
-            if(workItem->tFlags & EGW_RDRWRKITMFLG_DELETE)
+            if(workItem->tFlags & EGW_RDRWRKITMFLG_DELETE) {
                 egwRBTreeRemove(&_rQueues[workItem->qIndex], egwRBTreeNodePtr((const EGWbyte*)workItem));
-            else {
+            } else {
                 if(workItem->tFlags & EGW_RDRWRKITMFLG_RESORT) {
                     // NOTE: Validation will spark an orientation update, if pending, this must happen before the sort descriptor is built -jw
                     egwSFPVldtrValidate(workItem->sync, @selector(validate)); // NOTE: This may be a redundent call if on several queues -jw
                     
-                    if(egwRWIUpdate(workItem, &_rCameras[qIndex]))
+                    // NOTE: Flat lists are re-keyed and radix sorted in full every frame, so only the sort descriptor needs updated. -jw
+                    if(egwRWIUpdate(workItem, &_rCameras[workItem->qIndex]) && !(_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT))
                         egwRBTreeResortElement(&_rQueues[workItem->qIndex], egwRBTreeNodePtr((const EGWbyte*)workItem));
                     
                     workItem->tFlags &= ~EGW_RDRWRKITMFLG_RESORT;
                 }
             }
         }
+        
+        // Sweep removals out of flat lists, done last since removing shifts items that work items above point into
+        if(lSweeps) {
+            for(qIndex = 0; qIndex < 8; ++qIndex) {
+                if(lSweeps & (1 << qIndex)) {
+                    egwRenderingWorkItem* listItems = (egwRenderingWorkItem*)(_rLists[qIndex].rData);
+                    EGWuint lIndex, lCount = (EGWuint)_rLists[qIndex].eCount, kCount = 0;
+                    
+                    for(lIndex = 0; lIndex < lCount; ++lIndex) {
+                        if(listItems[lIndex].tFlags & EGW_RDRWRKITMFLG_DELETE)
+                            egwRWIRemove(&listItems[lIndex]);
+                        else if(kCount++ != lIndex)
+                            memcpy((void*)&listItems[kCount-1], (const void*)&listItems[lIndex], sizeof(egwRenderingWorkItem));
+                    }
+                    
+                    _rLists[qIndex].eCount = (EGWuint32)kCount;
+                }
+            }
+        }
     }
     
     // Handle cancellation
@@ -838,7 +1274,10 @@ static egwGfxRenderer* _singleton = nil;
     
     // Second pass: Perform render passes.
     
-    {   BOOL sameLastBase = NO;
+    {   BOOL sameLastBase = NO, hasItems;
+        BOOL doRecord = ((_params.mode & EGW_GFXRNDRR_RNDRMODE_RECORDED) && egwSITaskMngr ? YES : NO);
+        BOOL doBatch = (_params.mode & EGW_GFXRNDRR_RNDRMODE_BATCHED ? YES : NO);
+        egwRenderingRecordEntry renderEntry;
         EGWuint32 replyFlags;
         
         for(qIndex = 0; qIndex < 8; ++qIndex) {
@@ -846,16 +1285,93 @@ static egwGfxRenderer* _singleton = nil;
                          | (((EGWuint)_alphaMods[qIndex] << EGW_GFXOBJ_RPLYFLG_ALPHAMODSHFT) & EGW_GFXOBJ_RPLYFLG_ALPHAMODMASK)
                          | (((EGWuint)_shadeMods[qIndex] << EGW_GFXOBJ_RPLYFLG_SHADEMODSHFT) & EGW_GFXOBJ_RPLYFLG_SHADEMODMASK);
             
-            if(egwRBTreeEnumerateStart(&_rQueues[qIndex], EGW_ITERATE_MODE_BSTLSR, &workItmIter)) {
+            if(_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT) {
+                // Build packed sort keys for flat list, radix sort, then walk the sorted entries
+                // NOTE: Sort entries stay valid for this pass since the flat list is not modified again until next frame's first pass. -jw
+                egwRenderingWorkSortEntry* sortEntries = NULL;
+                EGWuint sortCount = _rLists[qIndex].eCount;
+                
+                if(sortCount && _rCameras[qIndex].camera) {
+                    if(_rSorts[0].eMaxCount < sortCount) {
+                        egwArrayResize(&_rSorts[0], sortCount);
+                        egwArrayResize(&_rSorts[1], sortCount);
+                    }
+                    
+                    if(_rSorts[0].eMaxCount >= sortCount && _rSorts[1].eMaxCount >= sortCount) {
+                        egwRenderingWorkItem* listItems = (egwRenderingWorkItem*)(_rLists[qIndex].rData);
+                        EGWuint sIndex;
+                        
+                        sortEntries = (egwRenderingWorkSortEntry*)(_rSorts[0].rData);
+                        for(sIndex = 0; sIndex < sortCount; ++sIndex) {
+                            sortEntries[sIndex].sortKey = egwRWISortKey(&listItems[sIndex]);
+                            sortEntries[sIndex].item = &listItems[sIndex];
+                        }
+                        
+                        sortEntries = egwRWIRadixSort(sortEntries, (egwRenderingWorkSortEntry*)(_rSorts[1].rData), sortCount);
+                    } else sortCount = 0;
+                }
+                
+                hasItems = egwRQEnumerateSortStart(sortEntries, sortCount, &workItmIter);
+            } else
+                hasItems = egwRQEnumerateTreeStart(&_rQueues[qIndex], &workItmIter);
+            
+            if(hasItems) {
+                egwRenderingQueueIter rendItmIter = workItmIter; // culling stage and render pass walk the same queue order
+                
                 if(_rCameras[qIndex].camera) {
                     egwAFPGfxCntxSetActiveCamera(egwAIGfxCntx, @selector(setActiveCamera:), _rCameras[qIndex].camera);
                     if(egwSFPVldtrIsInvalidated(_rCameras[qIndex].sync, @selector(isInvalidated)))
                         _rCameras[qIndex].fpBind(_rCameras[qIndex].camera, @selector(bindForRenderingWithFlags:), (_rCameras[qIndex].fpFlags(_rCameras[qIndex].camera, @selector(viewingFlags)) | EGW_BNDOBJ_BINDFLG_DFLT));
                 } else continue; // no camera, no pass
                 
-                while((workItem = (egwRenderingWorkItem*)egwRBTreeEnumerateNextPtr(&workItmIter))) {
+                // Culling stage: Hierarchically test rendering bounding volumes against the camera's coarse viewing sphere, then its fine viewing frustum.
+                // NOTE: Only perspective cameras are culled against; orthogonal (typically interface) queues are always rendered in full. Volume types other than spheres and boxes are never culled. -jw
+                if((_params.mode & EGW_GFXRNDRR_RNDRMODE_FRUSTUMCULL) && !_rCameras[qIndex].isOrtho) {
+                    id<egwPBounding> camFVol = [_rCameras[qIndex].camera cameraBounding];
+                    id<egwPBounding> camCVol = [_rCameras[qIndex].camera viewingBounding];
+                    
+                    if([(NSObject*)camFVol class] == [egwBoundingFrustum class]) {
+                        const egwFrustum4f* frustum = [(egwBoundingFrustum*)camFVol boundingObject];
+                        const egwSphere4f* cSphere = ([(NSObject*)camCVol class] == [egwBoundingSphere class] ? [(egwBoundingSphere*)camCVol boundingObject] : NULL);
+                        Class sphereClass = [egwBoundingSphere class];
+                        Class boxClass = [egwBoundingBox class];
+                        
+                        while((workItem = egwRQEnumerateNextPtr(&workItmIter))) {
+                            id<egwPBounding> rBVol = workItem->rJmpT->fpRBVol(workItem->object, @selector(renderingBounding));
+                            Class rBVolClass = [(NSObject*)rBVol class];
+                            
+                            workItem->tFlags &= ~EGW_RDRWRKITMFLG_CULLED;
+                            
+                            if(rBVolClass == sphereClass) {
+                                const egwSphere4f* sphere = [(egwBoundingSphere*)rBVol boundingObject];
+                                if((cSphere && !egwIsCollidingSphereSpheref(cSphere, sphere)) || egwRWICullSphere(workItem, frustum, sphere))
+                                    workItem->tFlags |= EGW_RDRWRKITMFLG_CULLED;
+                            } else if(rBVolClass == boxClass) {
+                                const egwBox4f* box = [(egwBoundingBox*)rBVol boundingObject];
+                                if((cSphere && !egwIsCollidingSphereBoxf(cSphere, box)) || egwRWICullBox(workItem, frustum, box))
+                                    workItem->tFlags |= EGW_RDRWRKITMFLG_CULLED;
+                            }
+                        }
+                    }
+                }
+                
+                _recordList.eCount = 0;
+                _batchList.eCount = 0;
+                
+                while((workItem = egwRQEnumerateNextPtr(&rendItmIter))) {
+                    if(workItem->tFlags & EGW_RDRWRKITMFLG_CULLED) {
+                        workItem->tFlags &= ~EGW_RDRWRKITMFLG_CULLED;
+                        continue;
+                    }
+                    
                     workObject = workItem->object;
                     
+                    // Close off current batch run on a differing item, merged draws leave array state undefined for the next same base item
+                    if(_batchList.eCount && (_batchList.eCount >= EGW_GFXRNDRR_BATCHMAXITEMS || !egwRWIIsSameBatch(((egwRenderingRecordEntry*)(_batchList.rData))[0].item, workItem)) &&
+                       egwRWIFlushBatch(&_batchList, (doRecord ? &_recordList : NULL), &_rCmdBufs[0], &_batchScratch)) {
+                        [_lBase release]; _lBase = nil;
+                    }
+                    
                     // Handle sameLastBase/_lBase tracking
                     sameLastBase = (_lBase && _lBase == workItem->rJmpT->fpRBase(workObject, @selector(renderingBase))) ? YES : NO;
                     if(_lBase == nil || !sameLastBase) {
@@ -863,10 +1379,27 @@ static egwGfxRenderer* _singleton = nil;
                         _lBase = [workItem->rJmpT->fpRBase(workObject, @selector(renderingBase)) retain];
                     }
                     
-                    // Render renderable object
                     workItem->tFlags |= EGW_RDRWRKITMFLG_RANPASS;
-                    workItem->rJmpT->fpRender(workObject, @selector(renderWithFlags), replyFlags | (sameLastBase ? EGW_GFXOBJ_RPLYFLG_SAMELASTBASE : 0));
+                    
+                    renderEntry.item = workItem;
+                    renderEntry.replyFlags = replyFlags | (sameLastBase ? EGW_GFXOBJ_RPLYFLG_SAMELASTBASE : 0);
+                    
+                    // Collect into batch run (run was closed above if this item differs), otherwise render or defer into record list
+                    if(doBatch && egwRWIIsBatchable(workItem) && egwArrayAddTail(&_batchList, (const EGWbyte*)&renderEntry))
+                        continue;
+                    
+                    if(_batchList.eCount && egwRWIFlushBatch(&_batchList, (doRecord ? &_recordList : NULL), &_rCmdBufs[0], &_batchScratch))
+                        renderEntry.replyFlags &= ~EGW_GFXOBJ_RPLYFLG_SAMELASTBASE; // this item re-establishes array state for _lBase
+                    
+                    egwRWIRenderEntry(&renderEntry, (doRecord ? &_recordList : NULL));
+                }
+                
+                if(_batchList.eCount && egwRWIFlushBatch(&_batchList, (doRecord ? &_recordList : NULL), &_rCmdBufs[0], &_batchScratch)) {
+                    [_lBase release]; _lBase = nil;
                 }
+                
+                if(_recordList.eCount)
+                    egwRWIReplayRecords(&_recordList, &_rCmdBufs[0]);
             }
             
             if(_params.mode & EGW_GFXRNDRR_RNDRMODE_IMMEDIATE)
@@ -898,20 +1431,31 @@ static egwGfxRenderer* _singleton = nil;
         }
         
         if(!(_params.mode & EGW_GFXRNDRR_RNDRMODE_PERSISTENT)) {
-            egwRBTreeRemoveAll(&_rQueues[0]);
-            egwRBTreeRemoveAll(&_rQueues[1]);
-            egwRBTreeRemoveAll(&_rQueues[2]);
-            egwRBTreeRemoveAll(&_rQueues[3]);
-            egwRBTreeRemoveAll(&_rQueues[4]);
-            egwRBTreeRemoveAll(&_rQueues[5]);
-            egwRBTreeRemoveAll(&_rQueues[6]);
-            egwRBTreeRemoveAll(&_rQueues[7]);
+            if(_params.mode & EGW_GFXRNDRR_RNDRMODE_RADIXSORT) {
+                egwArrayRemoveAll(&_rLists[0]);
+                egwArrayRemoveAll(&_rLists[1]);
+                egwArrayRemoveAll(&_rLists[2]);
+                egwArrayRemoveAll(&_rLists[3]);
+                egwArrayRemoveAll(&_rLists[4]);
+                egwArrayRemoveAll(&_rLists[5]);
+                egwArrayRemoveAll(&_rLists[6]);
+                egwArrayRemoveAll(&_rLists[7]);
+            } else {
+                egwRBTreeRemoveAll(&_rQueues[0]);
+                egwRBTreeRemoveAll(&_rQueues[1]);
+                egwRBTreeRemoveAll(&_rQueues[2]);
+                egwRBTreeRemoveAll(&_rQueues[3]);
+                egwRBTreeRemoveAll(&_rQueues[4]);
+                egwRBTreeRemoveAll(&_rQueues[5]);
+                egwRBTreeRemoveAll(&_rQueues[6]);
+                egwRBTreeRemoveAll(&_rQueues[7]);
+            }
         }
         
         // Set up for next run
         _doPreprocessing = YES;
     }
-    
+
 TaskBreak:
     // Ensurances (break due to cancellation, etc.)
     if(_amRunning) {
@@ -52,6 +52,8 @@
 #define EGW_PHYACTR_ACTRQUEUE_MAINPASS      0x0004  ///< Main pass interaction queue.
 
 #define EGW_PHYACTR_DFLTPRIORITY    0.55    ///< Default physics actuator priority.
+#define EGW_PHYACTR_RQSTRINGSIZE    256     ///< Lock-free request ring capacity (requests beyond this spill onto a locked overflow list).
+#define EGW_PHYACTR_RQSTBATCHSIZE   32      ///< Request ring dequeue batch size.
 #define EGW_PHYACTR_MAXDELTAT       0.5     ///< Maximum allowable delta time value.
 #define EGW_PHYACTR_MINDELTAT       0.0     ///< Minimum allowable delta time value.
 #define EGW_PHYACTR_NSDATEMAX 1000000.0     ///< Maximum seconds allowed for an NSDate object to use before creating a new one.
@@ -68,7 +70,6 @@
     egwPhyActParams _params;                ///< Actuator parameters (copy).
     
     pthread_mutex_t _qLock;                 ///< Interaction queue mutex lock (retained).
-    pthread_mutex_t _rLock;                 ///< Request queue mutex lock.
     
     egwSinglyLinkedList _iQueues[3];        ///< Interaction queues (contents retained).
     
@@ -84,7 +85,7 @@
     EGWtime _mThrottle;                     ///< Master throttle multiplier.
     
     egwArray _pendingList;                  ///< Queue work item pending list for remove/resort (weak).
-    egwArray _requestList;                  ///< Queue work request list for insertion/removal.
+    egwRequestRing _requestRing;            ///< Queue work request ring for insertion/removal (lock-free, contents retained).
     
     id<NSObject> _lBase;                    ///< Last base tracker (retained).
     EGWuint16 _tFrame;                      ///< Interaction task frame.
@@ -136,6 +137,11 @@
 - (void)setMasterThrottle:(EGWtime)throttle;
 
 
+
+/// Request Overflows Accessor.
+/// Returns the number of requests that have overflowed the lock-free request ring onto its locked overflow list.
+/// @return Overflowed request count.
+- (EGWuint)requestOverflows;
 @end
 
 
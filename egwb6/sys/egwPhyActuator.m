@@ -31,6 +31,7 @@
 #import "../sys/egwTaskManager.h"
 #import "../sys/egwPhyContext.h"
 #import "../data/egwArray.h"
+#import "../data/egwRequestRing.h"
 #import "../misc/egwValidater.h"
 
 
@@ -186,14 +187,13 @@ static egwPhyActuator* _singleton = nil;
     callbacks.fpAdd = (EGWelementfp)&egwAWIAdd; // Seperate add for actuator queue
     callbacks.fpRemove = (EGWelementfp)&egwAWIRemove; // Seperate remove for actuator queue
     if(!(egwSLListInit(&_iQueues[1], &callbacks, sizeof(egwInteractionWorkItem), EGW_LIST_FLG_DFLT))) { [self release]; return (self = nil); }
-    if(!(egwArrayInit(&_requestList, NULL, sizeof(egwInteractionWorkItemReq), 10, (EGW_ARRAY_FLG_GROWBY10 | EGW_ARRAY_FLG_GRWCND100 | EGW_ARRAY_FLG_SHRNKBY2X | EGW_ARRAY_FLG_RETAIN)))) { [self release]; return (self = nil); }
+    if(!(egwReqRingInit(&_requestRing, sizeof(egwInteractionWorkItemReq), EGW_PHYACTR_RQSTRINGSIZE, EGW_ARRAY_FLG_RETAIN))) { [self release]; return (self = nil); }
     _iReplies[0] = EGW_PHYOBJ_RPLYFLG_DOINTRCTPASS | (EGW_PHYOBJ_RPLYFLG_INTRCTPASSMASK & (EGWuint)1);
     _iReplies[1] = EGW_ACTOBJ_RPLYFLG_DOUPDATEPASS;
     _iReplies[2] = EGW_PHYOBJ_RPLYFLG_DOINTRCTPASS | (EGW_PHYOBJ_RPLYFLG_INTRCTPASSMASK & (EGWuint)2);
     
     // Allocate mutex lock
     if(pthread_mutex_init(&_qLock, NULL)) { [self release]; return (self = nil); }
-    if(pthread_mutex_init(&_rLock, NULL)) { [self release]; return (self = nil); }
     
     // Associated instance with active context
     if(!(egwAIPhyCntx && [egwAIPhyCntx associateTask:self])) { [self release]; return (self = nil); }
@@ -212,12 +212,11 @@ static egwPhyActuator* _singleton = nil;
     #else
         [_lTime release]; _lTime = nil;
     #endif
-    egwArrayFree(&_requestList);
+    egwReqRingFree(&_requestRing);
     egwSLListFree(&_iQueues[0]);
     egwSLListFree(&_iQueues[1]);
     egwSLListFree(&_iQueues[2]);
     pthread_mutex_destroy(&_qLock);
-    pthread_mutex_destroy(&_rLock);
     
     [super dealloc];
 }
@@ -227,12 +226,11 @@ static egwPhyActuator* _singleton = nil;
         egwInteractionWorkItemReq workItemReq;
         workItemReq.jmpTbls.aJmpT = [actuatorObject actuatorJumpTable];
         
-        workItemReq.object = actuatorObject; // weak, retained on add
+        workItemReq.object = actuatorObject; // weak, retained on enqueue
         workItemReq.flags = EGW_PHYACTR_ACTRQUEUE_INSERT | EGW_PHYACTR_ACTRQUEUE_ACTUATOR;
         
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -248,12 +246,11 @@ static egwPhyActuator* _singleton = nil;
         if(_params.mode & EGW_PHYACTR_ACTRMODE_FRAMECHECK)
             workItemReq.jmpTbls.iJmpT->fpSetIFrame(interactableObject, @selector(setInteractionFrame:), egwAFPPhyCntxInteractionFrame(egwAIPhyCntx, @selector(interactionFrame)));
         
-        workItemReq.object = interactableObject; // weak, retained on add
+        workItemReq.object = interactableObject; // weak, retained on enqueue
         workItemReq.flags = EGW_PHYACTR_ACTRQUEUE_INSERT | ((uFlags & EGW_PHYACTR_ACTRQUEUE_ALL) & ~EGW_PHYACTR_ACTRQUEUE_ACTUATOR);
         
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -261,7 +258,7 @@ static egwPhyActuator* _singleton = nil;
     if(object) {
         egwInteractionWorkItemReq workItemReq;
         
-        workItemReq.object = object; // weak, retained on add
+        workItemReq.object = object; // weak, retained on enqueue
         workItemReq.flags = EGW_PHYACTR_ACTRQUEUE_PAUSE;
         
         if([object conformsToProtocol:@protocol(egwPInteractable)]) {
@@ -272,9 +269,8 @@ static egwPhyActuator* _singleton = nil;
             workItemReq.flags |= EGW_PHYACTR_ACTRQUEUE_ACTUATOR;
         }
         
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -282,7 +278,7 @@ static egwPhyActuator* _singleton = nil;
     if(object) {
         egwInteractionWorkItemReq workItemReq;
         
-        workItemReq.object = object; // weak, retained on add
+        workItemReq.object = object; // weak, retained on enqueue
         workItemReq.flags = EGW_PHYACTR_ACTRQUEUE_REMOVE;
         
         if([object conformsToProtocol:@protocol(egwPInteractable)]) {
@@ -293,12 +289,15 @@ static egwPhyActuator* _singleton = nil;
             workItemReq.flags |= EGW_PHYACTR_ACTRQUEUE_ACTUATOR;
         }
         
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
+- (EGWuint)requestOverflows {
+    return egwReqRingOverflows(&_requestRing);
+}
+
 - (void)setMasterThrottle:(EGWtime)throttle {
     pthread_mutex_lock(&_qLock);
     
@@ -337,7 +336,7 @@ static egwPhyActuator* _singleton = nil;
                 #else
                     [_lTime release]; _lTime = nil;
                 #endif
-                egwArrayFree(&_requestList);
+                egwReqRingFree(&_requestRing);
                 egwSLListFree(&_iQueues[0]);
                 egwSLListFree(&_iQueues[1]);
                 egwSLListFree(&_iQueues[2]);
@@ -376,7 +375,6 @@ static egwPhyActuator* _singleton = nil;
     egwInteractionWorkItem* prevWorkItem = nil;
     egwInteractionWorkItemReq* workReq = nil;
     egwSinglyLinkedListIter workItmIter;
-    egwArrayIter workReqIter;
     EGWint qIndex;
     EGWuint16 wItmIFrame;
     
@@ -436,11 +434,15 @@ static egwPhyActuator* _singleton = nil;
     }
     
     // Move items from outer queue into internal queue system
-    if(_requestList.eCount > 0) {
-        if(pthread_mutex_trylock(&_rLock) == 0) {
-            if(_requestList.eCount > 0) {
-                if(egwArrayEnumerateStart(&_requestList, EGW_ITERATE_MODE_DFLT, &workReqIter)) {
-                    while((workReq = (egwInteractionWorkItemReq*)egwArrayEnumerateNextPtr(&workReqIter))) {
+    if(!egwReqRingIsEmpty(&_requestRing)) {
+        {   egwInteractionWorkItemReq workReqs[EGW_PHYACTR_RQSTBATCHSIZE];
+            EGWuint reqCount, reqIndex;
+            
+            do {
+                if((reqCount = egwReqRingDequeue(&_requestRing, (EGWbyte*)workReqs, EGW_PHYACTR_RQSTBATCHSIZE)) > 0) {
+                    for(reqIndex = 0; reqIndex < reqCount; ++reqIndex) {
+                        workReq = &workReqs[reqIndex];
+                        
                         if(workReq->flags & EGW_PHYACTR_ACTRQUEUE_INSERT) { // Insert into the queues
                             if(!(workReq->flags & EGW_PHYACTR_ACTRQUEUE_ACTUATOR)) {
                                 if(!workReq->jmpTbls.iJmpT->fpInteracting(workReq->object, @selector(isInteracting))) {
@@ -524,13 +526,12 @@ static egwPhyActuator* _singleton = nil;
                             }
                         }
                     }
+                    
+                    for(reqIndex = 0; reqIndex < reqCount; ++reqIndex)
+                        [workReqs[reqIndex].object release]; // retained by request ring on enqueue
                 }
-                
-                egwArrayRemoveAll(&_requestList);
-            }
+            } while(reqCount == EGW_PHYACTR_RQSTBATCHSIZE);
         }
-        
-        pthread_mutex_unlock(&_rLock);
     }
     
     // First pass: Perform PRE frame check, resync objects.
@@ -59,6 +59,8 @@
 #define EGW_SNDMIXER_MIXRQUEUE_PAUSE        0x0400  ///< Pause/resume object in queue list structure.
 
 #define EGW_SNDMIXER_DFLTPRIORITY   0.5     ///< Default sound mixer priority.
+#define EGW_SNDMIXER_RQSTRINGSIZE   256     ///< Lock-free request ring capacity (requests beyond this spill onto a locked overflow list).
+#define EGW_SNDMIXER_RQSTBATCHSIZE  32      ///< Request ring dequeue batch size.
 
 
 /// Sound Mixer.
@@ -67,7 +69,6 @@
     egwSndMxrParams _params;                ///< Mixer parameters (copy).
     
     pthread_mutex_t _qLock;                 ///< Playback queue mutex lock.
-    pthread_mutex_t _rLock;                 ///< Request queue mutex lock.
     
     egwRedBlackTree _pQueues[4];            ///< Playback queues array (alias).
     egwTaskCameraData _lCamera;             ///< Listening task camera data (contents retained).
@@ -77,7 +78,7 @@
     EGWuint8 _pitchMods[4];                 ///< Pitch modifiers per queue.
     
     egwArray _pendingList;                  ///< Queue work item pending list for remove/resort (weak).
-    egwArray _requestList;                  ///< Queue work request list for insertion/removal.
+    egwRequestRing _requestRing;            ///< Queue work request ring for insertion/removal (lock-free, contents retained).
     
     id<NSObject> _lBase;                    ///< Last base tracker (retained).
     EGWuint16 _tFrame;                      ///< Playback task frame.
@@ -117,6 +118,11 @@
 /// @return Listening camera object.
 - (id<egwPCamera>)listenerCamera;
 
+/// Request Overflows Accessor.
+/// Returns the number of requests that have overflowed the lock-free request ring onto its locked overflow list.
+/// @return Overflowed request count.
+- (EGWuint)requestOverflows;
+
 
 /// Listener Camera Mutator.
 /// Sets the @a camera object used as the main audio listening source.
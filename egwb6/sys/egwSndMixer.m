@@ -33,6 +33,7 @@
 #import "../math/egwMath.h"
 #import "../math/egwVector.h"
 #import "../data/egwArray.h"
+#import "../data/egwRequestRing.h"
 #import "../data/egwRedBlackTree.h"
 #import "../gfx/egwCameras.h"
 #import "../misc/egwValidater.h"
@@ -202,11 +203,10 @@ static egwSndMixer* _singleton = nil;
     if(!(egwRBTreeInit(&_pQueues[2], &callbacks, sizeof(egwPlaybackWorkItem), EGW_TREE_FLG_DFLT))) { [self release]; return (self = nil); }
     if(!(egwRBTreeInit(&_pQueues[3], &callbacks, sizeof(egwPlaybackWorkItem), EGW_TREE_FLG_DFLT))) { [self release]; return (self = nil); }
     if(!(egwArrayInit(&_pendingList, NULL, sizeof(void*), 10, (EGW_ARRAY_FLG_GROWBY10 | EGW_ARRAY_FLG_GRWCND100 | EGW_ARRAY_FLG_SHRNKBY2X)))) { [self release]; return (self = nil); }
-    if(!(egwArrayInit(&_requestList, NULL, sizeof(egwPlaybackWorkReq), 10, (EGW_ARRAY_FLG_GROWBY10 | EGW_ARRAY_FLG_GRWCND100 | EGW_ARRAY_FLG_SHRNKBY2X | EGW_ARRAY_FLG_RETAIN)))) { [self release]; return (self = nil); }
+    if(!(egwReqRingInit(&_requestRing, sizeof(egwPlaybackWorkReq), EGW_SNDMIXER_RQSTRINGSIZE, EGW_ARRAY_FLG_RETAIN))) { [self release]; return (self = nil); }
     
     // Allocate mutex lock
     if(pthread_mutex_init(&_qLock, NULL)) { [self release]; return (self = nil); }
-    if(pthread_mutex_init(&_rLock, NULL)) { [self release]; return (self = nil); }
     
     // Associated instance with active context
     if(!(egwAISndCntx && [egwAISndCntx associateTask:self])) { [self release]; return (self = nil); }
@@ -221,7 +221,7 @@ static egwSndMixer* _singleton = nil;
     
     [_lBase release]; _lBase = nil;
     egwArrayFree(&_pendingList);
-    egwArrayFree(&_requestList);
+    egwReqRingFree(&_requestRing);
     [_lCamera.camera release]; _lCamera.camera = nil;
     [_lCamera.sync release]; _lCamera.sync = nil;
     _lCamera.source = NULL;
@@ -233,7 +233,6 @@ static egwSndMixer* _singleton = nil;
     egwRBTreeFree(&_pQueues[1]);
 	egwRBTreeFree(&_pQueues[0]);
     pthread_mutex_destroy(&_qLock);
-    pthread_mutex_destroy(&_rLock);
     
     [super dealloc];
 }
@@ -255,7 +254,7 @@ static egwSndMixer* _singleton = nil;
         if(_params.mode & EGW_SNDMIXER_MIXRMODE_FRAMECHECK)
             workItemReq.pJmpT->fpSetPFrame(playableObject, @selector(setPlaybackFrame:), egwAFPSndCntxPlaybackFrame(egwAISndCntx, @selector(playbackFrame)));
         
-        workItemReq.object = playableObject; // weak, retained on add
+        workItemReq.object = playableObject; // weak, retained on enqueue
         workItemReq.flags = EGW_SNDMIXER_MIXRQUEUE_INSERT;
         
         // NOTE: This code is only valid for mixer, where sounds are delegated to JUST one queue (no multi-queue). -jw
@@ -268,10 +267,8 @@ static egwSndMixer* _singleton = nil;
         else if(pFlags & EGW_SNDOBJ_PLAYFLG_LOWPRI)
             workItemReq.flags |= EGW_SNDMIXER_MIXRQUEUE_LOWPRI;
         
-        // Lock mutex and add to request queue
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -280,13 +277,11 @@ static egwSndMixer* _singleton = nil;
         egwPlaybackWorkReq workItemReq;
         workItemReq.pJmpT = [playableObject playableJumpTable];
         
-        workItemReq.object = playableObject; // weak, retained on add
+        workItemReq.object = playableObject; // weak, retained on enqueue
         workItemReq.flags = EGW_SNDMIXER_MIXRQUEUE_PAUSE;
         
-        // Lock mutex and add to request queue
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -295,13 +290,11 @@ static egwSndMixer* _singleton = nil;
         egwPlaybackWorkReq workItemReq;
         workItemReq.pJmpT = [playableObject playableJumpTable];
         
-        workItemReq.object = playableObject; // weak, retained on add
+        workItemReq.object = playableObject; // weak, retained on enqueue
         workItemReq.flags = EGW_SNDMIXER_MIXRQUEUE_REMOVE;
         
-        // Lock mutex and add to request queue
-        pthread_mutex_lock(&_rLock);
-        egwArrayAddTail(&_requestList, (const EGWbyte*)&workItemReq);
-        pthread_mutex_unlock(&_rLock);
+        // Add to lock-free request ring
+        egwReqRingEnqueue(&_requestRing, (const EGWbyte*)&workItemReq);
     }
 }
 
@@ -331,7 +324,7 @@ static egwSndMixer* _singleton = nil;
                 
                 [_lBase release]; _lBase = nil;
                 egwArrayFree(&_pendingList);
-                egwArrayFree(&_requestList);
+                egwReqRingFree(&_requestRing);
                 [_lCamera.camera release]; _lCamera.camera = nil;
                 [_lCamera.sync release]; _lCamera.sync = nil;
                 _lCamera.source = NULL;
@@ -352,6 +345,10 @@ static egwSndMixer* _singleton = nil;
     }
 }
 
+- (EGWuint)requestOverflows {
+    return egwReqRingOverflows(&_requestRing);
+}
+
 - (id<egwPCamera>)listenerCamera {
     return _lCamera.camera;
 }
@@ -459,13 +456,15 @@ static egwSndMixer* _singleton = nil;
     rsrvdPBSlots[0] = _rPBSlots[0]; // low
     
     // Move items from outer queue into internal queue system
-    if(_requestList.eCount > 0) {
-        if(pthread_mutex_trylock(&_rLock) == 0) {
-            if(_requestList.eCount > 0) {
-                egwArrayIter workReqIter;
-                
-                if(egwArrayEnumerateStart(&_requestList, EGW_ITERATE_MODE_DFLT, &workReqIter)) {
-                    while((workReq = (egwPlaybackWorkReq*)egwArrayEnumerateNextPtr(&workReqIter))) {
+    if(!egwReqRingIsEmpty(&_requestRing)) {
+        {   egwPlaybackWorkReq workReqs[EGW_SNDMIXER_RQSTBATCHSIZE];
+            EGWuint reqCount, reqIndex;
+            
+            do {
+                if((reqCount = egwReqRingDequeue(&_requestRing, (EGWbyte*)workReqs, EGW_SNDMIXER_RQSTBATCHSIZE)) > 0) {
+                    for(reqIndex = 0; reqIndex < reqCount; ++reqIndex) {
+                        workReq = &workReqs[reqIndex];
+                        
                         if(workReq->flags & EGW_SNDMIXER_MIXRQUEUE_INSERT) { // Insert into the queues
                             if(!workReq->pJmpT->fpPlaying(workReq->object, @selector(isPlaying))) {
                                 workReq->pJmpT->fpPlay(workReq->object, @selector(playWithFlags:), EGW_SNDOBJ_RPLYFLG_DOPLYBCKSTART);
@@ -501,11 +500,10 @@ static egwSndMixer* _singleton = nil;
                         }
                     }
                     
-                    egwArrayRemoveAll(&_requestList);
+                    for(reqIndex = 0; reqIndex < reqCount; ++reqIndex)
+                        [workReqs[reqIndex].object release]; // retained by request ring on enqueue
                 }
-            }
-            
-            pthread_mutex_unlock(&_rLock);
+            } while(reqCount == EGW_SNDMIXER_RQSTBATCHSIZE);
         }
     }
         
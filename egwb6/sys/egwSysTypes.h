@@ -96,6 +96,22 @@
 #define EGW_GFXOBJ_RPLYFLG_SHADEMODMASK 0xff000000  ///< Material shade modifier (x100) mask.
 #define EGW_GFXOBJ_RPLYFLG_SHADEMODSHFT         24  ///< Material shade modifier (x100) shift.
 
+// Render command types
+#define EGW_GFXCMD_NONE                     0x0000  ///< No operation.
+#define EGW_GFXCMD_PUSHSTACKS               0x0001  ///< Push and bind binding stacks (nil stacks bind context defaults).
+#define EGW_GFXCMD_POPSTACKS                0x0002  ///< Pop binding stacks (nil stacks are skipped).
+#define EGW_GFXCMD_PUSHMATRIX               0x0003  ///< Push modelview matrix and multiply by transform.
+#define EGW_GFXCMD_POPMATRIX                0x0004  ///< Pop modelview matrix.
+#define EGW_GFXCMD_ARRAYS                   0x0005  ///< Bind array buffer and set vertex, normal, and texture coordinate array pointers.
+#define EGW_GFXCMD_DRAWELEMENTS             0x0006  ///< Bind element buffer and draw indexed triangles.
+#define EGW_GFXCMD_RENDER                   0x0007  ///< Invoke renderWithFlags: of an object that does not record.
+
+// Render command flags
+#define EGW_GFXCMD_FLG_NONE                 0x0000  ///< No command flags.
+#define EGW_GFXCMD_FLG_SAMELASTBASE         0x0001  ///< Array pointers are skipped if array buffer binding is unchanged.
+#define EGW_GFXCMD_FLG_TEXCOORDS            0x0002  ///< Texture coordinate array pointer is set.
+#define EGW_GFXCMD_FLG_WIDEINDICIES         0x0004  ///< Element indicies are 32-bit (otherwise 16-bit).
+
 // Playback flags
 #define EGW_SNDOBJ_PLAYFLG_DFLT             0x0002  ///< Default play flags.
 #define EGW_SNDOBJ_PLAYFLG_LOWPRI           0x0001  ///< A low priority (ambient) sound.
@@ -355,4 +371,61 @@ typedef struct {
     BOOL isOrtho;                           ///< Tracks orthographic camera status.
 } egwTaskCameraData;
 
+/// Render Command Structure.
+/// Compact render record produced by a renderable (possibly off of the graphics context thread) and later replayed on the graphics context thread.
+typedef struct {
+    EGWuint16 type;                         ///< Command type (EGW_GFXCMD_*).
+    EGWuint16 flags;                        ///< Bit-wise command flags (EGW_GFXCMD_FLG_*).
+    union {
+        struct {
+            egwLightStack* lStack;          ///< Light stack (weak).
+            egwMaterialStack* mStack;       ///< Material stack (weak).
+            egwShaderStack* sStack;         ///< Shader stack (weak).
+            egwTextureStack* tStack;        ///< Texture stack (weak).
+        } stacks;                           ///< Binding stacks (PUSHSTACKS, POPSTACKS).
+        egwMatrix44f transform;             ///< Combined object transform (PUSHMATRIX).
+        struct {
+            EGWuint bufID;                  ///< Array buffer identifier (0 for client arrays).
+            const EGWbyte* vCoords;         ///< Vertex coordinates pointer (offset if buffered).
+            const EGWbyte* nCoords;         ///< Normal coordinates pointer (offset if buffered).
+            const EGWbyte* tCoords;         ///< Texture coordinates pointer (offset if buffered).
+        } arrays;                           ///< Array pointers (ARRAYS).
+        struct {
+            EGWuint bufID;                  ///< Element buffer identifier (0 for client indicies).
+            EGWuint count;                  ///< Element index count.
+            const EGWbyte* indicies;        ///< Element indicies pointer (offset if buffered).
+        } elements;                         ///< Indexed triangles (DRAWELEMENTS).
+        struct {
+            id object;                      ///< Renderable object (weak).
+            void (*fpRender)(id, SEL, EGWuint);///< IMP function pointer to renderWithFlags: method.
+            EGWuint32 flags;                ///< Rendering reply flags.
+        } render;                           ///< Object render call (RENDER).
+    } data;                                 ///< Command data.
+} egwGfxCommand;
+
+/// Render Command Buffer Structure.
+/// Contains a recorded stream of render commands.
+typedef struct {
+    egwGfxCommand* commands;                ///< Commands array (owned).
+    EGWuint cCount;                         ///< Commands count.
+    EGWuint cMax;                           ///< Commands capacity.
+    BOOL overflowed;                        ///< Tracks command allocation failure while recording (stream is incomplete and must not be replayed).
+} egwGfxCommandBuffer;
+
+/// Render Batch Scratch Structure.
+/// Contains the merged client arrays of batched runs, kept by the renderer for reuse between frames.
+/// @note Indicies and texture coords only depend on the rendering base and instances per chunk, so they are kept until either changes.
+typedef struct {
+    egwVector3f* vCoords;                   ///< Merged vertex coordinates (owned).
+    egwVector3f* nCoords;                   ///< Merged normal coordinates (owned).
+    egwVector2f* tCoords;                   ///< Merged texture coordinates (owned).
+    void* fIndicies;                        ///< Merged face indicies (owned).
+    EGWuint vMax;                           ///< Vertex/normal coordinates capacity.
+    EGWuint tMax;                           ///< Texture coordinates capacity (only grown for textured runs).
+    EGWuint iSize;                          ///< Face indicies capacity (in bytes).
+    id<NSObject> cBase;                     ///< Rendering base merged indicies were built from (retained).
+    EGWuint cPerChunk;                      ///< Instances per chunk merged indicies were built for.
+    BOOL cTCoords;                          ///< Tracks if merged texture coords were built for the current base and chunk.
+} egwGfxBatchScratch;
+
 /// @}
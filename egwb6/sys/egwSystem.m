@@ -25,539 +25,428 @@
 /// Base System Implementation.
 
 #import <stdlib.h>
+#import <float.h>
 #import "egwSystem.h"
+#if defined(EGW_SIMD_SSE) && defined(__SSE2__)
+#import <emmintrin.h>
+#elif defined(EGW_SIMD_NEON)
+#import <arm_neon.h>
+#endif
 
 
-EGWuint egwParseStringi8cv(const EGWchar* string_in, EGWint8* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
+// !!!: ***** Parse Helpers *****
+
+#define egwParseIsDelim(chr)    ((chr) <= ' ' || (chr) == ',')  // Note: includes null terminator
+
+static const EGWdouble egwParsePow10[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+// Skips deliminators, stopping at the first token character or null terminator.
+static inline const EGWchar* egwParseSkipDelims(const EGWchar* string_in) {
+    // Single space/comma separators are the common case, long runs come from line indentation
+    if(!egwParseIsDelim(*string_in) || *string_in == '\0') return string_in;
+    if(++string_in, !egwParseIsDelim(*string_in) || *string_in == '\0') return string_in;
+    
+    #if defined(EGW_SIMD_SSE) && defined(__SSE2__)
+    // Aligned 16-byte loads never cross a page boundary, so reading past the terminator within a block is safe
+    while((EGWuintptr)string_in & (EGWuintptr)15) {
+        if(!egwParseIsDelim(*string_in) || *string_in == '\0') return string_in;
+        ++string_in;
+    }
+    {   const __m128i space = _mm_set1_epi8(' ');
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i zero = _mm_setzero_si128();
+        __m128i block;
+        EGWint mask;
+        
+        while(1) {
+            block = _mm_load_si128((const __m128i*)string_in); // signed compare treats >= 0x80 as deliminator, same as scalar
+            mask = _mm_movemask_epi8(_mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi8(block, comma), _mm_cmpgt_epi8(block, space)),
+                                                  _mm_cmpeq_epi8(block, zero)));
+            if(mask) return string_in + __builtin_ctz((EGWuint)mask);
+            string_in += 16;
+        }
+    }
+    #elif defined(EGW_SIMD_NEON)
+    while((EGWuintptr)string_in & (EGWuintptr)15) {
+        if(!egwParseIsDelim(*string_in) || *string_in == '\0') return string_in;
+        ++string_in;
+    }
+    {   const int8x16_t space = vdupq_n_s8(' ');
+        const int8x16_t comma = vdupq_n_s8(',');
+        const int8x16_t zero = vdupq_n_s8(0);
+        int8x16_t block;
+        uint8x16_t stop;
+        
+        while(1) {
+            block = vld1q_s8((const int8_t*)string_in);
+            stop = vorrq_u8(vbicq_u8(vcgtq_s8(block, space), vceqq_s8(block, comma)), vceqq_s8(block, zero));
+            if(vget_lane_u64(vreinterpret_u64_u8(vorr_u8(vget_low_u8(stop), vget_high_u8(stop))), 0)) {
+                while(egwParseIsDelim(*string_in) && *string_in != '\0') ++string_in;
+                return string_in;
+            }
+            string_in += 16;
+        }
+    }
+    #else
+    while(egwParseIsDelim(*string_in) && *string_in != '\0') ++string_in;
+    return string_in;
+    #endif
+}
+
+// Skips token characters, stopping at the first deliminator or null terminator.
+static inline const EGWchar* egwParseSkipToken(const EGWchar* string_in) {
+    while(!egwParseIsDelim(*string_in)) ++string_in;
+    return string_in;
+}
+
+// Parses an integer token in place (atoi semantics, wrapping on overflow), returns end of token.
+static inline const EGWchar* egwParseInteger(const EGWchar* string_in, EGWuint64* value_out) {
+    EGWuint64 value = 0;
+    BOOL negative = NO;
+    
+    if(*string_in == '-') { negative = YES; ++string_in; }
+    else if(*string_in == '+') ++string_in;
+    
+    while((EGWuint)(*string_in - '0') < 10)
+        value = (value * 10) + (EGWuint64)(*string_in++ - '0');
+    
+    *value_out = (negative ? (EGWuint64)0 - value : value);
+    
+    return egwParseSkipToken(string_in);
+}
+
+// Parses a decimal token in place when the result is exactly representable as m * 10^e (m <= 2^53, |e| <= 22), returns NO otherwise.
+static BOOL egwParseFastd(const EGWchar* string_in, const EGWchar** end_out, EGWdouble* value_out) {
+    EGWuint64 mantissa = 0;
+    EGWint exponent = 0, expValue = 0, digits = 0;
+    BOOL negative = NO, expNegative = NO, scanned = NO;
+    
+    if(*string_in == '-') { negative = YES; ++string_in; }
+    else if(*string_in == '+') ++string_in;
+    
+    for(; (EGWuint)(*string_in - '0') < 10; ++string_in, scanned = YES) {
+        if(mantissa || *string_in != '0') {
+            if(++digits > 19) return NO;
+            mantissa = (mantissa * 10) + (EGWuint64)(*string_in - '0');
+        }
+    }
+    
+    if(*string_in == '.') {
+        for(++string_in; (EGWuint)(*string_in - '0') < 10; ++string_in, scanned = YES) {
+            if(mantissa || *string_in != '0') {
+                if(++digits > 19) return NO;
+                mantissa = (mantissa * 10) + (EGWuint64)(*string_in - '0');
+            }
+            --exponent;
+        }
+    }
+    
+    if(!scanned) return NO;
+    
+    if(*string_in == 'e' || *string_in == 'E') {
+        ++string_in;
+        if(*string_in == '-') { expNegative = YES; ++string_in; }
+        else if(*string_in == '+') ++string_in;
+        if((EGWuint)(*string_in - '0') >= 10) return NO;
+        for(; (EGWuint)(*string_in - '0') < 10; ++string_in)
+            if(expValue < 10000) expValue = (expValue * 10) + (EGWint)(*string_in - '0');
+        exponent += (expNegative ? -expValue : expValue);
+    }
+    
+    if(!egwParseIsDelim(*string_in)) return NO;
+    
+    if(mantissa == 0)
+        *value_out = (negative ? -0.0 : 0.0);
+    else if(mantissa <= ((EGWuint64)1 << 53) && exponent >= -22 && exponent <= 22) {
+        // Both operands are exact, so the single IEEE multiply/divide is correctly rounded
+        *value_out = (exponent < 0 ? (EGWdouble)mantissa / egwParsePow10[-exponent] : (EGWdouble)mantissa * egwParsePow10[exponent]);
+        if(negative) *value_out = -*value_out;
+    } else return NO;
+    
+    *end_out = string_in;
+    return YES;
+}
+
+// Parses a single precision token in place, returns end of token.
+static inline const EGWchar* egwParseSingle(const EGWchar* string_in, EGWsingle* value_out) {
+    union { EGWdouble d; EGWuint64 u; } value;
     const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
-    EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
+    if(egwParseFastd(string_in, &end, &value.d)) {
+        EGWdouble magnitude = (value.d < 0.0 ? -value.d : value.d);
+        
+        // Narrowing is exact unless the double lands on a single precision rounding midpoint or outside the normal range
+        if(value.d == 0.0 || (magnitude >= (EGWdouble)FLT_MIN && magnitude <= (EGWdouble)FLT_MAX &&
+                              (value.u & (EGWuint64)0x1fffffff) != (EGWuint64)0x10000000)) {
+            *value_out = (EGWsingle)value.d;
+            return end;
+        }
+    }
+    
+    *value_out = (EGWsingle)strtof((const char*)string_in, NULL);
+    return egwParseSkipToken(string_in);
+}
+
+// Parses a double precision token in place, returns end of token.
+static inline const EGWchar* egwParseDouble(const EGWchar* string_in, EGWdouble* value_out) {
+    const EGWchar* end = NULL;
+    
+    if(egwParseFastd(string_in, &end, value_out))
+        return end;
+    
+    *value_out = (EGWdouble)strtod((const char*)string_in, NULL);
+    return egwParseSkipToken(string_in);
+}
+
+
+// !!!: ***** String Routines *****
+
+EGWuint egwParseStringi8cv(const EGWchar* string_in, EGWint8* array_out, EGWintptr strideB_out, EGWuint count) {
+    EGWuint64 value = 0;
+    EGWuint processed = 0;
     
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringi8cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseInteger(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWint8)atoi((const char*)value);
+            *array_out = (EGWint8)value;
             array_out = (EGWint8*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWint8) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringi16cv(const EGWchar* string_in, EGWint16* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringi16cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseInteger(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWint16)atoi((const char*)value);
+            *array_out = (EGWint16)value;
             array_out = (EGWint16*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWint16) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringi32cv(const EGWchar* string_in, EGWint32* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringi32cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
-            
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
+            string_in = egwParseInteger(string_in, &value);
             
-            *array_out = (EGWint32)atol((const char*)value);
+            *array_out = (EGWint32)value;
             array_out = (EGWint32*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWint32) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringi64cv(const EGWchar* string_in, EGWint64* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringi64cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseInteger(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWint64)atoll((const char*)value);
+            *array_out = (EGWint64)value;
             array_out = (EGWint64*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWint64) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringui8cv(const EGWchar* string_in, EGWuint8* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringui8cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseInteger(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWuint8)atoi((const char*)value);
+            *array_out = (EGWuint8)value;
             array_out = (EGWuint8*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWuint8) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringui16cv(const EGWchar* string_in, EGWuint16* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringui16cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
-            
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
+            string_in = egwParseInteger(string_in, &value);
             
-            *array_out = (EGWuint16)atoi((const char*)value);
+            *array_out = (EGWuint16)value;
             array_out = (EGWuint16*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWuint16) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringui32cv(const EGWchar* string_in, EGWuint32* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringui32cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseInteger(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWuint32)atoll((const char*)value);
+            *array_out = (EGWuint32)value;
             array_out = (EGWuint32*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWuint32) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringui64cv(const EGWchar* string_in, EGWuint64* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringui64cv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseInteger(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWuint64)atoll((const char*)value);
+            *array_out = (EGWuint64)value;
             array_out = (EGWuint64*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWuint64) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringicv(const EGWchar* string_in, EGWint* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringicv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
-            
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
+            string_in = egwParseInteger(string_in, &value);
             
-            *array_out = (EGWint)atol((const char*)value);
+            *array_out = (EGWint)value;
             array_out = (EGWint*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWint) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringuicv(const EGWchar* string_in, EGWuint* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWuint64 value = 0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringuicv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseInteger(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWuint)atol((const char*)value);
+            *array_out = (EGWuint)value;
             array_out = (EGWuint*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWuint) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringfcv(const EGWchar* string_in, EGWsingle* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWsingle value = 0.0f;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringfcv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseSingle(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWsingle)atof((const char*)value);
+            *array_out = (EGWsingle)value;
             array_out = (EGWsingle*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWsingle) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringdcv(const EGWchar* string_in, EGWdouble* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWdouble value = 0.0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringdcv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
+            string_in = egwParseDouble(string_in, &value);
             
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
-            
-            *array_out = (EGWdouble)atof((const char*)value);
+            *array_out = (EGWdouble)value;
             array_out = (EGWdouble*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWdouble) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
 EGWuint egwParseStringtcv(const EGWchar* string_in, EGWtriple* array_out, EGWintptr strideB_out, EGWuint count) {
-    const EGWchar* start = NULL;
-    const EGWchar* end = NULL;
-    EGWchar* value = NULL;
-    EGWuint valueSize = 0;
+    EGWdouble value = 0.0;
     EGWuint processed = 0;
     
-    while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-    if(*string_in == '\0') return processed;
-    else start = end = string_in;
-    
     while(processed < count) {
-        if(!(*string_in <= ' ' || *string_in == ',' || *string_in == '\0'))
-            end = ++string_in;
+        if(*(string_in = egwParseSkipDelims(string_in)) == '\0') break;
         else {
-            if(valueSize < ((EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1)) {
-                if(value) { free((void*)value); value = NULL; valueSize = 0; }
-                valueSize = (EGWuint)((EGWuintptr)end - (EGWuintptr)start) + 1; valueSize = valueSize + (valueSize >> 1); // x1.5
-                if(!(value = (EGWchar*)malloc((size_t)valueSize))) {
-                    NSLog(@"egwParseStringtcv: Failure allocating memory for temporary storage.");
-                    return processed;
-                }
-            }
-            
-            strncpy((char*)value, (const char*)start, (size_t)((EGWuintptr)end - (EGWuintptr)start)); value[(EGWuint)((EGWuintptr)end - (EGWuintptr)start)] = '\0';
+            string_in = egwParseDouble(string_in, &value);
             
-            *array_out = (EGWtriple)atof((const char*)value);
+            *array_out = (EGWtriple)value;
             array_out = (EGWtriple*)((EGWintptr)array_out + (EGWintptr)sizeof(EGWtriple) + strideB_out);
             
             ++processed;
-            while((*string_in <= ' ' || *string_in == ',') && *string_in != '\0') ++string_in;
-            if(*string_in == '\0') break;
-            else start = end = string_in;
         }
     }
     
-    if(value) { free((void*)value); value = NULL; valueSize = 0; }
-    
     return processed;
 }
 
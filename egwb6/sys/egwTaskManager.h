@@ -28,55 +28,112 @@
 /// @file egwTaskManager.h
 /// Task Manager Interface.
 
+#import <pthread.h>
 #import "egwSysTypes.h"
 #import "../inf/egwPSingleton.h"
 #import "../inf/egwPTask.h"
 
 
-#define EGW_TASKMNGR_TASKTHREADS        3   ///< Total number of task threads in thread pool.
-#define EGW_TASKMNGR_MAXTASKHANDLES     16  ///< Max number of tracked task handles.
-#define EGW_TASKMNGR_MAXDEPENDENCIES    16  ///< Max number of tracked task dependencies.
-#define EGW_TASKMNGR_MAXTASKDEPENDENTS  4   ///< Max number of dependencies per task handle.
+#define EGW_TASKMNGR_MINTASKTHREADS     3   ///< Minimum number of task threads in thread pool.
+#define EGW_TASKMNGR_MAXTASKTHREADS     16  ///< Maximum number of task threads in thread pool (pool is sized to active processor count).
+#define EGW_TASKMNGR_INITTASKHANDLES    16  ///< Initial task handle capacity (grows as needed).
+#define EGW_TASKMNGR_INITDEPENDENCIES   16  ///< Initial task dependency capacity (grows as needed).
+#define EGW_TASKMNGR_INITTASKLINKS      4   ///< Initial dependency link capacity per task handle (grows as needed).
+#define EGW_TASKMNGR_HANDLESLOTBITS     20  ///< Task handle low bits holding the task slot (slot + 1), the bits above hold the slot's generation.
 
 
 /// Task Item Structure.
+/// @note Task items are stored at a stable slot for the lifetime of their registration, a task handle is the slot + 1 in its low bits and the slot generation in its high bits.
 typedef struct {
     id<egwPTask> task;                      ///< Task object (retained).
     IMP fpPrfmTask;                         ///< Reference to performTask to reduce frequent dynamic lookup overhead.
     EGWsingle tPriority;                    ///< Task priority.
-    EGWuint16 tiFlags;                      ///< Task item flags.
-    EGWint8 ttDeps;                         ///< Total number of tasks this task is dependent on.
-    EGWint8 twDeps;                         ///< Number of tasks this task is waiting for.
-    EGWint8 tdDeps;                         ///< Total number of tasks dependent on this task.
-    EGWint8 ttIndicies[EGW_TASKMNGR_MAXTASKDEPENDENTS]; ///< Task dependency indicies for linkage to tasks this task is dependent on (left).
-    EGWint8 tdIndicies[EGW_TASKMNGR_MAXTASKDEPENDENTS]; ///< Task dependency indicies for linkage to tasks dependent on this task (right).
+    EGWuint16 tGen;                         ///< Slot generation (bumped on unregister, stale task handles fail to match).
+    EGWuint32 tiFlags;                      ///< Task item flags (atomically updated by task threads).
+    EGWuint ttDeps;                         ///< Total number of tasks this task is dependent on.
+    EGWuint32 twDeps;                       ///< Number of tasks this task is waiting for (atomically updated by task threads).
+    EGWuint tdDeps;                         ///< Total number of tasks dependent on this task.
+    EGWuint ttMax;                          ///< Left linkage capacity.
+    EGWuint tdMax;                          ///< Right linkage capacity.
+    EGWuint* ttIndicies;                    ///< Task dependency indicies for linkage to tasks this task is dependent on (left, owned).
+    EGWuint* tdIndicies;                    ///< Task dependency indicies for linkage to tasks dependent on this task (right, owned).
 } egwTaskItem;
 
 /// Task Dependency Structure.
 typedef struct {
-    EGWuint8 tdFlags;                       ///< Task dependency flags.
-    EGWint8 ttiIndex;                       ///< Task item index.
-    EGWint8 tdiIndex;                       ///< Task depedent-on item index.
+    EGWuint32 tdFlags;                      ///< Task dependency flags (atomically updated by task threads).
+    EGWuint ttiIndex;                       ///< Task item index.
+    EGWuint tdiIndex;                       ///< Task depedent-on item index.
 } egwTaskDependency;
 
+/// Task Thread Structure.
+typedef struct {
+    NSThread* thread;                       ///< Thread object (retained).
+    id<egwPTask> owner;                     ///< Task thread owner (retained).
+    pthread_mutex_t dLock;                  ///< Ready queues mutex lock.
+    pthread_cond_t wCond;                   ///< Work wait signal condition (targeted, waited on with dLock).
+    EGWuint* dQueue;                        ///< Ready task index deque ring (stealable, owner works tail, thieves take head, owned).
+    EGWuint* pQueue;                        ///< Ready task index queue ring (pinned to thread, for thread owner tasks, owned).
+    EGWuint dHead;                          ///< Ready deque head position.
+    EGWuint dCount;                         ///< Ready deque count.
+    EGWuint dMax;                           ///< Ready deque capacity.
+    EGWuint pHead;                          ///< Pinned queue head position.
+    EGWuint pCount;                         ///< Pinned queue count.
+    EGWuint pMax;                           ///< Pinned queue capacity.
+    BOOL isIdle;                            ///< Tracks idle waiting status (set with dLock).
+    BOOL threadAlert;                       ///< Tracks thread alert status (set with dLock).
+    BOOL doMemClean;                        ///< Tracks memory cleanup status.
+} egwTaskThread;
+
+/// Parallel range routine function pointer typedef.
+/// @note Called with the half-open index range [begin,end) to process, possibly concurrently from multiple threads.
+typedef void (*EGWrangefp)(void* context, EGWuint begin, EGWuint end);
+
+/// Parallel For Job Structure.
+/// @note Jobs are owned by (and live on the stack of) the forking thread until joined.
+typedef struct egwParallelForJob {
+    EGWrangefp fpRange;                     ///< Range routine.
+    void* context;                          ///< Range routine context (weak).
+    EGWuint rNext;                          ///< Next unclaimed range index.
+    EGWuint rEnd;                           ///< Range end index.
+    EGWuint rGrain;                         ///< Range grain size (indicies per claim).
+    EGWuint jHelpers;                       ///< Number of task threads still helping.
+    pthread_mutex_t jLock;                  ///< Job mutex lock.
+    pthread_cond_t jCond;                   ///< Job join signal condition.
+    struct egwParallelForJob* next;         ///< Next active job (weak).
+} egwParallelForJob;
+
 
 /// Task Manager.
 /// Manages instances and executions of cyclic tasks and performs operations relating to such.
+/// @note Ready tasks are queued onto per-thread deques (preferring the thread last executed on), idle threads steal from the others.
+/// @note Tasks and dependencies are stored in growable slot tables with free lists, completing a task only visits its own dependents.
+/// @note Task threads start and complete tasks under a shared graph lock (item flags & wait counts are updated atomically), graph changes take it exclusively.
+/// @note Readiness is pushed on completion (each finished task decrements its dependents' wait counts and queues those reaching zero) rather than read from a precomputed topological order, since task graphs are cyclic by design and a precomputed order would have to be rebuilt on every register/unregister.
 @interface egwTaskManager : NSThread <egwPSingleton> {
-    pthread_mutex_t _cLock;                 ///< Counter mutex lock.
-    pthread_cond_t _wCond;                  ///< Work wait signal condition.
-    NSThread* _tPool[EGW_TASKMNGR_TASKTHREADS]; ///< Task threads pool.
-    id<egwPTask> _tOwner[EGW_TASKMNGR_TASKTHREADS]; ///< Task thread owner (retained).
+    pthread_mutex_t _cLock;                 ///< Counter mutex lock (state counts, thread ownership, parallel for jobs).
+    pthread_rwlock_t _gLock;                ///< Task graph lock (shared by task threads to start & complete tasks, exclusive to change the graph).
+    pthread_cond_t _sCond;                  ///< State change signal condition (task, thread & cleanup counts).
+    egwTaskThread _tThreads[EGW_TASKMNGR_MAXTASKTHREADS]; ///< Task threads pool.
+    EGWuint16 _tpCount;                     ///< Task threads pool count.
+    EGWuint32 _tqNext;                      ///< Next task thread for unaffiliated ready tasks (round robin, atomically updated).
+    
+    EGWuint16 _ttCount;                     ///< Task threads (up) count.
+    EGWuint _tiCount;                       ///< Task items count.
+    EGWuint _tiUsed;                        ///< Task item slots used (high water mark).
+    EGWuint _tiMax;                         ///< Task item slots capacity.
+    egwTaskItem* _tItems;                   ///< Task items array (slot = handle low bits - 1, owned).
+    EGWuint _tiFreeCount;                   ///< Task item free slots count.
+    EGWuint* _tiFree;                       ///< Task item free slots stack (owned).
+    EGWuint _tdCount;                       ///< Task dependencies count.
+    EGWuint _tdUsed;                        ///< Task dependency slots used (high water mark).
+    EGWuint _tdMax;                         ///< Task dependency slots capacity.
+    egwTaskDependency* _tDeps;              ///< Task dependencies array (owned).
+    EGWuint _tdFreeCount;                   ///< Task dependency free slots count.
+    EGWuint* _tdFree;                       ///< Task dependency free slots stack (owned).
     
-    EGWuint16 _ttCount;                                 ///< Task threads (up) count.
-    EGWuint16 _tiCount;                                 ///< Task items count.
-    EGWint8 _tHndLkup[EGW_TASKMNGR_MAXTASKHANDLES];     ///< Task handle -> index lookup.
-    egwTaskItem _tItems[EGW_TASKMNGR_MAXTASKHANDLES];   ///< Task items array.
-    EGWuint _tdCount;                                   ///< Task dependencies count.
-    egwTaskDependency _tDeps[EGW_TASKMNGR_MAXDEPENDENCIES]; ///< Task dependencies array.
+    egwParallelForJob* _pfJobs;             ///< Active parallel for jobs stack (weak).
     
-    BOOL _threadAlert[EGW_TASKMNGR_TASKTHREADS]; ///< Tracks thread alert status.
-    BOOL _doMemClean[EGW_TASKMNGR_TASKTHREADS]; ///< Tracks memory cleanup status.
     EGWuint8 _memCleanLeft;                 ///< Tracks number of threads left to clean.
     
     BOOL _doShutdownPh1;                    ///< Tracks phase 1 shut down status.
@@ -145,6 +202,7 @@ typedef struct {
 
 /// Unregister Task Method.
 /// Removes task @a taskHandle and any of its dependencies from the managed task set.
+/// @note Stale task handles (of already unregistered tasks) are ignored by all handle methods, even after their slot is reused.
 /// @note Calling this method from inside a task manager thread may cause deadlock.
 /// @param [in] taskHandle Task handle identifier.
 - (void)unregisterTask:(EGWint)taskHandle;
@@ -154,6 +212,17 @@ typedef struct {
 /// @note This method blocks until all task threads have responded to the cleanup request.
 - (void)performMemoryCleanup;
 
+/// Parallel For (range) Method.
+/// Splits the index range [@a begin,@a end) into chunks of @a grainSize indicies and runs @a routine over them across the task thread pool.
+/// @note This method forks and joins: the calling thread works on chunks itself and blocks until every chunk has finished.
+/// @note Idle task threads help with chunks before taking new tasks, tasks may use this inside of performTask to fan out heavy loops.
+/// @param [in] begin Range begin index.
+/// @param [in] end Range end index (exclusive).
+/// @param [in] grainSize Indicies per chunk (0 for automatic sizing).
+/// @param [in] routine Range routine.
+/// @param [in] context Range routine context.
+- (void)parallelForRangeFrom:(EGWuint)begin to:(EGWuint)end withGrain:(EGWuint)grainSize usingRoutine:(EGWrangefp)routine withContext:(void*)context;
+
 /// Shut Down Task Threads Method.
 /// Signals task threads to shut down.
 /// @note This method blocks until all tasks are removed (or timeout), taks being responsible for removing themselves.
@@ -170,6 +239,11 @@ typedef struct {
 /// @return Number of tasks.
 - (EGWuint)taskCount;
 
+/// Task Thread Count Accessor.
+/// Returns the number of task threads in the thread pool.
+/// @return Number of task threads.
+- (EGWuint)taskThreadCount;
+
 
 /// IsShuttingDownTaskThreads Poller.
 /// Polls the object to determine status.
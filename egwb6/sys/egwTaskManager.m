@@ -24,7 +24,10 @@
 /// @ingroup geWizES_sys_taskmanager
 /// Task Manager Implementation.
 
+#import <errno.h>
 #import <pthread.h>
+#import <sys/time.h>
+#import <libkern/OSAtomic.h>
 #import "egwTaskManager.h"
 #import "../sys/egwEngine.h"
 #import "../sys/egwGfxContext.h"
@@ -40,20 +43,139 @@
 #define EGW_TSKITMFLG_STARTER       0x0400  // Task is a starter task.
 #define EGW_TSKITMFLG_TEMPORARY     0x0800  // Task is a temporary/run-once.
 #define EGW_TSKITMFLG_OWNSTHRD      0x1000  // Task owns a thread.
+#define EGW_TSKITMFLG_QUEUED        0x2000  // Task is queued on a task thread.
+#define EGW_TSKITMFLG_FREESLOT      0x4000  // Task slot freed while queued (reclaimed when dequeued).
 #define EGW_TSKITMFLG_MARKEDREM     0x8000  // Task is marked for removal.
 #define EGW_TSKITMFLG_EXLASTTHRD    0x00ff  // Used to extract last used thread from bitfield.
 
 #define EGW_TSKDPDFLG_NONE          0x00    // No flags.
 #define EGW_TSKDPDFLG_SATISFIED     0x01    // Dependent task has ran.
+#define EGW_TSKDPDFLG_FREESLOT      0x80    // Dependency slot is free.
+
+#define EGW_TSKHNDL_SLOTMASK        ((1 << EGW_TASKMNGR_HANDLESLOTBITS) - 1)    // Used to extract slot + 1 from task handle.
+#define EGW_TSKHNDL_GENMASK         (0x7fffffff >> EGW_TASKMNGR_HANDLESLOTBITS) // Slot generation range (keeps task handles positive).
 
 
 egwTaskManager* egwSITaskMngr = nil;
 
 
+// !!!: ***** Helper Routines *****
+
+static void egwTaskMngrDeadline(struct timespec* deadline_out, EGWtime seconds) {
+    struct timeval now; gettimeofday(&now, NULL);
+    
+    deadline_out->tv_sec = now.tv_sec + (time_t)seconds;
+    deadline_out->tv_nsec = ((long)now.tv_usec * 1000L) + (long)((seconds - (EGWtime)(time_t)seconds) * 1000000000.0);
+    if(deadline_out->tv_nsec >= 1000000000L) {
+        ++deadline_out->tv_sec;
+        deadline_out->tv_nsec -= 1000000000L;
+    }
+}
+
+static BOOL egwTaskMngrGrow(void** array_inout, EGWuint* capacity_inout, size_t elmSize, EGWuint minCapacity) {
+    EGWuint newCapacity = egwMax2ui(minCapacity, *capacity_inout << 1);
+    void* newArray = realloc(*array_inout, elmSize * (size_t)newCapacity);
+    
+    if(!newArray) return NO;
+    
+    *array_inout = newArray;
+    *capacity_inout = newCapacity;
+    
+    return YES;
+}
+
+static BOOL egwTaskMngrGrowSlots(void** slots_inout, EGWuint** free_inout, EGWuint* capacity_inout, size_t elmSize, EGWuint minCapacity) {
+    EGWuint newCapacity = egwMax2ui(minCapacity, *capacity_inout << 1);
+    void* newSlots; EGWuint* newFree;
+    
+    if(!(newSlots = realloc(*slots_inout, elmSize * (size_t)newCapacity))) return NO;
+    *slots_inout = newSlots;
+    
+    if(!(newFree = (EGWuint*)realloc((void*)*free_inout, sizeof(EGWuint) * (size_t)newCapacity))) return NO; // Capacity left as is
+    *free_inout = newFree;
+    
+    *capacity_inout = newCapacity;
+    
+    return YES;
+}
+
+static BOOL egwTaskMngrGrowRing(EGWuint** ring_inout, EGWuint* head_inout, EGWuint count, EGWuint* capacity_inout) {
+    EGWuint newCapacity = egwMax2ui(EGW_TASKMNGR_INITTASKHANDLES, *capacity_inout << 1);
+    EGWuint* newRing = (EGWuint*)malloc(sizeof(EGWuint) * (size_t)newCapacity);
+    
+    if(!newRing) return NO;
+    
+    // Unwrap into new ring starting at 0
+    for(EGWuint index = 0; index < count; ++index)
+        newRing[index] = (*ring_inout)[(*head_inout + index) % *capacity_inout];
+    
+    if(*ring_inout) free((void*)*ring_inout);
+    *ring_inout = newRing;
+    *head_inout = 0;
+    *capacity_inout = newCapacity;
+    
+    return YES;
+}
+
+// NOTE: Task threads start and complete tasks holding only the graph lock shared, so item flags, wait counts and dependency flags change through these. -jw
+static EGWuint32 egwTaskMngrFlagsSet(volatile EGWuint32* flags_inout, EGWuint32 bits) {
+    EGWuint32 flags;
+    do { flags = *flags_inout; } while(!OSAtomicCompareAndSwap32Barrier((int32_t)flags, (int32_t)(flags | bits), (volatile int32_t*)flags_inout));
+    return flags;
+}
+
+static EGWuint32 egwTaskMngrFlagsClear(volatile EGWuint32* flags_inout, EGWuint32 bits) {
+    EGWuint32 flags;
+    do { flags = *flags_inout; } while(!OSAtomicCompareAndSwap32Barrier((int32_t)flags, (int32_t)(flags & ~bits), (volatile int32_t*)flags_inout));
+    return flags;
+}
+
+static BOOL egwTaskMngrReleaseWait(volatile EGWuint32* waits_inout) {
+    EGWuint32 waits;
+    do { if(!(waits = *waits_inout)) return NO; } while(!OSAtomicCompareAndSwap32Barrier((int32_t)waits, (int32_t)(waits - 1), (volatile int32_t*)waits_inout));
+    return (waits == 1 ? YES : NO); // YES if this release was the last wait
+}
+
+static EGWint egwTaskMngrHandle(EGWuint taskIndex, EGWuint16 tGen) {
+    return (EGWint)((((EGWuint32)tGen & EGW_TSKHNDL_GENMASK) << EGW_TASKMNGR_HANDLESLOTBITS) | (EGWuint32)(taskIndex + 1));
+}
+
+static void egwTaskMngrUnlink(EGWuint* links_inout, EGWuint* count_inout, EGWuint depIndex) {
+    EGWuint linkIndex = *count_inout; while(linkIndex--)
+        if(links_inout[linkIndex] == depIndex) {
+            links_inout[linkIndex] = links_inout[--(*count_inout)]; // Swap remove, link order is irrelevant
+            break;
+        }
+}
+
+static void egwTaskMngrRunRange(egwParallelForJob* job) {
+    EGWuint rBegin, rEnd;
+    
+    while(1) {
+        // Claim next chunk
+        pthread_mutex_lock(&job->jLock);
+        rBegin = job->rNext;
+        rEnd = job->rNext = (job->rEnd - rBegin > job->rGrain ? rBegin + job->rGrain : job->rEnd);
+        pthread_mutex_unlock(&job->jLock);
+        
+        if(rBegin >= rEnd) break; // Range exhausted
+        
+        job->fpRange(job->context, rBegin, rEnd);
+    }
+}
+
+
 // !!!: ***** egwTaskManager *****
 
 @interface egwTaskManager (Private)
-- (void)unregisterTaskAlreadyLocked:(EGWint)taskHandle;
+- (EGWint)registerTaskAlreadyLocked:(id<egwPTask>)task withFlags:(EGWuint16)flags;
+- (EGWint)taskIndexForHandleAlreadyLocked:(EGWint)taskHandle;
+- (void)queueTaskAlreadyLocked:(EGWuint)taskIndex preferThread:(EGWuint)threadNumber;
+- (void)queueRemovalsAlreadyLocked;
+- (EGWint)dequeueTaskForThread:(EGWuint)threadNumber;
+- (void)alertTaskThreads;
+- (BOOL)assistParallelForJobs;
+- (void)unregisterTaskAtIndexAlreadyLocked:(EGWuint)taskIndex;
 - (void)taskThreadEntryPoint;
 - (void)taskThreadMainLoop:(NSAutoreleasePool**)arPool;
 @end
@@ -74,26 +196,35 @@ static egwTaskManager* _singleton = nil;
 - (id)init {
     if(!(self = [super init])) { [self release]; return (self = nil); }
     
-    _tiCount = _tdCount = 0;
+    _tiCount = _tiUsed = _tiMax = _tiFreeCount = 0;
+    _tdCount = _tdUsed = _tdMax = _tdFreeCount = 0;
+    _pfJobs = NULL;
     
-    memset((void*)&(_tItems[0]), 0, sizeof(egwTaskItem) * EGW_TASKMNGR_MAXTASKHANDLES);
-    memset((void*)&(_tDeps[0]), 0, sizeof(egwTaskDependency) * EGW_TASKMNGR_MAXDEPENDENCIES);
+    memset((void*)&(_tThreads[0]), 0, sizeof(egwTaskThread) * EGW_TASKMNGR_MAXTASKTHREADS);
+    
+    if(!egwTaskMngrGrowSlots((void**)&_tItems, &_tiFree, &_tiMax, sizeof(egwTaskItem), EGW_TASKMNGR_INITTASKHANDLES)) { [self release]; return (self = nil); }
+    if(!egwTaskMngrGrowSlots((void**)&_tDeps, &_tdFree, &_tdMax, sizeof(egwTaskDependency), EGW_TASKMNGR_INITDEPENDENCIES)) { [self release]; return (self = nil); }
     
     if(pthread_mutex_init(&_cLock, NULL)) { [self release]; return (self = nil); }
-    if(pthread_cond_init(&_wCond, NULL)) { [self release]; return (self = nil); }
+    if(pthread_rwlock_init(&_gLock, NULL)) { [self release]; return (self = nil); }
+    if(pthread_cond_init(&_sCond, NULL)) { [self release]; return (self = nil); }
     
-    // Set up task handle lookup
-    for(EGWint taskIndex = 0; taskIndex < EGW_TASKMNGR_MAXTASKHANDLES; ++taskIndex)
-        _tHndLkup[taskIndex] = -1;
+    // Size thread pool to the number of cores available
+    _tpCount = (EGWuint16)egwClampui((EGWuint)[[NSProcessInfo processInfo] activeProcessorCount], EGW_TASKMNGR_MINTASKTHREADS, EGW_TASKMNGR_MAXTASKTHREADS);
+    _tqNext = 0;
     
     // Initialize task threads first, then start afterwords
-    for(EGWint threadIndex = 0; threadIndex < EGW_TASKMNGR_TASKTHREADS; ++threadIndex) {
-        if(!(_tPool[threadIndex] = [[NSThread alloc] initWithTarget:self selector:@selector(taskThreadEntryPoint) object:nil])) { [self release]; return (self = nil); }
-        [_tPool[threadIndex] setName:[[NSString alloc] initWithFormat:@"egwTaskManagerTaskThread%02d", (threadIndex+1)]];
-        _tOwner[threadIndex] = nil;
+    for(EGWint threadIndex = 0; threadIndex < _tpCount; ++threadIndex) {
+        if(pthread_mutex_init(&_tThreads[threadIndex].dLock, NULL)) { [self release]; return (self = nil); }
+        if(pthread_cond_init(&_tThreads[threadIndex].wCond, NULL)) { pthread_mutex_destroy(&_tThreads[threadIndex].dLock); [self release]; return (self = nil); }
+        if(!egwTaskMngrGrowRing(&_tThreads[threadIndex].dQueue, &_tThreads[threadIndex].dHead, 0, &_tThreads[threadIndex].dMax) ||
+           !egwTaskMngrGrowRing(&_tThreads[threadIndex].pQueue, &_tThreads[threadIndex].pHead, 0, &_tThreads[threadIndex].pMax)) { [self release]; return (self = nil); }
+        if(!(_tThreads[threadIndex].thread = [[NSThread alloc] initWithTarget:self selector:@selector(taskThreadEntryPoint) object:nil])) { [self release]; return (self = nil); }
+        [_tThreads[threadIndex].thread setName:[[NSString alloc] initWithFormat:@"egwTaskManagerTaskThread%02d", (threadIndex+1)]];
+        _tThreads[threadIndex].owner = nil;
     }
-    for(EGWint threadIndex = 0; threadIndex < EGW_TASKMNGR_TASKTHREADS; ++threadIndex)
-        [_tPool[threadIndex] start];
+    for(EGWint threadIndex = 0; threadIndex < _tpCount; ++threadIndex)
+        [_tThreads[threadIndex].thread start];
     
     if(EGW_ENGINE_MANAGERS_STARTUPMSGS) NSLog(@"egwTaskManager: init: Task manager has been initialized.");
     
@@ -112,16 +243,31 @@ static egwTaskManager* _singleton = nil;
     if(!_doShutdownPh1 && !_doShutdownPh2)
         [self shutDownTaskThreads];
     
-    for(EGWint threadIndex = 0; threadIndex < EGW_TASKMNGR_TASKTHREADS; ++threadIndex) {
-        [_tPool[threadIndex] release]; _tPool[threadIndex] = nil;
-        [_tOwner[threadIndex] release]; _tOwner[threadIndex] = nil;
+    for(EGWint threadIndex = 0; threadIndex < _tpCount; ++threadIndex) {
+        if(_tThreads[threadIndex].thread) {
+            [_tThreads[threadIndex].thread release]; _tThreads[threadIndex].thread = nil;
+            pthread_cond_destroy(&_tThreads[threadIndex].wCond);
+            pthread_mutex_destroy(&_tThreads[threadIndex].dLock);
+        }
+        [_tThreads[threadIndex].owner release]; _tThreads[threadIndex].owner = nil;
+        if(_tThreads[threadIndex].dQueue) { free((void*)_tThreads[threadIndex].dQueue); _tThreads[threadIndex].dQueue = NULL; }
+        if(_tThreads[threadIndex].pQueue) { free((void*)_tThreads[threadIndex].pQueue); _tThreads[threadIndex].pQueue = NULL; }
     }
     
-    for(EGWint taskIndex = 0; taskIndex < EGW_TASKMNGR_MAXTASKHANDLES; ++taskIndex) {
-        [_tItems[taskIndex].task release]; _tItems[taskIndex].task = nil;
+    if(_tItems) {
+        for(EGWuint taskIndex = 0; taskIndex < _tiUsed; ++taskIndex) {
+            [_tItems[taskIndex].task release]; _tItems[taskIndex].task = nil;
+            if(_tItems[taskIndex].ttIndicies) { free((void*)_tItems[taskIndex].ttIndicies); _tItems[taskIndex].ttIndicies = NULL; }
+            if(_tItems[taskIndex].tdIndicies) { free((void*)_tItems[taskIndex].tdIndicies); _tItems[taskIndex].tdIndicies = NULL; }
+        }
+        free((void*)_tItems); _tItems = NULL;
     }
+    if(_tiFree) { free((void*)_tiFree); _tiFree = NULL; }
+    if(_tDeps) { free((void*)_tDeps); _tDeps = NULL; }
+    if(_tdFree) { free((void*)_tdFree); _tdFree = NULL; }
     
-    pthread_cond_destroy(&_wCond);
+    pthread_cond_destroy(&_sCond);
+    pthread_rwlock_destroy(&_gLock);
     pthread_mutex_destroy(&_cLock);
     
     if(EGW_ENGINE_MANAGERS_SHUTDOWNMSGS) NSLog(@"egwTaskManager: dealloc: Task manager has been deallocated.");
@@ -131,215 +277,146 @@ static egwTaskManager* _singleton = nil;
 
 - (void)enableAllTasks {
     if(!_doShutdownPh1 && _tiCount) {
-        pthread_mutex_lock(&_cLock);
-        
-        if(_tiCount) {
-            EGWint taskIndex = _tiCount; while(taskIndex--)
-                if(_tItems[taskIndex].task)
-                    _tItems[taskIndex].tiFlags &= ~EGW_TSKITMFLG_DISABLED;
+        pthread_rwlock_wrlock(&_gLock);
         
-            pthread_cond_broadcast(&_wCond);
-        }
+        for(EGWuint taskIndex = 0; taskIndex < _tiUsed; ++taskIndex)
+            if(_tItems[taskIndex].task) {
+                _tItems[taskIndex].tiFlags &= ~EGW_TSKITMFLG_DISABLED;
+                [self queueTaskAlreadyLocked:taskIndex preferThread:0];
+            }
         
-        pthread_mutex_unlock(&_cLock);
+        pthread_rwlock_unlock(&_gLock);
     }
 }
 
 - (void)enableTask:(EGWint)taskHandle {
-    if(!_doShutdownPh1 && _tiCount && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-        pthread_mutex_lock(&_cLock);
+    if(!_doShutdownPh1 && _tiCount && taskHandle >= 1) {
+        EGWint taskIndex;
         
-        if(_tiCount && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-            taskHandle = (EGWint)_tHndLkup[taskHandle-1];
-            
-            _tItems[taskHandle].tiFlags &= ~EGW_TSKITMFLG_DISABLED;
+        pthread_rwlock_wrlock(&_gLock);
+        
+        if((taskIndex = [self taskIndexForHandleAlreadyLocked:taskHandle]) >= 0) {
+            _tItems[taskIndex].tiFlags &= ~EGW_TSKITMFLG_DISABLED;
             
-            pthread_cond_broadcast(&_wCond);
+            [self queueTaskAlreadyLocked:(EGWuint)taskIndex preferThread:0];
         }
         
-        pthread_mutex_unlock(&_cLock);
+        pthread_rwlock_unlock(&_gLock);
     }
 }
 
 - (void)disableAllTasks {
     if(!_doShutdownPh1 && _tiCount) {
-        pthread_mutex_lock(&_cLock);
+        pthread_rwlock_wrlock(&_gLock);
         
-        if(_tiCount) {
-            EGWint taskIndex = _tiCount; while(taskIndex--)
-                if(_tItems[taskIndex].task)
-                    _tItems[taskIndex].tiFlags |= EGW_TSKITMFLG_DISABLED;
-        }
+        for(EGWuint taskIndex = 0; taskIndex < _tiUsed; ++taskIndex)
+            if(_tItems[taskIndex].task)
+                _tItems[taskIndex].tiFlags |= EGW_TSKITMFLG_DISABLED;
         
-        pthread_mutex_unlock(&_cLock);
+        pthread_rwlock_unlock(&_gLock);
     }
 }
 
 - (void)disableTask:(EGWint)taskHandle {
-    if(!_doShutdownPh1 && _tiCount && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-        pthread_mutex_lock(&_cLock);
+    if(!_doShutdownPh1 && _tiCount && taskHandle >= 1) {
+        EGWint taskIndex;
         
-        if(_tiCount && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-            taskHandle = (EGWint)_tHndLkup[taskHandle-1];
-            
-            _tItems[taskHandle].tiFlags |= EGW_TSKITMFLG_DISABLED;
-            
-            pthread_cond_broadcast(&_wCond);
-        }
+        pthread_rwlock_wrlock(&_gLock);
         
-        pthread_mutex_unlock(&_cLock);
+        if((taskIndex = [self taskIndexForHandleAlreadyLocked:taskHandle]) >= 0)
+            _tItems[taskIndex].tiFlags |= EGW_TSKITMFLG_DISABLED; // Queued tasks are rejected when dequeued
+        
+        pthread_rwlock_unlock(&_gLock);
     }
 }
 
 - (void)jumpStartTask:(EGWint)taskHandle {
-    if(!_doShutdownPh1 && _tiCount && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-        pthread_mutex_lock(&_cLock);
+    if(!_doShutdownPh1 && _tiCount && taskHandle >= 1) {
+        EGWint taskIndex;
         
-        if(_tiCount && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-            taskHandle = (EGWint)_tHndLkup[taskHandle-1];
-            
-            _tItems[taskHandle].tiFlags |= EGW_TSKITMFLG_STARTER;
-            _tItems[taskHandle].tiFlags &= ~EGW_TSKITMFLG_DISABLED;
+        pthread_rwlock_wrlock(&_gLock);
         
-            pthread_cond_broadcast(&_wCond);
+        if((taskIndex = [self taskIndexForHandleAlreadyLocked:taskHandle]) >= 0) {
+            _tItems[taskIndex].tiFlags |= EGW_TSKITMFLG_STARTER;
+            _tItems[taskIndex].tiFlags &= ~EGW_TSKITMFLG_DISABLED;
+            
+            [self queueTaskAlreadyLocked:(EGWuint)taskIndex preferThread:0];
         }
         
-        pthread_mutex_unlock(&_cLock);
+        pthread_rwlock_unlock(&_gLock);
     }
 }
 
 - (EGWint)registerTaskUsing:(id<egwPTask>)task {
-    if(!_doShutdownPh1 && task && _tiCount < EGW_TASKMNGR_MAXTASKHANDLES) {
-        pthread_mutex_lock(&_cLock);
-        
-        if(task && _tiCount < EGW_TASKMNGR_MAXTASKHANDLES) {
-            EGWint handleIndex = 0;
-            for(; handleIndex < EGW_TASKMNGR_MAXTASKHANDLES; ++handleIndex)
-                if(_tHndLkup[handleIndex] == -1) {
-                    _tHndLkup[handleIndex] = _tiCount;
-                    break;
-                }
-            
-            if(handleIndex < EGW_TASKMNGR_MAXTASKHANDLES) {
-                _tItems[_tiCount].task = [task retain];
-                _tItems[_tiCount].tiFlags = EGW_TSKITMFLG_NONE | EGW_TSKITMFLG_DISABLED | ([task isThreadOwner] ? EGW_TSKITMFLG_OWNSTHRD : 0);
-                _tItems[_tiCount].tPriority = (EGWsingle)[task taskPriority];
-                _tItems[_tiCount].ttDeps = 0;
-                _tItems[_tiCount].twDeps = 0;
-                _tItems[_tiCount].tdDeps = 0;
-                memset((void*)&(_tItems[_tiCount].ttIndicies[0]), -1, sizeof(EGWint8) * EGW_TASKMNGR_MAXTASKDEPENDENTS);
-                memset((void*)&(_tItems[_tiCount].tdIndicies[0]), -1, sizeof(EGWint8) * EGW_TASKMNGR_MAXTASKDEPENDENTS);
-                _tItems[_tiCount].fpPrfmTask = [((NSObject*)_tItems[_tiCount].task) methodForSelector:@selector(performTask)];
-                
-                ++_tiCount;
-                
-                pthread_mutex_unlock(&_cLock);
-                return handleIndex+1;
-            }
-        }
-        
-        pthread_mutex_unlock(&_cLock);
+    EGWint taskHandle = 0;
+    
+    if(!_doShutdownPh1 && task) {
+        pthread_rwlock_wrlock(&_gLock);
+        taskHandle = [self registerTaskAlreadyLocked:task withFlags:EGW_TSKITMFLG_NONE];
+        pthread_rwlock_unlock(&_gLock);
     }
     
-    return 0;
+    return taskHandle;
 }
 
 - (EGWint)registerStarterTaskUsing:(id<egwPTask>)task {
-    if(!_doShutdownPh1 && task && _tiCount < EGW_TASKMNGR_MAXTASKHANDLES) {
-        pthread_mutex_lock(&_cLock);
-        
-        if(task && _tiCount < EGW_TASKMNGR_MAXTASKHANDLES) {
-            EGWint handleIndex = 0;
-            for(; handleIndex < EGW_TASKMNGR_MAXTASKHANDLES; ++handleIndex)
-                if(_tHndLkup[handleIndex] == -1) {
-                    _tHndLkup[handleIndex] = _tiCount;
-                    break;
-                }
-            
-            if(handleIndex < EGW_TASKMNGR_MAXTASKHANDLES) {
-                _tItems[_tiCount].task = [task retain];
-                _tItems[_tiCount].tiFlags = EGW_TSKITMFLG_NONE | EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_STARTER | ([task isThreadOwner] ? EGW_TSKITMFLG_OWNSTHRD : 0);
-                _tItems[_tiCount].tPriority = (EGWsingle)[task taskPriority];
-                _tItems[_tiCount].ttDeps = 0;
-                _tItems[_tiCount].twDeps = 0;
-                _tItems[_tiCount].tdDeps = 0;
-                memset((void*)&(_tItems[_tiCount].ttIndicies[0]), -1, sizeof(EGWint8) * EGW_TASKMNGR_MAXTASKDEPENDENTS);
-                memset((void*)&(_tItems[_tiCount].tdIndicies[0]), -1, sizeof(EGWint8) * EGW_TASKMNGR_MAXTASKDEPENDENTS);
-                _tItems[_tiCount].fpPrfmTask = [((NSObject*)_tItems[_tiCount].task) methodForSelector:@selector(performTask)];
-                
-                ++_tiCount;
-                
-                pthread_mutex_unlock(&_cLock);
-                return handleIndex+1;
-            }
-        }
-        
-        pthread_mutex_unlock(&_cLock);
+    EGWint taskHandle = 0;
+    
+    if(!_doShutdownPh1 && task) {
+        pthread_rwlock_wrlock(&_gLock);
+        taskHandle = [self registerTaskAlreadyLocked:task withFlags:EGW_TSKITMFLG_STARTER];
+        pthread_rwlock_unlock(&_gLock);
     }
     
-    return 0;
+    return taskHandle;
 }
 
 - (EGWint)registerTemporaryTaskUsing:(id<egwPTask>)task {
-    if(!_doShutdownPh1 && task && _tiCount < EGW_TASKMNGR_MAXTASKHANDLES) {
-        pthread_mutex_lock(&_cLock);
-        
-        if(task && _tiCount < EGW_TASKMNGR_MAXTASKHANDLES) {
-            EGWint handleIndex = 0;
-            for(; handleIndex < EGW_TASKMNGR_MAXTASKHANDLES; ++handleIndex)
-                if(_tHndLkup[handleIndex] == -1) {
-                    _tHndLkup[handleIndex] = _tiCount;
-                    break;
-                }
-            
-            if(handleIndex < EGW_TASKMNGR_MAXTASKHANDLES) {
-                _tItems[_tiCount].task = [task retain];
-                _tItems[_tiCount].tiFlags = EGW_TSKITMFLG_NONE | EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_TEMPORARY | ([task isThreadOwner] ? EGW_TSKITMFLG_OWNSTHRD : 0);
-                _tItems[_tiCount].tPriority = (EGWsingle)[task taskPriority];
-                _tItems[_tiCount].ttDeps = 0;
-                _tItems[_tiCount].twDeps = 0;
-                _tItems[_tiCount].tdDeps = 0;
-                memset((void*)&(_tItems[_tiCount].ttIndicies[0]), -1, sizeof(EGWint8) * EGW_TASKMNGR_MAXTASKDEPENDENTS);
-                memset((void*)&(_tItems[_tiCount].tdIndicies[0]), -1, sizeof(EGWint8) * EGW_TASKMNGR_MAXTASKDEPENDENTS);
-                _tItems[_tiCount].fpPrfmTask = [((NSObject*)_tItems[_tiCount].task) methodForSelector:@selector(performTask)];
-                
-                ++_tiCount;
-                
-                pthread_mutex_unlock(&_cLock);
-                return handleIndex+1;
-            }
-        }
-        
-        pthread_mutex_unlock(&_cLock);
+    EGWint taskHandle = 0;
+    
+    if(!_doShutdownPh1 && task) {
+        pthread_rwlock_wrlock(&_gLock);
+        taskHandle = [self registerTaskAlreadyLocked:task withFlags:EGW_TSKITMFLG_TEMPORARY];
+        pthread_rwlock_unlock(&_gLock);
     }
     
-    return 0;
+    return taskHandle;
 }
 
 - (BOOL)registerDependencyForTask:(EGWint)taskHandle withTask:(EGWint)depTaskHandle {
-    if(!_doShutdownPh1 && _tiCount && _tdCount < EGW_TASKMNGR_MAXDEPENDENCIES && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0 && depTaskHandle >= 1 && _tHndLkup[depTaskHandle-1] >= 0) {
-        pthread_mutex_lock(&_cLock);
+    if(!_doShutdownPh1 && _tiCount && taskHandle >= 1 && depTaskHandle >= 1 && taskHandle != depTaskHandle) {
+        EGWint taskIndex, depTaskIndex;
         
-        if(_tiCount && _tdCount < EGW_TASKMNGR_MAXDEPENDENCIES && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0 && depTaskHandle >= 1 && _tHndLkup[depTaskHandle-1] >= 0) {
-            taskHandle = (EGWint)_tHndLkup[taskHandle-1];
-            depTaskHandle = (EGWint)_tHndLkup[depTaskHandle-1];
-            
-            _tDeps[_tdCount].tdFlags = EGW_TSKDPDFLG_NONE;
-            _tDeps[_tdCount].ttiIndex = taskHandle;
-            _tDeps[_tdCount].tdiIndex = depTaskHandle;
-            
-            _tItems[taskHandle].ttIndicies[_tItems[taskHandle].ttDeps++] = _tdCount; // left linkages
-            _tItems[depTaskHandle].tdIndicies[_tItems[depTaskHandle].tdDeps++] = _tdCount; // right linkages
-            
-            ++_tItems[taskHandle].twDeps;
-            
-            ++_tdCount;
+        pthread_rwlock_wrlock(&_gLock);
+        
+        if((taskIndex = [self taskIndexForHandleAlreadyLocked:taskHandle]) >= 0 && (depTaskIndex = [self taskIndexForHandleAlreadyLocked:depTaskHandle]) >= 0 && taskIndex != depTaskIndex) {
+            egwTaskItem* tItem = &_tItems[taskIndex];
+            egwTaskItem* dItem = &_tItems[depTaskIndex];
+            EGWuint depIndex;
             
-            pthread_mutex_unlock(&_cLock);
-            return YES;
+            // Ensure room for the linkages and the dependency before committing to anything
+            if((tItem->ttDeps < tItem->ttMax || egwTaskMngrGrow((void**)&tItem->ttIndicies, &tItem->ttMax, sizeof(EGWuint), EGW_TASKMNGR_INITTASKLINKS)) &&
+               (dItem->tdDeps < dItem->tdMax || egwTaskMngrGrow((void**)&dItem->tdIndicies, &dItem->tdMax, sizeof(EGWuint), EGW_TASKMNGR_INITTASKLINKS)) &&
+               (_tdFreeCount || _tdUsed < _tdMax || egwTaskMngrGrowSlots((void**)&_tDeps, &_tdFree, &_tdMax, sizeof(egwTaskDependency), EGW_TASKMNGR_INITDEPENDENCIES))) {
+                depIndex = (_tdFreeCount ? _tdFree[--_tdFreeCount] : _tdUsed++);
+                
+                _tDeps[depIndex].tdFlags = EGW_TSKDPDFLG_NONE;
+                _tDeps[depIndex].ttiIndex = (EGWuint)taskIndex;
+                _tDeps[depIndex].tdiIndex = (EGWuint)depTaskIndex;
+                
+                tItem->ttIndicies[tItem->ttDeps++] = depIndex; // left linkages
+                dItem->tdIndicies[dItem->tdDeps++] = depIndex; // right linkages
+                
+                ++tItem->twDeps;
+                
+                ++_tdCount;
+                
+                pthread_rwlock_unlock(&_gLock);
+                return YES;
+            }
         }
         
-        pthread_mutex_unlock(&_cLock);
+        pthread_rwlock_unlock(&_gLock);
     }
     
     return NO;
@@ -350,30 +427,23 @@ static egwTaskManager* _singleton = nil;
         @synchronized(self) {
             pthread_mutex_lock(&_cLock);
             
-            for(EGWint threadIndex = 0; threadIndex < EGW_TASKMNGR_TASKTHREADS; ++threadIndex) {
-                if(_tPool[threadIndex]) {
-                    _doMemClean[threadIndex] = YES;
+            for(EGWint threadIndex = 0; threadIndex < _tpCount; ++threadIndex) {
+                if(_tThreads[threadIndex].thread) {
+                    _tThreads[threadIndex].doMemClean = YES;
                     ++_memCleanLeft;
-                    _threadAlert[threadIndex] = YES;
                 }
             }
             
             if(_memCleanLeft)
-                pthread_cond_broadcast(&_wCond);
+                [self alertTaskThreads];
             
-            {   NSDate* waitTill = [[NSDate alloc] initWithTimeIntervalSinceNow:(NSTimeInterval)EGW_ENGINE_MANAGERS_TIMETOWAIT];
-                while(_memCleanLeft) {   
-                    if([waitTill timeIntervalSinceNow] < (NSTimeInterval)0.0) {
+            {   struct timespec waitTill; egwTaskMngrDeadline(&waitTill, (EGWtime)EGW_ENGINE_MANAGERS_TIMETOWAIT);
+                while(_memCleanLeft) {
+                    if(pthread_cond_timedwait(&_sCond, &_cLock, &waitTill) == ETIMEDOUT && _memCleanLeft) {
                         NSLog(@"egwTaskManager: performMemoryCleanup: Failure waiting for %d task(s) to report memory cleanup.", _memCleanLeft);
                         break;
                     }
-                    
-                    pthread_mutex_unlock(&_cLock);
-                    [NSThread sleepForTimeInterval:EGW_ENGINE_MANAGERS_TIMETOSLEEP];
-                    pthread_mutex_lock(&_cLock);
-                    pthread_cond_broadcast(&_wCond);
                 }
-                [waitTill release];
             }
             
             pthread_mutex_unlock(&_cLock);
@@ -381,72 +451,132 @@ static egwTaskManager* _singleton = nil;
     }
 }
 
+- (void)parallelForRangeFrom:(EGWuint)begin to:(EGWuint)end withGrain:(EGWuint)grainSize usingRoutine:(EGWrangefp)routine withContext:(void*)context {
+    if(routine && begin < end) {
+        egwParallelForJob job;
+        
+        if(!grainSize) // Automatic, aim for a few chunks per task thread for load balancing
+            grainSize = egwMax2ui(1, (end - begin) / ((EGWuint)_tpCount * 4));
+        
+        // Small ranges, or no threads to help, just run inline
+        if(end - begin <= grainSize || !_ttCount || _doShutdownPh2) {
+            routine(context, begin, end);
+            return;
+        }
+        
+        job.fpRange = routine;
+        job.context = context;
+        job.rNext = begin;
+        job.rEnd = end;
+        job.rGrain = grainSize;
+        job.jHelpers = 0;
+        
+        if(pthread_mutex_init(&job.jLock, NULL)) { routine(context, begin, end); return; }
+        if(pthread_cond_init(&job.jCond, NULL)) { pthread_mutex_destroy(&job.jLock); routine(context, begin, end); return; }
+        
+        // Fork: publish job and wake up enough idle task threads for the remaining chunks
+        pthread_mutex_lock(&_cLock);
+        
+        job.next = _pfJobs;
+        _pfJobs = &job;
+        
+        pthread_mutex_unlock(&_cLock);
+        
+        OSMemoryBarrier(); // Publish job before peeking idle status, pairs with the idle wait
+        
+        {   EGWuint wakeLeft = ((end - begin) + grainSize - 1) / grainSize - 1; // Calling thread takes one
+            for(EGWint threadIndex = 0; wakeLeft && threadIndex < _tpCount; ++threadIndex)
+                if(_tThreads[threadIndex].isIdle) { // Unlocked peek, rechecked below
+                    pthread_mutex_lock(&_tThreads[threadIndex].dLock);
+                    if(_tThreads[threadIndex].isIdle) {
+                        pthread_cond_signal(&_tThreads[threadIndex].wCond);
+                        --wakeLeft;
+                    }
+                    pthread_mutex_unlock(&_tThreads[threadIndex].dLock);
+                }
+        }
+        
+        egwTaskMngrRunRange(&job);
+        
+        // Join: unpublish job (no new helpers), then wait for helpers still running chunks
+        pthread_mutex_lock(&_cLock);
+        
+        {   egwParallelForJob** jobLink = &_pfJobs;
+            while(*jobLink != &job)
+                jobLink = &((*jobLink)->next);
+            *jobLink = job.next;
+        }
+        
+        pthread_mutex_unlock(&_cLock);
+        
+        pthread_mutex_lock(&job.jLock);
+        while(job.jHelpers)
+            pthread_cond_wait(&job.jCond, &job.jLock);
+        pthread_mutex_unlock(&job.jLock);
+        
+        pthread_cond_destroy(&job.jCond);
+        pthread_mutex_destroy(&job.jLock);
+    }
+}
+
 - (void)shutDownTaskThreads {
     if(!_doShutdownPh1 && !_doShutdownPh2) {
         @synchronized(self) {
             if(!_doShutdownPh1 && !_doShutdownPh2) {
-                pthread_mutex_lock(&_cLock);
+                BOOL timedOut = NO;
+                
+                pthread_rwlock_wrlock(&_gLock);
                 
                 if(EGW_ENGINE_MANAGERS_SHUTDOWNMSGS) NSLog(@"egwTaskManager: shutDownTaskThreads: Shutting down task threads.");
                 
                 _doShutdownPh1 = YES; // Forces task removal
                 
                 // Take corresponding task off all process blocks (delayed removal)
-                {   EGWint taskIndex = _tiCount; while(taskIndex--)
+                {   EGWuint taskIndex = _tiUsed; while(taskIndex--)
                         if(_tItems[taskIndex].task)
                             _tItems[taskIndex].tiFlags |= (EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_MARKEDREM);
                 }
                 
-                for(EGWint threadIndex = 0; threadIndex < EGW_TASKMNGR_TASKTHREADS; ++threadIndex)
-                    if(_tPool[threadIndex])
-                        _threadAlert[threadIndex] = YES;
+                [self queueRemovalsAlreadyLocked];
+                
+                pthread_rwlock_unlock(&_gLock);
                 
-                pthread_cond_broadcast(&_wCond);
+                pthread_mutex_lock(&_cLock);
                 
-                {   NSDate* waitTill = [[NSDate alloc] initWithTimeIntervalSinceNow:(NSTimeInterval)EGW_ENGINE_MANAGERS_TIMETOWAIT];
+                [self alertTaskThreads];
+                
+                {   struct timespec waitTill; egwTaskMngrDeadline(&waitTill, (EGWtime)EGW_ENGINE_MANAGERS_TIMETOWAIT);
                     while(_tiCount) {
-                        if([waitTill timeIntervalSinceNow] < (NSTimeInterval)0.0) {
-                            for(EGWint i = 0; i < EGW_TASKMNGR_MAXTASKHANDLES; ++i) {
-                                if(_tItems[i].task) {
-                                    EGWint j = EGW_TASKMNGR_MAXTASKHANDLES;
-                                    while(j--)
-                                        if(_tHndLkup[j] == i)
-                                            break;
-                                    NSLog(@"egwTaskManager: shutDownTaskThreads: Failure waiting on task '%@' with task handle #%d to unregister.", _tItems[i].task, j+1);
-                                }
-                            }
+                        if(pthread_cond_timedwait(&_sCond, &_cLock, &waitTill) == ETIMEDOUT && _tiCount) {
+                            timedOut = YES;
                             break;
                         }
-                        
-                        pthread_mutex_unlock(&_cLock);
-                        [NSThread sleepForTimeInterval:EGW_ENGINE_MANAGERS_TIMETOSLEEP];
-                        pthread_mutex_lock(&_cLock);
-                        pthread_cond_broadcast(&_wCond);
                     }
-                    [waitTill release];
                 }
                 
-                _doShutdownPh2 = YES; // Forces thread shutdown
+                if(timedOut) { // Graph lock is never taken while holding the counter lock
+                    pthread_mutex_unlock(&_cLock);
+                    pthread_rwlock_rdlock(&_gLock);
+                    
+                    for(EGWuint taskIndex = 0; taskIndex < _tiUsed; ++taskIndex)
+                        if(_tItems[taskIndex].task)
+                            NSLog(@"egwTaskManager: shutDownTaskThreads: Failure waiting on task '%@' with task handle #%d to unregister.", _tItems[taskIndex].task, egwTaskMngrHandle(taskIndex, _tItems[taskIndex].tGen));
+                    
+                    pthread_rwlock_unlock(&_gLock);
+                    pthread_mutex_lock(&_cLock);
+                }
                 
-                for(EGWint threadIndex = 0; threadIndex < EGW_TASKMNGR_TASKTHREADS; ++threadIndex)
-                    if(_tPool[threadIndex])
-                        _threadAlert[threadIndex] = YES;
+                _doShutdownPh2 = YES; // Forces thread shutdown
                 
-                pthread_cond_broadcast(&_wCond);
+                [self alertTaskThreads];
                 
-                {   NSDate* waitTill = [[NSDate alloc] initWithTimeIntervalSinceNow:(NSTimeInterval)EGW_ENGINE_MANAGERS_TIMETOWAIT];
+                {   struct timespec waitTill; egwTaskMngrDeadline(&waitTill, (EGWtime)EGW_ENGINE_MANAGERS_TIMETOWAIT);
                     while(_ttCount) {
-                        if([waitTill timeIntervalSinceNow] < (NSTimeInterval)0.0) {
+                        if(pthread_cond_timedwait(&_sCond, &_cLock, &waitTill) == ETIMEDOUT && _ttCount) {
                             NSLog(@"egwTaskManager: shutDownTaskThreads: Failure waiting for %d task thread(s) to quit.", _ttCount);
                             break;
                         }
-                        
-                        pthread_mutex_unlock(&_cLock);
-                        [NSThread sleepForTimeInterval:EGW_ENGINE_MANAGERS_TIMETOSLEEP];
-                        pthread_mutex_lock(&_cLock);
-                        pthread_cond_broadcast(&_wCond);
                     }
-                    [waitTill release];
                 }
                 
                 pthread_mutex_unlock(&_cLock);
@@ -458,36 +588,43 @@ static egwTaskManager* _singleton = nil;
 }
 
 - (void)unregisterAllTasks {
-    pthread_mutex_lock(&_cLock);
+    pthread_rwlock_wrlock(&_gLock);
     
     // Take all tasks off all process blocks (delayed removal)
-    EGWint taskIndex = _tiCount; while(taskIndex--)
+    EGWuint taskIndex = _tiUsed; while(taskIndex--)
         if(_tItems[taskIndex].task)
             _tItems[taskIndex].tiFlags |= (EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_MARKEDREM);
     
-    pthread_mutex_unlock(&_cLock);
+    [self queueRemovalsAlreadyLocked];
+    
+    pthread_rwlock_unlock(&_gLock);
 }
 
 - (void)unregisterAllTasksUsing:(id<egwPTask>)task {
     if(task) {
-        pthread_mutex_lock(&_cLock);
+        pthread_rwlock_wrlock(&_gLock);
         
         // Take corresponding task off all process blocks (delayed removal)
-        EGWint taskIndex = _tiCount; while(taskIndex--)
+        EGWuint taskIndex = _tiUsed; while(taskIndex--)
             if(_tItems[taskIndex].task == task)
                 _tItems[taskIndex].tiFlags |= (EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_MARKEDREM);
         
-        pthread_mutex_unlock(&_cLock);
+        [self queueRemovalsAlreadyLocked];
+        
+        pthread_rwlock_unlock(&_gLock);
     }
 }
 
 - (void)unregisterTask:(EGWint)taskHandle {
-    if(_tiCount && _tdCount < EGW_TASKMNGR_MAXDEPENDENCIES && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-        pthread_mutex_lock(&_cLock);
+    if(_tiCount && taskHandle >= 1) {
+        EGWint taskIndex;
         
-        [self unregisterTaskAlreadyLocked:taskHandle];
+        pthread_rwlock_wrlock(&_gLock);
         
-        pthread_mutex_unlock(&_cLock);
+        if((taskIndex = [self taskIndexForHandleAlreadyLocked:taskHandle]) >= 0)
+            [self unregisterTaskAtIndexAlreadyLocked:(EGWuint)taskIndex];
+        
+        pthread_rwlock_unlock(&_gLock);
     }
 }
 
@@ -511,6 +648,10 @@ static egwTaskManager* _singleton = nil;
     return (EGWuint)_tiCount;
 }
 
+- (EGWuint)taskThreadCount {
+    return (EGWuint)_tpCount;
+}
+
 + (BOOL)isAllocated {
     return (_singleton ? YES : NO);
 }
@@ -520,16 +661,27 @@ static egwTaskManager* _singleton = nil;
 }
 
 - (BOOL)isTaskEnabled:(EGWint)taskHandle {
-    if(taskHandle >= 1 && taskHandle <= EGW_TASKMNGR_MAXTASKHANDLES && _tHndLkup[taskHandle-1] >= 0)
-        return ((_tItems[_tHndLkup[taskHandle-1]].tiFlags & EGW_TSKITMFLG_DISABLED) ? NO : YES);
-    return NO;
+    BOOL isEnabled = NO;
+    
+    if(taskHandle >= 1) {
+        EGWint taskIndex;
+        
+        pthread_rwlock_rdlock(&_gLock); // Task table may be reallocated by a concurrent registration
+        
+        if((taskIndex = [self taskIndexForHandleAlreadyLocked:taskHandle]) >= 0)
+            isEnabled = ((_tItems[taskIndex].tiFlags & EGW_TSKITMFLG_DISABLED) ? NO : YES);
+        
+        pthread_rwlock_unlock(&_gLock);
+    }
+    
+    return isEnabled;
 }
 
 - (BOOL)isTaskManagerThread {
     NSThread* currentThread = [NSThread currentThread];
     
-    EGWint threadIndex = EGW_TASKMNGR_TASKTHREADS; while(threadIndex--)
-        if(_tPool[threadIndex] == currentThread)
+    EGWint threadIndex = _tpCount; while(threadIndex--)
+        if(_tThreads[threadIndex].thread == currentThread)
             return YES;
     
     return NO;
@@ -540,108 +692,291 @@ static egwTaskManager* _singleton = nil;
 
 @implementation egwTaskManager (Private)
 
-- (void)unregisterTaskAlreadyLocked:(EGWint)taskHandle {
-    if(_tiCount && _tdCount < EGW_TASKMNGR_MAXDEPENDENCIES && taskHandle >= 1 && _tHndLkup[taskHandle-1] >= 0) {
-        taskHandle = (EGWint)_tHndLkup[taskHandle-1];
-        
-        // Take task off process block (delayed removal if running)
-        _tItems[taskHandle].tiFlags |= (EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_MARKEDREM);
+- (EGWint)registerTaskAlreadyLocked:(id<egwPTask>)task withFlags:(EGWuint16)flags {
+    egwTaskItem* item;
+    EGWuint taskIndex;
+    
+    // Reuse a free slot, otherwise take the next unused slot (growing the table if full)
+    if(_tiFreeCount)
+        taskIndex = _tiFree[--_tiFreeCount];
+    else if(_tiUsed < EGW_TSKHNDL_SLOTMASK && (_tiUsed < _tiMax || egwTaskMngrGrowSlots((void**)&_tItems, &_tiFree, &_tiMax, sizeof(egwTaskItem), EGW_TASKMNGR_INITTASKHANDLES))) {
+        taskIndex = _tiUsed++;
+        _tItems[taskIndex].tGen = 0;
+        _tItems[taskIndex].ttMax = _tItems[taskIndex].tdMax = 0;
+        _tItems[taskIndex].ttIndicies = _tItems[taskIndex].tdIndicies = NULL;
+    } else {
+        NSLog(@"egwTaskManager: registerTaskAlreadyLocked:withFlags: Failure allocating task handle for task '%@'.", task);
+        return 0;
+    }
+    
+    item = &_tItems[taskIndex];
+    item->task = [task retain];
+    item->tPriority = (EGWsingle)[task taskPriority];
+    item->fpPrfmTask = [((NSObject*)task) methodForSelector:@selector(performTask)];
+    item->tiFlags = (EGW_TSKITMFLG_DISABLED | flags | ([task isThreadOwner] ? EGW_TSKITMFLG_OWNSTHRD : EGW_TSKITMFLG_NONE));
+    item->ttDeps = item->twDeps = item->tdDeps = 0; // Link buffers are kept from any prior slot use
+    
+    ++_tiCount;
+    
+    return egwTaskMngrHandle(taskIndex, item->tGen);
+}
+
+- (EGWint)taskIndexForHandleAlreadyLocked:(EGWint)taskHandle {
+    EGWuint taskIndex = ((EGWuint)taskHandle & EGW_TSKHNDL_SLOTMASK);
+    
+    // Slot must be registered and of the same generation the handle was given out with (stale handles to a reused slot fail)
+    if(taskHandle >= 1 && taskIndex >= 1 && taskIndex <= _tiUsed && _tItems[--taskIndex].task &&
+       (((EGWuint)taskHandle >> EGW_TASKMNGR_HANDLESLOTBITS) & EGW_TSKHNDL_GENMASK) == (EGWuint)_tItems[taskIndex].tGen)
+        return (EGWint)taskIndex;
+    
+    return -1;
+}
+
+- (void)queueTaskAlreadyLocked:(EGWuint)taskIndex preferThread:(EGWuint)threadNumber {
+    egwTaskItem* item = &_tItems[taskIndex];
+    egwTaskThread* tThread = NULL;
+    BOOL isPinned = NO;
+    EGWuint32 flags;
+    
+    // Claim the queued flag, graph lock may only be held shared so racing completions are settled here
+    do {
+        flags = item->tiFlags;
+        if(!item->task || (flags & (EGW_TSKITMFLG_ISRUNNING | EGW_TSKITMFLG_QUEUED)) ||
+           (!(flags & EGW_TSKITMFLG_MARKEDREM) && ((flags & EGW_TSKITMFLG_DISABLED) || (item->twDeps != 0 && !(flags & EGW_TSKITMFLG_STARTER)))))
+            return; // Not ready, or already queued
+    } while(!OSAtomicCompareAndSwap32Barrier((int32_t)flags, (int32_t)(flags | EGW_TSKITMFLG_QUEUED), (volatile int32_t*)&item->tiFlags));
+    
+    if(!(flags & EGW_TSKITMFLG_MARKEDREM) && (flags & EGW_TSKITMFLG_OWNSTHRD)) {
+        register EGWuint lastThread = (EGWuint)(flags & EGW_TSKITMFLG_EXLASTTHRD);
         
-        // If the task is running, don't remove it, rely on the MARKEDREM flag to force remove after finished running, call to this will be made afterword
-        if(!(_tItems[taskHandle].tiFlags & EGW_TSKITMFLG_ISRUNNING)) {
-            EGWint index;
+        if(!lastThread) { // First time used by a task thread owner, take ownership of a thread (only one task thread owner per thread)
+            pthread_mutex_lock(&_cLock);
             
-            // Cannot continue if any task with taskIndex higher than taskHandle is currently in run state due to selTaskIndex being shifted
-            index = _tiCount; while(--index > taskHandle)
-                if(_tItems[index].tiFlags & EGW_TSKITMFLG_ISRUNNING)
-                    return;
+            EGWint threadIndex = _tpCount; while(threadIndex--)
+                if(_tThreads[threadIndex].owner == item->task)
+                    break;
+            if(threadIndex < 0 && threadNumber && _tThreads[threadNumber-1].owner == nil)
+                threadIndex = threadNumber-1;
+            if(threadIndex < 0) {
+                threadIndex = _tpCount; while(threadIndex--)
+                    if(_tThreads[threadIndex].owner == nil)
+                        break;
+            }
+            if(threadIndex >= 0 && _tThreads[threadIndex].owner == nil)
+                _tThreads[threadIndex].owner = [item->task retain];
             
-            // Go through handle table and remove reference to taskHandle, also offset/decrement anything > taskHandle
-            index = EGW_TASKMNGR_MAXTASKHANDLES; while(index--) {
-                if(_tHndLkup[index] == taskHandle)
-                    _tHndLkup[index] = -1;
-                else if(_tHndLkup[index] > taskHandle)
-                    --_tHndLkup[index];
+            pthread_mutex_unlock(&_cLock);
+            
+            if(threadIndex < 0) { // No thread available to own
+                egwTaskMngrFlagsClear(&item->tiFlags, EGW_TSKITMFLG_QUEUED);
+                return;
             }
             
-            // Go through dependency table removing any dependencys that reference taskHandle
-            index = _tdCount; while(index--) {
-                if(_tDeps[index].ttiIndex == taskHandle || _tDeps[index].tdiIndex == taskHandle) { // Removing this one!
-                    EGWint taskIndex;
-                    
-                    // Ensure a correct twDep count on tasks dependent on the one we're removing
-                    if(_tDeps[index].tdiIndex == taskHandle) { // We're dependent to next - decrease their twDeps
-                        if(!(_tDeps[index].tdFlags & EGW_TSKDPDFLG_SATISFIED)) { // We haven't satisfied their dwDep count
-                            --_tItems[_tDeps[index].ttiIndex].twDeps;
-                            _tDeps[index].tdFlags |= EGW_TSKDPDFLG_SATISFIED;
-                        }
-                    } // NOTE: ttDeps will get correctly set in the next run
-                    
-                    // Go through _EVERY_ task handle and sniff/remove index from ttIndicies & tdIndicies, also offset/decrement anything > index
-                    taskIndex = _tiCount; while(taskIndex--) {
-                        if(taskIndex != taskHandle) { // Skip the one we're removing
-                            EGWint linkIndex;
-                            
-                            // Remove from ttIndicies & scoot down
-                            linkIndex = _tItems[taskIndex].ttDeps; while(linkIndex--) {
-                                if(_tItems[taskIndex].ttIndicies[linkIndex] == index) {
-                                    for(EGWint scootIndex = linkIndex; scootIndex < _tItems[taskIndex].ttDeps - 1; ++scootIndex)
-                                        _tItems[taskIndex].ttIndicies[scootIndex] = _tItems[taskIndex].ttIndicies[scootIndex+1];
-                                    _tItems[taskIndex].ttIndicies[_tItems[taskIndex].ttDeps-1] = -1;
-                                    --_tItems[taskIndex].ttDeps;
-                                }
-                            }
-                            // Remove from tdIndicies & scoot down
-                            linkIndex = _tItems[taskIndex].tdDeps; while(linkIndex--) {
-                                if(_tItems[taskIndex].tdIndicies[linkIndex] == index) {
-                                    for(EGWint scootIndex = linkIndex; scootIndex < _tItems[taskIndex].tdDeps - 1; ++scootIndex)
-                                        _tItems[taskIndex].tdIndicies[scootIndex] = _tItems[taskIndex].tdIndicies[scootIndex+1];
-                                    _tItems[taskIndex].tdIndicies[_tItems[taskIndex].tdDeps-1] = -1;
-                                    --_tItems[taskIndex].tdDeps;
-                                }
-                            }
-                            // Offset ttIndicies that are > index
-                            linkIndex = _tItems[taskIndex].ttDeps; while(linkIndex--) {
-                                if(_tItems[taskIndex].ttIndicies[linkIndex] > index)
-                                    --_tItems[taskIndex].ttIndicies[linkIndex];
-                            }
-                            // Offset tdIndicies that are > index
-                            linkIndex = _tItems[taskIndex].tdDeps; while(linkIndex--) {
-                                if(_tItems[taskIndex].tdIndicies[linkIndex] > index)
-                                    --_tItems[taskIndex].tdIndicies[linkIndex];
-                            }
-                        }
+            egwTaskMngrFlagsSet(&item->tiFlags, (EGWuint32)(lastThread = (EGWuint)threadIndex + 1) & EGW_TSKITMFLG_EXLASTTHRD);
+        }
+        
+        tThread = &_tThreads[lastThread-1];
+        isPinned = YES;
+    } else {
+        register EGWuint lastThread = (EGWuint)(flags & EGW_TSKITMFLG_EXLASTTHRD);
+        
+        // Prefer same thread last executed on, then the requesting thread, otherwise round robin
+        if(lastThread && lastThread <= _tpCount)
+            tThread = &_tThreads[lastThread-1];
+        else if(threadNumber)
+            tThread = &_tThreads[threadNumber-1];
+        else
+            tThread = &_tThreads[(EGWuint32)OSAtomicIncrement32Barrier((volatile int32_t*)&_tqNext) % _tpCount];
+    }
+    
+    pthread_mutex_lock(&tThread->dLock);
+    if(isPinned) {
+        if(tThread->pCount == tThread->pMax && !egwTaskMngrGrowRing(&tThread->pQueue, &tThread->pHead, tThread->pCount, &tThread->pMax)) {
+            pthread_mutex_unlock(&tThread->dLock);
+            egwTaskMngrFlagsClear(&item->tiFlags, EGW_TSKITMFLG_QUEUED);
+            NSLog(@"egwTaskManager: queueTaskAlreadyLocked:preferThread: Failure growing ready queue for task handle #%d.", egwTaskMngrHandle(taskIndex, item->tGen));
+            return;
+        }
+        tThread->pQueue[(tThread->pHead + tThread->pCount++) % tThread->pMax] = taskIndex;
+    } else {
+        if(tThread->dCount == tThread->dMax && !egwTaskMngrGrowRing(&tThread->dQueue, &tThread->dHead, tThread->dCount, &tThread->dMax)) {
+            pthread_mutex_unlock(&tThread->dLock);
+            egwTaskMngrFlagsClear(&item->tiFlags, EGW_TSKITMFLG_QUEUED);
+            NSLog(@"egwTaskManager: queueTaskAlreadyLocked:preferThread: Failure growing ready deque for task handle #%d.", egwTaskMngrHandle(taskIndex, item->tGen));
+            return;
+        }
+        tThread->dQueue[(tThread->dHead + tThread->dCount++) % tThread->dMax] = taskIndex;
+    }
+    
+    // Targeted wake up: the queue's thread if idle (it waits on its own dLock), otherwise a single idle thief for stealable work
+    if(tThread->isIdle) {
+        pthread_cond_signal(&tThread->wCond);
+        pthread_mutex_unlock(&tThread->dLock);
+    } else {
+        pthread_mutex_unlock(&tThread->dLock);
+        
+        if(!isPinned) {
+            OSMemoryBarrier(); // Publish deque count before peeking idle status, pairs with the idle wait
+            
+            EGWint threadIndex = _tpCount; while(threadIndex--)
+                if(&_tThreads[threadIndex] != tThread && _tThreads[threadIndex].isIdle) { // Unlocked peek, rechecked below
+                    pthread_mutex_lock(&_tThreads[threadIndex].dLock);
+                    if(_tThreads[threadIndex].isIdle) {
+                        pthread_cond_signal(&_tThreads[threadIndex].wCond);
+                        pthread_mutex_unlock(&_tThreads[threadIndex].dLock);
+                        break;
                     }
-                    
-                    // Remove from tDeps & scoot down
-                    for(EGWint scootIndex = index; scootIndex < _tdCount - 1; ++scootIndex)
-                        memcpy((void*)&(_tDeps[scootIndex]), (const void*)&(_tDeps[scootIndex+1]), sizeof(egwTaskDependency));
-                    memset((void*)&(_tDeps[_tdCount-1]), 0, sizeof(egwTaskDependency));
-                    --_tdCount;
+                    pthread_mutex_unlock(&_tThreads[threadIndex].dLock);
                 }
+        }
+    }
+}
+
+- (void)queueRemovalsAlreadyLocked {
+    EGWuint taskIndex = _tiUsed; while(taskIndex--)
+        if(_tItems[taskIndex].task && (_tItems[taskIndex].tiFlags & EGW_TSKITMFLG_MARKEDREM))
+            [self queueTaskAlreadyLocked:taskIndex preferThread:0];
+}
+
+- (EGWint)dequeueTaskForThread:(EGWuint)threadNumber {
+    egwTaskThread* tThread = &_tThreads[threadNumber-1];
+    EGWint taskIndex = -1;
+    
+    // Own pinned queue first, then own deque (tail end)
+    pthread_mutex_lock(&tThread->dLock);
+    if(tThread->pCount) {
+        taskIndex = (EGWint)tThread->pQueue[tThread->pHead];
+        tThread->pHead = (tThread->pHead + 1) % tThread->pMax;
+        --tThread->pCount;
+    } else if(tThread->dCount) {
+        --tThread->dCount;
+        taskIndex = (EGWint)tThread->dQueue[(tThread->dHead + tThread->dCount) % tThread->dMax];
+    }
+    pthread_mutex_unlock(&tThread->dLock);
+    
+    // Otherwise steal from the other deques (head end)
+    for(EGWuint offset = 1; taskIndex == -1 && offset < _tpCount; ++offset) {
+        egwTaskThread* vThread = &_tThreads[(threadNumber - 1 + offset) % _tpCount];
+        
+        if(vThread->dCount) { // Unlocked peek, rechecked below
+            pthread_mutex_lock(&vThread->dLock);
+            if(vThread->dCount) {
+                taskIndex = (EGWint)vThread->dQueue[vThread->dHead];
+                vThread->dHead = (vThread->dHead + 1) % vThread->dMax;
+                --vThread->dCount;
             }
+            pthread_mutex_unlock(&vThread->dLock);
+        }
+    }
+    
+    return taskIndex;
+}
+
+- (void)alertTaskThreads {
+    for(EGWint threadIndex = 0; threadIndex < _tpCount; ++threadIndex)
+        if(_tThreads[threadIndex].thread) {
+            pthread_mutex_lock(&_tThreads[threadIndex].dLock);
+            _tThreads[threadIndex].threadAlert = YES;
+            pthread_cond_signal(&_tThreads[threadIndex].wCond);
+            pthread_mutex_unlock(&_tThreads[threadIndex].dLock);
+        }
+}
+
+- (BOOL)assistParallelForJobs {
+    egwParallelForJob* job;
+    
+    // Join the most recently forked job that still has unclaimed chunks
+    pthread_mutex_lock(&_cLock);
+    for(job = _pfJobs; job; job = job->next) {
+        pthread_mutex_lock(&job->jLock);
+        if(job->rNext < job->rEnd) {
+            ++job->jHelpers;
+            pthread_mutex_unlock(&job->jLock);
+            break;
+        }
+        pthread_mutex_unlock(&job->jLock);
+    }
+    pthread_mutex_unlock(&_cLock);
+    
+    if(!job) return NO;
+    
+    egwTaskMngrRunRange(job);
+    
+    // Job cannot be released by the forking thread until this helper leaves
+    pthread_mutex_lock(&job->jLock);
+    if(--job->jHelpers == 0)
+        pthread_cond_signal(&job->jCond);
+    pthread_mutex_unlock(&job->jLock);
+    
+    return YES;
+}
+
+- (void)unregisterTaskAtIndexAlreadyLocked:(EGWuint)taskIndex {
+    if(taskIndex < _tiUsed && _tItems[taskIndex].task) {
+        egwTaskItem* item = &_tItems[taskIndex];
+        
+        // Take task off process block (delayed removal if running)
+        item->tiFlags |= (EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_MARKEDREM);
+        
+        // If the task is running, don't remove it, rely on the MARKEDREM flag to force remove after finished running, call to this will be made afterword
+        if(!(item->tiFlags & EGW_TSKITMFLG_ISRUNNING)) {
+            EGWuint index, depIndex;
             
-            // Offset tDeps that are > taskHandle
-            index = _tdCount; while(index--) {
-                if(_tDeps[index].ttiIndex > taskHandle) --_tDeps[index].ttiIndex;
-                if(_tDeps[index].tdiIndex > taskHandle) --_tDeps[index].tdiIndex;
+            // Unlink left linkages from the right linkages of the tasks this task is dependent on
+            index = item->ttDeps; while(index--) {
+                egwTaskItem* dItem = &_tItems[_tDeps[(depIndex = item->ttIndicies[index])].tdiIndex];
+                
+                egwTaskMngrUnlink(dItem->tdIndicies, &dItem->tdDeps, depIndex);
+                
+                _tDeps[depIndex].tdFlags = EGW_TSKDPDFLG_FREESLOT;
+                _tdFree[_tdFreeCount++] = depIndex;
+                --_tdCount;
+            }
+            
+            // Unlink right linkages from the left linkages of the tasks dependent on this task, releasing any wait on this task
+            index = item->tdDeps; while(index--) {
+                EGWuint tIndex = _tDeps[(depIndex = item->tdIndicies[index])].ttiIndex;
+                egwTaskItem* tItem = &_tItems[tIndex];
+                
+                // A running dependent had twDeps reset to include this linkage regardless of its satisfied state
+                if((!(_tDeps[depIndex].tdFlags & EGW_TSKDPDFLG_SATISFIED) || (tItem->tiFlags & EGW_TSKITMFLG_ISRUNNING)) && tItem->twDeps)
+                    --tItem->twDeps;
+                
+                egwTaskMngrUnlink(tItem->ttIndicies, &tItem->ttDeps, depIndex);
+                
+                _tDeps[depIndex].tdFlags = EGW_TSKDPDFLG_FREESLOT;
+                _tdFree[_tdFreeCount++] = depIndex;
+                --_tdCount;
+                
+                if(tItem->twDeps == 0)
+                    [self queueTaskAlreadyLocked:tIndex preferThread:0];
             }
             
+            item->ttDeps = item->twDeps = item->tdDeps = 0;
+            
             // Release any ownerships
-            index = EGW_TASKMNGR_TASKTHREADS; while(index--) {
-                if(_tOwner[index] == _tItems[taskHandle].task) {
-                    [_tOwner[index] release]; _tOwner[index] = nil;
+            index = _tpCount; while(index--) {
+                if(_tThreads[index].owner == item->task) {
+                    [_tThreads[index].owner release]; _tThreads[index].owner = nil;
                 }
             }
             
-            [_tItems[taskHandle].task release]; _tItems[taskHandle].task = nil;
+            [item->task release]; item->task = nil;
+            item->fpPrfmTask = NULL;
+            item->tGen = (EGWuint16)((item->tGen + 1) & EGW_TSKHNDL_GENMASK); // Invalidates outstanding handles to this slot
             
-            // Remove from tItems & scoot down
-            for(EGWint scootIndex = taskHandle; scootIndex < _tiCount - 1; ++scootIndex)
-                memcpy((void*)&(_tItems[scootIndex]), (const void*)&(_tItems[scootIndex+1]), sizeof(egwTaskItem));
-            memset((void*)&(_tItems[_tiCount-1]), 0, sizeof(egwTaskItem));
+            // Slot is reusable immediately unless still sitting in a ready queue, in which case it is reclaimed when dequeued
+            if(item->tiFlags & EGW_TSKITMFLG_QUEUED)
+                item->tiFlags = (EGW_TSKITMFLG_QUEUED | EGW_TSKITMFLG_FREESLOT);
+            else {
+                item->tiFlags = EGW_TSKITMFLG_NONE;
+                _tiFree[_tiFreeCount++] = taskIndex;
+            }
             
+            pthread_mutex_lock(&_cLock);
             --_tiCount;
+            pthread_cond_broadcast(&_sCond);
+            pthread_mutex_unlock(&_cLock);
         }
     }
 }
@@ -656,16 +991,17 @@ static egwTaskManager* _singleton = nil;
 
 - (void)taskThreadMainLoop:(NSAutoreleasePool**)arPool {
     EGWsingle threadPriority = (EGWsingle)[NSThread threadPriority];
-    EGWuint8 index, selTaskIndex, threadNumber, oddJobCounter = EGW_ENGINE_MANAGERS_ODDJOBSPINCYCLE;
+    EGWint selTaskIndex;
+    EGWuint index, depIndex, threadNumber, oddJobCounter = EGW_ENGINE_MANAGERS_ODDJOBSPINCYCLE;
     time_t drainAfter = time(NULL) + (time_t)EGW_ENGINE_MANAGERS_TIMETODRAIN;
     
     // Determine this thread number
-    for(threadNumber = 1; threadNumber <= EGW_TASKMNGR_TASKTHREADS; ++threadNumber)
-        if(_tPool[threadNumber-1] == [NSThread currentThread])
+    for(threadNumber = 1; threadNumber <= _tpCount; ++threadNumber)
+        if(_tThreads[threadNumber-1].thread == [NSThread currentThread])
             break;
     
-    // Thread alert poller to switch to odd jobs
-    BOOL* threadAlert = &_threadAlert[threadNumber-1];
+    // Thread structure, alert poller to switch to odd jobs
+    egwTaskThread* tThread = &_tThreads[threadNumber-1];
     
     pthread_mutex_lock(&_cLock);
     ++_ttCount;
@@ -675,100 +1011,129 @@ static egwTaskManager* _singleton = nil;
     
     // NOTICE: TIER 0 CODE SECTION!
     while(1) {
-        if(oddJobCounter-- && _tiCount && !*threadAlert) {
-            pthread_mutex_lock(&_cLock);
+        if(oddJobCounter-- && !tThread->threadAlert) {
+            // Chunks of forked parallel for jobs block a running task, help those first
+            if(_pfJobs && [self assistParallelForJobs]) // Unlocked peek, rechecked inside
+                continue;
             
-            selTaskIndex = _tiCount; // sentinel
+            selTaskIndex = [self dequeueTaskForThread:threadNumber];
             
-            index = _tiCount; while(index--) {
-                if(((_tItems[index].twDeps == 0 || (_tItems[index].tiFlags & EGW_TSKITMFLG_STARTER)) &&
-                   !(_tItems[index].tiFlags & (EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_ISRUNNING))) ||
-                   (_tItems[index].tiFlags & EGW_TSKITMFLG_MARKEDREM)) {
-                    register EGWuint lastThread = (EGWuint)(_tItems[index].tiFlags & EGW_TSKITMFLG_EXLASTTHRD);
+            if(selTaskIndex >= 0) {
+                egwTaskItem* item;
+                EGWuint32 flags, newFlags;
+                BOOL doRun;
+                
+                pthread_rwlock_rdlock(&_gLock);
+                
+                item = &_tItems[selTaskIndex];
+                
+                if(item->tiFlags & (EGW_TSKITMFLG_FREESLOT | EGW_TSKITMFLG_MARKEDREM)) { // Removals change the graph, retake lock exclusively
+                    pthread_rwlock_unlock(&_gLock);
+                    pthread_rwlock_wrlock(&_gLock);
                     
-                    if(lastThread == threadNumber ||
-                       (!lastThread && (!(_tItems[index].tiFlags & EGW_TSKITMFLG_OWNSTHRD) || (_tOwner[threadNumber-1] == nil || _tOwner[threadNumber-1] == _tItems[index].task)))) { // Only one task thread owner per thread
-                        selTaskIndex = index; // Always prefer same thread last executed on
-                        
-                        if(!lastThread && (_tItems[index].tiFlags & EGW_TSKITMFLG_OWNSTHRD)) // Enable ownership of thread if being used for first time by a task thread owner
-                            _tOwner[threadNumber-1] = [_tItems[index].task retain];
-                        
-                        break; // No more options to consider at this point
-                    } else if(!(_tItems[index].tiFlags & EGW_TSKITMFLG_OWNSTHRD)) { // Don't consider this task any longer if task owns its thread, and we ain't that thread
-                        if(selTaskIndex == _tiCount) // sentinel, use first available
-                            selTaskIndex = index;
-                        else if(_tItems[index].tPriority == threadPriority && _tItems[selTaskIndex].tPriority != threadPriority) // match better priority
-                            selTaskIndex = index;
-                    } else if(_tItems[index].tiFlags & EGW_TSKITMFLG_MARKEDREM) {
-                        selTaskIndex = index; // Always can do for a removal
-                        break;
-                    }
+                    item = &_tItems[selTaskIndex];
+                    item->tiFlags &= ~EGW_TSKITMFLG_QUEUED;
+                    
+                    if(item->tiFlags & EGW_TSKITMFLG_FREESLOT) { // Unregistered while queued, reclaim slot
+                        item->tiFlags = EGW_TSKITMFLG_NONE;
+                        _tiFree[_tiFreeCount++] = (EGWuint)selTaskIndex;
+                    } else if(!(item->tiFlags & EGW_TSKITMFLG_ISRUNNING))
+                        [self unregisterTaskAtIndexAlreadyLocked:(EGWuint)selTaskIndex];
+                    
+                    pthread_rwlock_unlock(&_gLock);
+                    continue;
                 }
-            }
-            
-            if(selTaskIndex != _tiCount) {
-                if(!(_tItems[selTaskIndex].tiFlags & EGW_TSKITMFLG_MARKEDREM)) {
-                    // These are here before unlock so that other threads don't grab them after we already have
-                    _tItems[selTaskIndex].twDeps = _tItems[selTaskIndex].ttDeps;
-                    _tItems[selTaskIndex].tiFlags &= ~(EGW_TSKITMFLG_STARTER | EGW_TSKITMFLG_EXLASTTHRD);
-                    _tItems[selTaskIndex].tiFlags |= (EGW_TSKITMFLG_ISRUNNING | ((EGWuint16)threadNumber & EGW_TSKITMFLG_EXLASTTHRD));
+                
+                // Swap queued for running in one step so that other threads don't grab it after we already have
+                do {
+                    flags = item->tiFlags;
+                    if((doRun = (item->task && (item->twDeps == 0 || (flags & EGW_TSKITMFLG_STARTER)) && !(flags & (EGW_TSKITMFLG_DISABLED | EGW_TSKITMFLG_ISRUNNING)))))
+                        newFlags = ((flags & ~(EGW_TSKITMFLG_QUEUED | EGW_TSKITMFLG_STARTER | EGW_TSKITMFLG_EXLASTTHRD)) | EGW_TSKITMFLG_ISRUNNING | ((EGWuint32)threadNumber & EGW_TSKITMFLG_EXLASTTHRD));
+                    else
+                        newFlags = (flags & ~EGW_TSKITMFLG_QUEUED);
+                } while(!OSAtomicCompareAndSwap32Barrier((int32_t)flags, (int32_t)newFlags, (volatile int32_t*)&item->tiFlags));
+                
+                if(doRun) {
+                    id<egwPTask> task = item->task;
+                    IMP fpPrfmTask = item->fpPrfmTask;
                     
-                    if(threadPriority != _tItems[selTaskIndex].tPriority)
-                        egwSFPNSThreadSetThreadPriority(nil, @selector(setThreadPriority:), (double)(threadPriority = _tItems[selTaskIndex].tPriority));
+                    item->twDeps = (EGWuint32)item->ttDeps;
                     
-                    pthread_mutex_unlock(&_cLock);
+                    if(threadPriority != item->tPriority)
+                        egwSFPNSThreadSetThreadPriority(nil, @selector(setThreadPriority:), (double)(threadPriority = item->tPriority));
                     
-                    _tItems[selTaskIndex].fpPrfmTask(_tItems[selTaskIndex].task, @selector(performTask));
+                    pthread_rwlock_unlock(&_gLock);
                     
-                    pthread_mutex_lock(&_cLock);
+                    fpPrfmTask(task, @selector(performTask)); // Task table may be reallocated while running, slot stays stable
+                    
+                    pthread_rwlock_rdlock(&_gLock);
                     
-                    _tItems[selTaskIndex].tiFlags &= ~EGW_TSKITMFLG_ISRUNNING;
+                    item = &_tItems[selTaskIndex];
                     
                     // Tell all links this was dependent on to unflag satisfied (left uncheck)
-                    index = _tItems[selTaskIndex].ttDeps; while(index--) {
-                        _tDeps[_tItems[selTaskIndex].ttIndicies[index]].tdFlags &= ~EGW_TSKDPDFLG_SATISFIED;
+                    index = item->ttDeps; while(index--) {
+                        egwTaskMngrFlagsClear(&_tDeps[item->ttIndicies[index]].tdFlags, EGW_TSKDPDFLG_SATISFIED);
                     }
                     
-                    // Tell all tasks dependent on this to satisfy linkage (right check), to decrement twDeps, check for workAvail, signal
-                    index = _tItems[selTaskIndex].tdDeps; while(index--) {
-                        if(!(_tDeps[_tItems[selTaskIndex].tdIndicies[index]].tdFlags & EGW_TSKDPDFLG_SATISFIED)) {
-                            _tDeps[_tItems[selTaskIndex].tdIndicies[index]].tdFlags |= EGW_TSKDPDFLG_SATISFIED;
-                            
-                            if((--_tItems[_tDeps[_tItems[selTaskIndex].tdIndicies[index]].ttiIndex].twDeps) == 0)
-                                pthread_cond_broadcast(&_wCond);
+                    // Tell all tasks dependent on this to satisfy linkage (right check), to decrement twDeps, queue up if now ready
+                    index = item->tdDeps; while(index--) {
+                        if(!(egwTaskMngrFlagsSet(&_tDeps[(depIndex = item->tdIndicies[index])].tdFlags, EGW_TSKDPDFLG_SATISFIED) & EGW_TSKDPDFLG_SATISFIED)) {
+                            if(egwTaskMngrReleaseWait(&_tItems[_tDeps[depIndex].ttiIndex].twDeps))
+                                [self queueTaskAlreadyLocked:_tDeps[depIndex].ttiIndex preferThread:threadNumber];
                         }
                     }
-                }
+                    
+                    if(item->tiFlags & (EGW_TSKITMFLG_TEMPORARY | EGW_TSKITMFLG_MARKEDREM)) {
+                        pthread_rwlock_unlock(&_gLock);
+                        pthread_rwlock_wrlock(&_gLock);
+                        
+                        _tItems[selTaskIndex].tiFlags &= ~EGW_TSKITMFLG_ISRUNNING;
+                        [self unregisterTaskAtIndexAlreadyLocked:(EGWuint)selTaskIndex];
+                    } else { // Cyclic, requeue self if still ready (e.g. no dependencies, or all satisfied while running)
+                        egwTaskMngrFlagsClear(&item->tiFlags, EGW_TSKITMFLG_ISRUNNING);
+                        [self queueTaskAlreadyLocked:(EGWuint)selTaskIndex preferThread:threadNumber];
+                    }
+                } else // Not ready, recheck since a completion may have been turned away while this was still flagged queued
+                    [self queueTaskAlreadyLocked:(EGWuint)selTaskIndex preferThread:threadNumber];
                 
-                if(_tItems[selTaskIndex].tiFlags & (EGW_TSKITMFLG_TEMPORARY | EGW_TSKITMFLG_MARKEDREM)) {
-                    // Reverse lookup for selTaskIndex into handle lookup
-                    index = EGW_TASKMNGR_MAXTASKHANDLES; while(index--)
-                        if(_tHndLkup[index] == selTaskIndex) {
-                            [self unregisterTaskAlreadyLocked:(index+1)];
-                            break;
-                        }
+                pthread_rwlock_unlock(&_gLock);
+            } else {
+                // No work yet available anywhere, wait on own dLock for a targeted new work signal
+                pthread_mutex_lock(&tThread->dLock);
+                
+                if(!tThread->pCount && !tThread->dCount && !tThread->threadAlert) {
+                    BOOL workAvail = NO;
+                    
+                    tThread->isIdle = YES;
+                    OSMemoryBarrier(); // Publish idle status before peeking, pairs with queuing and forking
+                    
+                    for(index = 0; !workAvail && index < _tpCount; ++index)
+                        if(_tThreads[index].dCount)
+                            workAvail = YES;
+                    
+                    if(!workAvail && !_pfJobs) // Unlocked peeks, a stale read only costs a spin
+                        pthread_cond_wait(&tThread->wCond, &tThread->dLock);
+                    
+                    tThread->isIdle = NO;
                 }
                 
-                pthread_mutex_unlock(&_cLock);
-            } else {
-                // No work yet available, wait for a new work signal
-                pthread_cond_wait(&_wCond, &_cLock);
-                pthread_mutex_unlock(&_cLock);
+                pthread_mutex_unlock(&tThread->dLock);
             }
         } else {
-            if(*threadAlert) *threadAlert = NO;
+            if(tThread->threadAlert) tThread->threadAlert = NO;
             
-            if(!_tPool[threadNumber-1] || [_tPool[threadNumber-1] isCancelled] || _doShutdownPh2)
+            if(!tThread->thread || [tThread->thread isCancelled] || _doShutdownPh2)
                 goto ThreadBreak;
-            else if(time(NULL) >= drainAfter || _doMemClean[threadNumber-1]) {
+            else if(time(NULL) >= drainAfter || tThread->doMemClean) {
                 [*arPool release]; *arPool = [[NSAutoreleasePool alloc] init];
                 drainAfter = time(NULL) + (time_t)EGW_ENGINE_MANAGERS_TIMETODRAIN;
-                if(_doMemClean[threadNumber-1]) {
+                if(tThread->doMemClean) {
                     pthread_mutex_lock(&_cLock);
                     
-                    if(_doMemClean[threadNumber-1]) {
-                        _doMemClean[threadNumber-1] = NO;
+                    if(tThread->doMemClean) {
+                        tThread->doMemClean = NO;
                         --_memCleanLeft;
+                        pthread_cond_broadcast(&_sCond);
                     }
                     
                     pthread_mutex_unlock(&_cLock);
@@ -780,14 +1145,15 @@ static egwTaskManager* _singleton = nil;
     }
     
 ThreadBreak:
-    if(_doMemClean[threadNumber-1]) {
+    if(tThread->doMemClean) {
         pthread_mutex_lock(&_cLock);
         
         [*arPool release]; *arPool = nil;
         
-        if(_doMemClean[threadNumber-1]) {
-            _doMemClean[threadNumber-1] = NO;
+        if(tThread->doMemClean) {
+            tThread->doMemClean = NO;
             --_memCleanLeft;
+            pthread_cond_broadcast(&_sCond);
         }
         
         pthread_mutex_unlock(&_cLock);
@@ -795,6 +1161,7 @@ ThreadBreak:
     
     pthread_mutex_lock(&_cLock);
     --_ttCount;
+    pthread_cond_broadcast(&_sCond);
     pthread_mutex_unlock(&_cLock);
     
     if(EGW_ENGINE_MANAGERS_SHUTDOWNMSGS) NSLog(@"egwTaskManager: taskThreadMainLoop: Task thread #%d shut down.", threadNumber);
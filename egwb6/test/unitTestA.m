@@ -176,6 +176,855 @@ void egwRBTreePrint(egwRedBlackTree* tree_in) {
     printf("\r\n");
 }
 
+#define EGW_UNITTEST_BENCHMARKS     0       // Set to 1 to run the benchmark harnesses on launch (timings are printed).
+
+double egwUnitTestTime(void) {
+    return (double)CFAbsoluteTimeGetCurrent();
+}
+
+void egwUnitTestBenchParticleReplace(EGWuint16 maxParts) {
+    // Times oldest particle replacement at capacity, head replacement (emission ordered alive times) vs full scan (offset alive times)
+    egwPSParticleDynamics pDyn; memset((void*)&pDyn, 0, sizeof(egwPSParticleDynamics));
+    egwPSSystemDynamics sDyn; memset((void*)&sDyn, 0, sizeof(egwPSSystemDynamics));
+    EGWuint emissions = 20000;
+    
+    pDyn.pWeight.origin = 1.0f;
+    pDyn.pSize.origin = 1.0f;
+    pDyn.pLife.origin = 1000.0f; // nothing dies during the run
+    egwVecInit4f(&pDyn.pColor.origin, 1.0f, 1.0f, 1.0f, 1.0f);
+    
+    sDyn.mParticles = maxParts;
+    sDyn.eDuration.tParticles.origin = 1000000000.0f;
+    sDyn.pFrequency.origin = 0.001f;
+    
+    for(int mode = 0; mode < 2; ++mode) {
+        sDyn.psFlags = EGW_PSYSFLAG_EMITOLDRPLC | EGW_PSYSFLAG_NOPOINTSPRT | (mode ? EGW_PSYSFLAG_OFFTIMEDTEX : 0);
+        
+        egwParticleSystem* system = [[egwParticleSystem alloc] initWithIdentity:@"benchSystem" particleDynamics:&pDyn systemDynamics:&sDyn systemBounding:nil geometryStorage:EGW_GEOMETRY_STRG_NONE lightStack:nil shaderStack:nil textureStack:nil];
+        if(!system) { printf("Particle replace: FAIL (init)\r\n"); return; }
+        
+        [system update:0.0 withFlags:EGW_ACTOBJ_RPLYFLG_DOUPDATESTART];
+        [system update:(EGWtime)maxParts * 0.001 withFlags:EGW_ACTOBJ_RPLYFLG_DOUPDATEPASS]; // fill to capacity
+        
+        double start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < emissions; eIndex += 100)
+            [system update:0.1 withFlags:EGW_ACTOBJ_RPLYFLG_DOUPDATEPASS]; // 100 emissions per update
+        double elapsed = egwUnitTestTime() - start;
+        
+        printf("Particle replace (%d particles, %s): %.3f ms per 1k emissions\r\n", (int)maxParts, (mode ? "scan" : "head"), elapsed * 1000.0 * 1000.0 / (double)emissions);
+        
+        [system update:0.0 withFlags:EGW_ACTOBJ_RPLYFLG_DOUPDATESTOP];
+        [system release];
+    }
+}
+
+EGWuint egwUnitTestMakeParseTokens(EGWchar* string_out, EGWuint count) {
+    // Mixes short decimals (fast path), long mantissas, large exponents and integers (strtod fallback)
+    EGWchar* scan = string_out;
+    
+    for(EGWuint tIndex = 0; tIndex < count; ++tIndex) {
+        switch(rand() % 4) {
+            case 0: scan += sprintf((char*)scan, "%d.%03d", (rand() % 2000) - 1000, rand() % 1000); break;
+            case 1: scan += sprintf((char*)scan, "%.*g", 1 + rand() % 17, ((double)rand() / (double)RAND_MAX - 0.5) * 1000.0); break;
+            case 2: scan += sprintf((char*)scan, "%.9e", ((double)rand() / (double)RAND_MAX) * pow(10.0, (double)((rand() % 80) - 40))); break;
+            default: scan += sprintf((char*)scan, "%d", rand() - (RAND_MAX / 2)); break;
+        }
+        *scan++ = ((rand() % 3) ? ' ' : ((rand() % 2) ? ',' : '\n'));
+        if(!(rand() % 8)) { memset((void*)scan, ' ', 20); scan += 20; } // indentation runs
+    }
+    *scan = '\0';
+    
+    return (EGWuint)(scan - string_out);
+}
+
+void egwUnitTestParseFloats(EGWuint count) {
+    // Checks the in place parsers against strtof/strtod on the same tokens, results must be bit identical
+    EGWchar* string = (EGWchar*)malloc((size_t)count * 48 + 1);
+    EGWsingle* singles = (EGWsingle*)malloc((size_t)count * sizeof(EGWsingle));
+    EGWdouble* doubles = (EGWdouble*)malloc((size_t)count * sizeof(EGWdouble));
+    EGWuint mismatches = 0;
+    
+    egwUnitTestMakeParseTokens(string, count);
+    
+    if(egwParseStringfcv(string, singles, 0, count) != count || egwParseStringdcv(string, doubles, 0, count) != count)
+        ++mismatches;
+    else {
+        const char* scan = (const char*)string;
+        char* end = NULL;
+        
+        for(EGWuint tIndex = 0; tIndex < count; ++tIndex) {
+            EGWsingle single = strtof(scan, &end);
+            EGWdouble dbl = strtod(scan, NULL);
+            
+            if(memcmp((void*)&single, (void*)&singles[tIndex], sizeof(EGWsingle)) != 0 ||
+               memcmp((void*)&dbl, (void*)&doubles[tIndex], sizeof(EGWdouble)) != 0) {
+                if(mismatches++ < 8) printf("Parse floats: mismatch at token %d (%.*s)\r\n", (int)tIndex, (int)(end - scan), scan);
+            }
+            
+            scan = end;
+            while(*scan != '\0' && (*scan <= ' ' || *scan == ',')) ++scan;
+        }
+    }
+    
+    printf("Parse floats (%d tokens): %s\r\n", (int)count, (mismatches ? "FAIL" : "PASS"));
+    
+    free((void*)doubles);
+    free((void*)singles);
+    free((void*)string);
+}
+
+void egwUnitTestBenchParseFloats(EGWuint count) {
+    // Times egwParseStringfcv against a bare strtok + atof loop over the same text
+    EGWchar* string = (EGWchar*)malloc((size_t)count * 48 + 1);
+    EGWchar* copy = (EGWchar*)malloc((size_t)count * 48 + 1);
+    EGWsingle* singles = (EGWsingle*)malloc((size_t)count * sizeof(EGWsingle));
+    EGWuint length = egwUnitTestMakeParseTokens(string, count);
+    double start, elapsed;
+    
+    start = egwUnitTestTime();
+    egwParseStringfcv(string, singles, 0, count);
+    elapsed = egwUnitTestTime() - start;
+    printf("Parse floats (%d tokens, egwParseStringfcv): %.3f s\r\n", (int)count, elapsed);
+    
+    memcpy((void*)copy, (const void*)string, (size_t)length + 1);
+    start = egwUnitTestTime();
+    {   EGWuint tIndex = 0;
+        for(char* token = strtok((char*)copy, " ,\n"); token && tIndex < count; token = strtok(NULL, " ,\n"))
+            singles[tIndex++] = (EGWsingle)atof(token);
+    }
+    elapsed = egwUnitTestTime() - start;
+    printf("Parse floats (%d tokens, atof): %.3f s\r\n", (int)count, elapsed);
+    
+    free((void*)singles);
+    free((void*)copy);
+    free((void*)string);
+}
+
+void egwUnitTestNodePool(void) {
+    // Checks node reuse and that trimming only releases slabs with no live nodes
+    egwNodePool pool;
+    EGWbyte* nodes[48];
+    EGWint passed = 1;
+    
+    if(!egwNodePoolInit(&pool, 40, 16)) { printf("Node pool: FAIL (init)\r\n"); return; }
+    
+    for(EGWuint nIndex = 0; nIndex < 48; ++nIndex) { // slabs of 16 + 32 nodes
+        if(!(nodes[nIndex] = egwNodePoolAlloc(&pool)) || ((EGWuintptr)nodes[nIndex] & (EGWuintptr)15)) passed = 0;
+        else memset((void*)nodes[nIndex], (EGWint)nIndex, 40);
+    }
+    for(EGWuint nIndex = 0; nIndex < 48; ++nIndex)
+        if(nodes[nIndex][39] != (EGWbyte)nIndex) passed = 0;
+    
+    egwNodePoolDealloc(&pool, nodes[5]);
+    if(egwNodePoolAlloc(&pool) != nodes[5]) passed = 0; // LIFO reuse
+    
+    for(EGWuint nIndex = 0; nIndex < 16; ++nIndex) // empty the first slab only
+        egwNodePoolDealloc(&pool, nodes[nIndex]);
+    if(egwNodePoolTrim(&pool) != 1 || pool.fHead != NULL) passed = 0;
+    
+    for(EGWuint nIndex = 16; nIndex < 47; ++nIndex)
+        egwNodePoolDealloc(&pool, nodes[nIndex]);
+    if(egwNodePoolTrim(&pool) != 0) passed = 0; // nodes[47] still live
+    egwNodePoolDealloc(&pool, nodes[47]);
+    if(egwNodePoolTrim(&pool) != 1 || pool.sHead != NULL || pool.fHead != NULL) passed = 0;
+    
+    if(!egwNodePoolAlloc(&pool)) passed = 0; // regrows after a full trim
+    
+    egwNodePoolFree(&pool);
+    
+    printf("Node pool: %s\r\n", (passed ? "PASS" : "FAIL"));
+}
+
+void egwUnitTestBenchNodePool(void) {
+    // Times 512 zeroed 48 byte node allocations followed by 512 scattered frees, malloc/free vs node pool
+    EGWbyte* nodes[512];
+    EGWuint order[512];
+    EGWuint rounds = 20000;
+    egwNodePool pool;
+    double start, elapsed;
+    
+    for(EGWuint nIndex = 0; nIndex < 512; ++nIndex) order[nIndex] = nIndex;
+    for(EGWuint nIndex = 511; nIndex > 0; --nIndex) { EGWuint swap = (EGWuint)rand() % (nIndex + 1), temp = order[nIndex]; order[nIndex] = order[swap]; order[swap] = temp; }
+    
+    start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) {
+        for(EGWuint nIndex = 0; nIndex < 512; ++nIndex) { nodes[nIndex] = (EGWbyte*)malloc(48); memset((void*)nodes[nIndex], 0, 48); }
+        for(EGWuint nIndex = 0; nIndex < 512; ++nIndex) free((void*)nodes[order[nIndex]]);
+    }
+    elapsed = egwUnitTestTime() - start;
+    printf("Node pool (malloc/free): %.1f ns per alloc+free\r\n", elapsed * 1.0e9 / (512.0 * (double)rounds));
+    
+    egwNodePoolInit(&pool, 48, EGW_NODEPOOL_DFLTSLABNODES);
+    start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) {
+        for(EGWuint nIndex = 0; nIndex < 512; ++nIndex) { nodes[nIndex] = egwNodePoolAlloc(&pool); memset((void*)nodes[nIndex], 0, 48); }
+        for(EGWuint nIndex = 0; nIndex < 512; ++nIndex) egwNodePoolDealloc(&pool, nodes[order[nIndex]]);
+    }
+    elapsed = egwUnitTestTime() - start;
+    egwNodePoolFree(&pool);
+    printf("Node pool (egwNodePool): %.1f ns per alloc+free\r\n", elapsed * 1.0e9 / (512.0 * (double)rounds));
+}
+
+static size_t egwUnitTestSortSize = 0;
+
+int egwUnitTestQSortBytes(const void* lhs, const void* rhs) {
+    return memcmp(lhs, rhs, egwUnitTestSortSize);
+}
+
+EGWint egwUnitTestCompareInt(const EGWbyte* lhs, const EGWbyte* rhs, size_t size) {
+    return (*(const EGWint32*)lhs > *(const EGWint32*)rhs ? 1 : (*(const EGWint32*)lhs < *(const EGWint32*)rhs ? -1 : 0));
+}
+
+void egwUnitTestArraySort(void) {
+    // Checks egwArraySort against qsort() byte-wise order for element sizes 1-40 and counts 0-300, then the compare function path
+    EGWbyte* expected = (EGWbyte*)malloc(40 * 300);
+    EGWuint failures = 0;
+    
+    for(EGWuint eSize = 1; eSize <= 40; ++eSize) {
+        for(EGWuint eCount = 0; eCount <= 300; ++eCount) {
+            egwArray array;
+            
+            if(!egwArrayInit(&array, NULL, eSize, eCount, EGW_ARRAY_FLG_DFLT)) { ++failures; continue; }
+            
+            for(EGWuint bIndex = 0; bIndex < eSize * eCount; ++bIndex) // small alphabet so that duplicates are common
+                array.rData[bIndex] = expected[bIndex] = (EGWbyte)((rand() % 4) * 0x55);
+            array.eCount = eCount;
+            
+            egwUnitTestSortSize = (size_t)eSize;
+            qsort((void*)expected, (size_t)eCount, (size_t)eSize, &egwUnitTestQSortBytes);
+            
+            if(!egwArraySort(&array) || memcmp((const void*)array.rData, (const void*)expected, (size_t)(eSize * eCount)) != 0) {
+                if(failures++ < 8) printf("Array sort: mismatch at size %d count %d\r\n", (int)eSize, (int)eCount);
+            }
+            
+            egwArrayFree(&array);
+        }
+    }
+    
+    {   egwDataFuncs funcs; memset((void*)&funcs, 0, sizeof(egwDataFuncs));
+        egwArray array;
+        funcs.fpCompare = (EGWcomparefp)&egwUnitTestCompareInt;
+        
+        if(egwArrayInit(&array, &funcs, sizeof(EGWint32), 1000, EGW_ARRAY_FLG_DFLT)) {
+            for(EGWuint eIndex = 0; eIndex < 1000; ++eIndex)
+                ((EGWint32*)array.rData)[eIndex] = (EGWint32)(rand() % 2001) - 1000;
+            array.eCount = 1000;
+            
+            egwArraySort(&array);
+            
+            for(EGWuint eIndex = 1; eIndex < 1000; ++eIndex)
+                if(((EGWint32*)array.rData)[eIndex-1] > ((EGWint32*)array.rData)[eIndex]) { ++failures; break; }
+            
+            egwArrayFree(&array);
+        } else ++failures;
+    }
+    
+    printf("Array sort: %s\r\n", (failures ? "FAIL" : "PASS"));
+    
+    free((void*)expected);
+}
+
+void egwUnitTestBenchArraySort(EGWuint count) {
+    // Times 4 byte element sorts over common input orderings, with memcmp() order and with a compare function
+    const char* patterns[5] = { "sorted", "reversed", "random", "few uniq", "organ" };
+    EGWint32* source = (EGWint32*)malloc(sizeof(EGWint32) * (size_t)count);
+    egwDataFuncs funcs; memset((void*)&funcs, 0, sizeof(egwDataFuncs));
+    funcs.fpCompare = (EGWcomparefp)&egwUnitTestCompareInt;
+    
+    for(EGWuint pattern = 0; pattern < 5; ++pattern) {
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            switch(pattern) {
+                case 0: source[eIndex] = (EGWint32)eIndex; break;
+                case 1: source[eIndex] = (EGWint32)(count - eIndex); break;
+                case 2: source[eIndex] = (EGWint32)rand(); break;
+                case 3: source[eIndex] = (EGWint32)(rand() % 8); break;
+                default: source[eIndex] = (EGWint32)(eIndex < count / 2 ? eIndex : count - eIndex); break;
+            }
+        }
+        
+        for(EGWuint useFunc = 0; useFunc < 2; ++useFunc) {
+            egwArray array;
+            double start, elapsed;
+            
+            if(!egwArrayInit(&array, (useFunc ? &funcs : NULL), sizeof(EGWint32), count, EGW_ARRAY_FLG_DFLT)) continue;
+            memcpy((void*)array.rData, (const void*)source, sizeof(EGWint32) * (size_t)count);
+            array.eCount = count;
+            
+            start = egwUnitTestTime();
+            egwArraySort(&array);
+            elapsed = egwUnitTestTime() - start;
+            
+            printf("Array sort (%d elements, %s, %s): %.1f ms\r\n", (int)count, patterns[pattern], (useFunc ? "compare fn" : "memcmp"), elapsed * 1000.0);
+            
+            egwArrayFree(&array);
+        }
+    }
+    
+    free((void*)source);
+}
+
+EGWuint32 egwUnitTestHashCluster(const EGWbyte* data, size_t size) {
+    return (EGWuint32)(*(const EGWint32*)data & 3) + 1; // 4 home slots, forces long probe runs
+}
+
+void egwUnitTestHashTable(void) {
+    // Checks hash table add/find/remove, backward shift removal within long probe runs, then random ops against a reference
+    EGWint32 elm[2];
+    EGWuint failures = 0;
+    
+    {   egwHashTable table;
+        
+        if(egwHashTableInit(&table, NULL, sizeof(EGWint32), 8, EGW_HASH_FLG_DFLT)) {
+            for(EGWint32 key = 0; key < 1000; ++key)
+                if(!egwHashTableAdd(&table, (const EGWbyte*)&key)) ++failures;
+            for(EGWint32 key = 0; key < 1000; ++key)
+                if(egwHashTableAdd(&table, (const EGWbyte*)&key)) ++failures; // duplicates rejected
+            for(EGWint32 key = 0; key < 2000; ++key)
+                if(egwHashTableContains(&table, (const EGWbyte*)&key) != (key < 1000 ? 1 : 0)) ++failures;
+            if(table.eCount != 1000) ++failures;
+            
+            for(EGWint32 key = 0; key < 1000; key += 2)
+                if(!egwHashTableRemove(&table, (const EGWbyte*)&key) || egwHashTableRemove(&table, (const EGWbyte*)&key)) ++failures;
+            for(EGWint32 key = 0; key < 1000; ++key)
+                if(egwHashTableContains(&table, (const EGWbyte*)&key) != (key & 1)) ++failures;
+            
+            egwHashTableRemoveAll(&table);
+            if(table.eCount != 0 || table.sCount != table.sMinCount) ++failures;
+            
+            egwHashTableFree(&table);
+        } else ++failures;
+    }
+    
+    {   egwDataFuncs funcs; memset((void*)&funcs, 0, sizeof(egwDataFuncs));
+        egwHashTable table;
+        funcs.fpCompare = (EGWcomparefp)&egwUnitTestCompareInt; // keyed on elm[0] only
+        funcs.fpHash = (EGWhashfp)&egwUnitTestHashCluster;
+        
+        if(egwHashTableInit(&table, &funcs, sizeof(EGWint32) * 2, 256, EGW_HASH_FLG_NOSHRINK)) {
+            for(EGWint32 key = 0; key < 200; ++key) {
+                elm[0] = key; elm[1] = key * 7;
+                if(!egwHashTableAdd(&table, (const EGWbyte*)elm)) ++failures;
+            }
+            
+            for(EGWint32 key = 0; key < 200; key += 3) { // removals from the middle of runs must shift followers back
+                elm[0] = key;
+                if(!egwHashTableRemove(&table, (const EGWbyte*)elm)) ++failures;
+            }
+            
+            for(EGWint32 key = 0; key < 200; ++key) {
+                EGWint32 found[2] = { -1, -1 };
+                elm[0] = key;
+                if(key % 3 == 0) {
+                    if(egwHashTableContains(&table, (const EGWbyte*)elm)) ++failures;
+                } else if(!egwHashTableGetElement(&table, (const EGWbyte*)elm, (EGWbyte*)found) || found[0] != key || found[1] != key * 7) ++failures;
+            }
+            if(table.eCount != 200 - 67) ++failures;
+            
+            egwHashTableFree(&table);
+        } else ++failures;
+    }
+    
+    {   EGWbyte present[512];
+        EGWuint count = 0;
+        egwHashTable table;
+        memset((void*)present, 0, sizeof(present));
+        
+        if(egwHashTableInit(&table, NULL, sizeof(EGWint32), 8, EGW_HASH_FLG_DFLT)) {
+            for(EGWuint op = 0; op < 100000; ++op) {
+                EGWint32 key = (EGWint32)(rand() % 512);
+                switch(rand() % 3) {
+                    case 0: if(egwHashTableAdd(&table, (const EGWbyte*)&key) != (present[key] ? 0 : 1)) ++failures; if(!present[key]) { present[key] = 1; ++count; } break;
+                    case 1: if(egwHashTableRemove(&table, (const EGWbyte*)&key) != (present[key] ? 1 : 0)) ++failures; if(present[key]) { present[key] = 0; --count; } break;
+                    default: if(egwHashTableContains(&table, (const EGWbyte*)&key) != (present[key] ? 1 : 0)) ++failures; break;
+                }
+            }
+            
+            {   egwHashTableIter iter;
+                EGWuint enumerated = 0;
+                if(egwHashTableEnumerateStart(&table, EGW_ITERATE_MODE_LINHTT, &iter)) {
+                    EGWint32* key;
+                    while((key = (EGWint32*)egwHashTableEnumerateNextPtr(&iter))) {
+                        if(!present[*key]) ++failures;
+                        ++enumerated;
+                    }
+                }
+                if(enumerated != count || table.eCount != count) ++failures;
+            }
+            
+            egwHashTableFree(&table);
+        } else ++failures;
+    }
+    
+    printf("Hash table: %s\r\n", (failures ? "FAIL" : "PASS"));
+}
+
+void egwUnitTestBenchHashTable(EGWuint count) {
+    // Times pointer keyed 16 byte element add/hit/miss/remove, red-black tree vs hash table
+    EGWbyte* elms = (EGWbyte*)malloc((size_t)count * 2 * 16);
+    EGWbyte* misses = elms + (count * 16);
+    double start, elapsed[4];
+    
+    memset((void*)elms, 0, (size_t)count * 2 * 16);
+    for(EGWuint eIndex = 0; eIndex < count * 2; ++eIndex) { // key is the element's own address, as for object pointer sets
+        EGWbyte* elm = elms + (eIndex * 16);
+        *(EGWbyte**)elm = elm;
+    }
+    
+    {   egwRedBlackTree tree;
+        egwRBTreeInit(&tree, NULL, 16, EGW_TREE_FLG_DFLT);
+        
+        start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwRBTreeAdd(&tree, elms + (eIndex * 16));
+        elapsed[0] = egwUnitTestTime() - start; start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwRBTreeContains(&tree, elms + (eIndex * 16));
+        elapsed[1] = egwUnitTestTime() - start; start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwRBTreeContains(&tree, misses + (eIndex * 16));
+        elapsed[2] = egwUnitTestTime() - start; start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwRBTreeRemove(&tree, egwRBTreeFind(&tree, elms + (eIndex * 16)));
+        elapsed[3] = egwUnitTestTime() - start;
+        
+        egwRBTreeFree(&tree);
+        printf("Hash table (%d elements, egwRedBlackTree): add %.1f, hit %.1f, miss %.1f, remove %.1f ns per op\r\n", (int)count,
+               elapsed[0] * 1.0e9 / (double)count, elapsed[1] * 1.0e9 / (double)count, elapsed[2] * 1.0e9 / (double)count, elapsed[3] * 1.0e9 / (double)count);
+    }
+    
+    {   egwHashTable table;
+        egwHashTableInit(&table, NULL, 16, 8, EGW_HASH_FLG_DFLT);
+        
+        start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwHashTableAdd(&table, elms + (eIndex * 16));
+        elapsed[0] = egwUnitTestTime() - start; start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwHashTableContains(&table, elms + (eIndex * 16));
+        elapsed[1] = egwUnitTestTime() - start; start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwHashTableContains(&table, misses + (eIndex * 16));
+        elapsed[2] = egwUnitTestTime() - start; start = egwUnitTestTime();
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) egwHashTableRemove(&table, elms + (eIndex * 16));
+        elapsed[3] = egwUnitTestTime() - start;
+        
+        egwHashTableFree(&table);
+        printf("Hash table (%d elements, egwHashTable): add %.1f, hit %.1f, miss %.1f, remove %.1f ns per op\r\n", (int)count,
+               elapsed[0] * 1.0e9 / (double)count, elapsed[1] * 1.0e9 / (double)count, elapsed[2] * 1.0e9 / (double)count, elapsed[3] * 1.0e9 / (double)count);
+    }
+    
+    free((void*)elms);
+}
+
+#define egwUnitTestStrided(type,base,index,gap) ((type*)((EGWuintptr)(base) + ((EGWuintptr)(index) * (EGWuintptr)(sizeof(type) + (gap)))))
+
+EGWuint egwUnitTestSIMDCompare(const EGWsingle* expected, const EGWsingle* actual, EGWuint floats) {
+    // Counts mismatches, NaN matching NaN (zero vector normalization), within a few ulp for NEON reciprocal sqrt estimates
+    EGWuint mismatches = 0;
+    
+    while(floats--) {
+        if(!(*expected != *expected && *actual != *actual) && !(fabsf(*expected - *actual) <= 1.0e-5f * (fabsf(*expected) > 1.0f ? fabsf(*expected) : 1.0f)))
+            ++mismatches;
+        ++expected; ++actual;
+    }
+    
+    return mismatches;
+}
+
+void egwUnitTestSIMDMath(void) {
+    // Checks the SIMD batch kernels against their single element routines over packed, strided and aliased layouts, including zero vectors
+    const EGWuint count = 4099; // not a multiple of 4, so the scalar tails run too
+    const EGWintptr gap = 12;   // strided layout padding (bytes)
+    egwVector3f* vec3s = (egwVector3f*)malloc(sizeof(egwVector3f) * 2 * (size_t)count);
+    egwVector4f* vec4s = (egwVector4f*)malloc(sizeof(egwVector4f) * (size_t)count);
+    egwMatrix44f* mats = (egwMatrix44f*)malloc(sizeof(egwMatrix44f) * 2 * (size_t)count);
+    EGWsingle* ws = (EGWsingle*)malloc(sizeof(EGWsingle) * (size_t)count);
+    EGWbyte* work = (EGWbyte*)malloc((sizeof(egwMatrix44f) + (size_t)gap) * (size_t)count);
+    EGWbyte* outs = (EGWbyte*)malloc((sizeof(egwMatrix44f) + (size_t)gap) * (size_t)count);
+    EGWuint failures[5] = { 0, 0, 0, 0, 0 };
+    
+    for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+        for(EGWuint fIndex = 0; fIndex < 3; ++fIndex) {
+            vec3s[eIndex].vector[fIndex] = (EGWsingle)(rand() % 20001 - 10000) * 0.01f;
+            vec3s[count + eIndex].vector[fIndex] = (EGWsingle)(rand() % 20001 - 10000) * 0.01f;
+        }
+        for(EGWuint fIndex = 0; fIndex < 4; ++fIndex)
+            vec4s[eIndex].vector[fIndex] = (EGWsingle)(rand() % 20001 - 10000) * 0.01f;
+        for(EGWuint fIndex = 0; fIndex < 16; ++fIndex) {
+            mats[eIndex].matrix[fIndex] = (EGWsingle)(rand() % 2001 - 1000) * 0.002f;
+            mats[count + eIndex].matrix[fIndex] = (EGWsingle)(rand() % 2001 - 1000) * 0.002f;
+        }
+        ws[eIndex] = (EGWsingle)(rand() % 3);
+        
+        if(eIndex % 37 == 0) { // zero vectors, also inside SIMD quads
+            memset((void*)&vec3s[eIndex], 0, sizeof(egwVector3f));
+            memset((void*)&vec4s[eIndex], 0, sizeof(egwVector4f));
+        }
+    }
+    
+    // Normalize3fv: packed, strided, aliased
+    {   egwVector3f expected;
+        
+        egwVecNormalize3fv(vec3s, (egwVector3f*)outs, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecNormalize3f(&vec3s[eIndex], &expected);
+            failures[0] += egwUnitTestSIMDCompare(expected.vector, ((egwVector3f*)outs)[eIndex].vector, 3);
+        }
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex)
+            *egwUnitTestStrided(egwVector3f, work, eIndex, gap) = vec3s[eIndex];
+        egwVecNormalize3fv((egwVector3f*)work, (egwVector3f*)outs, gap, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecNormalize3f(&vec3s[eIndex], &expected);
+            failures[0] += egwUnitTestSIMDCompare(expected.vector, egwUnitTestStrided(egwVector3f, outs, eIndex, gap)->vector, 3);
+        }
+        
+        memcpy((void*)work, (const void*)vec3s, sizeof(egwVector3f) * (size_t)count);
+        egwVecNormalize3fv((egwVector3f*)work, (egwVector3f*)work, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecNormalize3f(&vec3s[eIndex], &expected);
+            failures[0] += egwUnitTestSIMDCompare(expected.vector, ((egwVector3f*)work)[eIndex].vector, 3);
+        }
+    }
+    
+    // DotProd3fv: packed, strided
+    {   EGWsingle expected;
+        
+        egwVecDotProd3fv(vec3s, &vec3s[count], (EGWsingle*)outs, 0, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            expected = egwVecDotProd3f(&vec3s[eIndex], &vec3s[count + eIndex]);
+            failures[1] += egwUnitTestSIMDCompare(&expected, &((EGWsingle*)outs)[eIndex], 1);
+        }
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex)
+            *egwUnitTestStrided(egwVector3f, work, eIndex, gap) = vec3s[eIndex];
+        egwVecDotProd3fv((egwVector3f*)work, &vec3s[count], (EGWsingle*)outs, gap, 0, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            expected = egwVecDotProd3f(&vec3s[eIndex], &vec3s[count + eIndex]);
+            failures[1] += egwUnitTestSIMDCompare(&expected, egwUnitTestStrided(EGWsingle, outs, eIndex, gap), 1);
+        }
+    }
+    
+    // MatMultiply44fv: packed, strided, aliased as lhs and as rhs
+    {   egwMatrix44f expected;
+        
+        egwMatMultiply44fv(mats, &mats[count], (egwMatrix44f*)outs, 0, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwMatMultiply44f(&mats[eIndex], &mats[count + eIndex], &expected);
+            failures[2] += egwUnitTestSIMDCompare(expected.matrix, ((egwMatrix44f*)outs)[eIndex].matrix, 16);
+        }
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex)
+            *egwUnitTestStrided(egwMatrix44f, work, eIndex, gap) = mats[count + eIndex];
+        egwMatMultiply44fv(mats, (egwMatrix44f*)work, (egwMatrix44f*)outs, 0, gap, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwMatMultiply44f(&mats[eIndex], &mats[count + eIndex], &expected);
+            failures[2] += egwUnitTestSIMDCompare(expected.matrix, egwUnitTestStrided(egwMatrix44f, outs, eIndex, gap)->matrix, 16);
+        }
+        
+        for(EGWuint alias = 0; alias < 2; ++alias) {
+            memcpy((void*)work, (const void*)&mats[alias ? count : 0], sizeof(egwMatrix44f) * (size_t)count);
+            if(alias) egwMatMultiply44fv(mats, (egwMatrix44f*)work, (egwMatrix44f*)work, 0, 0, 0, count);
+            else egwMatMultiply44fv((egwMatrix44f*)work, &mats[count], (egwMatrix44f*)work, 0, 0, 0, count);
+            for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+                egwMatMultiply44f(&mats[eIndex], &mats[count + eIndex], &expected);
+                failures[2] += egwUnitTestSIMDCompare(expected.matrix, ((egwMatrix44f*)work)[eIndex].matrix, 16);
+            }
+        }
+    }
+    
+    // Transform443fv: packed, strided, aliased
+    {   egwVector3f expected;
+        
+        egwVecTransform443fv(mats, vec3s, ws, (egwVector3f*)outs, 0, 0, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecTransform443f(&mats[eIndex], &vec3s[eIndex], ws[eIndex], &expected);
+            failures[3] += egwUnitTestSIMDCompare(expected.vector, ((egwVector3f*)outs)[eIndex].vector, 3);
+        }
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex)
+            *egwUnitTestStrided(egwVector3f, work, eIndex, gap) = vec3s[eIndex];
+        egwVecTransform443fv(mats, (egwVector3f*)work, ws, (egwVector3f*)outs, 0, gap, 0, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecTransform443f(&mats[eIndex], &vec3s[eIndex], ws[eIndex], &expected);
+            failures[3] += egwUnitTestSIMDCompare(expected.vector, egwUnitTestStrided(egwVector3f, outs, eIndex, gap)->vector, 3);
+        }
+        
+        memcpy((void*)work, (const void*)vec3s, sizeof(egwVector3f) * (size_t)count);
+        egwVecTransform443fv(mats, (egwVector3f*)work, ws, (egwVector3f*)work, 0, 0, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecTransform443f(&mats[eIndex], &vec3s[eIndex], ws[eIndex], &expected);
+            failures[3] += egwUnitTestSIMDCompare(expected.vector, ((egwVector3f*)work)[eIndex].vector, 3);
+        }
+    }
+    
+    // Transform444fv: packed, strided, aliased
+    {   egwVector4f expected;
+        
+        egwVecTransform444fv(mats, vec4s, (egwVector4f*)outs, 0, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecTransform444f(&mats[eIndex], &vec4s[eIndex], &expected);
+            failures[4] += egwUnitTestSIMDCompare(expected.vector, ((egwVector4f*)outs)[eIndex].vector, 4);
+        }
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex)
+            *egwUnitTestStrided(egwVector4f, work, eIndex, gap) = vec4s[eIndex];
+        egwVecTransform444fv(mats, (egwVector4f*)work, (egwVector4f*)outs, 0, gap, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecTransform444f(&mats[eIndex], &vec4s[eIndex], &expected);
+            failures[4] += egwUnitTestSIMDCompare(expected.vector, egwUnitTestStrided(egwVector4f, outs, eIndex, gap)->vector, 4);
+        }
+        
+        memcpy((void*)work, (const void*)vec4s, sizeof(egwVector4f) * (size_t)count);
+        egwVecTransform444fv(mats, (egwVector4f*)work, (egwVector4f*)work, 0, 0, 0, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            egwVecTransform444f(&mats[eIndex], &vec4s[eIndex], &expected);
+            failures[4] += egwUnitTestSIMDCompare(expected.vector, ((egwVector4f*)work)[eIndex].vector, 4);
+        }
+    }
+    
+    {   const char* names[5] = { "Normalize3fv", "DotProd3fv", "MatMultiply44fv", "Transform443fv", "Transform444fv" };
+        for(EGWuint kIndex = 0; kIndex < 5; ++kIndex)
+            if(failures[kIndex]) printf("SIMD math: %s %d mismatches\r\n", names[kIndex], (int)failures[kIndex]);
+    }
+    printf("SIMD math (%s): %s\r\n", (EGW_SIMD_IDENT == EGW_SIMD_SSE_ID ? "SSE" : (EGW_SIMD_IDENT == EGW_SIMD_NEON_ID ? "NEON" : "scalar")),
+           (failures[0] || failures[1] || failures[2] || failures[3] || failures[4] ? "FAIL" : "PASS"));
+    
+    free((void*)outs);
+    free((void*)work);
+    free((void*)ws);
+    free((void*)mats);
+    free((void*)vec4s);
+    free((void*)vec3s);
+}
+
+void egwUnitTestMathKernels(EGWuint count) {
+    // Checks the batch sin/cos, inverse sqrt and atan2 kernels against double libm (documented error bounds), packed and strided, plus edge cases
+    EGWsingle* ins = (EGWsingle*)malloc(sizeof(EGWsingle) * 4 * (size_t)count); // two operand arrays, room for a one float gap stride
+    EGWsingle* outs = (EGWsingle*)malloc(sizeof(EGWsingle) * 4 * (size_t)count);
+    double sinErr = 0.0, cosErr = 0.0, isqErr = 0.0, atnErr = 0.0;
+    EGWuint failures = 0;
+    
+    for(EGWint strided = 0; strided < 2; ++strided) {
+        EGWintptr gap = (strided ? (EGWintptr)sizeof(EGWsingle) : 0);
+        EGWuint step = (strided ? 2 : 1);
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex)
+            ins[eIndex * step] = ((EGWsingle)rand() / (EGWsingle)RAND_MAX - 0.5f) * (eIndex & 1 ? 16384.0f : 8.0f);
+        egwSinCosfv(ins, outs, &outs[2 * count], gap, gap, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            double angle = (double)ins[eIndex * step];
+            sinErr = egwMax2d(sinErr, fabs((double)outs[eIndex * step] - sin(angle)));
+            cosErr = egwMax2d(cosErr, fabs((double)outs[2 * count + eIndex * step] - cos(angle)));
+        }
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex)
+            ins[eIndex * step] = (EGWsingle)pow(10.0, ((double)rand() / (double)RAND_MAX) * 12.0 - 6.0);
+        egwInvSqrtfv(ins, outs, gap, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            double expected = 1.0 / sqrt((double)ins[eIndex * step]);
+            isqErr = egwMax2d(isqErr, fabs((double)outs[eIndex * step] - expected) / expected);
+        }
+        
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            ins[eIndex * step] = (eIndex % 97 == 0 ? 0.0f : (EGWsingle)(rand() % 20001 - 10000) * 0.01f);
+            ins[2 * count + eIndex * step] = (eIndex % 89 == 0 ? 0.0f : (EGWsingle)(rand() % 20001 - 10000) * 0.01f);
+        }
+        egwArcTan2fv(ins, &ins[2 * count], outs, gap, gap, gap, count);
+        for(EGWuint eIndex = 0; eIndex < count; ++eIndex) {
+            double nmr = (double)ins[eIndex * step], dnm = (double)ins[2 * count + eIndex * step];
+            atnErr = egwMax2d(atnErr, fabs((double)outs[eIndex * step] - (nmr == 0.0 && dnm == 0.0 ? 0.0 : atan2(nmr, dnm))));
+        }
+    }
+    
+    if(sinErr > 1.0e-7 || cosErr > 1.0e-7 || isqErr > 3.0e-7 || atnErr > 3.0e-7) ++failures;
+    
+    {   EGWsingle vals[8] = { 0.0f, -0.0f, (EGWsingle)EGW_MATH_PI, (EGWsingle)EGW_MATH_PI * -0.25f, 1.0f, 0.0f, 0.0f, -1.0f };
+        EGWsingle res[8];
+        
+        egwSinCosfv(vals, res, NULL, 0, 0, 0, 5); // NULL cosine output allowed
+        if(res[0] != 0.0f || fabsf(res[2]) > 1.0e-7f || fabsf(res[3] + 0.70710678f) > 1.0e-7f) ++failures;
+        
+        egwInvSqrtfv(vals, res, 0, 0, 1);
+        if(!(res[0] > 3.0e38f)) ++failures; // +inf
+        
+        egwArcTan2fv(&vals[5], &vals[6], res, 0, 0, 0, 2); // 0/0 and 0/-1
+        if(res[0] != 0.0f || fabsf(res[1] - (EGWsingle)EGW_MATH_PI) > 3.0e-7f) ++failures;
+    }
+    
+    printf("Math kernels: max err sin %.2g, cos %.2g, invsqrt %.2g (rel), atan2 %.2g\r\n", sinErr, cosErr, isqErr, atnErr);
+    printf("Math kernels: %s\r\n", (failures ? "FAIL" : "PASS"));
+    
+    free((void*)outs);
+    free((void*)ins);
+}
+
+void egwUnitTestBenchMathKernels(EGWuint count) {
+    // Times the batch sin/cos, inverse sqrt and atan2 kernels against libm and the scalar fast routines, packed arrays
+    EGWsingle* ins = (EGWsingle*)malloc(sizeof(EGWsingle) * 2 * (size_t)count);
+    EGWsingle* outs = (EGWsingle*)malloc(sizeof(EGWsingle) * 2 * (size_t)count);
+    EGWuint rounds = 20;
+    double start, elapsed[3];
+    
+    for(EGWuint eIndex = 0; eIndex < count * 2; ++eIndex)
+        ins[eIndex] = ((EGWsingle)rand() / (EGWsingle)RAND_MAX - 0.5f) * 16.0f;
+    
+    start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) egwSinCosfv(ins, outs, &outs[count], 0, 0, 0, count);
+    elapsed[0] = egwUnitTestTime() - start; start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) for(EGWuint eIndex = 0; eIndex < count; ++eIndex) { outs[eIndex] = sinf(ins[eIndex]); outs[count + eIndex] = cosf(ins[eIndex]); }
+    elapsed[1] = egwUnitTestTime() - start; start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) for(EGWuint eIndex = 0; eIndex < count; ++eIndex) { outs[eIndex] = egwFastSinf(ins[eIndex]); outs[count + eIndex] = egwFastCosf(ins[eIndex]); }
+    elapsed[2] = egwUnitTestTime() - start;
+    printf("Math kernels (sin/cos): egwSinCosfv %.1f, sinf+cosf %.1f, egwFastSinf+egwFastCosf %.1f ns per element\r\n",
+           elapsed[0] * 1.0e9 / (double)(count * rounds), elapsed[1] * 1.0e9 / (double)(count * rounds), elapsed[2] * 1.0e9 / (double)(count * rounds));
+    
+    for(EGWuint eIndex = 0; eIndex < count * 2; ++eIndex)
+        ins[eIndex] = fabsf(ins[eIndex]) + 0.001f;
+    
+    start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) egwInvSqrtfv(ins, outs, 0, 0, count);
+    elapsed[0] = egwUnitTestTime() - start; start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) for(EGWuint eIndex = 0; eIndex < count; ++eIndex) outs[eIndex] = egwInvSqrtf(ins[eIndex]);
+    elapsed[1] = egwUnitTestTime() - start; start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) for(EGWuint eIndex = 0; eIndex < count; ++eIndex) outs[eIndex] = egwFastInvSqrtf(ins[eIndex]);
+    elapsed[2] = egwUnitTestTime() - start;
+    printf("Math kernels (inverse sqrt): egwInvSqrtfv %.1f, egwInvSqrtf %.1f, egwFastInvSqrtf %.1f ns per element\r\n",
+           elapsed[0] * 1.0e9 / (double)(count * rounds), elapsed[1] * 1.0e9 / (double)(count * rounds), elapsed[2] * 1.0e9 / (double)(count * rounds));
+    
+    for(EGWuint eIndex = 0; eIndex < count * 2; ++eIndex)
+        ins[eIndex] = ((EGWsingle)rand() / (EGWsingle)RAND_MAX - 0.5f) * 200.0f;
+    
+    start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) egwArcTan2fv(ins, &ins[count], outs, 0, 0, 0, count);
+    elapsed[0] = egwUnitTestTime() - start; start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) for(EGWuint eIndex = 0; eIndex < count; ++eIndex) outs[eIndex] = atan2f(ins[eIndex], ins[count + eIndex]);
+    elapsed[1] = egwUnitTestTime() - start; start = egwUnitTestTime();
+    for(EGWuint round = 0; round < rounds; ++round) for(EGWuint eIndex = 0; eIndex < count; ++eIndex) outs[eIndex] = egwFastArcTan2f((EGWtriple)ins[eIndex], (EGWtriple)ins[count + eIndex]);
+    elapsed[2] = egwUnitTestTime() - start;
+    printf("Math kernels (atan2): egwArcTan2fv %.1f, atan2f %.1f, egwFastArcTan2f %.1f ns per element\r\n",
+           elapsed[0] * 1.0e9 / (double)(count * rounds), elapsed[1] * 1.0e9 / (double)(count * rounds), elapsed[2] * 1.0e9 / (double)(count * rounds));
+    
+    free((void*)outs);
+    free((void*)ins);
+}
+
+#if defined(EGW_BUILDMODE_GFX_NULL)
+
+double egwUnitTestNullRender(EGWuint mode, EGWuint meshCount, EGWuint frames, egwGfxCntxNullCounters* counters_out) {
+    // Renders meshCount box meshes through the graphics renderer on a headless null context, returns seconds elapsed over frames (negative upon failure)
+    egwGfxCntxParams gfxCntxParams; memset((void*)&gfxCntxParams, 0, sizeof(egwGfxCntxParams));
+    egwGfxRdrParams gfxRdrParams; memset((void*)&gfxRdrParams, 0, sizeof(egwGfxRdrParams));
+    egwGfxContextNull* context = nil;
+    egwPerspectiveCamera* camera = nil;
+    NSMutableArray* meshes = nil;
+    double start, elapsed = -1.0;
+    
+    gfxCntxParams.fbWidth = 320; gfxCntxParams.fbHeight = 480;
+    gfxRdrParams.mode = mode;
+    
+    if(!(context = [[egwGfxContextNull alloc] initWithParams:(void*)&gfxCntxParams])) return -1.0;
+    
+    if([[egwGfxRenderer alloc] initWithParams:&gfxRdrParams] &&
+       (camera = [[egwPerspectiveCamera alloc] initWithIdentity:@"nullCamera" graspAngle:0.0f fieldOfView:48.0f aspectRatio:(320.0f / 480.0f) frontPlane:0.5f backPlane:100.0f]) &&
+       (meshes = [[NSMutableArray alloc] initWithCapacity:meshCount])) {
+        [egwSIGfxRdr setRenderingCamera:camera forQueue:EGW_GFXRNDRR_RNDRQUEUE_FIRSTPASS];
+        
+        for(EGWuint mIndex = 0; mIndex < meshCount; ++mIndex) {
+            egwMesh* mesh = [[egwMesh alloc] initBoxWithIdentity:@"nullBox" boxWidth:1.0f boxHeight:1.0f boxDepth:1.0f geometryStorage:EGW_GEOMETRY_STRG_NONE lightStack:nil materialStack:nil shaderStack:nil textureStack:nil];
+            if(!mesh) break;
+            [meshes addObject:(id)mesh];
+            [egwSIGfxRdr renderObject:mesh];
+            [mesh release]; mesh = nil;
+        }
+        
+        if([meshes count] == meshCount) {
+            [egwSIGfxRdr performTask]; // first frame inserts & starts all enqueued meshes
+            
+            start = egwUnitTestTime();
+            for(EGWuint fIndex = 0; fIndex < frames; ++fIndex)
+                [egwSIGfxRdr performTask];
+            elapsed = egwUnitTestTime() - start;
+            
+            if(counters_out) memcpy((void*)counters_out, (const void*)[context lastFrameCounters], sizeof(egwGfxCntxNullCounters));
+        }
+    }
+    
+    if(egwSIGfxRdr) {
+        [egwSIGfxRdr shutDownTask];
+        [egwGfxRenderer dealloc];
+    }
+    [meshes release]; meshes = nil;
+    [camera release]; camera = nil;
+    [context shutDownContext];
+    [context release]; context = nil;
+    
+    return elapsed;
+}
+
+void egwUnitTestNullRenderer(void) {
+    // Every mesh in view should account for exactly one draw per frame, in both tree and flat list queue modes
+    EGWuint modes[2] = { EGW_GFXRNDRR_RNDRMODE_DEFERRED | EGW_GFXRNDRR_RNDRMODE_PERSISTENT,
+                         EGW_GFXRNDRR_RNDRMODE_DEFERRED | EGW_GFXRNDRR_RNDRMODE_PERSISTENT | EGW_GFXRNDRR_RNDRMODE_RADIXSORT };
+    egwGfxCntxNullCounters counters;
+    BOOL passed = YES;
+    
+    for(EGWuint mIndex = 0; mIndex < 2; ++mIndex) {
+        memset((void*)&counters, 0, sizeof(egwGfxCntxNullCounters));
+        if(egwUnitTestNullRender(modes[mIndex], 50, 2, &counters) < 0.0) {
+            printf("Null renderer: FAIL (init)\r\n");
+            return;
+        }
+        if(counters.drawCalls != 50) {
+            printf("Null renderer (mode 0x%04x): %d draws for %d meshes\r\n", (int)modes[mIndex], (int)counters.drawCalls, 50);
+            passed = NO;
+        }
+    }
+    
+    printf("Null renderer: %s\r\n", (passed ? "PASS" : "FAIL"));
+}
+
+void egwUnitTestNullRecordedReplay(void) {
+    // Recorded render passes replayed on the renderer thread must issue the same draws & bindings as rendering each mesh directly
+    EGWuint direct = EGW_GFXRNDRR_RNDRMODE_DEFERRED | EGW_GFXRNDRR_RNDRMODE_PERSISTENT;
+    EGWuint meshCount = EGW_GFXRNDRR_RCMDMINITEMS * 2; // enough work items for the pass to be recorded instead of rendered directly
+    egwGfxCntxNullCounters dCounters, rCounters;
+    
+    memset((void*)&dCounters, 0, sizeof(egwGfxCntxNullCounters));
+    memset((void*)&rCounters, 0, sizeof(egwGfxCntxNullCounters));
+    
+    if(egwUnitTestNullRender(direct, meshCount, 2, &dCounters) < 0.0 ||
+       egwUnitTestNullRender(direct | EGW_GFXRNDRR_RNDRMODE_RECORDED, meshCount, 2, &rCounters) < 0.0) {
+        printf("Null recorded replay: FAIL (init)\r\n");
+        return;
+    }
+    
+    if(rCounters.drawCalls != dCounters.drawCalls || rCounters.stateChanges != dCounters.stateChanges || dCounters.drawCalls != meshCount) {
+        printf("Null recorded replay: direct %d draws %d state changes, replayed %d draws %d state changes\r\n",
+               (int)dCounters.drawCalls, (int)dCounters.stateChanges, (int)rCounters.drawCalls, (int)rCounters.stateChanges);
+        printf("Null recorded replay: FAIL\r\n");
+        return;
+    }
+    
+    printf("Null recorded replay: PASS\r\n");
+}
+
+void egwUnitTestBenchNullRenderer(EGWuint meshCount) {
+    // Times the renderer's CPU side per frame on the null context, with the counters of the last frame for reference
+    EGWuint modes[4] = { EGW_GFXRNDRR_RNDRMODE_DEFERRED | EGW_GFXRNDRR_RNDRMODE_PERSISTENT,
+                         EGW_GFXRNDRR_RNDRMODE_DEFERRED | EGW_GFXRNDRR_RNDRMODE_PERSISTENT | EGW_GFXRNDRR_RNDRMODE_RADIXSORT,
+                         EGW_GFXRNDRR_RNDRMODE_DEFERRED | EGW_GFXRNDRR_RNDRMODE_PERSISTENT | EGW_GFXRNDRR_RNDRMODE_RECORDED,
+                         EGW_GFXRNDRR_RNDRMODE_DEFERRED | EGW_GFXRNDRR_RNDRMODE_PERSISTENT | EGW_GFXRNDRR_RNDRMODE_BATCHED };
+    const char* names[4] = { "tree", "radix", "recorded", "batched" };
+    egwGfxCntxNullCounters counters;
+    double elapsed;
+    
+    for(EGWuint mIndex = 0; mIndex < 4; ++mIndex) {
+        memset((void*)&counters, 0, sizeof(egwGfxCntxNullCounters));
+        if((elapsed = egwUnitTestNullRender(modes[mIndex], meshCount, 100, &counters)) < 0.0) {
+            printf("Null renderer (%s): FAIL (init)\r\n", names[mIndex]);
+            continue;
+        }
+        printf("Null renderer (%s, %d meshes): %.3f ms per frame, %d draws, %d state changes\r\n",
+               names[mIndex], (int)meshCount, elapsed * 1000.0 / 100.0, (int)counters.drawCalls, (int)counters.stateChanges);
+    }
+}
+
+#endif
+
 @implementation egwUnitTestA
 
 - (void)applicationDidFinishLaunching:(UIApplication*)application { // on main thread
@@ -197,6 +1046,40 @@ void egwRBTreePrint(egwRedBlackTree* tree_in) {
         printf("\n");
     }*/
     
+    // Testing array intro sort
+    {   egwUnitTestArraySort();
+        
+        if(EGW_UNITTEST_BENCHMARKS) egwUnitTestBenchArraySort(200000);
+    }
+    
+    // Testing hash table
+    {   egwUnitTestHashTable();
+        
+        if(EGW_UNITTEST_BENCHMARKS) {
+            egwUnitTestBenchHashTable(1000);
+            egwUnitTestBenchHashTable(30000);
+            egwUnitTestBenchHashTable(65000);
+        }
+    }
+    
+    // Testing SIMD batch math kernels
+    egwUnitTestSIMDMath();
+    
+    // Testing batch sin/cos, inverse sqrt and atan2 kernels
+    {   egwUnitTestMathKernels(100000);
+        
+        if(EGW_UNITTEST_BENCHMARKS) egwUnitTestBenchMathKernels(4096);
+    }
+    
+    // Testing renderer through the null graphics context
+#if defined(EGW_BUILDMODE_GFX_NULL)
+    {   egwUnitTestNullRenderer();
+        egwUnitTestNullRecordedReplay();
+        
+        if(EGW_UNITTEST_BENCHMARKS) egwUnitTestBenchNullRenderer(500);
+    }
+#endif
+    
     // Testing linked list sort routine
     /*{   egwSinglyLinkedList list; egwSLListInit(&list, NULL, sizeof(int), EGW_LIST_FLG_DFLT);
         int val;
@@ -336,6 +1219,24 @@ void egwRBTreePrint(egwRedBlackTree* tree_in) {
         egwRBTreeFree(&tree);
     }
     
+    // Testing numeric list parsing
+    {   egwUnitTestParseFloats(200000);
+    
+        if(EGW_UNITTEST_BENCHMARKS) egwUnitTestBenchParseFloats(2000000);
+    }
+    
+    // Testing node pool
+    {   egwUnitTestNodePool();
+        
+        if(EGW_UNITTEST_BENCHMARKS) egwUnitTestBenchNodePool();
+    }
+    
+    // Benchmarking particle pool oldest replacement
+    if(EGW_UNITTEST_BENCHMARKS) {
+        egwUnitTestBenchParticleReplace(1000);
+        egwUnitTestBenchParticleReplace(10000);
+    }
+    
     _yaw = egwDegToRad(60); _pitch = egwDegToRad(55); _dist = 3.5f; memset((void*)&_lTest, 0, 2 * sizeof(egwVector3f));
     
     {   [application setIdleTimerDisabled:YES];
@@ -723,6 +1624,7 @@ void egwRBTreePrint(egwRedBlackTree* tree_in) {
         kfMesh.ttIndicies[0] = 0.0;
         kfMesh.ttIndicies[1] = 2.0;
         
+        NSAssert(!egwMeshIsWideIndexed(kfMesh.vCount), @"Face indicies below are written compact.");
         kfMesh.fIndicies[0].face.i1 = 0; kfMesh.fIndicies[0].face.i2 = 1; kfMesh.fIndicies[0].face.i3 = 2;
         kfMesh.fIndicies[1].face.i1 = 0; kfMesh.fIndicies[1].face.i2 = 2; kfMesh.fIndicies[1].face.i3 = 3;
         
@@ -0,0 +1,169 @@
+#!/usr/bin/env python
+
+__author__ = "Johanna Wolf"
+__url__ = ("http://gewizes.sourceforge.net/")
+__version__ = "1.0"
+__email__ = "johanna.a.wolf@gmail.com"
+__doc__ = """\
+Description: Compiles GAMX text asset manifests found from path walk into GAM binary asset manifests (same name, .gam extension).
+Usage: ./gam_conv.py [-fdrh] folder|file.
+    -f: Force conversion (no date checking).
+    -d: Keep decimal payloads in double precision (default single precision).
+    -r: Recursive operation.
+"""
+
+# geWiz GAM rev1 output format (see egwGAMHeader in sys/egwAssetManager.h):
+# 8 string - "EGWGAMR1" header tag, last byte is alpha-numeric revision #
+# 4 long   - Byte order mark 0x01020304
+# 4 long   - Manifest section offset
+# 4 long   - Manifest section length
+# 4 long   - Payload section offset (aligned to 16 bytes)
+# 4 long   - Payload section length
+# 4 long   - Reserved (zero)
+# manifest - GAMX text, with large numeric text nodes replaced by "@gam:<format>:<offset>:<count>" payload references
+# payload  - Raw payload arrays, each aligned to 16 bytes, offsets relative to payload section start
+#            <format> is 'f' (float32), 'd' (float64), or 'i' (int32)
+
+import sys
+import os
+import re
+import struct
+import xml.dom.minidom
+
+endian_out = '<' # See struct.pack format, < little-endian, for iPhone & x86
+
+print_help = 0
+check_date = 1
+keep_double = 0
+recursive = 0
+min_values = 16 # Minimum number of values in a text node before it is moved into the payload
+align_size = 16
+header_tag = b'EGWGAMR1'
+header_size = 32
+convft_list = [r'.gamx']
+ignore_list = [r'.svn', r'.git', r'.xcode', r'.DS_Store']
+split_re = re.compile(r'[\s,]+')
+int_re = re.compile(r'^[+-]?[0-9]+$')
+flt_max = 3.4028234663852886e+38
+
+def in_search_list(loc):
+    for item in convft_list:
+        if loc[-len(item):].lower() == item.lower():
+            return 1
+    return 0
+
+def in_ignore_list(loc):
+    for item in ignore_list:
+        if loc.lower().find(item.lower()) != -1:
+            return 1
+    return 0
+
+def classify_values(text):
+    # Returns (format, values) for a numeric value list, or (None, None) if not numeric/too short (stays as text)
+    tokens = [token for token in split_re.split(text.strip()) if len(token)]
+    if len(tokens) < min_values:
+        return (None, None)
+    if all(int_re.match(token) for token in tokens):
+        values = [int(token) for token in tokens]
+        if all(-2147483648 <= value <= 2147483647 for value in values):
+            return ('i', values)
+        return ('d', [float(value) for value in values])
+    try:
+        values = [float(token) for token in tokens]
+    except ValueError:
+        return (None, None)
+    if keep_double or any(abs(value) > flt_max and abs(value) != float('inf') for value in values):
+        return ('d', values)
+    return ('f', values)
+
+def compile_manifest(filename, filename_mod):
+    doc = xml.dom.minidom.parse(filename)
+    payload = bytearray()
+    counts = {'f': 0, 'd': 0, 'i': 0}
+    def visit(node):
+        for child in node.childNodes:
+            if child.nodeType == child.TEXT_NODE or child.nodeType == child.CDATA_SECTION_NODE:
+                (format, values) = classify_values(child.data)
+                if format:
+                    while len(payload) % align_size:
+                        payload.append(0)
+                    offset = len(payload)
+                    payload.extend(struct.pack("%s%d%s" % (endian_out, len(values), format), *values))
+                    child.data = "@gam:%s:%d:%d" % (format, offset, len(values))
+                    counts[format] += len(values)
+            elif child.nodeType == child.ELEMENT_NODE:
+                visit(child)
+    visit(doc)
+    manifest = doc.toxml(encoding='utf-8')
+    doc.unlink()
+    m_offset = header_size
+    p_offset = m_offset + len(manifest)
+    p_offset += (align_size - (p_offset % align_size)) % align_size
+    fout = open(filename_mod, 'wb')
+    fout.write(header_tag) # revision 1
+    fout.write(struct.pack("%s6L" % (endian_out,), 0x01020304, m_offset, len(manifest), p_offset, len(payload), 0))
+    fout.write(manifest)
+    fout.write(b'\0' * (p_offset - m_offset - len(manifest)))
+    fout.write(bytes(payload))
+    fout.close()
+    print("Info: GAM_Convert: '%s' payload: %d float32, %d float64, %d int32 values (%d bytes)." % (os.path.basename(filename), counts['f'], counts['d'], counts['i'], len(payload)))
+
+def walkpaths(loc):
+    if os.path.exists(loc):
+        if os.path.isdir(loc):
+            contents = os.listdir(loc)
+            for item in contents:
+                if recursive and os.path.isdir(os.path.join(loc, item)):
+                    walkpaths(os.path.join(loc, item))
+                elif os.path.isfile(os.path.join(loc, item)):
+                    walkpaths(os.path.join(loc, item))
+        elif os.path.isfile(loc) and in_search_list(loc) and not in_ignore_list(loc):
+            filename = os.path.realpath(loc)
+            filename_mod = filename[:filename.rfind('.')] + r'.gam'
+            if check_date and os.path.exists(filename) and os.path.exists(filename_mod) and os.path.getmtime(filename_mod) >= os.path.getmtime(filename):
+                print("Info: GAM_Convert: File '%s' is already up to date.\r\n" % (filename_mod,))
+            else:
+                print("Info: GAM_Convert: Beginning conversion of '%s' (%d bytes)." % (filename, os.path.getsize(filename)))
+                try:
+                    compile_manifest(filename, filename_mod)
+                except:
+                    print("Info: GAM_Convert: Failure converting '%s' due to exception: '%s'.\r\n" % (filename, sys.exc_info()))
+                    if os.path.exists(filename_mod): # don't leave a newer, broken manifest around
+                        os.remove(filename_mod)
+                else:
+                    print("Info: GAM_Convert: Successful conversion to '%s' (%d bytes).\r\n" % (filename_mod, os.path.getsize(filename_mod)))
+
+try:
+    paths = []
+    for arg in sys.argv[1:]:
+        if arg[:1] == r'-':
+            for i in range(1, len(arg)):
+                if arg[i].lower() == r'-':
+                    continue
+                elif arg[i].lower() == r'f': # Forced operation (skip date check)
+                    check_date = 0
+                elif arg[i].lower() == r'd': # Keep decimal payloads in double precision
+                    keep_double = 1
+                elif arg[i].lower() == r'r': # Recursively scan URL for supported file types
+                    recursive = 1
+                else:
+                    print_help = 1
+                    if not (arg[i].lower() == r'h' or arg[i].lower() == r'?'): # Print this help screen (skips conversion)
+                        print("Info: GAM_Convert: Command line argument '%s' not supported.\r\n" % (arg[i],))
+                    break
+        elif os.path.exists(arg):
+            paths.append(arg)
+    if not len(paths):
+        print_help = 1
+    if not print_help:
+        for path in paths:
+            walkpaths(path)
+except:
+    print("Info: GAM_Convert: Fatal Error: Unexpected exception: '%s'.\r\n" % (sys.exc_info(),))
+    raise
+if print_help:
+    print("Info: GAM_Convert: Supported command line arguments:")
+    print("    f : Forced operation (skip date check)")
+    print("    d : Keep decimal payloads in double precision (default single precision)")
+    print("    r : Recursively scan URL for supported file types")
+    print("  h/? : Print this help screen (skips conversion)\r\n")